@@ -0,0 +1,32 @@
+# Micro-benchmark for pane method dispatch.
+# Open this file and run it with [Tools] -> [Run as mruby script] (Alt+Ctrl+R).
+#
+# "unbound" calls method_missing explicitly, so every call resolves the name
+# against IFaceTable as all pane calls did before bindings were cached.
+# "bound" calls the method that the first method_missing defined on SciTE::Pane.
+
+ITERATIONS = 100000
+
+def calls_per_second(label)
+  t = Time.now
+  ITERATIONS.times { yield }
+  elapsed = Time.now - t
+  rate = elapsed > 0 ? (ITERATIONS / elapsed).to_i : 0
+  puts "#{label}: #{rate} calls/s"
+  rate
+end
+
+Editor.text_length
+Editor.current_pos
+Editor.style_at
+
+puts "Pane dispatch (#{ITERATIONS} iterations)"
+before = calls_per_second("function  unbound") { Editor.method_missing(:text_length) }
+after  = calls_per_second("function  bound  ") { Editor.text_length }
+puts "  speedup: #{after.to_f / before}" if before > 0
+before = calls_per_second("property  unbound") { Editor.method_missing(:current_pos) }
+after  = calls_per_second("property  bound  ") { Editor.current_pos }
+puts "  speedup: #{after.to_f / before}" if before > 0
+before = calls_per_second("indexed   unbound") { Editor.method_missing(:style_at)[0] }
+after  = calls_per_second("indexed   bound  ") { Editor.style_at[0] }
+puts "  speedup: #{after.to_f / before}" if before > 0
@@ -0,0 +1,98 @@
+# Script lexer throughput benchmark.
+# Open a large Ruby-like file whose lexer is a script lexer, e.g. add
+#   lexer.*.rbbench=script_bench
+# to SciTEUser.properties and open a file with the .rbbench extension,
+# then run this file with [Tools] -> [Run as mruby script] (Alt+Ctrl+R).
+#
+# The same document is styled three times: by a per-character script lexer,
+# by a script lexer using the bulk StylingContext primitives and by the
+# native LexRuby.
+
+S_DEFAULT = 0
+S_COMMENT = 2
+S_NUMBER = 4
+S_WORD = 5
+S_STRING = 6
+S_IDENTIFIER = 11
+
+WORD_CHARS = "a-zA-Z0-9_"
+KEYWORDS = SciTE::WordList.new("begin break class def do else elsif end ensure " +
+  "false for if in module next nil return self super then true unless until when while yield")
+
+def style_per_character(styler)
+  styler.start_styling(styler.start_pos, styler.length_doc, styler.init_style)
+  while styler.more
+    if styler.state == S_IDENTIFIER
+      if styler.current !~ /\w/
+        styler.change_state(S_WORD) if KEYWORDS.include?(styler.token)
+        styler.set_state(S_DEFAULT)
+      end
+    elsif styler.state == S_COMMENT
+      styler.set_state(S_DEFAULT) if styler.at_line_start
+    elsif styler.state == S_STRING
+      styler.forward_set_state(S_DEFAULT) if styler.current == "\""
+    end
+    if styler.state == S_DEFAULT
+      if styler.current == "#"
+        styler.set_state(S_COMMENT)
+      elsif styler.current == "\""
+        styler.set_state(S_STRING)
+      elsif styler.current =~ /[A-Za-z_]/
+        styler.set_state(S_IDENTIFIER)
+      end
+    end
+    styler.forward
+  end
+  styler.end_styling
+end
+
+def style_bulk(styler)
+  styler.start_styling(styler.start_pos, styler.length_doc, styler.init_style)
+  styler.set_state(S_DEFAULT)
+  while styler.more
+    styler.forward_until("#\"a-zA-Z_")
+    break unless styler.more
+    case styler.current
+    when "#"
+      styler.set_state(S_COMMENT)
+      styler.forward_until("\r\n")
+      styler.set_state(S_DEFAULT)
+    when "\""
+      len = styler.forward_to_regex("\"[^\"]*\"")
+      styler.colour_run(len, S_STRING) if len
+    else
+      styler.set_state(S_DEFAULT)
+      word, keyword = styler.scan_word(WORD_CHARS, KEYWORDS)
+      styler.change_state(keyword ? S_WORD : S_IDENTIFIER)
+      styler.set_state(S_DEFAULT)
+    end
+  end
+  styler.end_styling
+end
+
+$bench_style = nil
+
+def on_style(styler)
+  return false unless $bench_style
+  send $bench_style, styler
+  true
+end
+
+def throughput(label)
+  Editor.clear_document_style
+  t = Time.now
+  Editor.colourise(0, -1)
+  elapsed = Time.now - t
+  mb = Editor.length / 1000000.0
+  puts "#{label}: #{elapsed} s, #{elapsed > 0 ? mb / elapsed : 0} MB/s"
+end
+
+puts "Styling #{Editor.length} bytes"
+$bench_style = :style_per_character
+throughput "script, per character"
+$bench_style = :style_bulk
+throughput "script, bulk        "
+$bench_style = nil
+Editor.lexer_language = "ruby"
+throughput "native LexRuby      "
+Editor.lexer = SCLEX_CONTAINER
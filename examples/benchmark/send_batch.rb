@@ -0,0 +1,32 @@
+# Benchmark for sending many Scintilla messages from mruby.
+# Open a file of some size, then run this with [Tools] -> [Run as mruby script] (Alt+Ctrl+R).
+#
+# Every 8 byte range of the document is filled with an indicator, first with one
+# send_editor per range and then with one send_editor_batch for all of them.
+
+INDICATOR = 8
+RANGE = 8
+
+def fill_rate(label, count)
+  t = Time.now
+  yield
+  elapsed = Time.now - t
+  rate = elapsed > 0 ? (count / elapsed).to_i : 0
+  puts "#{label}: #{rate} ranges/s"
+  rate
+end
+
+length = Editor.length
+starts = (0...length).step(RANGE).to_a
+batch = [[SCI_SETINDICATORCURRENT, INDICATOR]]
+starts.each { |pos| batch << [SCI_INDICATORFILLRANGE, pos, RANGE / 2] }
+
+puts "Indicator fill (#{starts.length} ranges)"
+SciTE.send_editor(SCI_SETINDICATORCURRENT, INDICATOR)
+before = fill_rate("send_editor      ", starts.length) do
+  starts.each { |pos| SciTE.send_editor(SCI_INDICATORFILLRANGE, pos, RANGE / 2) }
+end
+SciTE.send_editor(SCI_INDICATORCLEARRANGE, 0, length)
+after = fill_rate("send_editor_batch", starts.length) { SciTE.send_editor_batch(batch) }
+SciTE.send_editor(SCI_INDICATORCLEARRANGE, 0, length)
+puts "  speedup: #{after.to_f / before}" if before > 0
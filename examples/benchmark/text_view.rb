@@ -0,0 +1,34 @@
+# Benchmark for reading the document from mruby.
+# Open a large file, then run this with [Tools] -> [Run as mruby script] (Alt+Ctrl+R).
+#
+# "copy" reads the whole document into a String with textrange and searches it.
+# "view" searches a SciTE::TextView, which reads the document in place.
+
+NEEDLE = "\n}"
+REPEAT = 10
+
+def scan_rate(label, length)
+  t = Time.now
+  count = 0
+  REPEAT.times { count = yield }
+  elapsed = Time.now - t
+  rate = elapsed > 0 ? (length * REPEAT / elapsed / 1048576.0) : 0
+  puts "#{label}: #{rate.round(1)} MB/s (#{count} matches)"
+  rate
+end
+
+def count_matches(text)
+  count = 0
+  pos = text.index(NEEDLE)
+  while pos
+    count += 1
+    pos = text.index(NEEDLE, pos + NEEDLE.length)
+  end
+  count
+end
+
+length = Editor.length
+puts "Document scan (#{length} bytes, #{REPEAT} passes)"
+before = scan_rate("copy") { count_matches(Editor.textrange(0, length)) }
+after  = scan_rate("view") { count_matches(Editor.text_view) }
+puts "  speedup: #{after / before}" if before > 0
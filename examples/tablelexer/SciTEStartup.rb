@@ -0,0 +1,18 @@
+#  -*- coding: utf-8 -*-
+
+# The lexer of examples/scriptlexer1 described as a table. The table is built
+# once and then runs natively for every styling request instead of onStyle.
+S_DEFAULT = 0
+S_IDENTIFIER = 1
+S_KEYWORD = 2
+S_UNICODECOMMENT = 3
+
+zog = SciTE::TableLexer.new
+zog.enter(S_DEFAULT, :literal, "«", S_UNICODECOMMENT)
+zog.exit(S_UNICODECOMMENT, :literal, "»", S_DEFAULT)
+zog.token(S_DEFAULT, :chars, "a-zA-Z", S_IDENTIFIER)
+zog.keywords(S_IDENTIFIER, "if end", S_KEYWORD)
+zog.fold(S_KEYWORD, "if", 1)
+zog.fold(S_KEYWORD, "end", -1)
+
+SciTE.register_lexer("script_zog", zog)
@@ -22,6 +22,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <list>
 
 #include "ILexer.h"
 
@@ -30,6 +31,7 @@
 #include "PropSetSimple.h"
 #endif
 
+#include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
 #include "RunStyles.h"
@@ -15,6 +15,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <list>
 #include <algorithm>
 
 #include <glib.h>
@@ -38,6 +39,7 @@
 #ifdef SCI_LEXER
 #include "LexerModule.h"
 #endif
+#include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
 #include "RunStyles.h"
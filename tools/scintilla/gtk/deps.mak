@@ -4,7 +4,7 @@ PlatGTK.o: PlatGTK.cxx \
 ScintillaGTK.o: ScintillaGTK.cxx \
  ../include/ILexer.h ../include/Scintilla.h ../include/ScintillaWidget.h \
  ../include/SciLexer.h ../lexlib/StringCopy.h ../lexlib/LexerModule.h \
- ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
+ ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
  ../src/ContractionState.h ../src/CellBuffer.h ../src/CallTip.h \
  ../src/KeyMap.h ../src/Indicator.h ../src/XPM.h ../src/LineMarker.h \
  ../src/Style.h ../src/ViewStyle.h ../src/CharClassify.h \
@@ -16,6 +16,13 @@ ScintillaGTK.o: ScintillaGTK.cxx \
  Converter.h
 AutoComplete.o: ../src/AutoComplete.cxx ../include/Platform.h \
  ../include/Scintilla.h ../lexlib/CharacterSet.h ../src/AutoComplete.h
+BackgroundWrap.o: ../src/BackgroundWrap.cxx ../include/Platform.h \
+ ../include/ILexer.h ../include/Scintilla.h ../src/Position.h ../src/SplitVector.h \
+ ../src/Partitioning.h ../src/RunStyles.h ../src/CellBuffer.h \
+ ../src/KeyMap.h ../src/Indicator.h ../src/XPM.h ../src/LineMarker.h \
+ ../src/Style.h ../src/ViewStyle.h ../src/CharClassify.h \
+ ../src/Decoration.h ../src/CaseFolder.h ../src/Document.h \
+ ../src/UniConversion.h ../src/BackgroundWrap.h
 CallTip.o: ../src/CallTip.cxx ../include/Platform.h \
  ../include/Scintilla.h ../lexlib/StringCopy.h ../src/CallTip.h
 CaseConvert.o: ../src/CaseConvert.cxx ../lexlib/StringCopy.h \
@@ -26,31 +33,34 @@ Catalogue.o: ../src/Catalogue.cxx ../include/ILexer.h \
  ../include/Scintilla.h ../include/SciLexer.h ../lexlib/LexerModule.h \
  ../src/Catalogue.h
 CellBuffer.o: ../src/CellBuffer.cxx ../include/Platform.h \
- ../include/Scintilla.h ../src/SplitVector.h ../src/Partitioning.h \
- ../src/CellBuffer.h ../src/UniConversion.h
+ ../include/ILexer.h ../include/Scintilla.h ../src/Position.h ../src/SplitVector.h \
+ ../src/Partitioning.h ../src/RunStyles.h ../src/CellBuffer.h ../src/UniConversion.h
 CharClassify.o: ../src/CharClassify.cxx ../src/CharClassify.h
 ContractionState.o: ../src/ContractionState.cxx ../include/Platform.h \
- ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
+ ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
  ../src/ContractionState.h
 Decoration.o: ../src/Decoration.cxx ../include/Platform.h \
- ../include/Scintilla.h ../src/SplitVector.h ../src/Partitioning.h \
+ ../include/Scintilla.h ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h \
  ../src/RunStyles.h ../src/Decoration.h
+DFASearch.o: ../src/DFASearch.cxx ../src/CharClassify.h ../src/RESearch.h \
+ ../src/DFASearch.h
 Document.o: ../src/Document.cxx ../include/Platform.h ../include/ILexer.h \
- ../include/Scintilla.h ../lexlib/CharacterSet.h ../src/SplitVector.h \
+ ../include/Scintilla.h ../lexlib/CharacterSet.h ../src/Position.h ../src/SplitVector.h \
  ../src/Partitioning.h ../src/RunStyles.h ../src/CellBuffer.h \
  ../src/PerLine.h ../src/CharClassify.h ../src/Decoration.h \
  ../src/CaseFolder.h ../src/Document.h ../src/RESearch.h \
- ../src/UniConversion.h
+ ../src/DFASearch.h ../src/LiteralSearch.h ../src/UniConversion.h \
+ ../src/SegmentCache.h
 EditModel.o: ../src/EditModel.cxx ../include/Platform.h \
  ../include/ILexer.h ../include/Scintilla.h ../lexlib/StringCopy.h \
- ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
+ ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
  ../src/ContractionState.h ../src/CellBuffer.h ../src/KeyMap.h \
  ../src/Indicator.h ../src/XPM.h ../src/LineMarker.h ../src/Style.h \
  ../src/ViewStyle.h ../src/CharClassify.h ../src/Decoration.h \
  ../src/CaseFolder.h ../src/Document.h ../src/UniConversion.h \
  ../src/Selection.h ../src/PositionCache.h ../src/EditModel.h
 EditView.o: ../src/EditView.cxx ../include/Platform.h ../include/ILexer.h \
- ../include/Scintilla.h ../lexlib/StringCopy.h ../src/SplitVector.h \
+ ../include/Scintilla.h ../lexlib/StringCopy.h ../src/Position.h ../src/SplitVector.h \
  ../src/Partitioning.h ../src/RunStyles.h ../src/ContractionState.h \
  ../src/CellBuffer.h ../src/KeyMap.h ../src/Indicator.h ../src/XPM.h \
  ../src/LineMarker.h ../src/Style.h ../src/ViewStyle.h \
@@ -59,14 +69,14 @@ EditView.o: ../src/EditView.cxx ../include/Platform.h ../include/ILexer.h \
  ../src/PositionCache.h ../src/EditModel.h ../src/MarginView.h \
  ../src/EditView.h
 Editor.o: ../src/Editor.cxx ../include/Platform.h ../include/ILexer.h \
- ../include/Scintilla.h ../lexlib/StringCopy.h ../src/SplitVector.h \
+ ../include/Scintilla.h ../lexlib/StringCopy.h ../src/Position.h ../src/SplitVector.h \
  ../src/Partitioning.h ../src/RunStyles.h ../src/ContractionState.h \
  ../src/CellBuffer.h ../src/KeyMap.h ../src/Indicator.h ../src/XPM.h \
  ../src/LineMarker.h ../src/Style.h ../src/ViewStyle.h \
  ../src/CharClassify.h ../src/Decoration.h ../src/CaseFolder.h \
  ../src/Document.h ../src/UniConversion.h ../src/Selection.h \
- ../src/PositionCache.h ../src/EditModel.h ../src/MarginView.h \
- ../src/EditView.h ../src/Editor.h
+ ../src/PositionCache.h ../src/SegmentCache.h ../src/EditModel.h \
+ ../src/MarginView.h ../src/EditView.h ../src/BackgroundWrap.h ../src/Editor.h
 ExternalLexer.o: ../src/ExternalLexer.cxx ../include/Platform.h \
  ../include/ILexer.h ../include/Scintilla.h ../include/SciLexer.h \
  ../lexlib/LexerModule.h ../src/Catalogue.h ../src/ExternalLexer.h
@@ -79,7 +89,7 @@ LineMarker.o: ../src/LineMarker.cxx ../include/Platform.h \
  ../src/LineMarker.h
 MarginView.o: ../src/MarginView.cxx ../include/Platform.h \
  ../include/ILexer.h ../include/Scintilla.h ../lexlib/StringCopy.h \
- ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
+ ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
  ../src/ContractionState.h ../src/CellBuffer.h ../src/KeyMap.h \
  ../src/Indicator.h ../src/XPM.h ../src/LineMarker.h ../src/Style.h \
  ../src/ViewStyle.h ../src/CharClassify.h ../src/Decoration.h \
@@ -87,24 +97,24 @@ MarginView.o: ../src/MarginView.cxx ../include/Platform.h \
  ../src/Selection.h ../src/PositionCache.h ../src/EditModel.h \
  ../src/MarginView.h ../src/EditView.h
 PerLine.o: ../src/PerLine.cxx ../include/Platform.h \
- ../include/Scintilla.h ../src/SplitVector.h ../src/Partitioning.h \
+ ../include/Scintilla.h ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h \
  ../src/CellBuffer.h ../src/PerLine.h
 PositionCache.o: ../src/PositionCache.cxx ../include/Platform.h \
- ../include/ILexer.h ../include/Scintilla.h ../src/SplitVector.h \
+ ../include/ILexer.h ../include/Scintilla.h ../src/Position.h ../src/SplitVector.h \
  ../src/Partitioning.h ../src/RunStyles.h ../src/ContractionState.h \
  ../src/CellBuffer.h ../src/KeyMap.h ../src/Indicator.h ../src/XPM.h \
  ../src/LineMarker.h ../src/Style.h ../src/ViewStyle.h \
  ../src/CharClassify.h ../src/Decoration.h ../src/CaseFolder.h \
  ../src/Document.h ../src/UniConversion.h ../src/Selection.h \
- ../src/PositionCache.h
+ ../src/PositionCache.h ../src/SegmentCache.h
 RESearch.o: ../src/RESearch.cxx ../src/CharClassify.h ../src/RESearch.h
 RunStyles.o: ../src/RunStyles.cxx ../include/Platform.h \
- ../include/Scintilla.h ../src/SplitVector.h ../src/Partitioning.h \
+ ../include/Scintilla.h ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h \
  ../src/RunStyles.h
 ScintillaBase.o: ../src/ScintillaBase.cxx ../include/Platform.h \
  ../include/ILexer.h ../include/Scintilla.h ../include/SciLexer.h \
  ../lexlib/PropSetSimple.h ../lexlib/LexerModule.h ../src/Catalogue.h \
- ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
+ ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
  ../src/ContractionState.h ../src/CellBuffer.h ../src/CallTip.h \
  ../src/KeyMap.h ../src/Indicator.h ../src/XPM.h ../src/LineMarker.h \
  ../src/Style.h ../src/ViewStyle.h ../src/CharClassify.h \
@@ -112,13 +122,15 @@ ScintillaBase.o: ../src/ScintillaBase.cxx ../include/Platform.h \
  ../src/Selection.h ../src/PositionCache.h ../src/EditModel.h \
  ../src/MarginView.h ../src/EditView.h ../src/Editor.h \
  ../src/AutoComplete.h ../src/ScintillaBase.h
+SegmentCache.o: ../src/SegmentCache.cxx ../include/Platform.h \
+ ../src/SegmentCache.h
 Selection.o: ../src/Selection.cxx ../include/Platform.h \
  ../include/Scintilla.h ../src/Selection.h
 Style.o: ../src/Style.cxx ../include/Platform.h ../include/Scintilla.h \
  ../src/Style.h
 UniConversion.o: ../src/UniConversion.cxx ../src/UniConversion.h
 ViewStyle.o: ../src/ViewStyle.cxx ../include/Platform.h \
- ../include/Scintilla.h ../src/SplitVector.h ../src/Partitioning.h \
+ ../include/Scintilla.h ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h \
  ../src/RunStyles.h ../src/Indicator.h ../src/XPM.h ../src/LineMarker.h \
  ../src/Style.h ../src/ViewStyle.h
 XPM.o: ../src/XPM.cxx ../include/Platform.h ../src/XPM.h
@@ -91,6 +91,14 @@ public:
 	virtual void * SCI_METHOD ConvertToDocument() = 0;
 };
 
+class IMappedText {
+public:
+	// Called when the document no longer reads the text
+	virtual void SCI_METHOD Release() = 0;
+	virtual const char * SCI_METHOD Text() = 0;
+	virtual int SCI_METHOD Length() = 0;
+};
+
 #ifdef SCI_NAMESPACE
 }
 #endif
@@ -375,6 +375,7 @@ typedef sptr_t (*SciFnDirect)(sptr_t ptr, unsigned int iMessage, uptr_t wParam,
 #define SCFIND_REGEXP 0x00200000
 #define SCFIND_POSIX 0x00400000
 #define SCFIND_CXX11REGEX 0x00800000
+#define SCFIND_DFAREGEX 0x01000000
 #define SCI_FINDTEXT 2150
 #define SCI_FORMATRANGE 2151
 #define SCI_GETFIRSTVISIBLELINE 2152
@@ -402,6 +403,8 @@ typedef sptr_t (*SciFnDirect)(sptr_t ptr, unsigned int iMessage, uptr_t wParam,
 #define SCI_CANPASTE 2173
 #define SCI_CANUNDO 2174
 #define SCI_EMPTYUNDOBUFFER 2175
+#define SCI_SETUNDOMEMORYLIMIT 2698
+#define SCI_GETUNDOMEMORYLIMIT 2699
 #define SCI_UNDO 2176
 #define SCI_CUT 2177
 #define SCI_COPY 2178
@@ -508,12 +511,24 @@ typedef sptr_t (*SciFnDirect)(sptr_t ptr, unsigned int iMessage, uptr_t wParam,
 #define SC_WRAPINDENT_INDENT 2
 #define SCI_SETWRAPINDENTMODE 2472
 #define SCI_GETWRAPINDENTMODE 2473
+#define SCI_SETWRAPTHREADS 2680
+#define SCI_GETWRAPTHREADS 2681
+#define SC_IDLESTYLING_NONE 0
+#define SC_IDLESTYLING_TOVISIBLE 1
+#define SC_IDLESTYLING_AFTERVISIBLE 2
+#define SC_IDLESTYLING_ALL 3
+#define SCI_SETIDLESTYLING 2692
+#define SCI_GETIDLESTYLING 2693
+#define SCI_SETIDLESTYLINGBUDGET 2694
+#define SCI_GETIDLESTYLINGBUDGET 2695
 #define SC_CACHE_NONE 0
 #define SC_CACHE_CARET 1
 #define SC_CACHE_PAGE 2
 #define SC_CACHE_DOCUMENT 3
 #define SCI_SETLAYOUTCACHE 2272
 #define SCI_GETLAYOUTCACHE 2273
+#define SCI_SETLAYOUTCACHEPAGES 2703
+#define SCI_GETLAYOUTCACHEPAGES 2704
 #define SCI_SETSCROLLWIDTH 2274
 #define SCI_GETSCROLLWIDTH 2275
 #define SCI_SETSCROLLWIDTHTRACKING 2516
@@ -779,6 +794,15 @@ typedef sptr_t (*SciFnDirect)(sptr_t ptr, unsigned int iMessage, uptr_t wParam,
 #define SCI_INDICATOREND 2509
 #define SCI_SETPOSITIONCACHE 2514
 #define SCI_GETPOSITIONCACHE 2515
+#define SCI_SETSEGMENTCACHEBUDGET 2700
+#define SCI_GETSEGMENTCACHEBUDGET 2701
+#define SC_POSITIONCACHE_HITS 0
+#define SC_POSITIONCACHE_MISSES 1
+#define SC_POSITIONCACHE_SEGMENTHITS 2
+#define SC_POSITIONCACHE_SEGMENTMISSES 3
+#define SC_POSITIONCACHE_SEGMENTBYTES 4
+#define SC_POSITIONCACHE_SEGMENTENTRIES 5
+#define SCI_GETPOSITIONCACHESTATISTIC 2702
 #define SCI_COPYALLOWLINE 2519
 #define SCI_GETCHARACTERPOINTER 2520
 #define SCI_GETRANGEPOINTER 2643
@@ -903,6 +927,8 @@ typedef sptr_t (*SciFnDirect)(sptr_t ptr, unsigned int iMessage, uptr_t wParam,
 #define SCI_SETTECHNOLOGY 2630
 #define SCI_GETTECHNOLOGY 2631
 #define SCI_CREATELOADER 2632
+#define SCI_CREATEMAPPEDDOCUMENT 2696
+#define SCI_GETINDEXINGLINES 2697
 #define SCI_FINDINDICATORSHOW 2640
 #define SCI_FINDINDICATORFLASH 2641
 #define SCI_FINDINDICATORHIDE 2642
@@ -973,7 +999,8 @@ typedef sptr_t (*SciFnDirect)(sptr_t ptr, unsigned int iMessage, uptr_t wParam,
 #define SC_MOD_LEXERSTATE 0x80000
 #define SC_MOD_INSERTCHECK 0x100000
 #define SC_MOD_CHANGETABSTOPS 0x200000
-#define SC_MODEVENTMASKALL 0x3FFFFF
+#define SC_MOD_LINESINDEXED 0x400000
+#define SC_MODEVENTMASKALL 0x7FFFFF
 #define SC_UPDATE_CONTENT 0x1
 #define SC_UPDATE_SELECTION 0x2
 #define SC_UPDATE_V_SCROLL 0x4
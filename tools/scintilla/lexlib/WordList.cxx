@@ -68,7 +68,7 @@ static char **ArrayFromWordList(char *wordlist, int *len, bool onlyLineEnds = fa
 }
 
 WordList::WordList(bool onlyLineEnds_) :
-	words(0), list(0), len(0), onlyLineEnds(onlyLineEnds_) {
+	words(0), list(0), len(0), onlyLineEnds(onlyLineEnds_), wordsHashed(0), hashMask(0) {
 }
 
 WordList::~WordList() {
@@ -98,9 +98,22 @@ void WordList::Clear() {
 		delete []list;
 		delete []words;
 	}
+	delete []wordsHashed;
 	words = 0;
 	list = 0;
 	len = 0;
+	wordsHashed = 0;
+	hashMask = 0;
+}
+
+// FNV-1a
+static unsigned int HashWord(const char *s) {
+	unsigned int hash = 2166136261u;
+	while (*s) {
+		hash ^= static_cast<unsigned char>(*s++);
+		hash *= 16777619u;
+	}
+	return hash;
 }
 
 #ifdef _MSC_VER
@@ -138,6 +151,20 @@ void WordList::Set(const char *s) {
 		unsigned char indexChar = words[l][0];
 		starts[indexChar] = l;
 	}
+	// Table is a power of 2 at least twice the number of words to keep probe sequences short
+	unsigned int sizeHash = 8;
+	while (sizeHash < static_cast<unsigned int>(len) * 2)
+		sizeHash *= 2;
+	hashMask = sizeHash - 1;
+	wordsHashed = new int[sizeHash];
+	for (unsigned int slot = 0; slot < sizeHash; slot++)
+		wordsHashed[slot] = -1;
+	for (int w = 0; w < len; w++) {
+		unsigned int slot = HashWord(words[w]) & hashMask;
+		while (wordsHashed[slot] >= 0)
+			slot = (slot + 1) & hashMask;
+		wordsHashed[slot] = w;
+	}
 }
 
 /** Check whether a string is in the list.
@@ -149,23 +176,15 @@ bool WordList::InList(const char *s) const {
 	if (0 == words)
 		return false;
 	unsigned char firstChar = s[0];
-	int j = starts[firstChar];
-	if (j >= 0) {
-		while (static_cast<unsigned char>(words[j][0]) == firstChar) {
-			if (s[1] == words[j][1]) {
-				const char *a = words[j] + 1;
-				const char *b = s + 1;
-				while (*a && *a == *b) {
-					a++;
-					b++;
-				}
-				if (!*a && !*b)
-					return true;
-			}
-			j++;
+	// Most strings are rejected by their first character before hashing
+	if (starts[firstChar] >= 0) {
+		for (unsigned int slot = HashWord(s) & hashMask; wordsHashed[slot] >= 0; slot = (slot + 1) & hashMask) {
+			const char *word = words[wordsHashed[slot]];
+			if ((word[0] == s[0]) && (strcmp(word, s) == 0))
+				return true;
 		}
 	}
-	j = starts[static_cast<unsigned int>('^')];
+	int j = starts[static_cast<unsigned int>('^')];
 	if (j >= 0) {
 		while (words[j][0] == '^') {
 			const char *a = words[j] + 1;
@@ -21,6 +21,10 @@ class WordList {
 	int len;
 	bool onlyLineEnds;	///< Delimited by any white space or only line ends
 	int starts[256];
+	// Open addressing hash table of indices into words, -1 for empty slots, so InList
+	// does not compare against every word with the same first character
+	int *wordsHashed;
+	unsigned int hashMask;
 public:
 	explicit WordList(bool onlyLineEnds_ = false);
 	~WordList();
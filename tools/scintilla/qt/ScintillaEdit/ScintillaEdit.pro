@@ -24,6 +24,7 @@ SOURCES += \
     ../../src/UniConversion.cxx \
     ../../src/Style.cxx \
     ../../src/Selection.cxx \
+    ../../src/SegmentCache.cxx \
     ../../src/ScintillaBase.cxx \
     ../../src/RunStyles.cxx \
     ../../src/RESearch.cxx \
@@ -38,6 +39,7 @@ SOURCES += \
     ../../src/Editor.cxx \
     ../../src/EditModel.cxx \
     ../../src/Document.cxx \
+    ../../src/DFASearch.cxx \
     ../../src/Decoration.cxx \
     ../../src/ContractionState.cxx \
     ../../src/CharClassify.cxx \
@@ -47,6 +49,7 @@ SOURCES += \
     ../../src/CaseConvert.cxx \
     ../../src/CallTip.cxx \
     ../../src/AutoComplete.cxx \
+    ../../src/BackgroundWrap.cxx \
     ../../lexlib/WordList.cxx \
     ../../lexlib/StyleContext.cxx \
     ../../lexlib/PropSetSimple.cxx \
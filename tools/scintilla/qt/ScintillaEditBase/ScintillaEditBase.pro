@@ -22,6 +22,7 @@ SOURCES += \
     ../../src/UniConversion.cxx \
     ../../src/Style.cxx \
     ../../src/Selection.cxx \
+    ../../src/SegmentCache.cxx \
     ../../src/ScintillaBase.cxx \
     ../../src/RunStyles.cxx \
     ../../src/RESearch.cxx \
@@ -36,6 +37,7 @@ SOURCES += \
     ../../src/Editor.cxx \
     ../../src/EditModel.cxx \
     ../../src/Document.cxx \
+    ../../src/DFASearch.cxx \
     ../../src/Decoration.cxx \
     ../../src/ContractionState.cxx \
     ../../src/CharClassify.cxx \
@@ -45,6 +47,7 @@ SOURCES += \
     ../../src/CaseConvert.cxx \
     ../../src/CallTip.cxx \
     ../../src/AutoComplete.cxx \
+    ../../src/BackgroundWrap.cxx \
     ../../lexlib/WordList.cxx \
     ../../lexlib/StyleContext.cxx \
     ../../lexlib/PropSetSimple.cxx \
@@ -68,9 +71,11 @@ HEADERS  += \
     ../../src/Style.h \
     ../../src/SplitVector.h \
     ../../src/Selection.h \
+    ../../src/SegmentCache.h \
     ../../src/ScintillaBase.h \
     ../../src/RunStyles.h \
     ../../src/RESearch.h \
+    ../../src/Position.h \
     ../../src/PositionCache.h \
     ../../src/PerLine.h \
     ../../src/Partitioning.h \
@@ -81,6 +86,7 @@ HEADERS  += \
     ../../src/ExternalLexer.h \
     ../../src/Editor.h \
     ../../src/Document.h \
+    ../../src/DFASearch.h \
     ../../src/Decoration.h \
     ../../src/ContractionState.h \
     ../../src/CharClassify.h \
@@ -90,6 +96,7 @@ HEADERS  += \
     ../../src/CaseConvert.h \
     ../../src/CallTip.h \
     ../../src/AutoComplete.h \
+    ../../src/BackgroundWrap.h \
     ../../include/Scintilla.h \
     ../../include/SciLexer.h \
     ../../include/Platform.h \
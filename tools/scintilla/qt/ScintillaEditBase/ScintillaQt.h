@@ -21,11 +21,13 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <list>
 #include <algorithm>
 
 #include "Scintilla.h"
 #include "Platform.h"
 #include "ILexer.h"
+#include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
 #include "RunStyles.h"
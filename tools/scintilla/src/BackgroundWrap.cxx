@@ -0,0 +1,407 @@
+// Scintilla source code edit control
+/** @file BackgroundWrap.cxx
+ ** Wrap lines outside the view on background threads.
+ **/
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <map>
+#include <deque>
+#include <algorithm>
+
+#ifndef NO_CXX11_THREADS
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#endif
+
+#include "Platform.h"
+
+#include "ILexer.h"
+#include "Scintilla.h"
+
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "CellBuffer.h"
+#include "KeyMap.h"
+#include "Indicator.h"
+#include "XPM.h"
+#include "LineMarker.h"
+#include "Style.h"
+#include "ViewStyle.h"
+#include "CharClassify.h"
+#include "Decoration.h"
+#include "CaseFolder.h"
+#include "Document.h"
+#include "UniConversion.h"
+#include "BackgroundWrap.h"
+
+#ifdef SCI_NAMESPACE
+using namespace Scintilla;
+#endif
+
+static inline bool IsSpaceOrTab(int ch) {
+	return ch == ' ' || ch == '\t';
+}
+
+WrapWidths::WrapWidths() : encodingFamily(-1) {
+	Clear();
+}
+
+void WrapWidths::Clear() {
+	encodingFamily = -1;
+	std::fill(dbcsLeadBytes, dbcsLeadBytes + 256, false);
+	byteWidths.clear();
+	characterWidths.clear();
+}
+
+void WrapWidths::MeasureText(CharacterMeasurer &measurer, const char *chars, const unsigned char *styles, int length) {
+	if (encodingFamily < 0) {
+		encodingFamily = measurer.EncodingFamily();
+		if (encodingFamily == efDBCS) {
+			for (int ch = 0; ch < 256; ch++)
+				dbcsLeadBytes[ch] = measurer.IsDBCSLeadByte(static_cast<char>(ch));
+		}
+		byteWidths.resize(256);
+	}
+	int i = 0;
+	while (i < length) {
+		const int style = styles[i];
+		std::vector<XYPOSITION> &widths = byteWidths[style];
+		if (widths.empty()) {
+			widths.resize(256, widthUnmeasured);
+			widths['\t'] = measurer.Visible(style) ? static_cast<XYPOSITION>(widthTab) : 0.0f;
+		}
+		const int lenChar = CharacterLength(chars + i, length - i);
+		if (lenChar == 1) {
+			const unsigned char uch = static_cast<unsigned char>(chars[i]);
+			if (widths[uch] == widthUnmeasured) {
+				widths[uch] = measurer.Visible(style) ? measurer.Measure(style, chars + i, 1) : 0.0f;
+			}
+		} else {
+			int key = 0;
+			for (int b = 0; b < lenChar; b++)
+				key = (key << 8) | static_cast<unsigned char>(chars[i + b]);
+			const std::pair<int, int> styleAndCharacter(style, key);
+			if (characterWidths.find(styleAndCharacter) == characterWidths.end()) {
+				characterWidths[styleAndCharacter] =
+					measurer.Visible(style) ? measurer.Measure(style, chars + i, lenChar) : 0.0f;
+			}
+		}
+		i += lenChar;
+	}
+}
+
+int WrapWidths::CharacterLength(const char *s, int len) const {
+	if (encodingFamily == efUnicode) {
+		return UTF8DrawBytes(reinterpret_cast<const unsigned char *>(s), len);
+	} else if ((encodingFamily == efDBCS) && (len > 1)) {
+		return dbcsLeadBytes[static_cast<unsigned char>(s[0])] ? 2 : 1;
+	}
+	return 1;
+}
+
+XYPOSITION WrapWidths::Width(int style, const char *s, int len) const {
+	if (len == 1) {
+		const std::vector<XYPOSITION> &widths = byteWidths[style];
+		return widths.empty() ? 0.0f : widths[static_cast<unsigned char>(s[0])];
+	}
+	int key = 0;
+	for (int b = 0; b < len; b++)
+		key = (key << 8) | static_cast<unsigned char>(s[b]);
+	std::map<std::pair<int, int>, XYPOSITION>::const_iterator it = characterWidths.find(std::pair<int, int>(style, key));
+	return (it != characterWidths.end()) ? it->second : 0.0f;
+}
+
+WrapParameters::WrapParameters() : width(0), wrapState(eWrapWord), wrapVisualFlags(0), wrapIndentMode(SC_WRAPINDENT_FIXED),
+	wrapVisualStartIndent(0), aveCharWidth(1), spaceWidth(1), tabWidth(8), indentSize(8) {
+}
+
+WrapJob::WrapJob(int lineStart_, const WrapParameters &parameters_, const WrapWidths &widths_) :
+	lineStart(lineStart_), lineEnd(lineStart_), parameters(parameters_), widths(widths_),
+	state(jsWaiting), discarded(false) {
+	lineStarts.push_back(0);
+}
+
+void WrapJob::AddLine(const char *s, const unsigned char *st, int length, int lengthLaidOut) {
+	chars.insert(chars.end(), s, s + length);
+	styles.insert(styles.end(), st, st + length);
+	lineStarts.push_back(static_cast<int>(chars.size()));
+	lineLengths.push_back(lengthLaidOut);
+	lineEnd++;
+}
+
+int WrapJob::Lines() const {
+	return lineEnd - lineStart;
+}
+
+void WrapJob::Wrap() {
+	subLines.resize(Lines());
+	const char *s = chars.empty() ? "" : &chars[0];
+	const unsigned char *st = styles.empty() ? reinterpret_cast<const unsigned char *>("") : &styles[0];
+	for (int line = 0; line < Lines(); line++) {
+		const int start = lineStarts[line];
+		subLines[line] = WrapLine(s + start, st + start, lineLengths[line]);
+	}
+}
+
+int WrapJob::CharacterStartBefore(int position) const {
+	while ((position > 0) && !characterStarts[position])
+		position--;
+	return position;
+}
+
+int WrapJob::CharacterStartAfter(int position) const {
+	while ((position < static_cast<int>(characterStarts.size()) - 1) && !characterStarts[position])
+		position++;
+	return position;
+}
+
+// Follows the positioning of EditView::LayoutLine and its rules for breaking lines.
+int WrapJob::WrapLine(const char *s, const unsigned char *st, int length) {
+	positions.assign(length + 1, 0.0f);
+	characterStarts.assign(length + 1, false);
+	XYPOSITION x = 0.0f;
+	int i = 0;
+	while (i < length) {
+		const int lenChar = widths.CharacterLength(s + i, length - i);
+		XYPOSITION widthChar = widths.Width(st[i], s + i, lenChar);
+		if (widthChar == WrapWidths::widthTab) {
+			widthChar = (static_cast<int>((x + 2) / parameters.tabWidth) + 1) * parameters.tabWidth - x;
+		}
+		characterStarts[i] = true;
+		x += widthChar;
+		for (int b = 1; b <= lenChar; b++)
+			positions[i + b] = x;
+		i += lenChar;
+	}
+	characterStarts[length] = true;
+
+	// Hard to cope when too narrow, so just assume there is space
+	int width = std::max(parameters.width, 20);
+	if (width > positions[length]) {
+		// Simple common case where line does not need wrapping.
+		return 1;
+	}
+	if (parameters.wrapVisualFlags & SC_WRAPVISUALFLAG_END) {
+		width -= static_cast<int>(parameters.aveCharWidth); // take into account the space for end wrap mark
+	}
+	XYPOSITION wrapAddIndent = 0; // This will be added to initial indent of line
+	if (parameters.wrapIndentMode == SC_WRAPINDENT_INDENT) {
+		wrapAddIndent = parameters.indentSize * parameters.spaceWidth;
+	} else if (parameters.wrapIndentMode == SC_WRAPINDENT_FIXED) {
+		wrapAddIndent = parameters.wrapVisualStartIndent * parameters.aveCharWidth;
+	}
+	XYPOSITION wrapIndent = wrapAddIndent;
+	if (parameters.wrapIndentMode != SC_WRAPINDENT_FIXED) {
+		for (int c = 0; c < length; c++) {
+			if (!IsSpaceOrTab(s[c])) {
+				wrapIndent += positions[c]; // Add line indent
+				break;
+			}
+		}
+	}
+	// Check for text width minimum
+	if (wrapIndent > width - static_cast<int>(parameters.aveCharWidth) * 15)
+		wrapIndent = wrapAddIndent;
+	// Check for wrapIndent minimum
+	if ((parameters.wrapVisualFlags & SC_WRAPVISUALFLAG_START) && (wrapIndent < parameters.aveCharWidth))
+		wrapIndent = parameters.aveCharWidth; // Indent to show start visual
+	int lines = 0;
+	// Calculate line start positions based upon width.
+	int lastGoodBreak = 0;
+	int lastLineStart = 0;
+	XYACCUMULATOR startOffset = 0;
+	int p = 0;
+	while (p < length) {
+		if ((positions[p + 1] - startOffset) >= width) {
+			if (lastGoodBreak == lastLineStart) {
+				// Try moving to start of last character
+				if (p > 0) {
+					lastGoodBreak = CharacterStartBefore(p);
+				}
+				if (lastGoodBreak == lastLineStart) {
+					// Ensure at least one character on line.
+					lastGoodBreak = CharacterStartAfter(lastGoodBreak + 1);
+				}
+			}
+			lastLineStart = lastGoodBreak;
+			lines++;
+			startOffset = positions[lastGoodBreak];
+			// take into account the space for start wrap mark and indent
+			startOffset -= wrapIndent;
+			p = lastGoodBreak + 1;
+			continue;
+		}
+		if (p > 0) {
+			if (parameters.wrapState == eWrapChar) {
+				lastGoodBreak = CharacterStartBefore(p);
+				p = CharacterStartAfter(p + 1);
+				continue;
+			} else if ((parameters.wrapState == eWrapWord) && (st[p] != st[p - 1])) {
+				lastGoodBreak = p;
+			} else if (IsSpaceOrTab(s[p - 1]) && !IsSpaceOrTab(s[p])) {
+				lastGoodBreak = p;
+			}
+		}
+		p++;
+	}
+	return lines + 1;
+}
+
+#ifndef NO_CXX11_THREADS
+
+struct WrapQueue::Shared {
+	std::mutex mutex;
+	std::condition_variable workAdded;
+	std::condition_variable workFinished;
+	std::deque<WrapJob *> jobs;
+	std::vector<std::thread> threads;
+	bool stopping;
+	Shared() : stopping(false) {
+	}
+};
+
+WrapQueue::WrapQueue(int threads) : shared(new Shared()) {
+	for (int t = 0; t < threads; t++) {
+		shared->threads.push_back(std::thread(Work, shared));
+	}
+}
+
+WrapQueue::~WrapQueue() {
+	Clear();
+	{
+		std::lock_guard<std::mutex> lock(shared->mutex);
+		shared->stopping = true;
+	}
+	shared->workAdded.notify_all();
+	for (size_t t = 0; t < shared->threads.size(); t++) {
+		shared->threads[t].join();
+	}
+	delete shared;
+	shared = 0;
+}
+
+void WrapQueue::Work(Shared *shared) {
+	std::unique_lock<std::mutex> lock(shared->mutex);
+	for (;;) {
+		if (shared->stopping)
+			return;
+		WrapJob *job = 0;
+		for (size_t j = 0; j < shared->jobs.size(); j++) {
+			if (shared->jobs[j]->state == WrapJob::jsWaiting) {
+				job = shared->jobs[j];
+				break;
+			}
+		}
+		if (!job) {
+			shared->workAdded.wait(lock);
+			continue;
+		}
+		job->state = WrapJob::jsRunning;
+		lock.unlock();
+		job->Wrap();
+		lock.lock();
+		if (job->discarded) {
+			delete job;
+		} else {
+			job->state = WrapJob::jsFinished;
+			shared->workFinished.notify_all();
+		}
+	}
+}
+
+void WrapQueue::Add(WrapJob *job) {
+	{
+		std::lock_guard<std::mutex> lock(shared->mutex);
+		shared->jobs.push_back(job);
+	}
+	shared->workAdded.notify_one();
+}
+
+WrapJob *WrapQueue::TakeFinished(int waitMilliseconds) {
+	std::unique_lock<std::mutex> lock(shared->mutex);
+	if (shared->jobs.empty())
+		return 0;
+	if ((shared->jobs.front()->state != WrapJob::jsFinished) && (waitMilliseconds > 0)) {
+		shared->workFinished.wait_for(lock, std::chrono::milliseconds(waitMilliseconds));
+	}
+	if (shared->jobs.empty() || (shared->jobs.front()->state != WrapJob::jsFinished))
+		return 0;
+	WrapJob *job = shared->jobs.front();
+	shared->jobs.pop_front();
+	return job;
+}
+
+void WrapQueue::Clear() {
+	std::lock_guard<std::mutex> lock(shared->mutex);
+	for (size_t j = 0; j < shared->jobs.size(); j++) {
+		WrapJob *job = shared->jobs[j];
+		if (job->state == WrapJob::jsRunning) {
+			// Deleted by its thread when finished
+			job->discarded = true;
+		} else {
+			delete job;
+		}
+	}
+	shared->jobs.clear();
+}
+
+size_t WrapQueue::Length() {
+	std::lock_guard<std::mutex> lock(shared->mutex);
+	return shared->jobs.size();
+}
+
+#else
+
+struct WrapQueue::Shared {
+	std::deque<WrapJob *> jobs;
+};
+
+WrapQueue::WrapQueue(int) : shared(new Shared()) {
+}
+
+WrapQueue::~WrapQueue() {
+	Clear();
+	delete shared;
+	shared = 0;
+}
+
+void WrapQueue::Work(Shared *) {
+}
+
+void WrapQueue::Add(WrapJob *job) {
+	job->Wrap();
+	job->state = WrapJob::jsFinished;
+	shared->jobs.push_back(job);
+}
+
+WrapJob *WrapQueue::TakeFinished(int) {
+	if (shared->jobs.empty())
+		return 0;
+	WrapJob *job = shared->jobs.front();
+	shared->jobs.pop_front();
+	return job;
+}
+
+void WrapQueue::Clear() {
+	for (size_t j = 0; j < shared->jobs.size(); j++) {
+		delete shared->jobs[j];
+	}
+	shared->jobs.clear();
+}
+
+size_t WrapQueue::Length() {
+	return shared->jobs.size();
+}
+
+#endif
@@ -0,0 +1,123 @@
+// Scintilla source code edit control
+/** @file BackgroundWrap.h
+ ** Wrap lines outside the view on background threads.
+ **/
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef BACKGROUNDWRAP_H
+#define BACKGROUNDWRAP_H
+
+#ifdef SCI_NAMESPACE
+namespace Scintilla {
+#endif
+
+/**
+ * Measures characters on the main thread for WrapWidths.
+ */
+class CharacterMeasurer {
+public:
+	virtual ~CharacterMeasurer() {}
+	virtual int EncodingFamily() const = 0;
+	virtual bool IsDBCSLeadByte(char ch) const = 0;
+	virtual bool Visible(int style) const = 0;
+	virtual XYPOSITION Measure(int style, const char *s, int len) = 0;
+};
+
+/**
+ * Widths of the characters used in each style, measured on the main thread so that other
+ * threads can lay out lines without a Surface.
+ * The widths of characters are summed so kerning is ignored and lines wrapped from these
+ * widths are wrapped again with a full layout when they become visible.
+ */
+class WrapWidths {
+public:
+	enum { widthUnmeasured = -1, widthTab = -2 };
+	WrapWidths();
+	void Clear();
+	void MeasureText(CharacterMeasurer &measurer, const char *chars, const unsigned char *styles, int length);
+	int CharacterLength(const char *s, int len) const;
+	XYPOSITION Width(int style, const char *s, int len) const;
+private:
+	int encodingFamily;
+	bool dbcsLeadBytes[256];
+	std::vector<std::vector<XYPOSITION> > byteWidths;	// For each style, empty until used
+	std::map<std::pair<int, int>, XYPOSITION> characterWidths;	// Multi-byte characters by style
+};
+
+/**
+ * The wrap settings of the view, copied so they can be read by other threads.
+ */
+struct WrapParameters {
+	int width;
+	int wrapState;
+	int wrapVisualFlags;
+	int wrapIndentMode;
+	int wrapVisualStartIndent;
+	XYPOSITION aveCharWidth;
+	XYPOSITION spaceWidth;
+	XYPOSITION tabWidth;
+	int indentSize;
+	WrapParameters();
+};
+
+/**
+ * A copy of the text and styles of a range of lines along with everything needed to find the
+ * number of sub-lines each wraps into. Wrap may be called on any thread.
+ */
+class WrapJob {
+public:
+	enum JobState { jsWaiting, jsRunning, jsFinished };
+	int lineStart;
+	int lineEnd;
+	WrapParameters parameters;
+	WrapWidths widths;
+	std::vector<char> chars;
+	std::vector<unsigned char> styles;
+	std::vector<int> lineStarts;	// Offset of each line in chars and styles followed by the end
+	std::vector<int> lineLengths;	// Number of characters laid out for each line
+	std::vector<int> subLines;	// Result: number of sub-lines for each line
+	// Owned by WrapQueue
+	JobState state;
+	bool discarded;
+
+	WrapJob(int lineStart_, const WrapParameters &parameters_, const WrapWidths &widths_);
+	void AddLine(const char *s, const unsigned char *st, int length, int lengthLaidOut);
+	int Lines() const;
+	void Wrap();
+private:
+	std::vector<XYPOSITION> positions;
+	std::vector<bool> characterStarts;
+	int CharacterStartBefore(int position) const;
+	int CharacterStartAfter(int position) const;
+	int WrapLine(const char *s, const unsigned char *st, int length);
+};
+
+/**
+ * Runs WrapJobs on a set of threads and returns them in the order they were added.
+ * When built without thread support, jobs are run as they are added.
+ */
+class WrapQueue {
+public:
+	explicit WrapQueue(int threads);
+	~WrapQueue();
+	void Add(WrapJob *job);
+	// Returns the oldest job once it has finished, waiting for it up to waitMilliseconds
+	WrapJob *TakeFinished(int waitMilliseconds);
+	// Discard all jobs not yet taken
+	void Clear();
+	size_t Length();
+private:
+	struct Shared;
+	Shared *shared;
+	static void Work(Shared *shared);
+
+	// Private so WrapQueue objects can not be copied
+	WrapQueue(const WrapQueue &);
+	WrapQueue &operator=(const WrapQueue &);
+};
+
+#ifdef SCI_NAMESPACE
+}
+#endif
+
+#endif
@@ -6,17 +6,34 @@
 // The License.txt file describes the conditions under which this software may be distributed.
 
 #include <stdlib.h>
+#include <stddef.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdarg.h>
 
+#include <vector>
 #include <algorithm>
 
+#ifndef NO_CXX11_THREADS
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#endif
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#define CELLBUFFER_SSE2
+#endif
+
 #include "Platform.h"
 
+#include "ILexer.h"
 #include "Scintilla.h"
+#include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
+#include "RunStyles.h"
 #include "CellBuffer.h"
 #include "UniConversion.h"
 
@@ -43,11 +60,11 @@ void LineVector::SetPerLine(PerLine *pl) {
 	perLine = pl;
 }
 
-void LineVector::InsertText(int line, int delta) {
+void LineVector::InsertText(int line, Sci::Position delta) {
 	starts.InsertText(line, delta);
 }
 
-void LineVector::InsertLine(int line, int position, bool lineStart) {
+void LineVector::InsertLine(int line, Sci::Position position, bool lineStart) {
 	starts.InsertPartition(line, position);
 	if (perLine) {
 		if ((line > 0) && lineStart)
@@ -56,7 +73,16 @@ void LineVector::InsertLine(int line, int position, bool lineStart) {
 	}
 }
 
-void LineVector::SetLineStart(int line, int position) {
+void LineVector::InsertLines(int line, const Sci::Position *positions, int lines, bool lineStart) {
+	starts.InsertPartitions(line, positions, lines);
+	if (perLine) {
+		if ((line > 0) && lineStart)
+			line--;
+		perLine->InsertLines(line, lines);
+	}
+}
+
+void LineVector::SetLineStart(int line, Sci::Position position) {
 	starts.SetPartitionStartPosition(line, position);
 }
 
@@ -67,55 +93,109 @@ void LineVector::RemoveLine(int line) {
 	}
 }
 
-int LineVector::LineFromPosition(int pos) const {
+int LineVector::LineFromPosition(Sci::Position pos) const {
 	return starts.PartitionFromPosition(pos);
 }
 
 Action::Action() {
 	at = startAction;
+	mayCoalesce = false;
 	position = 0;
 	data = 0;
 	lenData = 0;
-	mayCoalesce = false;
 }
 
-Action::~Action() {
-	Destroy();
+void Action::Create(actionType at_, Sci::Position position_, const char *data_, Sci::Position lenData_, bool mayCoalesce_) {
+	at = at_;
+	mayCoalesce = mayCoalesce_;
+	position = position_;
+	data = data_;
+	lenData = lenData_;
 }
 
-void Action::Create(actionType at_, int position_, const char *data_, int lenData_, bool mayCoalesce_) {
-	delete []data;
-	data = NULL;
-	position = position_;
-	at = at_;
-	if (lenData_) {
-		data = new char[lenData_];
-		memcpy(data, data_, lenData_);
+struct UndoArena::Chunk {
+	char *data;
+	size_t size;
+	size_t used;
+	Chunk *next;
+	explicit Chunk(size_t size_) : data(new char[size_]), size(size_), used(0), next(0) {
 	}
-	lenData = lenData_;
-	mayCoalesce = mayCoalesce_;
+	~Chunk() {
+		delete []data;
+	}
+	bool Contains(const char *s) const {
+		return (s >= data) && (s <= data + used);
+	}
+};
+
+// Chunks start small so documents with little undo history stay small
+static const size_t minChunk = 4096;
+static const size_t maxChunk = 1024 * 1024;
+
+UndoArena::UndoArena() : first(0), last(0), used(0) {
 }
 
-void Action::Destroy() {
-	delete []data;
-	data = 0;
+UndoArena::~UndoArena() {
+	DiscardBefore(0);
+}
+
+char *UndoArena::Allocate(Sci::Position length) {
+	const size_t lengthAllocate = static_cast<size_t>(length);
+	if (!last || (last->size - last->used < lengthAllocate)) {
+		// Each chunk is about as large as the text already held, within limits
+		const size_t sizeChunk = std::max(lengthAllocate, std::min(std::max(used, minChunk), maxChunk));
+		Chunk *chunk = new Chunk(sizeChunk);
+		if (last)
+			last->next = chunk;
+		else
+			first = chunk;
+		last = chunk;
+	}
+	char *allocation = last->data + last->used;
+	last->used += lengthAllocate;
+	used += lengthAllocate;
+	return allocation;
 }
 
-void Action::Grab(Action *source) {
-	delete []data;
+void UndoArena::TruncateAfter(const char *end) {
+	// Most often end is already the end of the last chunk
+	if (last && end && (end == last->data + last->used))
+		return;
+	Chunk *chunk = first;
+	while (chunk && !(end && chunk->Contains(end))) {
+		chunk = chunk->next;
+	}
+	Chunk *discard = first;
+	if (chunk) {
+		used -= (chunk->data + chunk->used) - end;
+		chunk->used = end - chunk->data;
+		discard = chunk->next;
+		chunk->next = 0;
+	} else {
+		first = 0;
+	}
+	last = chunk;
+	while (discard) {
+		Chunk *next = discard->next;
+		used -= discard->used;
+		delete discard;
+		discard = next;
+	}
+}
 
-	position = source->position;
-	at = source->at;
-	data = source->data;
-	lenData = source->lenData;
-	mayCoalesce = source->mayCoalesce;
+void UndoArena::DiscardBefore(const char *start) {
+	while (first && !(start && first->Contains(start))) {
+		Chunk *next = first->next;
+		used -= first->used;
+		delete first;
+		first = next;
+	}
+	if (!first)
+		last = 0;
+}
 
-	// Ownership of source data transferred to this
-	source->position = 0;
-	source->at = startAction;
-	source->data = 0;
-	source->lenData = 0;
-	source->mayCoalesce = true;
+size_t UndoArena::Used() const {
+	return used;
 }
 
 // The undo history stores a sequence of user operations that represent the user's view of the
@@ -145,6 +225,7 @@ UndoHistory::UndoHistory() {
 	undoSequenceDepth = 0;
 	savePoint = 0;
 	tentativePoint = -1;
+	memoryLimit = 0;
 
 	actions[currentAction].Create(startAction);
 }
@@ -162,14 +243,14 @@ void UndoHistory::EnsureUndoRoom() {
 		int lenActionsNew = lenActions * 2;
 		Action *actionsNew = new Action[lenActionsNew];
 		for (int act = 0; act <= currentAction; act++)
-			actionsNew[act].Grab(&actions[act]);
+			actionsNew[act] = actions[act];
 		delete []actions;
 		lenActions = lenActionsNew;
 		actions = actionsNew;
 	}
 }
 
-const char *UndoHistory::AppendAction(actionType at, int position, const char *data, int lengthData,
+const char *UndoHistory::AppendAction(actionType at, Sci::Position position, const char *data, Sci::Position lengthData,
 	bool &startSequence, bool mayCoalesce) {
 	EnsureUndoRoom();
 	//Platform::DebugPrintf("%% %d action %d %d %d\n", at, position, lengthData, currentAction);
@@ -237,12 +318,25 @@ const char *UndoHistory::AppendAction(actionType at, int position, const char *d
 		currentAction++;
 	}
 	startSequence = oldCurrentAction != currentAction;
-	int actionWithData = currentAction;
-	actions[currentAction].Create(at, position, data, lengthData, mayCoalesce);
+	// Discard the text of any redo actions being replaced
+	int actionBefore = currentAction - 1;
+	while ((actionBefore >= 0) && (actions[actionBefore].lenData == 0)) {
+		actionBefore--;
+	}
+	arena.TruncateAfter((actionBefore >= 0) ?
+		actions[actionBefore].data + actions[actionBefore].lenData : 0);
+	char *dataStored = 0;
+	if (lengthData) {
+		dataStored = arena.Allocate(lengthData);
+		memcpy(dataStored, data, lengthData);
+	}
+	actions[currentAction].Create(at, position, dataStored, lengthData, mayCoalesce);
 	currentAction++;
 	actions[currentAction].Create(startAction);
 	maxAction = currentAction;
-	return actions[actionWithData].data;
+	if (memoryLimit && startSequence && (Memory() > memoryLimit))
+		LimitMemory();
+	return dataStored;
 }
 
 void UndoHistory::BeginUndoAction() {
@@ -269,6 +363,8 @@ void UndoHistory::EndUndoAction() {
 			maxAction = currentAction;
 		}
 		actions[currentAction].mayCoalesce = false;
+		if (memoryLimit && (Memory() > memoryLimit))
+			LimitMemory();
 	}
 }
 
@@ -277,8 +373,7 @@ void UndoHistory::DropUndoSequence() {
 }
 
 void UndoHistory::DeleteUndoHistory() {
-	for (int i = 1; i < maxAction; i++)
-		actions[i].Destroy();
+	arena.DiscardBefore(0);
 	maxAction = 0;
 	currentAction = 0;
 	actions[currentAction].Create(startAction);
@@ -286,6 +381,46 @@ void UndoHistory::DeleteUndoHistory() {
 	tentativePoint = -1;
 }
 
+size_t UndoHistory::Memory() const {
+	return arena.Used() + (maxAction + 1) * sizeof(Action);
+}
+
+void UndoHistory::SetMemoryLimit(size_t limit) {
+	memoryLimit = limit;
+	if (memoryLimit && (Memory() > memoryLimit))
+		LimitMemory();
+}
+
+void UndoHistory::LimitMemory() {
+	// Inside a sequence the start of the operation being built could be discarded
+	if ((undoSequenceDepth > 0) || (tentativePoint >= 0))
+		return;
+	// Discard down to 3/4 of the limit so this is not repeated for every action
+	const size_t target = memoryLimit / 4 * 3;
+	size_t memory = Memory();
+	int discard = 0;
+	// Only whole user operations before the current one are discarded and
+	// the start action that begins the next operation becomes the first action
+	for (int act = 1; (act < currentAction) && (memory > target); act++) {
+		memory -= actions[act - 1].lenData + sizeof(Action);
+		if (actions[act].at == startAction)
+			discard = act;
+	}
+	if (discard == 0)
+		return;
+	const char *dataKept = 0;
+	for (int act = discard; (act <= maxAction) && !dataKept; act++) {
+		if (actions[act].lenData)
+			dataKept = actions[act].data;
+	}
+	arena.DiscardBefore(dataKept);
+	for (int act = discard; act <= maxAction; act++)
+		actions[act - discard] = actions[act];
+	currentAction -= discard;
+	maxAction -= discard;
+	savePoint = (savePoint >= discard) ? savePoint - discard : -1;
+}
+
 void UndoHistory::SetSavePoint() {
 	savePoint = currentAction;
 }
@@ -364,63 +499,331 @@ void UndoHistory::CompletedRedoStep() {
 	currentAction++;
 }
 
+static void FindLineStarts(const char *s, Sci::Position start, Sci::Position end, Sci::Position length,
+	bool utf8LineEnds, std::vector<Sci::Position> &starts);
+
+#ifdef SCI_NAMESPACE
+namespace Scintilla {
+#endif
+
+/**
+ * Finds the line starts of mapped text. The text is scanned on another thread so that
+ * reading it from the file does not block the user interface.
+ * When built without thread support, each call to Take scans the next block.
+ */
+class LineIndexer {
+public:
+	LineIndexer(const char *text_, Sci::Position length_, bool utf8LineEnds_);
+	~LineIndexer();
+	/// Move the line starts found so far into starts, waiting up to waitMilliseconds for some.
+	/// @return true once all of the line starts have been taken.
+	bool Take(std::vector<Sci::Position> &starts, int waitMilliseconds);
+private:
+	enum { blockSize = 1024 * 1024 };
+	const char *text;
+	Sci::Position length;
+	bool utf8LineEnds;
+#ifdef NO_CXX11_THREADS
+	Sci::Position scanned;
+#else
+	std::mutex mutex;
+	std::condition_variable found;
+	std::vector<Sci::Position> pending;
+	bool finished;
+	bool cancelling;
+	std::thread thread;
+	void Scan();
+#endif
+
+	// Private so LineIndexer objects can not be copied
+	LineIndexer(const LineIndexer &);
+	LineIndexer &operator=(const LineIndexer &);
+};
+
+#ifdef SCI_NAMESPACE
+}
+#endif
+
+#ifdef NO_CXX11_THREADS
+
+LineIndexer::LineIndexer(const char *text_, Sci::Position length_, bool utf8LineEnds_) :
+	text(text_), length(length_), utf8LineEnds(utf8LineEnds_), scanned(0) {
+}
+
+LineIndexer::~LineIndexer() {
+}
+
+bool LineIndexer::Take(std::vector<Sci::Position> &starts, int) {
+	const Sci::Position end = std::min(scanned + static_cast<Sci::Position>(blockSize) * 16, length);
+	FindLineStarts(text, scanned, end, length, utf8LineEnds, starts);
+	scanned = end;
+	return scanned == length;
+}
+
+#else
+
+LineIndexer::LineIndexer(const char *text_, Sci::Position length_, bool utf8LineEnds_) :
+	text(text_), length(length_), utf8LineEnds(utf8LineEnds_), finished(false), cancelling(false) {
+	thread = std::thread(&LineIndexer::Scan, this);
+}
+
+LineIndexer::~LineIndexer() {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		cancelling = true;
+	}
+	thread.join();
+}
+
+void LineIndexer::Scan() {
+	std::vector<Sci::Position> starts;
+	for (Sci::Position position = 0; position < length; position += blockSize) {
+		const Sci::Position end = std::min(position + blockSize, length);
+		FindLineStarts(text, position, end, length, utf8LineEnds, starts);
+		std::lock_guard<std::mutex> lock(mutex);
+		if (cancelling)
+			return;
+		pending.insert(pending.end(), starts.begin(), starts.end());
+		starts.clear();
+		found.notify_one();
+	}
+	std::lock_guard<std::mutex> lock(mutex);
+	finished = true;
+	found.notify_one();
+}
+
+bool LineIndexer::Take(std::vector<Sci::Position> &starts, int waitMilliseconds) {
+	std::unique_lock<std::mutex> lock(mutex);
+	if (pending.empty() && !finished && (waitMilliseconds > 0)) {
+		found.wait_for(lock, std::chrono::milliseconds(waitMilliseconds));
+	}
+	starts.swap(pending);
+	pending.clear();
+	return finished;
+}
+
+#endif
+
 CellBuffer::CellBuffer() {
 	readOnly = false;
 	utf8LineEnds = 0;
 	collectingUndo = true;
+	mappedText = 0;
+	mappedBytes = 0;
+	lengthMapped = 0;
+	indexer = 0;
 }
 
 CellBuffer::~CellBuffer() {
+	// The indexer reads the mapped text so must finish before the text is released
+	delete indexer;
+	indexer = 0;
+	if (mappedText) {
+		mappedText->Release();
+		mappedText = 0;
+	}
 }
 
-char CellBuffer::CharAt(int position) const {
+char CellBuffer::CharAt(Sci::Position position) const {
+	if (mappedBytes)
+		return ((position >= 0) && (position < lengthMapped)) ? mappedBytes[position] : 0;
 	return substance.ValueAt(position);
 }
 
-void CellBuffer::GetCharRange(char *buffer, int position, int lengthRetrieve) const {
+void CellBuffer::GetCharRange(char *buffer, Sci::Position position, Sci::Position lengthRetrieve) const {
 	if (lengthRetrieve <= 0)
 		return;
 	if (position < 0)
 		return;
-	if ((position + lengthRetrieve) > substance.Length()) {
-		Platform::DebugPrintf("Bad GetCharRange %d for %d of %d\n", position,
-		                      lengthRetrieve, substance.Length());
+	if ((position + lengthRetrieve) > Length()) {
+		Platform::DebugPrintf("Bad GetCharRange %ld for %ld of %ld\n", static_cast<long>(position),
+		                      static_cast<long>(lengthRetrieve), static_cast<long>(Length()));
+		return;
+	}
+	if (mappedBytes)
+		memcpy(buffer, mappedBytes + position, lengthRetrieve);
+	else
+		substance.GetRange(buffer, position, lengthRetrieve);
+}
+
+// Each run takes about this many bytes so styles in shorter runs are stored as bytes
+static const int bytesPerRun = 12;
+
+StyleBuffer::StyleBuffer() : length(0), runs(0), bytes(0) {
+}
+
+StyleBuffer::~StyleBuffer() {
+	FreeStorage();
+}
+
+StyleBuffer::Storage StyleBuffer::GetStorage() const {
+	if (bytes)
+		return stBytes;
+	return runs ? stRuns : stNone;
+}
+
+Sci::Position StyleBuffer::Length() const {
+	return length;
+}
+
+char StyleBuffer::ValueAt(Sci::Position position) const {
+	if ((position < 0) || (position >= length))
+		return 0;
+	if (bytes)
+		return bytes->ValueAt(position);	// 0 after the bytes stored
+	if (runs)
+		return static_cast<char>(runs->ValueAt(position));
+	return 0;
+}
+
+void StyleBuffer::GetRange(char *buffer, Sci::Position position, Sci::Position retrieveLength) const {
+	if (bytes) {
+		const Sci::Position lengthStored = std::max(std::min(retrieveLength, bytes->Length() - position),
+			static_cast<Sci::Position>(0));
+		if (lengthStored > 0)
+			bytes->GetRange(buffer, position, lengthStored);
+		buffer += lengthStored;
+		retrieveLength -= lengthStored;
+	} else if (runs) {
+		const Sci::Position end = position + retrieveLength;
+		while (position < end) {
+			const Sci::Position endRun = std::min(runs->EndRun(position), end);
+			memset(buffer, runs->ValueAt(position), endRun - position);
+			buffer += endRun - position;
+			position = endRun;
+		}
+		retrieveLength = 0;
+	}
+	if (retrieveLength > 0)
+		memset(buffer, 0, retrieveLength);
+}
+
+bool StyleBuffer::FillRange(Sci::Position position, char value, Sci::Position fillLength) {
+	if ((fillLength <= 0) || (position < 0) || (position + fillLength > length))
+		return false;
+	if (bytes) {
+		bool changed = false;
+		if (value)
+			bytes->EnsureLength(position + fillLength);
+		const Sci::Position end = std::min(position + fillLength, bytes->Length());
+		for (; position < end; position++) {
+			if (bytes->ValueAt(position) != value) {
+				bytes->SetValueAt(position, value);
+				changed = true;
+			}
+		}
+		return changed;
+	}
+	if (!runs) {
+		if (!value)
+			return false;
+		runs = new RunStyles();
+		runs->InsertSpace(0, length);
+	}
+	if (!runs->FillRange(position, value, fillLength))
+		return false;
+	if ((runs->Runs() == 1) && (runs->ValueAt(0) == 0)) {
+		FreeStorage();
+	} else {
+		// Only the styles up to the start of a final run of 0 are stored as bytes
+		const Sci::Position lengthStyled = runs->ValueAt(length - 1) ? length : runs->StartRun(length - 1);
+		if (static_cast<Sci::Position>(runs->Runs()) * bytesPerRun > lengthStyled)
+			ChangeToBytes();
+	}
+	return true;
+}
+
+void StyleBuffer::InsertSpace(Sci::Position position, Sci::Position insertLength) {
+	if (insertLength <= 0)
+		return;
+	length += insertLength;
+	if (bytes) {
+		if (position < bytes->Length())
+			bytes->InsertValue(position, insertLength, 0);
+	} else if (runs) {
+		runs->InsertSpace(position, insertLength);
+		// RunStyles extends the run at position but inserted text starts with style 0
+		runs->FillRange(position, 0, insertLength);
+	}
+}
+
+void StyleBuffer::DeleteRange(Sci::Position position, Sci::Position deleteLength) {
+	if (deleteLength <= 0)
 		return;
+	length -= deleteLength;
+	if (length == 0) {
+		FreeStorage();
+	} else if (bytes) {
+		const Sci::Position lengthStored = std::min(deleteLength, bytes->Length() - position);
+		if (lengthStored > 0)
+			bytes->DeleteRange(position, lengthStored);
+	} else if (runs) {
+		runs->DeleteRange(position, deleteLength);
 	}
-	substance.GetRange(buffer, position, lengthRetrieve);
 }
 
-char CellBuffer::StyleAt(int position) const {
+void StyleBuffer::Allocate(Sci::Position newSize) {
+	if (bytes)
+		bytes->ReAllocate(newSize);
+}
+
+void StyleBuffer::FreeStorage() {
+	delete runs;
+	runs = 0;
+	delete bytes;
+	bytes = 0;
+}
+
+void StyleBuffer::ChangeToBytes() {
+	const Sci::Position lengthStyled = runs->ValueAt(length - 1) ? length : runs->StartRun(length - 1);
+	bytes = new SplitVector<char>();
+	bytes->ReAllocate(lengthStyled + 1);
+	for (Sci::Position position = 0; position < lengthStyled;) {
+		const Sci::Position endRun = runs->EndRun(position);
+		bytes->InsertValue(position, endRun - position, static_cast<char>(runs->ValueAt(position)));
+		position = endRun;
+	}
+	delete runs;
+	runs = 0;
+}
+
+char CellBuffer::StyleAt(Sci::Position position) const {
 	return style.ValueAt(position);
 }
 
-void CellBuffer::GetStyleRange(unsigned char *buffer, int position, int lengthRetrieve) const {
+void CellBuffer::GetStyleRange(unsigned char *buffer, Sci::Position position, Sci::Position lengthRetrieve) const {
 	if (lengthRetrieve < 0)
 		return;
 	if (position < 0)
 		return;
-	if ((position + lengthRetrieve) > style.Length()) {
-		Platform::DebugPrintf("Bad GetStyleRange %d for %d of %d\n", position,
-		                      lengthRetrieve, style.Length());
+	if ((position + lengthRetrieve) > Length()) {
+		Platform::DebugPrintf("Bad GetStyleRange %ld for %ld of %ld\n", static_cast<long>(position),
+		                      static_cast<long>(lengthRetrieve), static_cast<long>(Length()));
 		return;
 	}
 	style.GetRange(reinterpret_cast<char *>(buffer), position, lengthRetrieve);
 }
 
 const char *CellBuffer::BufferPointer() {
+	if (mappedBytes)
+		return mappedBytes;
 	return substance.BufferPointer();
 }
 
-const char *CellBuffer::RangePointer(int position, int rangeLength) {
+const char *CellBuffer::RangePointer(Sci::Position position, Sci::Position rangeLength) {
+	if (mappedBytes)
+		return mappedBytes + position;
 	return substance.RangePointer(position, rangeLength);
 }
 
-int CellBuffer::GapPosition() const {
+Sci::Position CellBuffer::GapPosition() const {
+	if (mappedBytes)
+		return lengthMapped;
 	return substance.GapPosition();
 }
 
 // The char* returned is to an allocation owned by the undo history
-const char *CellBuffer::InsertString(int position, const char *s, int insertLength, bool &startSequence) {
+const char *CellBuffer::InsertString(Sci::Position position, const char *s, Sci::Position insertLength, bool &startSequence) {
 	// InsertString and DeleteChars are the bottleneck though which all changes occur
 	const char *data = s;
 	if (!readOnly) {
@@ -435,33 +838,18 @@ const char *CellBuffer::InsertString(int position, const char *s, int insertLeng
 	return data;
 }
 
-bool CellBuffer::SetStyleAt(int position, char styleValue) {
-	char curVal = style.ValueAt(position);
-	if (curVal != styleValue) {
-		style.SetValueAt(position, styleValue);
-		return true;
-	} else {
-		return false;
-	}
+bool CellBuffer::SetStyleAt(Sci::Position position, char styleValue) {
+	return style.FillRange(position, styleValue, 1);
 }
 
-bool CellBuffer::SetStyleFor(int position, int lengthStyle, char styleValue) {
-	bool changed = false;
+bool CellBuffer::SetStyleFor(Sci::Position position, Sci::Position lengthStyle, char styleValue) {
 	PLATFORM_ASSERT(lengthStyle == 0 ||
 		(lengthStyle > 0 && lengthStyle + position <= style.Length()));
-	while (lengthStyle--) {
-		char curVal = style.ValueAt(position);
-		if (curVal != styleValue) {
-			style.SetValueAt(position, styleValue);
-			changed = true;
-		}
-		position++;
-	}
-	return changed;
+	return style.FillRange(position, styleValue, lengthStyle);
 }
 
 // The char* returned is to an allocation owned by the undo history
-const char *CellBuffer::DeleteChars(int position, int deleteLength, bool &startSequence) {
+const char *CellBuffer::DeleteChars(Sci::Position position, Sci::Position deleteLength, bool &startSequence) {
 	// InsertString and DeleteChars are the bottleneck though which all changes occur
 	PLATFORM_ASSERT(deleteLength > 0);
 	const char *data = 0;
@@ -478,13 +866,15 @@ const char *CellBuffer::DeleteChars(int position, int deleteLength, bool &startS
 	return data;
 }
 
-int CellBuffer::Length() const {
+Sci::Position CellBuffer::Length() const {
+	if (mappedBytes)
+		return lengthMapped;
 	return substance.Length();
 }
 
-void CellBuffer::Allocate(int newSize) {
+void CellBuffer::Allocate(Sci::Position newSize) {
 	substance.ReAllocate(newSize);
-	style.ReAllocate(newSize);
+	style.Allocate(newSize);
 }
 
 void CellBuffer::SetLineEndTypes(int utf8LineEnds_) {
@@ -502,7 +892,7 @@ int CellBuffer::Lines() const {
 	return lv.Lines();
 }
 
-int CellBuffer::LineStart(int line) const {
+Sci::Position CellBuffer::LineStart(int line) const {
 	if (line < 0)
 		return 0;
 	else if (line >= Lines())
@@ -516,7 +906,8 @@ bool CellBuffer::IsReadOnly() const {
 }
 
 void CellBuffer::SetReadOnly(bool set) {
-	readOnly = set;
+	// Mapped text can not be changed
+	readOnly = set || (mappedText != 0);
 }
 
 void CellBuffer::SetSavePoint() {
@@ -545,7 +936,7 @@ bool CellBuffer::TentativeActive() const {
 
 // Without undo
 
-void CellBuffer::InsertLine(int line, int position, bool lineStart) {
+void CellBuffer::InsertLine(int line, Sci::Position position, bool lineStart) {
 	lv.InsertLine(line, position, lineStart);
 }
 
@@ -553,7 +944,35 @@ void CellBuffer::RemoveLine(int line) {
 	lv.RemoveLine(line);
 }
 
-bool CellBuffer::UTF8LineEndOverlaps(int position) const {
+void CellBuffer::SetMappedText(IMappedText *mappedText_) {
+	PLATFORM_ASSERT(Length() == 0 && !mappedText);
+	mappedText = mappedText_;
+	mappedBytes = mappedText->Text();
+	lengthMapped = mappedText->Length();
+	style.InsertSpace(0, lengthMapped);
+	readOnly = true;
+	collectingUndo = false;
+	ResetLineEnds();
+}
+
+int CellBuffer::IndexLines(int waitMilliseconds) {
+	if (!indexer)
+		return 0;
+	std::vector<Sci::Position> starts;
+	const bool finished = indexer->Take(starts, waitMilliseconds);
+	const int lines = static_cast<int>(starts.size());
+	if (lines > 0) {
+		// The new lines follow all the lines already known
+		lv.InsertLines(lv.Lines(), &starts[0], lines, false);
+	}
+	if (finished) {
+		delete indexer;
+		indexer = 0;
+	}
+	return lines;
+}
+
+bool CellBuffer::UTF8LineEndOverlaps(Sci::Position position) const {
 	unsigned char bytes[] = {
 		static_cast<unsigned char>(substance.ValueAt(position-2)),
 		static_cast<unsigned char>(substance.ValueAt(position-1)),
@@ -563,43 +982,139 @@ bool CellBuffer::UTF8LineEndOverlaps(int position) const {
 	return UTF8IsSeparator(bytes) || UTF8IsSeparator(bytes+1) || UTF8IsNEL(bytes+1);
 }
 
-void CellBuffer::ResetLineEnds() {
-	// Reinitialize line data -- too much work to preserve
-	lv.Init();
+// Return the position of the first byte from start that may end a line: CR, LF and, when
+// utf8LineEnds is set, the last bytes of NEL, LS and PS. Return length when there is none.
+static Sci::Position NextLineEndCandidate(const char *s, Sci::Position start, Sci::Position length, bool utf8LineEnds) {
+	Sci::Position i = start;
+#ifdef CELLBUFFER_SSE2
+	// Skip blocks of 16 bytes without any candidates then find the candidate with the scalar loop
+	const __m128i cr = _mm_set1_epi8('\r');
+	const __m128i lf = _mm_set1_epi8('\n');
+	const __m128i nel = _mm_set1_epi8(static_cast<char>(0x85));
+	const __m128i separator = _mm_set1_epi8(static_cast<char>(0xa8));
+	const __m128i separatorMask = _mm_set1_epi8(static_cast<char>(0xfe));	// 0xa8 and 0xa9 differ in bit 0
+	for (; i + 16 <= length; i += 16) {
+		const __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s + i));
+		__m128i found = _mm_or_si128(_mm_cmpeq_epi8(block, cr), _mm_cmpeq_epi8(block, lf));
+		if (utf8LineEnds) {
+			found = _mm_or_si128(found, _mm_cmpeq_epi8(block, nel));
+			found = _mm_or_si128(found, _mm_cmpeq_epi8(_mm_and_si128(block, separatorMask), separator));
+		}
+		if (_mm_movemask_epi8(found))
+			break;
+	}
+#endif
+	for (; i < length; i++) {
+		const unsigned char ch = s[i];
+		if ((ch == '\r') || (ch == '\n'))
+			return i;
+		if (utf8LineEnds && ((ch == 0x85) || (ch == 0xa8) || (ch == 0xa9)))
+			return i;
+	}
+	return length;
+}
+
+// Append the positions after the line ends in s from start up to end to starts. Unlike
+// InsertLineStarts, the bytes around the range are available in s so no state is carried
+// from one range to the next.
+static void FindLineStarts(const char *s, Sci::Position start, Sci::Position end, Sci::Position length,
+	bool utf8LineEnds, std::vector<Sci::Position> &starts) {
+	Sci::Position i = start;
+	while ((i = NextLineEndCandidate(s, i, end, utf8LineEnds)) < end) {
+		const unsigned char ch = s[i];
+		bool lineEnd = false;
+		if (ch == '\r') {
+			// The line of a CR followed by LF ends at the LF
+			lineEnd = (i + 1 >= length) || (s[i + 1] != '\n');
+		} else if (ch == '\n') {
+			lineEnd = true;
+		} else {
+			const unsigned char back3[3] = {
+				static_cast<unsigned char>((i >= 2) ? s[i - 2] : 0),
+				static_cast<unsigned char>((i >= 1) ? s[i - 1] : 0),
+				ch};
+			lineEnd = UTF8IsSeparator(back3) || UTF8IsNEL(back3 + 1);
+		}
+		if (lineEnd)
+			starts.push_back(i + 1);
+		i++;
+	}
+}
 
-	int position = 0;
-	int length = Length();
-	int lineInsert = 1;
-	bool atLineStart = true;
-	lv.InsertText(lineInsert-1, length);
-	unsigned char chBeforePrev = 0;
-	unsigned char chPrev = 0;
-	for (int i = 0; i < length; i++) {
-		unsigned char ch = substance.ValueAt(position + i);
+// Add the line starts after the line ends in s which is being inserted at position.
+// chBeforePrev and chPrev are the two bytes before s and are updated to the last two
+// bytes of s. Line starts are collected and added in batches as adding them one at a
+// time is slow for large insertions. Returns the line after the last line added.
+int CellBuffer::InsertLineStarts(int lineInsert, Sci::Position position, const char *s, Sci::Position length, bool atLineStart,
+	unsigned char &chBeforePrev, unsigned char &chPrev) {
+	enum { batchSize = 1024 };
+	Sci::Position starts[batchSize];
+	int batched = 0;
+	Sci::Position i = 0;
+	while (i < length) {
+		const Sci::Position iEnd = NextLineEndCandidate(s, i, length, utf8LineEnds != 0);
+		if (iEnd > i) {
+			// Bytes skipped over may be the start of a UTF-8 line end
+			chBeforePrev = (iEnd - i >= 2) ? s[iEnd - 2] : chPrev;
+			chPrev = s[iEnd - 1];
+			if (iEnd == length)
+				break;
+		}
+		i = iEnd;
+		const unsigned char ch = s[i];
+		bool lineEnd = false;
 		if (ch == '\r') {
-			InsertLine(lineInsert, (position + i) + 1, atLineStart);
-			lineInsert++;
+			lineEnd = true;
 		} else if (ch == '\n') {
 			if (chPrev == '\r') {
 				// Patch up what was end of line
-				lv.SetLineStart(lineInsert - 1, (position + i) + 1);
+				if (batched > 0)
+					starts[batched - 1] = (position + i) + 1;
+				else
+					lv.SetLineStart(lineInsert - 1, (position + i) + 1);
 			} else {
-				InsertLine(lineInsert, (position + i) + 1, atLineStart);
-				lineInsert++;
+				lineEnd = true;
 			}
 		} else if (utf8LineEnds) {
 			unsigned char back3[3] = {chBeforePrev, chPrev, ch};
-			if (UTF8IsSeparator(back3) || UTF8IsNEL(back3+1)) {
-				InsertLine(lineInsert, (position + i) + 1, atLineStart);
-				lineInsert++;
+			lineEnd = UTF8IsSeparator(back3) || UTF8IsNEL(back3+1);
+		}
+		if (lineEnd) {
+			if (batched == batchSize) {
+				lv.InsertLines(lineInsert - batched, starts, batched, atLineStart);
+				batched = 0;
 			}
+			starts[batched++] = (position + i) + 1;
+			lineInsert++;
 		}
 		chBeforePrev = chPrev;
 		chPrev = ch;
+		i++;
+	}
+	if (batched > 0)
+		lv.InsertLines(lineInsert - batched, starts, batched, atLineStart);
+	return lineInsert;
+}
+
+void CellBuffer::ResetLineEnds() {
+	// Reinitialize line data -- too much work to preserve
+	lv.Init();
+
+	Sci::Position length = Length();
+	int lineInsert = 1;
+	lv.InsertText(lineInsert-1, length);
+	if (mappedBytes) {
+		// Find the lines again in the background
+		delete indexer;
+		indexer = new LineIndexer(mappedBytes, lengthMapped, utf8LineEnds != 0);
+		return;
 	}
+	unsigned char chBeforePrev = 0;
+	unsigned char chPrev = 0;
+	InsertLineStarts(lineInsert, 0, substance.RangePointer(0, length), length, true, chBeforePrev, chPrev);
 }
 
-void CellBuffer::BasicInsertString(int position, const char *s, int insertLength) {
+void CellBuffer::BasicInsertString(Sci::Position position, const char *s, Sci::Position insertLength) {
 	if (insertLength == 0)
 		return;
 	PLATFORM_ASSERT(insertLength > 0);
@@ -611,7 +1126,7 @@ void CellBuffer::BasicInsertString(int position, const char *s, int insertLength
 	}
 
 	substance.InsertFromArray(position, s, 0, insertLength);
-	style.InsertValue(position, insertLength, 0);
+	style.InsertSpace(position, insertLength);
 
 	int lineInsert = lv.LineFromPosition(position) + 1;
 	bool atLineStart = lv.LineStart(lineInsert-1) == position;
@@ -627,30 +1142,8 @@ void CellBuffer::BasicInsertString(int position, const char *s, int insertLength
 	if (breakingUTF8LineEnd) {
 		RemoveLine(lineInsert);
 	}
-	unsigned char ch = ' ';
-	for (int i = 0; i < insertLength; i++) {
-		ch = s[i];
-		if (ch == '\r') {
-			InsertLine(lineInsert, (position + i) + 1, atLineStart);
-			lineInsert++;
-		} else if (ch == '\n') {
-			if (chPrev == '\r') {
-				// Patch up what was end of line
-				lv.SetLineStart(lineInsert - 1, (position + i) + 1);
-			} else {
-				InsertLine(lineInsert, (position + i) + 1, atLineStart);
-				lineInsert++;
-			}
-		} else if (utf8LineEnds) {
-			unsigned char back3[3] = {chBeforePrev, chPrev, ch};
-			if (UTF8IsSeparator(back3) || UTF8IsNEL(back3+1)) {
-				InsertLine(lineInsert, (position + i) + 1, atLineStart);
-				lineInsert++;
-			}
-		}
-		chBeforePrev = chPrev;
-		chPrev = ch;
-	}
+	lineInsert = InsertLineStarts(lineInsert, position, s, insertLength, atLineStart, chBeforePrev, chPrev);
+	const unsigned char ch = s[insertLength - 1];
 	// Joining two lines where last insertion is cr and following substance starts with lf
 	if (chAfter == '\n') {
 		if (ch == '\r') {
@@ -676,7 +1169,7 @@ void CellBuffer::BasicInsertString(int position, const char *s, int insertLength
 	}
 }
 
-void CellBuffer::BasicDeleteChars(int position, int deleteLength) {
+void CellBuffer::BasicDeleteChars(Sci::Position position, Sci::Position deleteLength) {
 	if (deleteLength == 0)
 		return;
 
@@ -707,7 +1200,7 @@ void CellBuffer::BasicDeleteChars(int position, int deleteLength) {
 		}
 
 		unsigned char ch = chNext;
-		for (int i = 0; i < deleteLength; i++) {
+		for (Sci::Position i = 0; i < deleteLength; i++) {
 			chNext = substance.ValueAt(position + i + 1);
 			if (ch == '\r') {
 				if (chNext != '\n') {
@@ -771,6 +1264,14 @@ void CellBuffer::DeleteUndoHistory() {
 	uh.DeleteUndoHistory();
 }
 
+void CellBuffer::SetUndoMemoryLimit(size_t limit) {
+	uh.SetMemoryLimit(limit);
+}
+
+size_t CellBuffer::UndoMemoryLimit() const {
+	return uh.MemoryLimit();
+}
+
 bool CellBuffer::CanUndo() const {
 	return uh.CanUndo();
 }
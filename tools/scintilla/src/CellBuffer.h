@@ -12,12 +12,18 @@
 namespace Scintilla {
 #endif
 
+class IMappedText;
+class LineIndexer;
+class RunStyles;
+
 // Interface to per-line data that wants to see each line insertion and deletion
 class PerLine {
 public:
 	virtual ~PerLine() {}
 	virtual void Init()=0;
 	virtual void InsertLine(int line)=0;
+	/// Same as calling InsertLine for each of lines consecutive lines starting at line
+	virtual void InsertLines(int line, int lines)=0;
 	virtual void RemoveLine(int line)=0;
 };
 
@@ -36,15 +42,16 @@ public:
 	void Init();
 	void SetPerLine(PerLine *pl);
 
-	void InsertText(int line, int delta);
-	void InsertLine(int line, int position, bool lineStart);
-	void SetLineStart(int line, int position);
+	void InsertText(int line, Sci::Position delta);
+	void InsertLine(int line, Sci::Position position, bool lineStart);
+	void InsertLines(int line, const Sci::Position *positions, int lines, bool lineStart);
+	void SetLineStart(int line, Sci::Position position);
 	void RemoveLine(int line);
 	int Lines() const {
 		return starts.Partitions();
 	}
-	int LineFromPosition(int pos) const;
-	int LineStart(int line) const {
+	int LineFromPosition(Sci::Position pos) const;
+	Sci::Position LineStart(int line) const {
 		return starts.PositionFromPartition(line);
 	}
 
@@ -73,16 +80,39 @@ enum actionType { insertAction, removeAction, startAction, containerAction };
 class Action {
 public:
 	actionType at;
-	int position;
-	char *data;
-	int lenData;
 	bool mayCoalesce;
+	Sci::Position position;
+	const char *data;	///< Owned by the UndoArena of the history
+	Sci::Position lenData;
 
 	Action();
-	~Action();
-	void Create(actionType at_, int position_=0, const char *data_=0, int lenData_=0, bool mayCoalesce_=true);
-	void Destroy();
-	void Grab(Action *source);
+	void Create(actionType at_, Sci::Position position_=0, const char *data_=0, Sci::Position lenData_=0, bool mayCoalesce_=true);
+};
+
+/**
+ * Holds the text of undo actions in large chunks which are only added to at the end so that
+ * each action does not need its own allocation. The text of the actions is in the same order
+ * as the actions so discarding the newest or oldest actions frees the end or start.
+ */
+class UndoArena {
+	struct Chunk;
+	Chunk *first;
+	Chunk *last;
+	size_t used;
+
+	// Private so UndoArena objects can not be copied
+	UndoArena(const UndoArena &);
+	UndoArena &operator=(const UndoArena &);
+
+public:
+	UndoArena();
+	~UndoArena();
+	char *Allocate(Sci::Position length);
+	/// Discard everything after end or everything when end is NULL.
+	void TruncateAfter(const char *end);
+	/// Free the chunks before the one containing start or every chunk when start is NULL.
+	void DiscardBefore(const char *start);
+	size_t Used() const;
 };
 
 /**
@@ -96,8 +126,11 @@ class UndoHistory {
 	int undoSequenceDepth;
 	int savePoint;
 	int tentativePoint;
+	UndoArena arena;
+	size_t memoryLimit;
 
 	void EnsureUndoRoom();
+	void LimitMemory();
 
 	// Private so UndoHistory objects can not be copied
 	UndoHistory(const UndoHistory &);
@@ -106,13 +139,20 @@ public:
 	UndoHistory();
 	~UndoHistory();
 
-	const char *AppendAction(actionType at, int position, const char *data, int length, bool &startSequence, bool mayCoalesce=true);
+	const char *AppendAction(actionType at, Sci::Position position, const char *data, Sci::Position length, bool &startSequence, bool mayCoalesce=true);
 
 	void BeginUndoAction();
 	void EndUndoAction();
 	void DropUndoSequence();
 	void DeleteUndoHistory();
 
+	/// Approximate memory used by the actions and their text.
+	size_t Memory() const;
+	/// When the memory used exceeds the limit, the oldest user operations are discarded.
+	/// A limit of 0 keeps the whole history.
+	void SetMemoryLimit(size_t limit);
+	size_t MemoryLimit() const { return memoryLimit; }
+
 	/// The save point is a marker in the undo stack where the container has stated that
 	/// the buffer was saved. Undo and redo can move over the save point.
 	void SetSavePoint();
@@ -136,6 +176,37 @@ public:
 	void CompletedRedoStep();
 };
 
+/**
+ * The style of each character. Nothing is stored while every style is 0 so unstyled text
+ * costs no memory. Styles are then held as runs and change to one byte per character when
+ * the runs become too short for that to save memory. The bytes only reach as far as the last
+ * position with a style other than 0.
+ */
+class StyleBuffer {
+public:
+	enum Storage { stNone, stRuns, stBytes };
+	StyleBuffer();
+	~StyleBuffer();
+	Storage GetStorage() const;
+	Sci::Position Length() const;
+	char ValueAt(Sci::Position position) const;
+	void GetRange(char *buffer, Sci::Position position, Sci::Position retrieveLength) const;
+	/// @return true if any style is changed.
+	bool FillRange(Sci::Position position, char value, Sci::Position fillLength);
+	void InsertSpace(Sci::Position position, Sci::Position insertLength);
+	void DeleteRange(Sci::Position position, Sci::Position deleteLength);
+	void Allocate(Sci::Position newSize);
+private:
+	Sci::Position length;
+	RunStyles *runs;
+	SplitVector<char> *bytes;
+	void FreeStorage();
+	void ChangeToBytes();
+	// Private so StyleBuffer objects can not be copied
+	StyleBuffer(const StyleBuffer &);
+	StyleBuffer &operator=(const StyleBuffer &);
+};
+
 /**
  * Holder for an expandable array of characters that supports undo and line markers.
  * Based on article "Data Structures in a Bit-Mapped Text Editor"
@@ -144,7 +215,7 @@ public:
 class CellBuffer {
 private:
 	SplitVector<char> substance;
-	SplitVector<char> style;
+	StyleBuffer style;
 	bool readOnly;
 	int utf8LineEnds;
 
@@ -153,11 +224,20 @@ private:
 
 	LineVector lv;
 
-	bool UTF8LineEndOverlaps(int position) const;
+	/// Read only text owned by the container which is used instead of substance
+	IMappedText *mappedText;
+	const char *mappedBytes;
+	Sci::Position lengthMapped;
+	/// Finds the line ends of mappedText, NULL once they have all been added to lv
+	LineIndexer *indexer;
+
+	bool UTF8LineEndOverlaps(Sci::Position position) const;
+	int InsertLineStarts(int lineInsert, Sci::Position position, const char *s, Sci::Position length, bool atLineStart,
+		unsigned char &chBeforePrev, unsigned char &chPrev);
 	void ResetLineEnds();
 	/// Actions without undo
-	void BasicInsertString(int position, const char *s, int insertLength);
-	void BasicDeleteChars(int position, int deleteLength);
+	void BasicInsertString(Sci::Position position, const char *s, Sci::Position insertLength);
+	void BasicDeleteChars(Sci::Position position, Sci::Position deleteLength);
 
 public:
 
@@ -165,32 +245,42 @@ public:
 	~CellBuffer();
 
 	/// Retrieving positions outside the range of the buffer works and returns 0
-	char CharAt(int position) const;
-	void GetCharRange(char *buffer, int position, int lengthRetrieve) const;
-	char StyleAt(int position) const;
-	void GetStyleRange(unsigned char *buffer, int position, int lengthRetrieve) const;
+	char CharAt(Sci::Position position) const;
+	void GetCharRange(char *buffer, Sci::Position position, Sci::Position lengthRetrieve) const;
+	char StyleAt(Sci::Position position) const;
+	void GetStyleRange(unsigned char *buffer, Sci::Position position, Sci::Position lengthRetrieve) const;
 	const char *BufferPointer();
-	const char *RangePointer(int position, int rangeLength);
-	int GapPosition() const;
+	const char *RangePointer(Sci::Position position, Sci::Position rangeLength);
+	Sci::Position GapPosition() const;
 
-	int Length() const;
-	void Allocate(int newSize);
+	Sci::Position Length() const;
+	void Allocate(Sci::Position newSize);
 	int GetLineEndTypes() const { return utf8LineEnds; }
 	void SetLineEndTypes(int utf8LineEnds_);
 	void SetPerLine(PerLine *pl);
 	int Lines() const;
-	int LineStart(int line) const;
-	int LineFromPosition(int pos) const { return lv.LineFromPosition(pos); }
-	void InsertLine(int line, int position, bool lineStart);
+	Sci::Position LineStart(int line) const;
+	int LineFromPosition(Sci::Position pos) const { return lv.LineFromPosition(pos); }
+	void InsertLine(int line, Sci::Position position, bool lineStart);
 	void RemoveLine(int line);
-	const char *InsertString(int position, const char *s, int insertLength, bool &startSequence);
+
+	/// Show text from the container without copying it. The buffer must be empty and becomes
+	/// read only. Lines are found in the background and added by calls to IndexLines.
+	void SetMappedText(IMappedText *mappedText_);
+	bool IsMapped() const { return mappedText != 0; }
+	bool IndexingLines() const { return indexer != 0; }
+	/// Add the lines found since the last call, waiting up to waitMilliseconds for more.
+	/// @return the number of lines added.
+	int IndexLines(int waitMilliseconds);
+
+	const char *InsertString(Sci::Position position, const char *s, Sci::Position insertLength, bool &startSequence);
 
 	/// Setting styles for positions outside the range of the buffer is safe and has no effect.
 	/// @return true if the style of a character is changed.
-	bool SetStyleAt(int position, char styleValue);
-	bool SetStyleFor(int position, int length, char styleValue);
+	bool SetStyleAt(Sci::Position position, char styleValue);
+	bool SetStyleFor(Sci::Position position, Sci::Position length, char styleValue);
 
-	const char *DeleteChars(int position, int deleteLength, bool &startSequence);
+	const char *DeleteChars(Sci::Position position, Sci::Position deleteLength, bool &startSequence);
 
 	bool IsReadOnly() const;
 	void SetReadOnly(bool set);
@@ -211,6 +301,8 @@ public:
 	void EndUndoAction();
 	void AddUndoAction(int token, bool mayCoalesce);
 	void DeleteUndoHistory();
+	void SetUndoMemoryLimit(size_t limit);
+	size_t UndoMemoryLimit() const;
 
 	/// To perform an undo, StartUndo is called to retrieve the number of steps, then UndoStep is
 	/// called that many times. Similarly for redo.
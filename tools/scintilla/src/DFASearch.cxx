@@ -0,0 +1,823 @@
+// Scintilla source code edit control
+/** @file DFASearch.cxx
+ ** Linear time regular expression search for the RESearch syntax.
+ **/
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include "CharClassify.h"
+#include "RESearch.h"
+#include "DFASearch.h"
+
+#ifdef SCI_NAMESPACE
+using namespace Scintilla;
+#endif
+
+namespace {
+
+// Number of DFA states kept for a pattern before giving up on the DFA for that pattern.
+const size_t dfaStateMax = 2000;
+
+enum OpCode {
+	opChar,		// Match the character x
+	opSet,		// Match a character in sets[x]
+	opAny,		// Match any character
+	opSplit,	// Continue at x, or with lower priority at y
+	opJump,		// Continue at x
+	opSave,		// Record position in tag slot x
+	opBOL,
+	opEOL,
+	opBOW,
+	opEOW,
+	opMatch
+};
+
+struct Instruction {
+	OpCode op;
+	int x;
+	int y;
+	Instruction(OpCode op_, int x_=0, int y_=0) : op(op_), x(x_), y(y_) {}
+};
+
+struct CharSet {
+	unsigned char bits[MAXCHR / CHRBIT];
+	CharSet() {
+		memset(bits, 0, sizeof(bits));
+	}
+	void Add(unsigned char ch) {
+		bits[ch >> 3] |= static_cast<unsigned char>(1 << (ch & 7));
+	}
+	void AddWithCase(unsigned char ch, bool caseSensitive) {
+		Add(ch);
+		if (!caseSensitive) {
+			if ((ch >= 'a') && (ch <= 'z'))
+				Add(static_cast<unsigned char>(ch - 'a' + 'A'));
+			else if ((ch >= 'A') && (ch <= 'Z'))
+				Add(static_cast<unsigned char>(ch - 'A' + 'a'));
+		}
+	}
+	void Invert() {
+		for (size_t i = 0; i < sizeof(bits); i++)
+			bits[i] = static_cast<unsigned char>(~bits[i]);
+	}
+	bool Contains(unsigned char ch) const {
+		return (bits[ch >> 3] & (1 << (ch & 7))) != 0;
+	}
+};
+
+enum Closure { closureNone, closureStar, closurePlus, closureQuest };
+
+// An element of the pattern before it is turned into instructions.
+struct Piece {
+	OpCode op;
+	int value;
+	Closure closure;
+	bool lazy;
+	Piece(OpCode op_, int value_=0) : op(op_), value(value_), closure(closureNone), lazy(false) {}
+	bool Consumes() const {
+		return op == opChar || op == opSet || op == opAny;
+	}
+};
+
+int HexaDigit(unsigned char hd) {
+	if (hd >= '0' && hd <= '9')
+		return hd - '0';
+	else if (hd >= 'A' && hd <= 'F')
+		return hd - 'A' + 10;
+	else if (hd >= 'a' && hd <= 'f')
+		return hd - 'a' + 10;
+	return -1;
+}
+
+int HexaChar(unsigned char hd1, unsigned char hd2) {
+	const int high = HexaDigit(hd1);
+	const int low = HexaDigit(hd2);
+	if (high < 0 || low < 0)
+		return -1;
+	return high * 16 + low;
+}
+
+}
+
+class DFASearch::Program {
+public:
+	std::string pattern;
+	bool caseSensitive;
+	bool posix;
+	CharSet wordChars;
+
+	std::vector<Instruction> code;
+	std::vector<CharSet> sets;
+	bool anchored;
+	bool eolOnly;
+
+	Program(const std::string &pattern_, bool caseSensitive_, bool posix_, const CharSet &wordChars_) :
+		pattern(pattern_), caseSensitive(caseSensitive_), posix(posix_), wordChars(wordChars_),
+		anchored(false), eolOnly(false), dfaDisabled(false), stamp(0) {
+	}
+	~Program() {
+		ClearStates();
+	}
+	bool Same(const std::string &pattern_, bool caseSensitive_, bool posix_, const CharSet &wordChars_) const {
+		return (pattern == pattern_) && (caseSensitive == caseSensitive_) && (posix == posix_) &&
+			(memcmp(wordChars.bits, wordChars_.bits, sizeof(wordChars.bits)) == 0);
+	}
+	const char *Compile();
+	bool MayMatch(CharacterIndexer &ci, int lp, int endp);
+	bool Match(CharacterIndexer &ci, int lp, int endp, int *bopat, int *eopat);
+
+private:
+	// Lazy DFA
+	struct State {
+		std::vector<int> pcs;
+		bool match;
+		int next[MAXCHR];
+		explicit State(const std::vector<int> &pcs_) : pcs(pcs_), match(false) {
+			std::fill(next, next + MAXCHR, -1);
+		}
+	};
+	std::vector<State *> states;
+	std::map<std::vector<int>, int> stateIndex;
+	bool dfaDisabled;
+
+	// Pike VM
+	struct Thread {
+		int pc;
+		int caps[MAXTAG * 2];
+	};
+	struct ThreadList {
+		std::vector<Thread> threads;
+		std::vector<unsigned int> marks;
+		unsigned int stamp;
+	};
+	unsigned int stamp;
+	ThreadList lists[2];
+
+	bool IsWord(unsigned char ch) const {
+		return wordChars.Contains(ch);
+	}
+	void ChSet(CharSet &set, const char *pattern, int &incr, int &result) const;
+	bool Matches(const Instruction &ins, unsigned char ch) const;
+	void Emit(const std::vector<Piece> &pieces);
+
+	void ClearStates();
+	void AddClosure(std::vector<int> &pcs, std::vector<bool> &seen, int pc) const;
+	int StateFor(std::vector<int> &pcs);
+	int Transition(int state, unsigned char ch);
+
+	void StartList(ThreadList &list);
+	void AddThread(ThreadList &list, int pc, int pos, int *caps,
+		CharacterIndexer &ci, int bol, int endp);
+};
+
+/**
+ * Interpret the expression after a backslash as GetBackslashExpression in RESearch does.
+ * Sets result to the character or -1 when a character class was added to set.
+ */
+void DFASearch::Program::ChSet(CharSet &set, const char *p, int &incr, int &result) const {
+	incr = 0;
+	result = -1;
+	const unsigned char bsc = *p;
+	if (!bsc) {
+		result = '\\';
+		return;
+	}
+	int c;
+	switch (bsc) {
+	case 'a':	result = '\a';	break;
+	case 'b':	result = '\b';	break;
+	case 'f':	result = '\f';	break;
+	case 'n':	result = '\n';	break;
+	case 'r':	result = '\r';	break;
+	case 't':	result = '\t';	break;
+	case 'v':	result = '\v';	break;
+	case 'x': {
+			const int hexValue = HexaChar(p[1], p[1] ? p[2] : 0);
+			if (hexValue >= 0) {
+				result = hexValue;
+				incr = 2;
+			} else {
+				result = 'x';
+			}
+		}
+		break;
+	case 'd':
+		for (c = '0'; c <= '9'; c++)
+			set.Add(static_cast<unsigned char>(c));
+		break;
+	case 'D':
+		for (c = 0; c < MAXCHR; c++) {
+			if (c < '0' || c > '9')
+				set.Add(static_cast<unsigned char>(c));
+		}
+		break;
+	case 's':
+		set.Add(' ');
+		set.Add('\t');
+		set.Add('\n');
+		set.Add('\r');
+		set.Add('\f');
+		set.Add('\v');
+		break;
+	case 'S':
+		for (c = 0; c < MAXCHR; c++) {
+			if (c != ' ' && !(c >= 0x09 && c <= 0x0D))
+				set.Add(static_cast<unsigned char>(c));
+		}
+		break;
+	case 'w':
+		for (c = 0; c < MAXCHR; c++) {
+			if (IsWord(static_cast<unsigned char>(c)))
+				set.Add(static_cast<unsigned char>(c));
+		}
+		break;
+	case 'W':
+		for (c = 0; c < MAXCHR; c++) {
+			if (!IsWord(static_cast<unsigned char>(c)))
+				set.Add(static_cast<unsigned char>(c));
+		}
+		break;
+	default:
+		result = bsc;
+	}
+}
+
+/**
+ * Parse the pattern following the rules of RESearch::Compile into pieces and emit them.
+ * Returns the same messages as RESearch for malformed patterns.
+ */
+const char *DFASearch::Program::Compile() {
+	std::vector<Piece> pieces;
+	int tagstk[MAXTAG];
+	int tagi = 0;
+	int tagc = 1;
+	const int length = static_cast<int>(pattern.length());
+	const char *start = pattern.c_str();
+	const char *p = start;
+	for (int i=0; i<length; i++, p++) {
+		switch (*p) {
+
+		case '.':
+			pieces.push_back(Piece(opAny));
+			break;
+
+		case '^':
+			if (p == start)
+				pieces.push_back(Piece(opBOL));
+			else
+				pieces.push_back(Piece(opChar, '^'));
+			break;
+
+		case '$':
+			if (!*(p+1))
+				pieces.push_back(Piece(opEOL));
+			else
+				pieces.push_back(Piece(opChar, '$'));
+			break;
+
+		case '[': {
+				CharSet set;
+				int prevChar = 0;
+				bool invert = false;
+				i++;
+				if (*++p == '^') {
+					invert = true;
+					i++;
+					p++;
+				}
+				if (*p == '-') {
+					i++;
+					prevChar = *p;
+					set.Add(*p++);
+				}
+				if (*p == ']') {
+					i++;
+					prevChar = *p;
+					set.Add(*p++);
+				}
+				while (*p && *p != ']') {
+					if (*p == '-') {
+						if (prevChar < 0) {
+							prevChar = *p;
+							set.Add(*p);
+						} else if (*(p+1)) {
+							if (*(p+1) != ']') {
+								int c1 = prevChar + 1;
+								i++;
+								int c2 = static_cast<unsigned char>(*++p);
+								if (c2 == '\\') {
+									if (!*(p+1))
+										return "Missing ]";
+									i++;
+									p++;
+									int incr;
+									ChSet(set, p, incr, c2);
+									i += incr;
+									p += incr;
+									if (c2 >= 0) {
+										set.Add(static_cast<unsigned char>(c2));
+										prevChar = c2;
+									} else {
+										prevChar = -1;
+									}
+								}
+								if (prevChar < 0) {
+									prevChar = '-';
+									set.Add('-');
+								} else {
+									while (c1 <= c2)
+										set.AddWithCase(static_cast<unsigned char>(c1++), caseSensitive);
+								}
+							} else {
+								prevChar = *p;
+								set.Add(*p);
+							}
+						} else {
+							return "Missing ]";
+						}
+					} else if (*p == '\\' && *(p+1)) {
+						i++;
+						p++;
+						int incr;
+						int c;
+						ChSet(set, p, incr, c);
+						i += incr;
+						p += incr;
+						if (c >= 0) {
+							set.Add(static_cast<unsigned char>(c));
+							prevChar = c;
+						} else {
+							prevChar = -1;
+						}
+					} else {
+						prevChar = static_cast<unsigned char>(*p);
+						set.AddWithCase(*p, caseSensitive);
+					}
+					i++;
+					p++;
+				}
+				if (!*p)
+					return "Missing ]";
+				if (invert)
+					set.Invert();
+				sets.push_back(set);
+				pieces.push_back(Piece(opSet, static_cast<int>(sets.size() - 1)));
+			}
+			break;
+
+		case '*':
+		case '+':
+		case '?':
+			if (p == start)
+				return "Empty closure";
+			if (pieces.empty() || !pieces.back().Consumes())
+				return "Illegal closure";
+			if (pieces.back().closure != closureNone) {
+				// Repeated closures are equivalent to the first apart from ?? being lazy
+				if (*p == '?' && pieces.back().closure == closureQuest)
+					pieces.back().lazy = true;
+				break;
+			}
+			if (*p == '?') {
+				pieces.back().closure = closureQuest;
+			} else {
+				pieces.back().closure = (*p == '*') ? closureStar : closurePlus;
+				pieces.back().lazy = *(p+1) == '?';
+			}
+			break;
+
+		case '\\':
+			i++;
+			switch (*++p) {
+			case '<':
+				pieces.push_back(Piece(opBOW));
+				break;
+			case '>':
+				if (!pieces.empty() && pieces.back().op == opBOW)
+					return "Null pattern inside \\<\\>";
+				pieces.push_back(Piece(opEOW));
+				break;
+			case '1':
+			case '2':
+			case '3':
+			case '4':
+			case '5':
+			case '6':
+			case '7':
+			case '8':
+			case '9':
+				return "Back references not supported";
+			default:
+				if (!posix && (*p == '(' || *p == ')')) {
+					if (*p == '(') {
+						if (tagc >= MAXTAG)
+							return "Too many \\(\\) pairs";
+						tagstk[++tagi] = tagc;
+						pieces.push_back(Piece(opSave, tagc++ * 2));
+					} else {
+						if (!pieces.empty() && pieces.back().op == opSave && (pieces.back().value % 2 == 0))
+							return "Null pattern inside \\(\\)";
+						if (tagi <= 0)
+							return "Unmatched \\)";
+						pieces.push_back(Piece(opSave, tagstk[tagi--] * 2 + 1));
+					}
+				} else {
+					int incr;
+					int c;
+					CharSet set;
+					ChSet(set, p, incr, c);
+					i += incr;
+					p += incr;
+					if (c >= 0) {
+						pieces.push_back(Piece(opChar, static_cast<unsigned char>(c)));
+					} else {
+						sets.push_back(set);
+						pieces.push_back(Piece(opSet, static_cast<int>(sets.size() - 1)));
+					}
+				}
+			}
+			break;
+
+		default:
+			if (posix && (*p == '(' || *p == ')')) {
+				if (*p == '(') {
+					if (tagc >= MAXTAG)
+						return "Too many () pairs";
+					tagstk[++tagi] = tagc;
+					pieces.push_back(Piece(opSave, tagc++ * 2));
+				} else {
+					if (!pieces.empty() && pieces.back().op == opSave && (pieces.back().value % 2 == 0))
+						return "Null pattern inside ()";
+					if (tagi <= 0)
+						return "Unmatched )";
+					pieces.push_back(Piece(opSave, tagstk[tagi--] * 2 + 1));
+				}
+			} else {
+				unsigned char c = *p;
+				if (!c)
+					c = '\\';
+				if (caseSensitive || !IsWord(c)) {
+					pieces.push_back(Piece(opChar, c));
+				} else {
+					CharSet set;
+					set.AddWithCase(c, false);
+					sets.push_back(set);
+					pieces.push_back(Piece(opSet, static_cast<int>(sets.size() - 1)));
+				}
+			}
+			break;
+		}
+	}
+	if (tagi > 0)
+		return posix ? "Unmatched (" : "Unmatched \\(";
+	Emit(pieces);
+	return 0;
+}
+
+void DFASearch::Program::Emit(const std::vector<Piece> &pieces) {
+	anchored = !pieces.empty() && (pieces.front().op == opBOL);
+	eolOnly = (pieces.size() == 1) && (pieces.front().op == opEOL);
+	for (std::vector<Piece>::const_iterator it = pieces.begin(); it != pieces.end(); ++it) {
+		const Instruction atom(it->op, it->value);
+		const int pc = static_cast<int>(code.size());
+		switch (it->closure) {
+		case closureNone:
+			code.push_back(atom);
+			break;
+		case closureStar:
+			// pc: split pc+1, pc+3; pc+1: atom; pc+2: jump pc
+			code.push_back(it->lazy ? Instruction(opSplit, pc + 3, pc + 1) : Instruction(opSplit, pc + 1, pc + 3));
+			code.push_back(atom);
+			code.push_back(Instruction(opJump, pc));
+			break;
+		case closurePlus:
+			// pc: atom; pc+1: split pc, pc+2
+			code.push_back(atom);
+			code.push_back(it->lazy ? Instruction(opSplit, pc + 2, pc) : Instruction(opSplit, pc, pc + 2));
+			break;
+		case closureQuest:
+			// pc: split pc+1, pc+2; pc+1: atom
+			code.push_back(it->lazy ? Instruction(opSplit, pc + 2, pc + 1) : Instruction(opSplit, pc + 1, pc + 2));
+			code.push_back(atom);
+			break;
+		}
+	}
+	code.push_back(Instruction(opMatch));
+}
+
+bool DFASearch::Program::Matches(const Instruction &ins, unsigned char ch) const {
+	switch (ins.op) {
+	case opChar:
+		return ch == ins.x;
+	case opSet:
+		return sets[ins.x].Contains(ch);
+	case opAny:
+		return true;
+	default:
+		return false;
+	}
+}
+
+void DFASearch::Program::ClearStates() {
+	for (std::vector<State *>::iterator it = states.begin(); it != states.end(); ++it)
+		delete *it;
+	states.clear();
+	stateIndex.clear();
+}
+
+/// Add pc and everything reachable from it without consuming a character. Tags and
+/// assertions are treated as always passing so the DFA may report matches that are not.
+void DFASearch::Program::AddClosure(std::vector<int> &pcs, std::vector<bool> &seen, int pc) const {
+	if (seen[pc])
+		return;
+	seen[pc] = true;
+	const Instruction &ins = code[pc];
+	switch (ins.op) {
+	case opSplit:
+		AddClosure(pcs, seen, ins.x);
+		AddClosure(pcs, seen, ins.y);
+		break;
+	case opJump:
+		AddClosure(pcs, seen, ins.x);
+		break;
+	case opSave:
+	case opBOL:
+	case opEOL:
+	case opBOW:
+	case opEOW:
+		AddClosure(pcs, seen, pc + 1);
+		break;
+	default:
+		pcs.push_back(pc);
+	}
+}
+
+int DFASearch::Program::StateFor(std::vector<int> &pcs) {
+	std::sort(pcs.begin(), pcs.end());
+	std::map<std::vector<int>, int>::const_iterator it = stateIndex.find(pcs);
+	if (it != stateIndex.end())
+		return it->second;
+	if (states.size() >= dfaStateMax) {
+		// Pattern needs too many states so stop using the DFA for it
+		dfaDisabled = true;
+		ClearStates();
+		return -1;
+	}
+	State *state = new State(pcs);
+	for (std::vector<int>::const_iterator pc = pcs.begin(); pc != pcs.end(); ++pc) {
+		if (code[*pc].op == opMatch)
+			state->match = true;
+	}
+	const int index = static_cast<int>(states.size());
+	states.push_back(state);
+	stateIndex[pcs] = index;
+	return index;
+}
+
+int DFASearch::Program::Transition(int state, unsigned char ch) {
+	std::vector<int> pcs;
+	std::vector<bool> seen(code.size());
+	const std::vector<int> &current = states[state]->pcs;
+	for (std::vector<int>::const_iterator pc = current.begin(); pc != current.end(); ++pc) {
+		if (Matches(code[*pc], ch))
+			AddClosure(pcs, seen, *pc + 1);
+	}
+	if (!anchored) {
+		// A match may start at any position
+		AddClosure(pcs, seen, 0);
+	}
+	const int next = StateFor(pcs);
+	if (next >= 0)
+		states[state]->next[ch] = next;
+	return next;
+}
+
+/**
+ * Returns false when there is certainly no match starting in lp..endp.
+ */
+bool DFASearch::Program::MayMatch(CharacterIndexer &ci, int lp, int endp) {
+	if (dfaDisabled)
+		return true;
+	if (states.empty()) {
+		std::vector<int> pcs;
+		std::vector<bool> seen(code.size());
+		AddClosure(pcs, seen, 0);
+		if (StateFor(pcs) < 0)
+			return true;
+	}
+	int state = 0;
+	for (int pos = lp; pos < endp; pos++) {
+		if (states[state]->match)
+			return true;
+		const unsigned char ch = ci.CharAt(pos);
+		int next = states[state]->next[ch];
+		if (next < 0) {
+			next = Transition(state, ch);
+			if (next < 0)
+				return true;
+		}
+		state = next;
+		if (states[state]->pcs.empty())
+			return false;
+	}
+	return states[state]->match;
+}
+
+void DFASearch::Program::StartList(ThreadList &list) {
+	list.threads.clear();
+	if (list.marks.size() != code.size())
+		list.marks.assign(code.size(), 0);
+	list.stamp = ++stamp;
+	if (stamp == 0) {
+		// Wrapped around so forget all marks
+		std::fill(lists[0].marks.begin(), lists[0].marks.end(), 0);
+		std::fill(lists[1].marks.begin(), lists[1].marks.end(), 0);
+		list.stamp = stamp = 1;
+	}
+}
+
+void DFASearch::Program::AddThread(ThreadList &list, int pc, int pos, int *caps,
+	CharacterIndexer &ci, int bol, int endp) {
+	if (list.marks[pc] == list.stamp)
+		return;
+	list.marks[pc] = list.stamp;
+	const Instruction &ins = code[pc];
+	switch (ins.op) {
+	case opSplit:
+		AddThread(list, ins.x, pos, caps, ci, bol, endp);
+		AddThread(list, ins.y, pos, caps, ci, bol, endp);
+		break;
+	case opJump:
+		AddThread(list, ins.x, pos, caps, ci, bol, endp);
+		break;
+	case opSave: {
+			const int saved = caps[ins.x];
+			caps[ins.x] = pos;
+			AddThread(list, pc + 1, pos, caps, ci, bol, endp);
+			caps[ins.x] = saved;
+		}
+		break;
+	case opBOL:
+		if (pos == bol)
+			AddThread(list, pc + 1, pos, caps, ci, bol, endp);
+		break;
+	case opEOL:
+		if (pos >= endp)
+			AddThread(list, pc + 1, pos, caps, ci, bol, endp);
+		break;
+	case opBOW:
+		if (!((pos != bol && IsWord(ci.CharAt(pos - 1))) || !IsWord(ci.CharAt(pos))))
+			AddThread(list, pc + 1, pos, caps, ci, bol, endp);
+		break;
+	case opEOW:
+		if (!(pos == bol || !IsWord(ci.CharAt(pos - 1)) || IsWord(ci.CharAt(pos))))
+			AddThread(list, pc + 1, pos, caps, ci, bol, endp);
+		break;
+	default: {
+			Thread thread;
+			thread.pc = pc;
+			std::copy(caps, caps + MAXTAG * 2, thread.caps);
+			list.threads.push_back(thread);
+		}
+	}
+}
+
+/**
+ * Find the match RESearch would: the earliest starting position in lp..endp-1 (only lp
+ * when anchored) and, from there, the first match in backtracking order. Threads are kept
+ * in backtracking priority order so the first thread to match beats all those after it.
+ */
+bool DFASearch::Program::Match(CharacterIndexer &ci, int lp, int endp, int *bopat, int *eopat) {
+	ThreadList *clist = &lists[0];
+	ThreadList *nlist = &lists[1];
+	StartList(*clist);
+	int caps[MAXTAG * 2];
+	int capsMatch[MAXTAG * 2];
+	bool matched = false;
+	for (int pos = lp; ; pos++) {
+		if (!matched && (anchored ? (pos == lp) : (pos < endp))) {
+			std::fill(caps, caps + MAXTAG * 2, NOTFOUND);
+			caps[0] = pos;
+			AddThread(*clist, 0, pos, caps, ci, lp, endp);
+		}
+		if (clist->threads.empty() && (matched || anchored || (pos >= endp)))
+			break;
+		const bool atEnd = pos >= endp;
+		const unsigned char ch = atEnd ? 0 : static_cast<unsigned char>(ci.CharAt(pos));
+		StartList(*nlist);
+		for (size_t t = 0; t < clist->threads.size(); t++) {
+			const Thread &thread = clist->threads[t];
+			const Instruction &ins = code[thread.pc];
+			if (ins.op == opMatch) {
+				std::copy(thread.caps, thread.caps + MAXTAG * 2, capsMatch);
+				capsMatch[1] = pos;
+				matched = true;
+				// Lower priority threads can not produce the match
+				break;
+			}
+			if (!atEnd && Matches(ins, ch)) {
+				std::copy(thread.caps, thread.caps + MAXTAG * 2, caps);
+				AddThread(*nlist, thread.pc + 1, pos + 1, caps, ci, lp, endp);
+			}
+		}
+		std::swap(clist, nlist);
+		if (atEnd)
+			break;
+	}
+	if (!matched)
+		return false;
+	for (int i = 0; i < MAXTAG; i++) {
+		bopat[i] = capsMatch[i * 2];
+		eopat[i] = capsMatch[i * 2 + 1];
+	}
+	return true;
+}
+
+DFASearch::DFASearch(CharClassify *charClassTable) : charClass(charClassTable), program(0) {
+	Clear();
+}
+
+DFASearch::~DFASearch() {
+	for (std::vector<Program *>::iterator it = cache.begin(); it != cache.end(); ++it)
+		delete *it;
+}
+
+void DFASearch::Clear() {
+	for (int i = 0; i < MAXTAG; i++) {
+		pat[i].clear();
+		bopat[i] = NOTFOUND;
+		eopat[i] = NOTFOUND;
+	}
+}
+
+void DFASearch::GrabMatches(CharacterIndexer &ci) {
+	for (unsigned int i = 0; i < MAXTAG; i++) {
+		if ((bopat[i] != NOTFOUND) && (eopat[i] != NOTFOUND)) {
+			unsigned int len = eopat[i] - bopat[i];
+			pat[i].resize(len);
+			for (unsigned int j = 0; j < len; j++)
+				pat[i][j] = ci.CharAt(bopat[i] + j);
+		}
+	}
+}
+
+const char *DFASearch::Compile(const char *pattern, int length, bool caseSensitive, bool posix) {
+	if (!pattern || !length) {
+		if (program)
+			return 0;
+		else
+			return "No previous regular expression";
+	}
+	program = 0;
+
+	// Word characters are part of the key as they change \w, \<, \> and case folding
+	CharSet wordChars;
+	for (int ch = 0; ch < MAXCHR; ch++) {
+		if (charClass->IsWord(static_cast<unsigned char>(ch)))
+			wordChars.Add(static_cast<unsigned char>(ch));
+	}
+	const std::string sPattern(pattern, length);
+	for (std::vector<Program *>::iterator it = cache.begin(); it != cache.end(); ++it) {
+		if ((*it)->Same(sPattern, caseSensitive, posix, wordChars)) {
+			program = *it;
+			cache.erase(it);
+			cache.insert(cache.begin(), program);
+			return 0;
+		}
+	}
+
+	Program *compiled = new Program(sPattern, caseSensitive, posix, wordChars);
+	const char *errmsg = compiled->Compile();
+	if (errmsg) {
+		delete compiled;
+		return errmsg;
+	}
+	if (cache.size() >= cacheSize) {
+		delete cache.back();
+		cache.pop_back();
+	}
+	cache.insert(cache.begin(), compiled);
+	program = compiled;
+	return 0;
+}
+
+int DFASearch::Execute(CharacterIndexer &ci, int lp, int endp) {
+	Clear();
+	if (!program)
+		return 0;
+	if (program->eolOnly) {
+		// Matches the end of the range even when empty, as RESearch does
+		bopat[0] = endp;
+		eopat[0] = endp;
+		return 1;
+	}
+	if (!program->MayMatch(ci, lp, endp))
+		return 0;
+	return program->Match(ci, lp, endp, bopat, eopat) ? 1 : 0;
+}
@@ -0,0 +1,55 @@
+// Scintilla source code edit control
+/** @file DFASearch.h
+ ** Linear time regular expression search for the RESearch syntax.
+ **/
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef DFASEARCH_H
+#define DFASEARCH_H
+
+#ifdef SCI_NAMESPACE
+namespace Scintilla {
+#endif
+
+/**
+ * Accepts the same expressions as RESearch, apart from back references, and has the
+ * same interface so can be used in its place.
+ * Patterns are compiled into a Thompson NFA which is run as a Pike VM so each character
+ * is examined once whatever the pattern. Before that, a lazily built DFA which ignores
+ * tags and assertions checks whether the range could match so most ranges are rejected
+ * with a table lookup per character.
+ * Recently compiled patterns, along with their DFA states, are kept for reuse.
+ */
+class DFASearch {
+public:
+	explicit DFASearch(CharClassify *charClassTable);
+	~DFASearch();
+	void Clear();
+	void GrabMatches(CharacterIndexer &ci);
+	const char *Compile(const char *pattern, int length, bool caseSensitive, bool posix);
+	int Execute(CharacterIndexer &ci, int lp, int endp);
+
+	enum { MAXTAG=10 };
+	enum { NOTFOUND=-1 };
+	enum { cacheSize=8 };
+
+	int bopat[MAXTAG];
+	int eopat[MAXTAG];
+	std::string pat[MAXTAG];
+
+private:
+	class Program;
+	CharClassify *charClass;
+	std::vector<Program *> cache;	// Most recently used first
+	Program *program;
+
+	// Private so DFASearch objects can not be copied
+	DFASearch(const DFASearch &);
+	DFASearch &operator=(const DFASearch &);
+};
+
+#ifdef SCI_NAMESPACE
+}
+#endif
+
+#endif
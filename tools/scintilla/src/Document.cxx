@@ -10,6 +10,7 @@
 #include <stdio.h>
 #include <assert.h>
 #include <ctype.h>
+#include <limits.h>
 
 #include <stdexcept>
 #include <string>
@@ -26,6 +27,7 @@
 #include "Scintilla.h"
 
 #include "CharacterSet.h"
+#include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
 #include "RunStyles.h"
@@ -35,7 +37,10 @@
 #include "Decoration.h"
 #include "CaseFolder.h"
 #include "Document.h"
+#include "SegmentCache.h"
 #include "RESearch.h"
+#include "DFASearch.h"
+#include "LiteralSearch.h"
 #include "UniConversion.h"
 
 #ifdef SCI_NAMESPACE
@@ -99,6 +104,7 @@ Document::Document() {
 	styleClock = 0;
 	enteredModification = 0;
 	enteredStyling = 0;
+	durationStyleOneLine = 0.00001;
 	enteredReadOnlyCount = 0;
 	insertionSet = false;
 	tabInChars = 8;
@@ -111,6 +117,8 @@ Document::Document() {
 	matchesValid = false;
 	regex = 0;
 
+	segmentCache = new SegmentCache();
+
 	UTF8BytesOfLeadInitialise();
 
 	perLineData[ldMarkers] = new LineMarkers();
@@ -134,6 +142,8 @@ Document::~Document() {
 	}
 	delete regex;
 	regex = 0;
+	delete segmentCache;
+	segmentCache = 0;
 	delete pli;
 	pli = 0;
 	delete pcf;
@@ -188,6 +198,13 @@ void Document::InsertLine(int line) {
 	}
 }
 
+void Document::InsertLines(int line, int lines) {
+	for (int j=0; j<ldSize; j++) {
+		if (perLineData[j])
+			perLineData[j]->InsertLines(line, lines);
+	}
+}
+
 void Document::RemoveLine(int line) {
 	for (int j=0; j<ldSize; j++) {
 		if (perLineData[j])
@@ -1010,6 +1027,11 @@ int Document::InsertString(int position, const char *s, int insertLength) {
 		s = insertion.c_str();
 		insertLength = static_cast<int>(insertion.length());
 	}
+	// Positions are int so the document can not grow beyond INT_MAX bytes
+	if (insertLength > INT_MAX - Length()) {
+		enteredModification--;
+		return 0;
+	}
 	NotifyModified(
 		DocModification(
 			SC_MOD_BEFOREINSERT | SC_PERFORMED_USER,
@@ -1039,9 +1061,27 @@ void Document::ChangeInsertion(const char *s, int length) {
 	insertion.assign(s, length);
 }
 
+// Show text mapped by the container without copying it. The document becomes read only.
+void Document::SetMappedText(IMappedText *mappedText) {
+	cb.SetMappedText(mappedText);
+	decorations.InsertSpace(0, Length());
+}
+
+// Add lines found in mapped text in the background, notifying watchers of the new lines.
+int Document::IndexLines(int waitMilliseconds) {
+	const int linesBefore = LinesTotal();
+	const int linesAdded = cb.IndexLines(waitMilliseconds);
+	if (linesAdded > 0) {
+		NotifyModified(DocModification(SC_MOD_LINESINDEXED, LineStart(linesBefore), 0, linesAdded, 0, linesBefore));
+	}
+	return linesAdded;
+}
+
 int SCI_METHOD Document::AddData(char *data, int length) {
 	try {
 		int position = Length();
+		if (length > INT_MAX - position)
+			return SC_STATUS_BADALLOC;
 		InsertString(position, data, length);
 	} catch (std::bad_alloc &) {
 		return SC_STATUS_BADALLOC;
@@ -1586,6 +1626,60 @@ bool Document::MatchesWordOptions(bool word, bool wordStart, int pos, int length
 			(wordStart && IsWordStartAt(pos));
 }
 
+/**
+ * Whether the character iteration used by searching stops at pos.
+ * Only for single byte and UTF-8 documents.
+ */
+bool Document::IsCharacterStart(int pos) const {
+	if (SC_CP_UTF8 == dbcsCodePage)
+		return !UTF8IsTrailByte(static_cast<unsigned char>(cb.CharAt(pos))) ||
+			(MovePositionOutsideChar(pos, 1, false) == pos);
+	return true;
+}
+
+/**
+ * Find the first match (or last when searching backwards) that starts between
+ * minMatch and maxMatch inclusive. The two halves of the gap buffer are searched in place
+ * and only the starting positions of matches that would straddle the gap are checked
+ * a byte at a time.
+ */
+int Document::FindLiteral(const LiteralSearch &literal, int minMatch, int maxMatch, bool forward) {
+	const int lengthFind = literal.Length();
+	const int gap = cb.GapPosition();
+	const int before = 0;
+	const int straddle = 1;
+	const int after = 2;
+	const int ranges[3][2] = {
+		{ minMatch, Platform::Minimum(maxMatch, gap - lengthFind) },
+		{ Platform::Maximum(minMatch, gap - lengthFind + 1), Platform::Minimum(maxMatch, gap - 1) },
+		{ Platform::Maximum(minMatch, gap), maxMatch },
+	};
+	for (int step = 0; step < 3; step++) {
+		const int part = forward ? (before + step) : (after - step);
+		const int first = ranges[part][0];
+		const int last = ranges[part][1];
+		if (first > last)
+			continue;
+		if (part == straddle) {
+			for (int i = 0; i <= last - first; i++) {
+				const int pos = forward ? (first + i) : (last - i);
+				int indexSearch = 0;
+				while ((indexSearch < lengthFind) && (cb.CharAt(pos + indexSearch) == literal.Needle()[indexSearch]))
+					indexSearch++;
+				if (indexSearch == lengthFind)
+					return pos;
+			}
+		} else {
+			const int lengthText = last - first + lengthFind;
+			const char *text = cb.RangePointer(first, lengthText);
+			const int index = forward ? literal.FindForward(text, lengthText) : literal.FindBackward(text, lengthText);
+			if (index >= 0)
+				return first + index;
+		}
+	}
+	return -1;
+}
+
 bool Document::HasCaseFolder(void) const {
 	return pcf != 0;
 }
@@ -1614,6 +1708,93 @@ Document::CharacterExtracted Document::ExtractCharacter(int position) const {
 	}
 }
 
+/**
+ * Case folded copy of a run of whole characters from a UTF-8 document so that case
+ * insensitive search can scan it with LiteralSearch. Characters are folded one at a time
+ * exactly as the character by character search did so matches are the same.
+ * For each folded byte, the document position of the character whose folding starts
+ * there is recorded, or -1 for the following bytes of the same folding.
+ */
+class FoldedChunk {
+	const CellBuffer &cb;
+	CaseFolder *pcf;
+	std::vector<char> folded;
+	std::vector<int> positions;
+	// Foldings of single byte characters, which are most characters, to avoid calling pcf
+	char foldedByte[256];
+	bool byteFoldsToByte[256];
+	bool reachedLimit;
+public:
+	FoldedChunk(const CellBuffer &cb_, CaseFolder *pcf_) : cb(cb_), pcf(pcf_), reachedLimit(false) {
+		for (int ch = 0; ch < 256; ch++) {
+			const char mixed = static_cast<char>(ch);
+			char chFolded[UTF8MaxBytes * 4 + 1];
+			byteFoldsToByte[ch] = pcf->Fold(chFolded, sizeof(chFolded), &mixed, 1) == 1;
+			foldedByte[ch] = chFolded[0];
+		}
+	}
+	/// Fold characters from start until at least lengthWanted bytes have been produced or
+	/// the next character would extend past limit.
+	void Fold(int start, int limit, size_t lengthWanted) {
+		folded.clear();
+		positions.clear();
+		reachedLimit = false;
+		int pos = start;
+		char bytes[UTF8MaxBytes + 1];
+		char chFolded[UTF8MaxBytes * 4 + 1];
+		while (folded.size() < lengthWanted) {
+			const unsigned char leadByte = static_cast<unsigned char>(cb.CharAt(pos));
+			bytes[0] = leadByte;
+			int widthChar = 1;
+			if (!UTF8IsAscii(leadByte)) {
+				const int widthCharBytes = UTF8BytesOfLead[leadByte];
+				for (int b=1; b<widthCharBytes; b++) {
+					bytes[b] = cb.CharAt(pos+b);
+				}
+				widthChar = UTF8Classify(reinterpret_cast<const unsigned char *>(bytes), widthCharBytes) & UTF8MaskWidth;
+			}
+			if ((pos + widthChar) > limit) {
+				reachedLimit = true;
+				break;
+			}
+			if ((widthChar == 1) && byteFoldsToByte[leadByte]) {
+				folded.push_back(foldedByte[leadByte]);
+				positions.push_back(pos);
+			} else {
+				const size_t lenFlat = pcf->Fold(chFolded, sizeof(chFolded), bytes, widthChar);
+				for (size_t i = 0; i < lenFlat; i++) {
+					folded.push_back(chFolded[i]);
+					positions.push_back((i == 0) ? pos : -1);
+				}
+			}
+			pos += widthChar;
+		}
+		// Entry for the end so matches finishing at the end of the chunk can be measured
+		positions.push_back(pos);
+	}
+	const char *Text() const {
+		return folded.empty() ? "" : &folded[0];
+	}
+	int Length() const {
+		return static_cast<int>(folded.size());
+	}
+	bool ReachedLimit() const {
+		return reachedLimit;
+	}
+	/// Document position of the character whose folding starts at index or -1.
+	int Position(int index) const {
+		return positions[index];
+	}
+	/// Document position of the first character whose folding starts after index.
+	int PositionAfter(int index) const {
+		for (int i = index + 1; i < static_cast<int>(positions.size()); i++) {
+			if (positions[i] >= 0)
+				return positions[i];
+		}
+		return positions.back();
+	}
+};
+
 /**
  * Find text in document, supporting both forward and backward
  * searches (just pass minPos > maxPos to do a backward search)
@@ -1647,7 +1828,24 @@ long Document::FindText(int minPos, int maxPos, const char *search,
 			// Back all of a character
 			pos = NextPosition(pos, increment);
 		}
-		if (caseSensitive) {
+		if (caseSensitive && (!dbcsCodePage || (SC_CP_UTF8 == dbcsCodePage))) {
+			// Match starts are limited to the positions that the character iteration below
+			// would visit and the match must end within the range.
+			LiteralSearch literal(search, lengthFind);
+			int minMatch = forward ? startPos : endPos;
+			int maxMatch = forward ? (endPos - lengthFind) : Platform::Minimum(pos, startPos - lengthFind);
+			while (minMatch <= maxMatch) {
+				const int posMatch = FindLiteral(literal, minMatch, maxMatch, forward);
+				if (posMatch < 0)
+					break;
+				if (IsCharacterStart(posMatch) && MatchesWordOptions(word, wordStart, posMatch, lengthFind))
+					return posMatch;
+				if (forward)
+					minMatch = posMatch + 1;
+				else
+					maxMatch = posMatch - 1;
+			}
+		} else if (caseSensitive) {
 			const int endSearch = (startPos <= endPos) ? endPos - lengthFind + 1 : endPos;
 			const char charStartSearch =  search[0];
 			while (forward ? (pos < endSearch) : (pos >= endSearch)) {
@@ -1664,54 +1862,68 @@ long Document::FindText(int minPos, int maxPos, const char *search,
 					break;
 			}
 		} else if (SC_CP_UTF8 == dbcsCodePage) {
+			// Fold a chunk of the document at a time and search the folded text for the
+			// folded search string. Matches must start and end on character boundaries.
 			const size_t maxFoldingExpansion = 4;
 			std::vector<char> searchThing(lengthFind * UTF8MaxBytes * maxFoldingExpansion + 1);
 			const int lenSearch = static_cast<int>(
 				pcf->Fold(&searchThing[0], searchThing.size(), search, lengthFind));
-			char bytes[UTF8MaxBytes + 1];
-			char folded[UTF8MaxBytes * maxFoldingExpansion + 1];
-			while (forward ? (pos < endPos) : (pos >= endPos)) {
-				int widthFirstCharacter = 0;
-				int posIndexDocument = pos;
-				int indexSearch = 0;
-				bool characterMatches = true;
-				for (;;) {
-					const unsigned char leadByte = static_cast<unsigned char>(cb.CharAt(posIndexDocument));
-					bytes[0] = leadByte;
-					int widthChar = 1;
-					if (!UTF8IsAscii(leadByte)) {
-						const int widthCharBytes = UTF8BytesOfLead[leadByte];
-						for (int b=1; b<widthCharBytes; b++) {
-							bytes[b] = cb.CharAt(posIndexDocument+b);
+			if (lenSearch <= 0)
+				return -1;
+			LiteralSearch literal(&searchThing[0], lenSearch);
+			FoldedChunk chunk(cb, pcf);
+			// Forwards, chunks are lengthChunk folded bytes. Backwards, they are lengthChunk
+			// document bytes which, as every character folds to at least one byte, always
+			// reaches back past the characters needed to complete matches from the chunk before.
+			const int lengthChunk = 0x10000 + lenSearch * UTF8MaxBytes;
+			if (forward) {
+				int chunkStart = pos;
+				while (chunkStart < endPos) {
+					chunk.Fold(chunkStart, limitPos, lengthChunk);
+					int index = 0;
+					for (;;) {
+						const int found = literal.FindForward(chunk.Text() + index, chunk.Length() - index);
+						if (found < 0)
+							break;
+						const int indexMatch = index + found;
+						const int posMatch = chunk.Position(indexMatch);
+						const int posEnd = chunk.Position(indexMatch + lenSearch);
+						if ((posMatch >= 0) && (posEnd >= 0) &&
+							MatchesWordOptions(word, wordStart, posMatch, posEnd - posMatch)) {
+							*length = posEnd - posMatch;
+							return posMatch;
 						}
-						widthChar = UTF8Classify(reinterpret_cast<const unsigned char *>(bytes), widthCharBytes) & UTF8MaskWidth;
+						index = indexMatch + 1;
 					}
-					if (!widthFirstCharacter)
-						widthFirstCharacter = widthChar;
-					if ((posIndexDocument + widthChar) > limitPos)
-						break;
-					const int lenFlat = static_cast<int>(pcf->Fold(folded, sizeof(folded), bytes, widthChar));
-					folded[lenFlat] = 0;
-					// Does folded match the buffer
-					characterMatches = 0 == memcmp(folded, &searchThing[0] + indexSearch, lenFlat);
-					if (!characterMatches)
-						break;
-					posIndexDocument += widthChar;
-					indexSearch += lenFlat;
-					if (indexSearch >= lenSearch)
+					if (chunk.ReachedLimit())
 						break;
+					// Continue from the first character that could not be completed in this chunk
+					chunkStart = chunk.PositionAfter(chunk.Length() - lenSearch);
 				}
-				if (characterMatches && (indexSearch == static_cast<int>(lenSearch))) {
-					if (MatchesWordOptions(word, wordStart, pos, posIndexDocument - pos)) {
-						*length = posIndexDocument - pos;
-						return pos;
+			} else {
+				int chunkEnd = limitPos;
+				for (;;) {
+					const int chunkStart = MovePositionOutsideChar(
+						Platform::Maximum(endPos, chunkEnd - lengthChunk), -1, false);
+					chunk.Fold(chunkStart, chunkEnd, (chunkEnd - chunkStart) * UTF8MaxBytes * maxFoldingExpansion + 1);
+					int lengthSearched = chunk.Length();
+					for (;;) {
+						const int indexMatch = literal.FindBackward(chunk.Text(), lengthSearched);
+						if (indexMatch < 0)
+							break;
+						const int posMatch = chunk.Position(indexMatch);
+						const int posEnd = chunk.Position(indexMatch + lenSearch);
+						if ((posMatch >= 0) && (posEnd >= 0) &&
+							MatchesWordOptions(word, wordStart, posMatch, posEnd - posMatch)) {
+							*length = posEnd - posMatch;
+							return posMatch;
+						}
+						lengthSearched = indexMatch + lenSearch - 1;
 					}
-				}
-				if (forward) {
-					pos += widthFirstCharacter;
-				} else {
-					if (!NextCharacter(pos, increment))
+					if (chunkStart <= endPos)
 						break;
+					// Matches starting before this chunk may need the characters folded at its start
+					chunkEnd = chunk.PositionAfter(lenSearch - 1);
 				}
 			}
 		} else if (dbcsCodePage) {
@@ -1864,6 +2076,32 @@ void Document::EnsureStyledTo(int pos) {
 	}
 }
 
+// Style to pos while measuring how long styling takes so callers can limit the amount
+// of text styled in one go.
+void Document::StyleToAdjustingLineDuration(int pos) {
+	// Bound the duration so a glitch does not make styling very slow or non-responsive
+	const double minDurationOneLine = 0.000001;
+	const double maxDurationOneLine = 0.0001;
+	// Exponential smoothing with the most recent value contributing 25%
+	const double alpha = 0.25;
+
+	const int lineFirst = LineFromPosition(GetEndStyled());
+	ElapsedTime etStyling;
+	EnsureStyledTo(pos);
+	const double durationStyling = etStyling.Duration();
+	const int lineLast = LineFromPosition(GetEndStyled());
+	if (lineLast >= lineFirst + 8) {
+		// Only adjust after styling several lines to avoid instability
+		const double durationOneLine = durationStyling / (lineLast - lineFirst);
+		durationStyleOneLine = alpha * durationOneLine + (1.0 - alpha) * durationStyleOneLine;
+		if (durationStyleOneLine < minDurationOneLine) {
+			durationStyleOneLine = minDurationOneLine;
+		} else if (durationStyleOneLine > maxDurationOneLine) {
+			durationStyleOneLine = maxDurationOneLine;
+		}
+	}
+}
+
 void Document::LexerChanged() {
 	// Tell the watchers the lexer has changed.
 	for (std::vector<WatcherWithUserData>::iterator it = watchers.begin(); it != watchers.end(); ++it) {
@@ -2189,7 +2427,7 @@ int Document::BraceMatch(int position, int /*maxReStyle*/) {
  */
 class BuiltinRegex : public RegexSearchBase {
 public:
-	explicit BuiltinRegex(CharClassify *charClassTable) : search(charClassTable) {}
+	explicit BuiltinRegex(CharClassify *charClassTable) : search(charClassTable), dfaSearch(charClassTable) {}
 
 	virtual ~BuiltinRegex() {
 	}
@@ -2202,6 +2440,7 @@ public:
 
 private:
 	RESearch search;
+	DFASearch dfaSearch;
 	std::string substituted;
 };
 
@@ -2633,27 +2872,11 @@ long Cxx11RegexFindText(Document *doc, int minPos, int maxPos, const char *s,
 
 #endif
 
-}
-
-long BuiltinRegex::FindText(Document *doc, int minPos, int maxPos, const char *s,
-                        bool caseSensitive, bool, bool, int flags,
-                        int *length) {
-
-#ifdef CXX11_REGEX
-	if (flags & SCFIND_CXX11REGEX) {
-			return Cxx11RegexFindText(doc, minPos, maxPos, s,
-			caseSensitive, length, search);
-	}
-#endif
-
-	const RESearchRange resr(doc, minPos, maxPos);
-
-	const bool posix = (flags & SCFIND_POSIX) != 0;
-
-	const char *errmsg = search.Compile(s, *length, caseSensitive, posix);
-	if (errmsg) {
-		return -1;
-	}
+/**
+ * Search each line of the range with a RESearch or DFASearch that has compiled s.
+ */
+template <typename Search>
+long FindInLines(Search &search, Document *doc, const RESearchRange &resr, int minPos, const char *s, int *length) {
 	// Find a variable in a property file: \$(\([A-Za-z0-9_.]+\))
 	// Replace first '.' with '-' in each property file variable reference:
 	//     Search: \$(\([A-Za-z0-9_-]+\)\.\([A-Za-z0-9_.]+\))
@@ -2719,6 +2942,42 @@ long BuiltinRegex::FindText(Document *doc, int minPos, int maxPos, const char *s
 	return pos;
 }
 
+}
+
+long BuiltinRegex::FindText(Document *doc, int minPos, int maxPos, const char *s,
+                        bool caseSensitive, bool, bool, int flags,
+                        int *length) {
+
+#ifdef CXX11_REGEX
+	if (flags & SCFIND_CXX11REGEX) {
+			return Cxx11RegexFindText(doc, minPos, maxPos, s,
+			caseSensitive, length, search);
+	}
+#endif
+
+	const RESearchRange resr(doc, minPos, maxPos);
+
+	const bool posix = (flags & SCFIND_POSIX) != 0;
+
+	if (flags & SCFIND_DFAREGEX) {
+		// Patterns DFASearch can not handle, such as back references, use RESearch
+		if (!dfaSearch.Compile(s, *length, caseSensitive, posix)) {
+			const long pos = FindInLines(dfaSearch, doc, resr, minPos, s, length);
+			// Make the tags available for substitution
+			search.Clear();
+			std::copy(dfaSearch.bopat, dfaSearch.bopat + RESearch::MAXTAG, search.bopat);
+			std::copy(dfaSearch.eopat, dfaSearch.eopat + RESearch::MAXTAG, search.eopat);
+			return pos;
+		}
+	}
+
+	const char *errmsg = search.Compile(s, *length, caseSensitive, posix);
+	if (errmsg) {
+		return -1;
+	}
+	return FindInLines(search, doc, resr, minPos, s, length);
+}
+
 const char *BuiltinRegex::SubstituteByPosition(Document *doc, const char *text, int *length) {
 	substituted.clear();
 	DocumentIndexer di(doc, doc->Length());
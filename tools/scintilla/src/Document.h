@@ -89,6 +89,8 @@ public:
 class DocWatcher;
 class DocModification;
 class Document;
+class LiteralSearch;
+class SegmentCache;
 
 /**
  * Interface class for regular expression searching
@@ -232,6 +234,8 @@ private:
 	bool matchesValid;
 	RegexSearchBase *regex;
 
+	SegmentCache *segmentCache;
+
 public:
 
 	LexInterface *pli;
@@ -246,6 +250,7 @@ public:
 	bool useTabs;
 	bool tabIndents;
 	bool backspaceUnindents;
+	double durationStyleOneLine;	///< Smoothed seconds taken to style one line
 
 	DecorationList decorations;
 
@@ -255,6 +260,9 @@ public:
 	int AddRef();
 	int SCI_METHOD Release();
 
+	/// Positions of long segments of text, shared by the views of the document
+	SegmentCache *SegmentWidths() const { return segmentCache; }
+
 	virtual void Init();
 	int LineEndTypesSupported() const;
 	bool SetDBCSCodePage(int dbcsCodePage_);
@@ -262,6 +270,7 @@ public:
 	bool SetLineEndTypesAllowed(int lineEndBitSet_);
 	int GetLineEndTypesActive() const { return cb.GetLineEndTypes(); }
 	virtual void InsertLine(int line);
+	virtual void InsertLines(int line, int lines);
 	virtual void RemoveLine(int line);
 
 	int SCI_METHOD Version() const {
@@ -302,6 +311,8 @@ public:
 		return cb.SetUndoCollection(collectUndo);
 	}
 	bool IsCollectingUndo() const { return cb.IsCollectingUndo(); }
+	void SetUndoMemoryLimit(size_t limit) { cb.SetUndoMemoryLimit(limit); }
+	size_t UndoMemoryLimit() const { return cb.UndoMemoryLimit(); }
 	void BeginUndoAction() { cb.BeginUndoAction(); }
 	void EndUndoAction() { cb.EndUndoAction(); }
 	void AddUndoAction(int token, bool mayCoalesce) { cb.AddUndoAction(token, mayCoalesce); }
@@ -368,7 +379,10 @@ public:
 	int NextWordStart(int pos, int delta);
 	int NextWordEnd(int pos, int delta);
 	int SCI_METHOD Length() const { return cb.Length(); }
-	void Allocate(int newSize) { cb.Allocate(newSize); }
+	void Allocate(Sci::Position newSize) { cb.Allocate(newSize); }
+	void SetMappedText(IMappedText *mappedText);
+	bool IndexingLines() const { return cb.IndexingLines(); }
+	int IndexLines(int waitMilliseconds);
 
 	struct CharacterExtracted {
 		unsigned int character;
@@ -395,6 +409,7 @@ public:
 	bool SCI_METHOD SetStyles(int length, const char *styles);
 	int GetEndStyled() const { return endStyled; }
 	void EnsureStyledTo(int pos);
+	void StyleToAdjustingLineDuration(int pos);
 	void LexerChanged();
 	int GetStyleClock() const { return styleClock; }
 	void IncrementStyleClock();
@@ -439,6 +454,8 @@ private:
 	bool IsWordStartAt(int pos) const;
 	bool IsWordEndAt(int pos) const;
 	bool IsWordAt(int start, int end) const;
+	bool IsCharacterStart(int pos) const;
+	int FindLiteral(const LiteralSearch &literal, int minMatch, int maxMatch, bool forward);
 
 	void NotifyModifyAttempt();
 	void NotifySavePoint(bool atSavePoint);
@@ -16,6 +16,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <list>
 #include <algorithm>
 #include <memory>
 
@@ -25,6 +26,7 @@
 #include "Scintilla.h"
 
 #include "StringCopy.h"
+#include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
 #include "RunStyles.h"
@@ -249,6 +251,7 @@ int EditView::GetNextTabstop(int line, int x) const {
 }
 
 void EditView::LinesAddedOrRemoved(int lineOfPos, int linesAdded) {
+	llc.LinesAddedOrRemoved(lineOfPos, linesAdded);
 	if (ldTabstops) {
 		if (linesAdded > 0) {
 			for (int line = lineOfPos; line < lineOfPos + linesAdded; line++) {
@@ -344,7 +347,7 @@ LineLayout *EditView::RetrieveLineLayout(int lineNumber, const EditModel &model)
 	PLATFORM_ASSERT(posLineEnd >= posLineStart);
 	int lineCaret = model.pdoc->LineFromPosition(model.sel.MainCaret());
 	return llc.Retrieve(lineNumber, lineCaret,
-		posLineEnd - posLineStart, model.pdoc->GetStyleClock(),
+		posLineEnd - posLineStart,
 		model.LinesOnScreen() + 1, model.pdoc->LinesTotal());
 }
 
@@ -16,6 +16,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <list>
 #include <algorithm>
 #include <memory>
 
@@ -25,6 +26,7 @@
 #include "Scintilla.h"
 
 #include "StringCopy.h"
+#include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
 #include "RunStyles.h"
@@ -44,9 +46,11 @@
 #include "UniConversion.h"
 #include "Selection.h"
 #include "PositionCache.h"
+#include "SegmentCache.h"
 #include "EditModel.h"
 #include "MarginView.h"
 #include "EditView.h"
+#include "BackgroundWrap.h"
 #include "Editor.h"
 
 #ifdef SCI_NAMESPACE
@@ -172,6 +176,9 @@ Editor::Editor() {
 	paintAbandonedByStyling = false;
 	paintingAllText = false;
 	willRedrawAll = false;
+	idleStyling = SC_IDLESTYLING_NONE;
+	idleStylingBudget = 20;
+	needIdleStyling = false;
 
 	modEventMask = SC_MODEVENTMASKALL;
 
@@ -182,12 +189,23 @@ Editor::Editor() {
 
 	convertPastes = true;
 
+	wrapThreads = 0;
+	wrapWidths = new WrapWidths();
+	wrapQueue = 0;
+	wrapLineQueued = 0;
+	wrapCheckedStart = 0;
+	wrapCheckedEnd = 0;
+
 	SetRepresentations();
 }
 
 Editor::~Editor() {
 	pdoc->RemoveWatcher(this, 0);
 	DropGraphics(true);
+	delete wrapQueue;
+	wrapQueue = 0;
+	delete wrapWidths;
+	wrapWidths = 0;
 }
 
 void Editor::Finalise() {
@@ -197,6 +215,7 @@ void Editor::Finalise() {
 
 void Editor::SetRepresentations() {
 	reprs.Clear();
+	wrapWidths->Clear();
 
 	// C0 control set
 	const char *reps[] = {
@@ -255,6 +274,7 @@ void Editor::InvalidateStyleData() {
 	AllocateGraphics();
 	view.llc.Invalidate(LineLayout::llInvalid);
 	view.posCache.Clear();
+	wrapWidths->Clear();
 }
 
 void Editor::InvalidateStyleRedraw() {
@@ -847,7 +867,7 @@ void Editor::ScrollTo(int line, bool moveThumb) {
 		SetTopLine(topLineNew);
 		// Optimize by styling the view as this will invalidate any needed area
 		// which could abort the initial paint if discovered later.
-		StyleToPositionInView(PositionAfterArea(GetClientRectangle()));
+		StyleAreaBounded(GetClientRectangle(), true);
 #ifndef UNDER_CE
 		// Perform redraw rather than scroll if many lines would be redrawn anyway.
 		if (performBlit) {
@@ -1371,8 +1391,13 @@ bool Editor::Wrapping() const {
 void Editor::NeedWrapping(int docLineStart, int docLineEnd) {
 //Platform::DebugPrintf("\nNeedWrapping: %0d..%0d\n", docLineStart, docLineEnd);
 	if (wrapPending.AddRange(docLineStart, docLineEnd)) {
-		view.llc.Invalidate(LineLayout::llPositions);
+		view.llc.InvalidateLines(docLineStart, docLineEnd, LineLayout::llPositions);
 	}
+	// Results of background wrapping may no longer match the document
+	if (wrapQueue)
+		wrapQueue->Clear();
+	wrapCheckedStart = 0;
+	wrapCheckedEnd = 0;
 	// Wrap lines during idle.
 	if (Wrapping() && wrapPending.NeedsWrap()) {
 		SetIdle(true);
@@ -1409,6 +1434,8 @@ bool Editor::WrapLines(enum wrapScope ws) {
 		}
 		wrapPending.Reset();
 
+	} else if ((ws == wsVisible) && (wrapThreads > 0)) {
+		return WrapVisibleLinesExactly();
 	} else if (wrapPending.NeedsWrap()) {
 		wrapPending.start = std::min(wrapPending.start, pdoc->LinesTotal());
 		if (!SetIdle(true)) {
@@ -1484,6 +1511,221 @@ bool Editor::WrapLines(enum wrapScope ws) {
 	return wrapOccurred;
 }
 
+// Lines outside the view may have been wrapped in the background from summed character
+// widths so wrap each visible line with a full layout unless done since the last change.
+// Return true if wrapping occurred.
+bool Editor::WrapVisibleLinesExactly() {
+	const int lineDocTop = cs.DocFromDisplay(topLine);
+	const int subLineTop = topLine - cs.DisplayFromDoc(lineDocTop);
+	// Since wrapping could reduce display lines, treat each
+	// as taking only one display line.
+	int lineDocBottom = lineDocTop;
+	int lines = LinesOnScreen() + 1;
+	while ((lineDocBottom < cs.LinesInDoc()) && (lines > 0)) {
+		if (cs.GetVisible(lineDocBottom))
+			lines--;
+		lineDocBottom++;
+	}
+	if ((lineDocTop >= wrapCheckedStart) && (lineDocBottom <= wrapCheckedEnd))
+		return false;
+
+	// Ensure all lines being wrapped are styled.
+	pdoc->EnsureStyledTo(pdoc->LineStart(lineDocBottom));
+
+	bool wrapOccurred = false;
+	PRectangle rcTextArea = GetClientRectangle();
+	rcTextArea.left = static_cast<XYPOSITION>(vs.textStart);
+	rcTextArea.right -= vs.rightMarginWidth;
+	wrapWidth = static_cast<int>(rcTextArea.Width());
+	RefreshStyleData();
+	AutoSurface surface(this);
+	if (surface) {
+		for (int lineToWrap = lineDocTop; lineToWrap < lineDocBottom; lineToWrap++) {
+			if ((lineToWrap < wrapCheckedStart) || (lineToWrap >= wrapCheckedEnd)) {
+				if (WrapOneLine(surface, lineToWrap)) {
+					wrapOccurred = true;
+				}
+			}
+		}
+		if ((lineDocTop <= wrapCheckedEnd) && (lineDocBottom >= wrapCheckedStart) && (wrapCheckedStart < wrapCheckedEnd)) {
+			wrapCheckedStart = std::min(wrapCheckedStart, lineDocTop);
+			wrapCheckedEnd = std::max(wrapCheckedEnd, lineDocBottom);
+		} else {
+			wrapCheckedStart = lineDocTop;
+			wrapCheckedEnd = lineDocBottom;
+		}
+	}
+
+	if (wrapOccurred) {
+		SetScrollBars();
+		SetTopLine(Platform::Clamp(cs.DisplayFromDoc(lineDocTop) + std::min(subLineTop, cs.GetHeight(lineDocTop)-1),
+			0, MaxScrollPos()));
+		SetVerticalScrollPos();
+	}
+	return wrapOccurred;
+}
+
+/**
+ * Measures characters for background wrapping in the same way as EditView::LayoutLine.
+ */
+class ViewCharacterMeasurer : public CharacterMeasurer {
+	Surface *surface;
+	const ViewStyle &vs;
+	PositionCache &posCache;
+	Document *pdoc;
+	const SpecialRepresentations &reprs;
+	// Private so ViewCharacterMeasurer objects can not be copied
+	ViewCharacterMeasurer(const ViewCharacterMeasurer &);
+	ViewCharacterMeasurer &operator=(const ViewCharacterMeasurer &);
+public:
+	ViewCharacterMeasurer(Surface *surface_, const ViewStyle &vs_, PositionCache &posCache_, Document *pdoc_,
+		const SpecialRepresentations &reprs_) :
+		surface(surface_), vs(vs_), posCache(posCache_), pdoc(pdoc_), reprs(reprs_) {
+	}
+	virtual int EncodingFamily() const {
+		return pdoc->CodePageFamily();
+	}
+	virtual bool IsDBCSLeadByte(char ch) const {
+		return pdoc->IsDBCSLeadByte(ch);
+	}
+	virtual bool Visible(int style) const {
+		return vs.styles[style].visible;
+	}
+	virtual XYPOSITION Measure(int style, const char *s, int len) {
+		const Representation *repr = reprs.RepresentationFromCharacter(s, len);
+		if (repr) {
+			if (vs.controlCharWidth > 0.0)
+				return vs.controlCharWidth;
+			XYPOSITION positionsRepr[256];	// Should expand when needed
+			const unsigned int lenRepr = static_cast<unsigned int>(repr->stringRep.length());
+			posCache.MeasureWidths(surface, vs, STYLE_CONTROLCHAR, repr->stringRep.c_str(), lenRepr, positionsRepr, pdoc);
+			return positionsRepr[lenRepr - 1] + vs.ctrlCharPadding;
+		}
+		if ((len == 1) && (s[0] == ' '))
+			return vs.styles[style].spaceWidth;
+		char forced[UTF8MaxBytes] = "";
+		memcpy(forced, s, len);
+		if ((len == 1) && (vs.styles[style].caseForce == Style::caseUpper))
+			forced[0] = static_cast<char>(toupper(s[0]));
+		else if ((len == 1) && (vs.styles[style].caseForce == Style::caseLower))
+			forced[0] = static_cast<char>(tolower(s[0]));
+		XYPOSITION positions[UTF8MaxBytes];
+		posCache.MeasureWidths(surface, vs, style, forced, len, positions, pdoc);
+		return positions[len - 1];
+	}
+};
+
+// Find the number of sub-lines for lines outside the view on other threads, publishing the
+// results in document order. Used for idle wrapping when wrapThreads is more than 0.
+// Return true if wrapping occurred.
+bool Editor::WrapLinesInBackground() {
+	wrapPending.start = std::min(wrapPending.start, pdoc->LinesTotal());
+	const int lineEndNeedWrap = std::min(wrapPending.end, pdoc->LinesTotal());
+	if ((!wrapQueue || (wrapQueue->Length() == 0)) &&
+		(lineEndNeedWrap - wrapPending.start <= LinesOnScreen() + 100)) {
+		// Too few lines to be worth passing to other threads
+		return WrapLines(wsIdle);
+	}
+	if (!wrapQueue) {
+		wrapQueue = new WrapQueue(wrapThreads);
+	}
+	if ((wrapQueue->Length() == 0) || (wrapLineQueued < wrapPending.start)) {
+		wrapLineQueued = wrapPending.start;
+	}
+	const size_t jobsQueuedMax = 2 * wrapThreads;
+	const int lineDocTop = cs.DocFromDisplay(topLine);
+	const int subLineTop = topLine - cs.DisplayFromDoc(lineDocTop);
+	bool wrapOccurred = false;
+
+	// Publish finished jobs, waiting briefly for the oldest when no more jobs can be queued
+	// so that idle does not spin while other threads wrap
+	const bool canQueue = (wrapQueue->Length() < jobsQueuedMax) && (wrapLineQueued < lineEndNeedWrap);
+	int waitMilliseconds = ((wrapQueue->Length() > 0) && !canQueue) ? 10 : 0;
+	while (WrapJob *job = wrapQueue->TakeFinished(waitMilliseconds)) {
+		waitMilliseconds = 0;
+		if ((job->lineStart <= wrapPending.start) && (job->parameters.width == wrapWidth)) {
+			const int lineEndJob = std::min(job->lineEnd, lineEndNeedWrap);
+			for (int line = wrapPending.start; line < lineEndJob; line++) {
+				// Lines wrapped with a full layout are more accurate
+				if ((line < wrapCheckedStart) || (line >= wrapCheckedEnd)) {
+					if (cs.SetHeight(line, job->subLines[line - job->lineStart] +
+						(vs.annotationVisible ? pdoc->AnnotationLines(line) : 0))) {
+						wrapOccurred = true;
+					}
+				}
+				wrapPending.Wrapped(line);
+			}
+		} else {
+			// Not a continuation of the wrapped lines so queue again from there
+			wrapQueue->Clear();
+			wrapLineQueued = wrapPending.start;
+		}
+		delete job;
+	}
+
+	if ((wrapQueue->Length() < jobsQueuedMax) && (wrapLineQueued < lineEndNeedWrap)) {
+		PRectangle rcTextArea = GetClientRectangle();
+		rcTextArea.left = static_cast<XYPOSITION>(vs.textStart);
+		rcTextArea.right -= vs.rightMarginWidth;
+		wrapWidth = static_cast<int>(rcTextArea.Width());
+		RefreshStyleData();
+		AutoSurface surface(this);
+		if (surface) {
+			WrapParameters parameters;
+			parameters.width = wrapWidth;
+			parameters.wrapState = vs.wrapState;
+			parameters.wrapVisualFlags = vs.wrapVisualFlags;
+			parameters.wrapIndentMode = vs.wrapIndentMode;
+			parameters.wrapVisualStartIndent = vs.wrapVisualStartIndent;
+			parameters.aveCharWidth = vs.aveCharWidth;
+			parameters.spaceWidth = vs.spaceWidth;
+			parameters.tabWidth = vs.tabWidth;
+			parameters.indentSize = pdoc->IndentSize();
+			ViewCharacterMeasurer measurer(surface, vs, view.posCache, pdoc, reprs);
+			const int lengthJob = 0x20000;
+			std::vector<char> chars;
+			std::vector<unsigned char> styles;
+			while ((wrapQueue->Length() < jobsQueuedMax) && (wrapLineQueued < lineEndNeedWrap)) {
+				const int posStart = pdoc->LineStart(wrapLineQueued);
+				int lineEndJob = wrapLineQueued + 1;
+				while ((lineEndJob < lineEndNeedWrap) && (pdoc->LineStart(lineEndJob) - posStart < lengthJob))
+					lineEndJob++;
+				const int posEnd = pdoc->LineStart(lineEndJob);
+				// Ensure all lines being wrapped are styled.
+				pdoc->EnsureStyledTo(posEnd);
+				chars.resize(posEnd - posStart + 1);
+				styles.resize(posEnd - posStart + 1);
+				pdoc->GetCharRange(&chars[0], posStart, posEnd - posStart);
+				pdoc->GetStyleRange(&styles[0], posStart, posEnd - posStart);
+				wrapWidths->MeasureText(measurer, &chars[0], &styles[0], posEnd - posStart);
+				WrapJob *job = new WrapJob(wrapLineQueued, parameters, *wrapWidths);
+				for (int line = wrapLineQueued; line < lineEndJob; line++) {
+					const int posLineStart = pdoc->LineStart(line);
+					const int lengthLine = pdoc->LineStart(line + 1) - posLineStart;
+					const int lengthLaidOut = vs.viewEOL ? lengthLine : (pdoc->LineEnd(line) - posLineStart);
+					job->AddLine(&chars[posLineStart - posStart], &styles[posLineStart - posStart], lengthLine, lengthLaidOut);
+				}
+				wrapQueue->Add(job);
+				wrapLineQueued = lineEndJob;
+			}
+		}
+	}
+
+	// If wrapping is done, bring it to resting position
+	if (wrapPending.start >= lineEndNeedWrap) {
+		wrapPending.Reset();
+	}
+
+	if (wrapOccurred) {
+		SetScrollBars();
+		SetTopLine(Platform::Clamp(cs.DisplayFromDoc(lineDocTop) + std::min(subLineTop, cs.GetHeight(lineDocTop)-1),
+			0, MaxScrollPos()));
+		SetVerticalScrollPos();
+	}
+
+	return wrapOccurred;
+}
+
 void Editor::LinesJoin() {
 	if (!RangeContainsProtected(targetStart, targetEnd)) {
 		UndoGroup ug(pdoc);
@@ -1618,7 +1860,7 @@ void Editor::Paint(Surface *surfaceWindow, PRectangle rcArea) {
 
 	paintAbandonedByStyling = false;
 
-	StyleToPositionInView(PositionAfterArea(rcArea));
+	StyleAreaBounded(rcArea, false);
 
 	PRectangle rcClient = GetClientRectangle();
 	//Platform::DebugPrintf("Client: (%3d,%3d) ... (%3d,%3d)   %d\n",
@@ -2409,10 +2651,12 @@ void Editor::NotifySavePoint(Document *, void *, bool atSavePoint) {
 }
 
 void Editor::CheckModificationForWrap(DocModification mh) {
-	if (mh.modificationType & (SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT)) {
-		view.llc.Invalidate(LineLayout::llCheckTextAndStyle);
+	if (mh.modificationType & (SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT | SC_MOD_LINESINDEXED)) {
 		int lineDoc = pdoc->LineFromPosition(mh.position);
 		int lines = Platform::Maximum(0, mh.linesAdded);
+		// Indexing may have extended the line before the new lines
+		const int lineChanged = (mh.modificationType & SC_MOD_LINESINDEXED) ? lineDoc - 1 : lineDoc;
+		view.llc.InvalidateLines(lineChanged, lineDoc + lines, LineLayout::llCheckTextAndStyle);
 		if (Wrapping()) {
 			NeedWrapping(lineDoc, lineDoc + lines + 1);
 		}
@@ -2483,7 +2727,8 @@ void Editor::NotifyModified(Document *, DocModification mh, void *) {
 			}
 		}
 		if (mh.modificationType & SC_MOD_CHANGESTYLE) {
-			view.llc.Invalidate(LineLayout::llCheckTextAndStyle);
+			view.llc.InvalidateLines(pdoc->LineFromPosition(mh.position),
+				pdoc->LineFromPosition(mh.position + mh.length), LineLayout::llCheckTextAndStyle);
 		}
 	} else {
 		// Move selection and brace highlights
@@ -4588,14 +4833,30 @@ bool Editor::Idle() {
 
 	bool idleDone;
 
-	bool wrappingDone = !Wrapping();
+	bool wrappingDone = !Wrapping() || !wrapPending.NeedsWrap();
+	bool stylingDone = !needIdleStyling;
+	bool indexingDone = !pdoc->IndexingLines();
+
+	if (!indexingDone) {
+		// Add the lines of mapped text found by the indexing thread, waiting briefly when
+		// there are none yet so idle does not spin while the file is read.
+		pdoc->IndexLines(10);
+		indexingDone = !pdoc->IndexingLines();
+	}
 
 	if (!wrappingDone) {
 		// Wrap lines during idle.
-		WrapLines(wsIdle);
+		if (wrapThreads > 0)
+			WrapLinesInBackground();
+		else
+			WrapLines(wsIdle);
 		// No more wrapping
 		if (!wrapPending.NeedsWrap())
 			wrappingDone = true;
+	} else if (!stylingDone) {
+		// Style lines during idle once wrapping is finished.
+		IdleStyling();
+		stylingDone = !needIdleStyling;
 	}
 
 	// Add more idle things to do here, but make sure idleDone is
@@ -4603,7 +4864,7 @@ bool Editor::Idle() {
 	// false will stop calling this idle function until SetIdle() is
 	// called again.
 
-	idleDone = wrappingDone; // && thatDone && theOtherThingDone...
+	idleDone = wrappingDone && stylingDone && indexingDone; // && theOtherThingDone...
 
 	return !idleDone;
 }
@@ -4708,6 +4969,62 @@ void Editor::StyleToPositionInView(Position pos) {
 	}
 }
 
+// Limit the amount of styling performed in one go to the idle styling budget so the
+// application remains responsive. The remainder is styled in idle time.
+int Editor::PositionAfterMaxStyling(int posMax, bool scrolling) const {
+	if ((idleStyling == SC_IDLESTYLING_NONE) || (idleStyling == SC_IDLESTYLING_AFTERVISIBLE)) {
+		// Visible text is always styled completely
+		return posMax;
+	}
+
+	// Allow less time when scrolling so it remains smooth
+	const double secondsAllowed = idleStylingBudget / (scrolling ? 4000.0 : 1000.0);
+	const int linesToStyle = Platform::Clamp(static_cast<int>(secondsAllowed / pdoc->durationStyleOneLine),
+		10, 0x10000);
+	const int stylingMaxLine = std::min(pdoc->LineFromPosition(pdoc->GetEndStyled()) + linesToStyle,
+		pdoc->LinesTotal());
+	return std::min(pdoc->LineStart(stylingMaxLine), posMax);
+}
+
+void Editor::StartIdleStyling(bool truncatedLastStyling) {
+	if ((idleStyling == SC_IDLESTYLING_ALL) || (idleStyling == SC_IDLESTYLING_AFTERVISIBLE)) {
+		if (pdoc->GetEndStyled() < pdoc->Length()) {
+			// Style remainder of document in idle time
+			needIdleStyling = true;
+		}
+	} else if (truncatedLastStyling) {
+		needIdleStyling = true;
+	}
+
+	if (needIdleStyling) {
+		SetIdle(true);
+	}
+}
+
+// Style an area but bound the amount of styling to remain responsive.
+void Editor::StyleAreaBounded(PRectangle rcArea, bool scrolling) {
+	const int posAfterArea = PositionAfterArea(rcArea);
+	const int posAfterMax = PositionAfterMaxStyling(posAfterArea, scrolling);
+	if (posAfterMax < posAfterArea) {
+		// Style a bit now then continue in idle time
+		pdoc->StyleToAdjustingLineDuration(posAfterMax);
+	} else {
+		StyleToPositionInView(posAfterArea);
+	}
+	StartIdleStyling(posAfterMax < posAfterArea);
+}
+
+void Editor::IdleStyling() {
+	const int posAfterArea = PositionAfterArea(GetClientRectangle());
+	const int endGoal = (idleStyling >= SC_IDLESTYLING_AFTERVISIBLE) ?
+		pdoc->Length() : posAfterArea;
+	const int posAfterMax = PositionAfterMaxStyling(endGoal, false);
+	pdoc->StyleToAdjustingLineDuration(posAfterMax);
+	if (pdoc->GetEndStyled() >= endGoal) {
+		needIdleStyling = false;
+	}
+}
+
 void Editor::IdleWork() {
 	// Style the line after the modification as this allows modifications that change just the
 	// line of the modification to heal instead of propagating to the rest of the window.
@@ -4839,6 +5156,8 @@ void Editor::SetDocPointer(Document *document) {
 	pdoc->AddWatcher(this, 0);
 	SetScrollBars();
 	Redraw();
+	if (pdoc->IndexingLines())
+		SetIdle(true);
 }
 
 void Editor::SetAnnotationVisible(int visible) {
@@ -5698,6 +6017,13 @@ sptr_t Editor::WndProc(unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
 	case SCI_GETUNDOCOLLECTION:
 		return pdoc->IsCollectingUndo();
 
+	case SCI_SETUNDOMEMORYLIMIT:
+		pdoc->SetUndoMemoryLimit(static_cast<size_t>(wParam));
+		return 0;
+
+	case SCI_GETUNDOMEMORYLIMIT:
+		return pdoc->UndoMemoryLimit();
+
 	case SCI_BEGINUNDOACTION:
 		pdoc->BeginUndoAction();
 		return 0;
@@ -5939,6 +6265,8 @@ sptr_t Editor::WndProc(unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
 			cs.InsertLines(0, pdoc->LinesTotal() - 1);
 			SetAnnotationHeights(0, pdoc->LinesTotal());
 			InvalidateStyleRedraw();
+			if (pdoc->IndexingLines())
+				SetIdle(true);
 		}
 		break;
 
@@ -6132,6 +6460,32 @@ sptr_t Editor::WndProc(unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
 	case SCI_GETWRAPINDENTMODE:
 		return vs.wrapIndentMode;
 
+	case SCI_SETWRAPTHREADS:
+		if (wrapThreads != std::max(static_cast<int>(wParam), 0)) {
+			delete wrapQueue;
+			wrapQueue = 0;
+			wrapThreads = std::max(static_cast<int>(wParam), 0);
+			NeedWrapping();
+		}
+		break;
+
+	case SCI_GETWRAPTHREADS:
+		return wrapThreads;
+
+	case SCI_SETIDLESTYLING:
+		idleStyling = static_cast<int>(wParam);
+		break;
+
+	case SCI_GETIDLESTYLING:
+		return idleStyling;
+
+	case SCI_SETIDLESTYLINGBUDGET:
+		idleStylingBudget = std::max(static_cast<int>(wParam), 1);
+		break;
+
+	case SCI_GETIDLESTYLINGBUDGET:
+		return idleStylingBudget;
+
 	case SCI_SETLAYOUTCACHE:
 		view.llc.SetLevel(static_cast<int>(wParam));
 		break;
@@ -6139,6 +6493,13 @@ sptr_t Editor::WndProc(unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
 	case SCI_GETLAYOUTCACHE:
 		return view.llc.GetLevel();
 
+	case SCI_SETLAYOUTCACHEPAGES:
+		view.llc.SetPages(static_cast<int>(wParam));
+		break;
+
+	case SCI_GETLAYOUTCACHEPAGES:
+		return view.llc.GetPages();
+
 	case SCI_SETPOSITIONCACHE:
 		view.posCache.SetSize(wParam);
 		break;
@@ -6146,6 +6507,31 @@ sptr_t Editor::WndProc(unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
 	case SCI_GETPOSITIONCACHE:
 		return view.posCache.GetSize();
 
+	case SCI_SETSEGMENTCACHEBUDGET:
+		pdoc->SegmentWidths()->SetBudget(static_cast<size_t>(wParam));
+		break;
+
+	case SCI_GETSEGMENTCACHEBUDGET:
+		return pdoc->SegmentWidths()->Budget();
+
+	case SCI_GETPOSITIONCACHESTATISTIC:
+		switch (wParam) {
+		case SC_POSITIONCACHE_HITS:
+			return view.posCache.Hits();
+		case SC_POSITIONCACHE_MISSES:
+			return view.posCache.Misses();
+		case SC_POSITIONCACHE_SEGMENTHITS:
+			return pdoc->SegmentWidths()->Hits();
+		case SC_POSITIONCACHE_SEGMENTMISSES:
+			return pdoc->SegmentWidths()->Misses();
+		case SC_POSITIONCACHE_SEGMENTBYTES:
+			return pdoc->SegmentWidths()->Used();
+		case SC_POSITIONCACHE_SEGMENTENTRIES:
+			return pdoc->SegmentWidths()->Entries();
+		default:
+			return 0;
+		}
+
 	case SCI_SETSCROLLWIDTH:
 		PLATFORM_ASSERT(wParam > 0);
 		if ((wParam > 0) && (wParam != static_cast<unsigned int >(scrollWidth))) {
@@ -6265,6 +6651,8 @@ sptr_t Editor::WndProc(unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
 				SetAnnotationHeights(0, pdoc->LinesTotal());
 				InvalidateStyleRedraw();
 				SetRepresentations();
+				if (pdoc->IndexingLines())
+					SetIdle(true);
 			}
 		}
 		break;
@@ -7030,6 +7418,19 @@ sptr_t Editor::WndProc(unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
 			return reinterpret_cast<sptr_t>(static_cast<ILoader *>(doc));
 		}
 
+	case SCI_CREATEMAPPEDDOCUMENT: {
+			IMappedText *mappedText = reinterpret_cast<IMappedText *>(lParam);
+			if (!mappedText || !mappedText->Text() || (mappedText->Length() < 0))
+				return 0;
+			Document *doc = new Document();
+			doc->AddRef();
+			doc->SetMappedText(mappedText);
+			return reinterpret_cast<sptr_t>(doc);
+		}
+
+	case SCI_GETINDEXINGLINES:
+		return pdoc->IndexingLines();
+
 	case SCI_SETMODEVENTMASK:
 		modEventMask = static_cast<int>(wParam);
 		return 0;
@@ -7146,6 +7547,9 @@ sptr_t Editor::WndProc(unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
 
 	case SCI_SETREPRESENTATION:
 		reprs.SetRepresentation(reinterpret_cast<const char *>(wParam), CharPtrFromSPtr(lParam));
+		// Representations are measured into the widths used for wrapping
+		wrapWidths->Clear();
+		NeedWrapping();
 		break;
 
 	case SCI_GETREPRESENTATION: {
@@ -7159,6 +7563,8 @@ sptr_t Editor::WndProc(unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
 
 	case SCI_CLEARREPRESENTATION:
 		reprs.ClearRepresentation(reinterpret_cast<const char *>(wParam));
+		wrapWidths->Clear();
+		NeedWrapping();
 		break;
 
 	case SCI_STARTRECORD:
@@ -12,6 +12,9 @@
 namespace Scintilla {
 #endif
 
+class WrapWidths;
+class WrapQueue;
+
 /**
  */
 class Timer {
@@ -234,6 +237,9 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 	bool paintingAllText;
 	bool willRedrawAll;
 	WorkNeeded workNeeded;
+	int idleStyling;
+	int idleStylingBudget;	///< Milliseconds of styling allowed in each idle call
+	bool needIdleStyling;
 
 	int modEventMask;
 
@@ -256,6 +262,12 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 
 	// Wrapping support
 	WrapPending wrapPending;
+	int wrapThreads;	// When more than 0, lines outside the view are wrapped on this many threads
+	WrapWidths *wrapWidths;
+	WrapQueue *wrapQueue;
+	int wrapLineQueued;	// Lines before this have been queued for background wrapping
+	int wrapCheckedStart;	// Range of lines wrapped with a full layout since the last change
+	int wrapCheckedEnd;
 
 	bool convertPastes;
 
@@ -368,6 +380,8 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 	bool WrapOneLine(Surface *surface, int lineToWrap);
 	enum wrapScope {wsAll, wsVisible, wsIdle};
 	bool WrapLines(enum wrapScope ws);
+	bool WrapVisibleLinesExactly();
+	bool WrapLinesInBackground();
 	void LinesJoin();
 	void LinesSplit(int pixelWidth);
 
@@ -514,6 +528,10 @@ protected:	// ScintillaBase subclass needs access to much of Editor
 
 	int PositionAfterArea(PRectangle rcArea) const;
 	void StyleToPositionInView(Position pos);
+	int PositionAfterMaxStyling(int posMax, bool scrolling) const;
+	void StartIdleStyling(bool truncatedLastStyling);
+	void StyleAreaBounded(PRectangle rcArea, bool scrolling);
+	void IdleStyling();
 	virtual void IdleWork();
 	virtual void QueueIdleWork(WorkNeeded::workItems items, int upTo=0);
 
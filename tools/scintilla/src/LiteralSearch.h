@@ -0,0 +1,97 @@
+// Scintilla source code edit control
+/** @file LiteralSearch.h
+ ** Find a literal byte string in contiguous text.
+ **/
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef LITERALSEARCH_H
+#define LITERALSEARCH_H
+
+#ifdef SCI_NAMESPACE
+namespace Scintilla {
+#endif
+
+/**
+ * Boyer-Moore-Horspool search in both directions. Short needles are found with
+ * memchr on their first byte as the skip table does not help them.
+ * The needle is not copied so must outlive the LiteralSearch.
+ */
+class LiteralSearch {
+	const char *needle;
+	int lengthNeedle;
+	int skipForward[256];
+	int skipBackward[256];
+	enum { lengthShort = 3 };
+public:
+	LiteralSearch(const char *needle_, int lengthNeedle_) : needle(needle_), lengthNeedle(lengthNeedle_) {
+		for (int ch = 0; ch < 256; ch++) {
+			skipForward[ch] = lengthNeedle;
+			skipBackward[ch] = lengthNeedle;
+		}
+		for (int i = 0; i < lengthNeedle - 1; i++)
+			skipForward[static_cast<unsigned char>(needle[i])] = lengthNeedle - 1 - i;
+		for (int i = lengthNeedle - 1; i > 0; i--)
+			skipBackward[static_cast<unsigned char>(needle[i])] = i;
+	}
+	const char *Needle() const {
+		return needle;
+	}
+	int Length() const {
+		return lengthNeedle;
+	}
+	/// Returns the index of the first match in text or -1.
+	int FindForward(const char *text, int lengthText) const {
+		if (lengthNeedle <= 0 || lengthText < lengthNeedle)
+			return -1;
+		const int last = lengthText - lengthNeedle;
+		if (lengthNeedle <= lengthShort) {
+			const char *p = text;
+			const char *end = text + last + 1;
+			while (p < end) {
+				p = static_cast<const char *>(memchr(p, needle[0], end - p));
+				if (!p)
+					return -1;
+				if (memcmp(p + 1, needle + 1, lengthNeedle - 1) == 0)
+					return static_cast<int>(p - text);
+				p++;
+			}
+			return -1;
+		}
+		const char chLast = needle[lengthNeedle - 1];
+		int pos = 0;
+		while (pos <= last) {
+			const char ch = text[pos + lengthNeedle - 1];
+			if ((ch == chLast) && (memcmp(text + pos, needle, lengthNeedle - 1) == 0))
+				return pos;
+			pos += skipForward[static_cast<unsigned char>(ch)];
+		}
+		return -1;
+	}
+	/// Returns the index of the last match in text or -1.
+	int FindBackward(const char *text, int lengthText) const {
+		if (lengthNeedle <= 0 || lengthText < lengthNeedle)
+			return -1;
+		const char chFirst = needle[0];
+		int pos = lengthText - lengthNeedle;
+		if (lengthNeedle <= lengthShort) {
+			for (; pos >= 0; pos--) {
+				if ((text[pos] == chFirst) && (memcmp(text + pos + 1, needle + 1, lengthNeedle - 1) == 0))
+					return pos;
+			}
+			return -1;
+		}
+		while (pos >= 0) {
+			const char ch = text[pos];
+			if ((ch == chFirst) && (memcmp(text + pos + 1, needle + 1, lengthNeedle - 1) == 0))
+				return pos;
+			pos -= skipBackward[static_cast<unsigned char>(ch)];
+		}
+		return -1;
+	}
+};
+
+#ifdef SCI_NAMESPACE
+}
+#endif
+
+#endif
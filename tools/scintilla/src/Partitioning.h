@@ -12,24 +12,24 @@
 namespace Scintilla {
 #endif
 
-/// A split vector of integers with a method for adding a value to all elements
+/// A split vector of positions with a method for adding a value to all elements
 /// in a range.
 /// Used by the Partitioning class.
 
-class SplitVectorWithRangeAdd : public SplitVector<int> {
+class SplitVectorWithRangeAdd : public SplitVector<Sci::Position> {
 public:
-	explicit SplitVectorWithRangeAdd(int growSize_) {
+	explicit SplitVectorWithRangeAdd(Sci::Position growSize_) {
 		SetGrowSize(growSize_);
 		ReAllocate(growSize_);
 	}
 	~SplitVectorWithRangeAdd() {
 	}
-	void RangeAddDelta(int start, int end, int delta) {
+	void RangeAddDelta(Sci::Position start, Sci::Position end, Sci::Position delta) {
 		// end is 1 past end, so end-start is number of elements to change
-		int i = 0;
-		int rangeLength = end - start;
-		int range1Length = rangeLength;
-		int part1Left = part1Length - start;
+		Sci::Position i = 0;
+		Sci::Position rangeLength = end - start;
+		Sci::Position range1Length = rangeLength;
+		Sci::Position part1Left = part1Length - start;
 		if (range1Length > part1Left)
 			range1Length = part1Left;
 		while (i < range1Length) {
@@ -56,7 +56,7 @@ private:
 	// To avoid calculating all the partition positions whenever any text is inserted
 	// there may be a step somewhere in the list.
 	int stepPartition;
-	int stepLength;
+	Sci::Position stepLength;
 	SplitVectorWithRangeAdd *body;
 
 	// Move step forward
@@ -65,8 +65,8 @@ private:
 			body->RangeAddDelta(stepPartition+1, partitionUpTo + 1, stepLength);
 		}
 		stepPartition = partitionUpTo;
-		if (stepPartition >= body->Length()-1) {
-			stepPartition = body->Length()-1;
+		if (stepPartition >= Partitions()) {
+			stepPartition = Partitions();
 			stepLength = 0;
 		}
 	}
@@ -79,7 +79,7 @@ private:
 		stepPartition = partitionDownTo;
 	}
 
-	void Allocate(int growSize) {
+	void Allocate(Sci::Position growSize) {
 		body = new SplitVectorWithRangeAdd(growSize);
 		stepPartition = 0;
 		stepLength = 0;
@@ -88,7 +88,7 @@ private:
 	}
 
 public:
-	explicit Partitioning(int growSize) {
+	explicit Partitioning(Sci::Position growSize) {
 		Allocate(growSize);
 	}
 
@@ -98,10 +98,10 @@ public:
 	}
 
 	int Partitions() const {
-		return body->Length()-1;
+		return static_cast<int>(body->Length())-1;
 	}
 
-	void InsertPartition(int partition, int pos) {
+	void InsertPartition(int partition, Sci::Position pos) {
 		if (stepPartition < partition) {
 			ApplyStep(partition);
 		}
@@ -109,7 +109,16 @@ public:
 		stepPartition++;
 	}
 
-	void SetPartitionStartPosition(int partition, int pos) {
+	/// Insert several partitions at once, positions must be ascending
+	void InsertPartitions(int partition, const Sci::Position *positions, int count) {
+		if (stepPartition < partition) {
+			ApplyStep(partition);
+		}
+		body->InsertFromArray(partition, positions, 0, count);
+		stepPartition += count;
+	}
+
+	void SetPartitionStartPosition(int partition, Sci::Position pos) {
 		ApplyStep(partition+1);
 		if ((partition < 0) || (partition > body->Length())) {
 			return;
@@ -117,7 +126,7 @@ public:
 		body->SetValueAt(partition, pos);
 	}
 
-	void InsertText(int partitionInsert, int delta) {
+	void InsertText(int partitionInsert, Sci::Position delta) {
 		// Point all the partitions after the insertion point further along in the buffer
 		if (stepLength != 0) {
 			if (partitionInsert >= stepPartition) {
@@ -129,7 +138,7 @@ public:
 				BackStep(partitionInsert);
 				stepLength += delta;
 			} else {
-				ApplyStep(body->Length()-1);
+				ApplyStep(Partitions());
 				stepPartition = partitionInsert;
 				stepLength = delta;
 			}
@@ -149,29 +158,29 @@ public:
 		body->Delete(partition);
 	}
 
-	int PositionFromPartition(int partition) const {
+	Sci::Position PositionFromPartition(int partition) const {
 		PLATFORM_ASSERT(partition >= 0);
 		PLATFORM_ASSERT(partition < body->Length());
 		if ((partition < 0) || (partition >= body->Length())) {
 			return 0;
 		}
-		int pos = body->ValueAt(partition);
+		Sci::Position pos = body->ValueAt(partition);
 		if (partition > stepPartition)
 			pos += stepLength;
 		return pos;
 	}
 
 	/// Return value in range [0 .. Partitions() - 1] even for arguments outside interval
-	int PartitionFromPosition(int pos) const {
+	int PartitionFromPosition(Sci::Position pos) const {
 		if (body->Length() <= 1)
 			return 0;
-		if (pos >= (PositionFromPartition(body->Length()-1)))
-			return body->Length() - 1 - 1;
+		if (pos >= (PositionFromPartition(Partitions())))
+			return Partitions() - 1;
 		int lower = 0;
-		int upper = body->Length()-1;
+		int upper = Partitions();
 		do {
 			int middle = (upper + lower + 1) / 2; 	// Round high
-			int posMiddle = body->ValueAt(middle);
+			Sci::Position posMiddle = body->ValueAt(middle);
 			if (middle > stepPartition)
 				posMiddle += stepLength;
 			if (pos < posMiddle) {
@@ -184,7 +193,7 @@ public:
 	}
 
 	void DeleteAll() {
-		int growSize = body->GetGrowSize();
+		Sci::Position growSize = body->GetGrowSize();
 		delete body;
 		Allocate(growSize);
 	}
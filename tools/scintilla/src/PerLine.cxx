@@ -5,6 +5,7 @@
 // Copyright 1998-2009 by Neil Hodgson <neilh@scintilla.org>
 // The License.txt file describes the conditions under which this software may be distributed.
 
+#include <stddef.h>
 #include <string.h>
 
 #include <vector>
@@ -13,6 +14,7 @@
 #include "Platform.h"
 
 #include "Scintilla.h"
+#include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
 #include "CellBuffer.h"
@@ -134,6 +136,12 @@ void LineMarkers::InsertLine(int line) {
 	}
 }
 
+void LineMarkers::InsertLines(int line, int lines) {
+	if (markers.Length()) {
+		markers.InsertValue(line, lines, 0);
+	}
+}
+
 void LineMarkers::RemoveLine(int line) {
 	// Retain the markers from the deleted line by oring them into the previous line
 	if (markers.Length()) {
@@ -248,6 +256,13 @@ void LineLevels::InsertLine(int line) {
 	}
 }
 
+void LineLevels::InsertLines(int line, int lines) {
+	if (levels.Length()) {
+		int level = (line < levels.Length()) ? levels[line] : SC_FOLDLEVELBASE;
+		levels.InsertValue(line, lines, level);
+	}
+}
+
 void LineLevels::RemoveLine(int line) {
 	if (levels.Length()) {
 		// Move up following lines but merge header flag from this line
@@ -306,6 +321,14 @@ void LineState::InsertLine(int line) {
 	}
 }
 
+void LineState::InsertLines(int line, int lines) {
+	if (lineStates.Length()) {
+		lineStates.EnsureLength(line);
+		int val = (line < lineStates.Length()) ? lineStates[line] : 0;
+		lineStates.InsertValue(line, lines, val);
+	}
+}
+
 void LineState::RemoveLine(int line) {
 	if (lineStates.Length() > line) {
 		lineStates.Delete(line);
@@ -370,6 +393,13 @@ void LineAnnotation::InsertLine(int line) {
 	}
 }
 
+void LineAnnotation::InsertLines(int line, int lines) {
+	if (annotations.Length()) {
+		annotations.EnsureLength(line);
+		annotations.InsertValue(line, lines, 0);
+	}
+}
+
 void LineAnnotation::RemoveLine(int line) {
 	if (annotations.Length() && (line > 0) && (line <= annotations.Length())) {
 		delete []annotations[line-1];
@@ -504,6 +534,13 @@ void LineTabstops::InsertLine(int line) {
 	}
 }
 
+void LineTabstops::InsertLines(int line, int lines) {
+	if (tabstops.Length()) {
+		tabstops.EnsureLength(line);
+		tabstops.InsertValue(line, lines, 0);
+	}
+}
+
 void LineTabstops::RemoveLine(int line) {
 	if (tabstops.Length() > line) {
 		delete tabstops[line];
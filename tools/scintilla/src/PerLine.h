@@ -50,6 +50,7 @@ public:
 	virtual ~LineMarkers();
 	virtual void Init();
 	virtual void InsertLine(int line);
+	virtual void InsertLines(int line, int lines);
 	virtual void RemoveLine(int line);
 
 	int MarkValue(int line);
@@ -67,6 +68,7 @@ public:
 	virtual ~LineLevels();
 	virtual void Init();
 	virtual void InsertLine(int line);
+	virtual void InsertLines(int line, int lines);
 	virtual void RemoveLine(int line);
 
 	void ExpandLevels(int sizeNew=-1);
@@ -83,6 +85,7 @@ public:
 	virtual ~LineState();
 	virtual void Init();
 	virtual void InsertLine(int line);
+	virtual void InsertLines(int line, int lines);
 	virtual void RemoveLine(int line);
 
 	int SetLineState(int line, int state);
@@ -98,6 +101,7 @@ public:
 	virtual ~LineAnnotation();
 	virtual void Init();
 	virtual void InsertLine(int line);
+	virtual void InsertLines(int line, int lines);
 	virtual void RemoveLine(int line);
 
 	bool MultipleStyles(int line) const;
@@ -122,6 +126,7 @@ public:
 	virtual ~LineTabstops();
 	virtual void Init();
 	virtual void InsertLine(int line);
+	virtual void InsertLines(int line, int lines);
 	virtual void RemoveLine(int line);
 
 	bool ClearTabstops(int line);
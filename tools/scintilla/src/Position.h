@@ -0,0 +1,23 @@
+// Scintilla source code edit control
+/** @file Position.h
+ ** Defines the type used for positions and lengths within documents.
+ **/
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef POSITION_H
+#define POSITION_H
+
+/**
+ * A Position is a location between two bytes of a document or its start or end and is also
+ * used for lengths of text.
+ * Positions are int like those of Document, Editor and the messages so documents are
+ * limited to 2 GB.
+ */
+
+namespace Sci {
+
+typedef int Position;
+
+}
+
+#endif
@@ -14,6 +14,7 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <list>
 #include <algorithm>
 
 #include "Platform.h"
@@ -21,6 +22,7 @@
 #include "ILexer.h"
 #include "Scintilla.h"
 
+#include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
 #include "RunStyles.h"
@@ -37,6 +39,7 @@
 #include "CaseFolder.h"
 #include "Document.h"
 #include "UniConversion.h"
+#include "SegmentCache.h"
 #include "Selection.h"
 #include "PositionCache.h"
 
@@ -94,6 +97,7 @@ void LineLayout::Free() {
 	positions = 0;
 	delete []lineStarts;
 	lineStarts = 0;
+	lenLineStarts = 0;
 }
 
 void LineLayout::Invalidate(validLevel validity_) {
@@ -244,59 +248,125 @@ int LineLayout::EndLineStyle() const {
 }
 
 LineLayoutCache::LineLayoutCache() :
-	level(0),
-	allInvalidated(false), styleClock(-1), useCount(0) {
-	Allocate(0);
+	level(0), pages(4), maxLines(0), stepIndex(0), stepLength(0),
+	allInvalidated(false), useCount(0) {
 }
 
 LineLayoutCache::~LineLayoutCache() {
 	Deallocate();
 }
 
-void LineLayoutCache::Allocate(size_t length_) {
-	PLATFORM_ASSERT(cache.empty());
-	allInvalidated = false;
-	cache.resize(length_);
-}
-
 void LineLayoutCache::AllocateForLevel(int linesOnScreen, int linesInDoc) {
 	PLATFORM_ASSERT(useCount == 0);
-	size_t lengthForLevel = 0;
+	size_t linesForLevel = 0;
 	if (level == llcCaret) {
-		lengthForLevel = 1;
+		linesForLevel = 1;
 	} else if (level == llcPage) {
-		lengthForLevel = linesOnScreen + 1;
+		linesForLevel = pages * (linesOnScreen + 1);
 	} else if (level == llcDocument) {
-		lengthForLevel = linesInDoc;
+		linesForLevel = linesInDoc;
 	}
-	if (lengthForLevel > cache.size()) {
-		Deallocate();
-		Allocate(lengthForLevel);
-	} else {
-		if (lengthForLevel < cache.size()) {
-			for (size_t i = lengthForLevel; i < cache.size(); i++) {
-				delete cache[i];
-				cache[i] = 0;
+	maxLines = linesForLevel;
+	while (layouts.size() > maxLines) {
+		LineLayoutList::iterator last = --layouts.end();
+		Forget(last);
+		delete *last;
+		layouts.erase(last);
+	}
+}
+
+// Move step forward, renumbering the layouts passed
+void LineLayoutCache::ApplyStep(int indexUpTo) {
+	for (int i = stepIndex; i < indexUpTo; i++) {
+		byLine.ValueAt(i)->lineNumber += stepLength;
+	}
+	stepIndex = indexUpTo;
+	if (stepIndex >= Indexed()) {
+		stepIndex = Indexed();
+		stepLength = 0;
+	}
+}
+
+// Move step backward, renumbering the layouts passed
+void LineLayoutCache::BackStep(int indexDownTo) {
+	for (int i = indexDownTo; i < stepIndex; i++) {
+		byLine.ValueAt(i)->lineNumber -= stepLength;
+	}
+	stepIndex = indexDownTo;
+}
+
+int LineLayoutCache::LineAt(int index) const {
+	const int line = byLine.ValueAt(index)->lineNumber;
+	return (index >= stepIndex) ? line + stepLength : line;
+}
+
+// Return the index of the first layout on or after line.
+int LineLayoutCache::IndexFromLine(int line) const {
+	int lower = 0;
+	int upper = Indexed();
+	while (lower < upper) {
+		const int middle = (lower + upper) / 2;
+		if (LineAt(middle) < line) {
+			lower = middle + 1;
+		} else {
+			upper = middle;
+		}
+	}
+	return lower;
+}
+
+// Find the index of a layout from its stored lineNumber, which is ordered separately
+// before and after the step. Returns -1 when the layout does not hold a line.
+int LineLayoutCache::IndexOf(const LineLayout *ll) const {
+	const int ranges[] = { 0, stepIndex, Indexed() };
+	for (int range = 0; range < 2; range++) {
+		int lower = ranges[range];
+		int upper = ranges[range + 1];
+		while (lower < upper) {
+			const int middle = (lower + upper) / 2;
+			if (byLine.ValueAt(middle)->lineNumber < ll->lineNumber) {
+				lower = middle + 1;
+			} else {
+				upper = middle;
 			}
 		}
-		cache.resize(lengthForLevel);
+		if ((lower < ranges[range + 1]) && (byLine.ValueAt(lower) == ll))
+			return lower;
+	}
+	return -1;
+}
+
+// Remove a layout from the index so it can be reused for another line.
+void LineLayoutCache::Forget(LineLayoutList::iterator it) {
+	LineLayout *ll = *it;
+	const int index = IndexOf(ll);
+	if (index >= 0) {
+		if (index < stepIndex)
+			stepIndex--;
+		byLine.Delete(index);
+		if (stepIndex >= Indexed()) {
+			stepIndex = Indexed();
+			stepLength = 0;
+		}
+		ll->lineNumber = -1;
 	}
-	PLATFORM_ASSERT(cache.size() == lengthForLevel);
+	ll->Invalidate(LineLayout::llInvalid);
 }
 
 void LineLayoutCache::Deallocate() {
 	PLATFORM_ASSERT(useCount == 0);
-	for (size_t i = 0; i < cache.size(); i++)
-		delete cache[i];
-	cache.clear();
+	for (LineLayoutList::iterator it = layouts.begin(); it != layouts.end(); ++it)
+		delete *it;
+	layouts.clear();
+	byLine.DeleteAll();
+	stepIndex = 0;
+	stepLength = 0;
 }
 
 void LineLayoutCache::Invalidate(LineLayout::validLevel validity_) {
-	if (!cache.empty() && !allInvalidated) {
-		for (size_t i = 0; i < cache.size(); i++) {
-			if (cache[i]) {
-				cache[i]->Invalidate(validity_);
-			}
+	if (!layouts.empty() && !allInvalidated) {
+		for (LineLayoutList::iterator it = layouts.begin(); it != layouts.end(); ++it) {
+			(*it)->Invalidate(validity_);
 		}
 		if (validity_ == LineLayout::llInvalid) {
 			allInvalidated = true;
@@ -304,6 +374,42 @@ void LineLayoutCache::Invalidate(LineLayout::validLevel validity_) {
 	}
 }
 
+void LineLayoutCache::InvalidateLines(int lineFirst, int lineLast, LineLayout::validLevel validity_) {
+	for (int i = IndexFromLine(lineFirst); (i < Indexed()) && (LineAt(i) <= lineLast); i++) {
+		byLine.ValueAt(i)->Invalidate(validity_);
+	}
+}
+
+// Renumber the layouts after lines are inserted or removed at lineOfPos so that they stay
+// with their text. Layouts of removed lines are kept for reuse.
+void LineLayoutCache::LinesAddedOrRemoved(int lineOfPos, int linesAdded) {
+	if ((linesAdded == 0) || (Indexed() == 0))
+		return;
+	const int index = IndexFromLine(lineOfPos);
+	while ((linesAdded < 0) && (index < Indexed()) && (LineAt(index) < lineOfPos - linesAdded)) {
+		LineLayoutList::iterator itLayout = byLine.ValueAt(index)->positionUse;
+		Forget(itLayout);
+		layouts.splice(layouts.end(), layouts, itLayout);
+	}
+	if (index >= Indexed())
+		return;
+	if (stepLength == 0) {
+		stepIndex = index;
+	} else if (index >= stepIndex) {
+		ApplyStep(index);
+	} else {
+		BackStep(index);
+	}
+	stepLength += linesAdded;
+}
+
+int LineLayoutCache::LineOf(const LineLayout *ll) const {
+	if (!ll->inCache)
+		return ll->lineNumber;
+	const int index = IndexOf(ll);
+	return (index >= 0) ? LineAt(index) : -1;
+}
+
 void LineLayoutCache::SetLevel(int level_) {
 	allInvalidated = false;
 	if ((level_ != -1) && (level != level_)) {
@@ -312,45 +418,57 @@ void LineLayoutCache::SetLevel(int level_) {
 	}
 }
 
-LineLayout *LineLayoutCache::Retrieve(int lineNumber, int lineCaret, int maxChars, int styleClock_,
+void LineLayoutCache::SetPages(int pages_) {
+	if (pages_ >= 1) {
+		pages = pages_;
+	}
+}
+
+LineLayout *LineLayoutCache::Retrieve(int lineNumber, int lineCaret, int maxChars,
                                       int linesOnScreen, int linesInDoc) {
 	AllocateForLevel(linesOnScreen, linesInDoc);
-	if (styleClock != styleClock_) {
-		Invalidate(LineLayout::llCheckTextAndStyle);
-		styleClock = styleClock_;
-	}
 	allInvalidated = false;
-	int pos = -1;
 	LineLayout *ret = 0;
-	if (level == llcCaret) {
-		pos = 0;
-	} else if (level == llcPage) {
-		if (lineNumber == lineCaret) {
-			pos = 0;
-		} else if (cache.size() > 1) {
-			pos = 1 + (lineNumber % (cache.size() - 1));
-		}
-	} else if (level == llcDocument) {
-		pos = lineNumber;
-	}
-	if (pos >= 0) {
+	if (maxLines > 0) {
 		PLATFORM_ASSERT(useCount == 0);
-		if (!cache.empty() && (pos < static_cast<int>(cache.size()))) {
-			if (cache[pos]) {
-				if ((cache[pos]->lineNumber != lineNumber) ||
-				        (cache[pos]->maxLineLength < maxChars)) {
-					delete cache[pos];
-					cache[pos] = 0;
+		int index = IndexFromLine(lineNumber);
+		if ((index < Indexed()) && (LineAt(index) == lineNumber)) {
+			// Move to the front as most recently used
+			layouts.splice(layouts.begin(), layouts, byLine.ValueAt(index)->positionUse);
+			ret = layouts.front();
+			if (ret->maxLineLength < maxChars) {
+				ret->Resize(maxChars);
+				ret->Invalidate(LineLayout::llInvalid);
+			}
+		} else {
+			if (layouts.size() < maxLines) {
+				layouts.push_front(new LineLayout(maxChars));
+				layouts.front()->positionUse = layouts.begin();
+			} else {
+				// Reuse the least recently used layout but keep the caret line if possible
+				if ((LineOf(layouts.back()) == lineCaret) && (layouts.size() > 1)) {
+					layouts.splice(layouts.begin(), layouts, --layouts.end());
 				}
+				layouts.splice(layouts.begin(), layouts, --layouts.end());
+				Forget(layouts.begin());
+				layouts.front()->Resize(maxChars);
+				index = IndexFromLine(lineNumber);
+			}
+			ret = layouts.front();
+			if (index > stepIndex) {
+				ApplyStep(index);
 			}
-			if (!cache[pos]) {
-				cache[pos] = new LineLayout(maxChars);
+			// The new layout is before the step so holds its real line number
+			stepIndex++;
+			ret->lineNumber = lineNumber;
+			byLine.Insert(index, ret);
+			if (stepIndex >= Indexed()) {
+				stepIndex = Indexed();
+				stepLength = 0;
 			}
-			cache[pos]->lineNumber = lineNumber;
-			cache[pos]->inCache = true;
-			ret = cache[pos];
-			useCount++;
 		}
+		ret->inCache = true;
+		useCount++;
 	}
 
 	if (!ret) {
@@ -614,6 +732,8 @@ PositionCache::PositionCache() {
 	clock = 1;
 	pces.resize(0x400);
 	allClear = true;
+	hits = 0;
+	misses = 0;
 }
 
 PositionCache::~PositionCache() {
@@ -640,6 +760,8 @@ void PositionCache::MeasureWidths(Surface *surface, const ViewStyle &vstyle, uns
 
 	allClear = false;
 	size_t probe = pces.size();	// Out of bounds
+	FontAlias fontStyle = vstyle.styles[styleNumber].font;
+	SegmentCache *segments = 0;
 	if ((!pces.empty()) && (len < 30)) {
 		// Only store short strings in the cache so it doesn't churn with
 		// long comments with only a single comment.
@@ -648,16 +770,27 @@ void PositionCache::MeasureWidths(Surface *surface, const ViewStyle &vstyle, uns
 		unsigned int hashValue = PositionCacheEntry::Hash(styleNumber, s, len);
 		probe = hashValue % pces.size();
 		if (pces[probe].Retrieve(styleNumber, s, len, positions)) {
+			hits++;
 			return;
 		}
 		unsigned int probe2 = (hashValue * 37) % pces.size();
 		if (pces[probe2].Retrieve(styleNumber, s, len, positions)) {
+			hits++;
 			return;
 		}
+		misses++;
 		// Not found. Choose the oldest of the two slots to replace
 		if (pces[probe].NewerThan(pces[probe2])) {
 			probe = probe2;
 		}
+	} else if (pdoc && (len > 0)) {
+		// Longer strings are kept by the document with a least recently used policy
+		segments = pdoc->SegmentWidths();
+		if (segments->Budget() == 0) {
+			segments = 0;
+		} else if (segments->Retrieve(fontStyle.GetID(), styleNumber, s, len, positions)) {
+			return;
+		}
 	}
 	if (len > BreakFinder::lengthStartSubdivision) {
 		// Break up into segments
@@ -665,7 +798,6 @@ void PositionCache::MeasureWidths(Surface *surface, const ViewStyle &vstyle, uns
 		XYPOSITION xStartSegment = 0;
 		while (startSegment < len) {
 			unsigned int lenSegment = pdoc->SafeSegment(s + startSegment, len - startSegment, BreakFinder::lengthEachSubdivision);
-			FontAlias fontStyle = vstyle.styles[styleNumber].font;
 			surface->MeasureWidths(fontStyle, s + startSegment, lenSegment, positions + startSegment);
 			for (unsigned int inSeg = 0; inSeg < lenSegment; inSeg++) {
 				positions[startSegment + inSeg] += xStartSegment;
@@ -674,9 +806,11 @@ void PositionCache::MeasureWidths(Surface *surface, const ViewStyle &vstyle, uns
 			startSegment += lenSegment;
 		}
 	} else {
-		FontAlias fontStyle = vstyle.styles[styleNumber].font;
 		surface->MeasureWidths(fontStyle, s, len, positions);
 	}
+	if (segments) {
+		segments->Store(fontStyle.GetID(), styleNumber, s, len, positions);
+	}
 	if (probe < pces.size()) {
 		// Store into cache
 		clock++;
@@ -26,6 +26,8 @@ private:
 	/// Drawing is only performed for @a maxLineLength characters on each line.
 	int lineNumber;
 	bool inCache;
+	/// Where the layout is in the cache's list of layouts in order of use
+	std::list<LineLayout *>::iterator positionUse;
 public:
 	enum { wrapWidthInfinite = 0x7ffffff };
 	int maxLineLength;
@@ -68,16 +70,38 @@ public:
 	int EndLineStyle() const;
 };
 
+typedef std::list<LineLayout *> LineLayoutList;
+
 /**
+ * Layouts are found by line number and kept in order of use. When more lines than the
+ * level allows are needed, the least recently used layout is reused for the new line so
+ * its buffers are not reallocated. Changes to the document invalidate or renumber only the
+ * lines they affect.
+ * Like Partitioning, the line numbers of the layouts after a step are stored without the
+ * lines added or removed since so that an edit only renumbers the layouts between it
+ * and the previous edit.
  */
 class LineLayoutCache {
 	int level;
-	std::vector<LineLayout *>cache;
+	int pages;
+	size_t maxLines;
+	/// Most recently used first
+	LineLayoutList layouts;
+	/// Layouts holding a line in line order
+	SplitVector<LineLayout *> byLine;
+	/// Layouts in byLine from stepIndex on are really stepLength lines after their lineNumber
+	int stepIndex;
+	int stepLength;
 	bool allInvalidated;
-	int styleClock;
 	int useCount;
-	void Allocate(size_t length_);
 	void AllocateForLevel(int linesOnScreen, int linesInDoc);
+	void ApplyStep(int indexUpTo);
+	void BackStep(int indexDownTo);
+	int Indexed() const { return static_cast<int>(byLine.Length()); }
+	int LineAt(int index) const;
+	int IndexFromLine(int line) const;
+	int IndexOf(const LineLayout *ll) const;
+	void Forget(LineLayoutList::iterator it);
 public:
 	LineLayoutCache();
 	virtual ~LineLayoutCache();
@@ -89,9 +113,15 @@ public:
 		llcDocument=SC_CACHE_DOCUMENT
 	};
 	void Invalidate(LineLayout::validLevel validity_);
+	void InvalidateLines(int lineFirst, int lineLast, LineLayout::validLevel validity_);
+	void LinesAddedOrRemoved(int lineOfPos, int linesAdded);
 	void SetLevel(int level_);
 	int GetLevel() const { return level; }
-	LineLayout *Retrieve(int lineNumber, int lineCaret, int maxChars, int styleClock_,
+	void SetPages(int pages_);
+	int GetPages() const { return pages; }
+	size_t Lines() const { return layouts.size(); }
+	int LineOf(const LineLayout *ll) const;
+	LineLayout *Retrieve(int lineNumber, int lineCaret, int maxChars,
 		int linesOnScreen, int linesInDoc);
 	void Dispose(LineLayout *ll);
 };
@@ -174,10 +204,16 @@ public:
 	bool More() const;
 };
 
+/**
+ * Short strings are cached in the view while longer strings are cached by the document's
+ * SegmentCache so the views of a document share them.
+ */
 class PositionCache {
 	std::vector<PositionCacheEntry> pces;
 	unsigned int clock;
 	bool allClear;
+	size_t hits;
+	size_t misses;
 	// Private so PositionCache objects can not be copied
 	PositionCache(const PositionCache &);
 public:
@@ -186,6 +222,8 @@ public:
 	void Clear();
 	void SetSize(size_t size_);
 	size_t GetSize() const { return pces.size(); }
+	size_t Hits() const { return hits; }
+	size_t Misses() const { return misses; }
 	void MeasureWidths(Surface *surface, const ViewStyle &vstyle, unsigned int styleNumber,
 		const char *s, unsigned int len, XYPOSITION *positions, Document *pdoc);
 };
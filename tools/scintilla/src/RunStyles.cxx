@@ -15,6 +15,7 @@
 #include "Platform.h"
 
 #include "Scintilla.h"
+#include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
 #include "RunStyles.h"
@@ -24,7 +25,7 @@ using namespace Scintilla;
 #endif
 
 // Find the first run at a position
-int RunStyles::RunFromPosition(int position) const {
+int RunStyles::RunFromPosition(Sci::Position position) const {
 	int run = starts->PartitionFromPosition(position);
 	// Go to first element with this position
 	while ((run > 0) && (position == starts->PositionFromPartition(run-1))) {
@@ -34,9 +35,9 @@ int RunStyles::RunFromPosition(int position) const {
 }
 
 // If there is no run boundary at position, insert one continuing style.
-int RunStyles::SplitRun(int position) {
+int RunStyles::SplitRun(Sci::Position position) {
 	int run = RunFromPosition(position);
-	int posRun = starts->PositionFromPartition(run);
+	Sci::Position posRun = starts->PositionFromPartition(run);
 	if (posRun < position) {
 		int runStyle = ValueAt(position);
 		run++;
@@ -80,21 +81,21 @@ RunStyles::~RunStyles() {
 	styles = NULL;
 }
 
-int RunStyles::Length() const {
+Sci::Position RunStyles::Length() const {
 	return starts->PositionFromPartition(starts->Partitions());
 }
 
-int RunStyles::ValueAt(int position) const {
+int RunStyles::ValueAt(Sci::Position position) const {
 	return styles->ValueAt(starts->PartitionFromPosition(position));
 }
 
-int RunStyles::FindNextChange(int position, int end) const {
+Sci::Position RunStyles::FindNextChange(Sci::Position position, Sci::Position end) const {
 	int run = starts->PartitionFromPosition(position);
 	if (run < starts->Partitions()) {
-		int runChange = starts->PositionFromPartition(run);
+		Sci::Position runChange = starts->PositionFromPartition(run);
 		if (runChange > position)
 			return runChange;
-		int nextChange = starts->PositionFromPartition(run + 1);
+		Sci::Position nextChange = starts->PositionFromPartition(run + 1);
 		if (nextChange > position) {
 			return nextChange;
 		} else if (position < end) {
@@ -107,19 +108,19 @@ int RunStyles::FindNextChange(int position, int end) const {
 	}
 }
 
-int RunStyles::StartRun(int position) const {
+Sci::Position RunStyles::StartRun(Sci::Position position) const {
 	return starts->PositionFromPartition(starts->PartitionFromPosition(position));
 }
 
-int RunStyles::EndRun(int position) const {
+Sci::Position RunStyles::EndRun(Sci::Position position) const {
 	return starts->PositionFromPartition(starts->PartitionFromPosition(position) + 1);
 }
 
-bool RunStyles::FillRange(int &position, int value, int &fillLength) {
+bool RunStyles::FillRange(Sci::Position &position, int value, Sci::Position &fillLength) {
 	if (fillLength <= 0) {
 		return false;
 	}
-	int end = position + fillLength;
+	Sci::Position end = position + fillLength;
 	if (end > Length()) {
 		return false;
 	}
@@ -164,12 +165,12 @@ bool RunStyles::FillRange(int &position, int value, int &fillLength) {
 	}
 }
 
-void RunStyles::SetValueAt(int position, int value) {
-	int len = 1;
+void RunStyles::SetValueAt(Sci::Position position, int value) {
+	Sci::Position len = 1;
 	FillRange(position, value, len);
 }
 
-void RunStyles::InsertSpace(int position, int insertLength) {
+void RunStyles::InsertSpace(Sci::Position position, Sci::Position insertLength) {
 	int runStart = RunFromPosition(position);
 	if (starts->PositionFromPartition(runStart) == position) {
 		int runStyle = ValueAt(position);
@@ -207,8 +208,8 @@ void RunStyles::DeleteAll() {
 	styles->InsertValue(0, 2, 0);
 }
 
-void RunStyles::DeleteRange(int position, int deleteLength) {
-	int end = position + deleteLength;
+void RunStyles::DeleteRange(Sci::Position position, Sci::Position deleteLength) {
+	Sci::Position end = position + deleteLength;
 	int runStart = RunFromPosition(position);
 	int runEnd = RunFromPosition(end);
 	if (runStart == runEnd) {
@@ -244,7 +245,7 @@ bool RunStyles::AllSameAs(int value) const {
 	return AllSame() && (styles->ValueAt(0) == value);
 }
 
-int RunStyles::Find(int value, int start) const {
+Sci::Position RunStyles::Find(int value, Sci::Position start) const {
 	if (start < Length()) {
 		int run = start ? RunFromPosition(start) : 0;
 		if (styles->ValueAt(run) == value)
@@ -269,9 +270,9 @@ void RunStyles::Check() const {
 	if (starts->Partitions() != styles->Length()-1) {
 		throw std::runtime_error("RunStyles: Partitions and styles different lengths.");
 	}
-	int start=0;
+	Sci::Position start=0;
 	while (start < Length()) {
-		int end = EndRun(start);
+		Sci::Position end = EndRun(start);
 		if (start >= end) {
 			throw std::runtime_error("RunStyles: Partition is 0 length.");
 		}
@@ -0,0 +1,160 @@
+// Scintilla source code edit control
+/** @file SegmentCache.cxx
+ ** Cache for the positions of long segments of text shared by the views of a document.
+ **/
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+#include <list>
+#include <map>
+#include <algorithm>
+
+#include "Platform.h"
+
+#include "SegmentCache.h"
+
+#ifdef SCI_NAMESPACE
+using namespace Scintilla;
+#endif
+
+namespace {
+
+struct SegmentEntry {
+	unsigned int hash;
+	FontID font;
+	unsigned int styleNumber;
+	std::string text;
+	std::vector<XYPOSITION> positions;
+	SegmentEntry(unsigned int hash_, FontID font_, unsigned int styleNumber_, const char *s, unsigned int len,
+		const XYPOSITION *positions_) :
+		hash(hash_), font(font_), styleNumber(styleNumber_), text(s, len), positions(positions_, positions_ + len) {
+	}
+	bool Matches(FontID font_, unsigned int styleNumber_, const char *s, unsigned int len) const {
+		return (font == font_) && (styleNumber == styleNumber_) && (text.length() == len) &&
+			(memcmp(text.c_str(), s, len) == 0);
+	}
+	// Approximate so that the budget includes the overhead of allocations and the lookup table
+	size_t Bytes() const {
+		return sizeof(SegmentEntry) + 64 + text.length() + positions.size() * sizeof(XYPOSITION);
+	}
+};
+
+typedef std::list<SegmentEntry> SegmentList;
+
+unsigned int HashSegment(FontID font, unsigned int styleNumber, const char *s, unsigned int len) {
+	// FNV-1a
+	unsigned int hash = 2166136261u;
+	for (unsigned int i = 0; i < len; i++) {
+		hash ^= static_cast<unsigned char>(s[i]);
+		hash *= 16777619u;
+	}
+	hash ^= styleNumber;
+	hash *= 16777619u;
+	hash ^= static_cast<unsigned int>(reinterpret_cast<size_t>(font) >> 4);
+	hash *= 16777619u;
+	return hash;
+}
+
+}
+
+// Entries in order of use with the most recently used first, indexed by hash
+struct SegmentCache::Cache {
+	SegmentList entries;
+	std::multimap<unsigned int, SegmentList::iterator> byHash;
+};
+
+unsigned int SegmentCache::fontGeneration = 0;
+
+SegmentCache::SegmentCache() : cache(new Cache()), budget(0x100000), used(0), hits(0), misses(0),
+	generation(fontGeneration) {
+}
+
+SegmentCache::~SegmentCache() {
+	delete cache;
+	cache = 0;
+}
+
+void SegmentCache::Clear() {
+	cache->byHash.clear();
+	cache->entries.clear();
+	used = 0;
+}
+
+void SegmentCache::SetBudget(size_t bytes) {
+	budget = bytes;
+	Discard();
+}
+
+size_t SegmentCache::Budget() const {
+	return budget;
+}
+
+size_t SegmentCache::Used() const {
+	return used;
+}
+
+size_t SegmentCache::Entries() const {
+	return cache->entries.size();
+}
+
+bool SegmentCache::Retrieve(FontID font, unsigned int styleNumber, const char *s, unsigned int len, XYPOSITION *positions) {
+	CheckGeneration();
+	if (!cache->entries.empty()) {
+		const unsigned int hash = HashSegment(font, styleNumber, s, len);
+		typedef std::multimap<unsigned int, SegmentList::iterator>::const_iterator HashIterator;
+		const std::pair<HashIterator, HashIterator> range = cache->byHash.equal_range(hash);
+		for (HashIterator it = range.first; it != range.second; ++it) {
+			const SegmentList::iterator entry = it->second;
+			if (entry->Matches(font, styleNumber, s, len)) {
+				std::copy(entry->positions.begin(), entry->positions.end(), positions);
+				// Move to the front as most recently used
+				cache->entries.splice(cache->entries.begin(), cache->entries, entry);
+				hits++;
+				return true;
+			}
+		}
+	}
+	misses++;
+	return false;
+}
+
+void SegmentCache::Store(FontID font, unsigned int styleNumber, const char *s, unsigned int len, const XYPOSITION *positions) {
+	CheckGeneration();
+	const unsigned int hash = HashSegment(font, styleNumber, s, len);
+	cache->entries.push_front(SegmentEntry(hash, font, styleNumber, s, len, positions));
+	cache->byHash.insert(std::make_pair(hash, cache->entries.begin()));
+	used += cache->entries.front().Bytes();
+	Discard();
+}
+
+void SegmentCache::FontsChanged() {
+	fontGeneration++;
+}
+
+void SegmentCache::CheckGeneration() {
+	if (generation != fontGeneration) {
+		Clear();
+		generation = fontGeneration;
+	}
+}
+
+void SegmentCache::Discard() {
+	// Remove least recently used entries until within budget
+	while ((used > budget) && !cache->entries.empty()) {
+		const SegmentList::iterator last = --cache->entries.end();
+		typedef std::multimap<unsigned int, SegmentList::iterator>::iterator HashIterator;
+		const std::pair<HashIterator, HashIterator> range = cache->byHash.equal_range(last->hash);
+		for (HashIterator it = range.first; it != range.second; ++it) {
+			if (it->second == last) {
+				cache->byHash.erase(it);
+				break;
+			}
+		}
+		used -= last->Bytes();
+		cache->entries.erase(last);
+	}
+}
@@ -0,0 +1,58 @@
+// Scintilla source code edit control
+/** @file SegmentCache.h
+ ** Cache for the positions of long segments of text shared by the views of a document.
+ **/
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef SEGMENTCACHE_H
+#define SEGMENTCACHE_H
+
+#ifdef SCI_NAMESPACE
+namespace Scintilla {
+#endif
+
+/**
+ * Holds the positions of segments too long for PositionCache such as long identifiers, comments
+ * and the runs of minified files. Each Document has one so that all the views of the document
+ * share it. Entries are found by font, style and text so views with different fonts do not see
+ * each other's entries. Once the entries use more than the budget of bytes, the least recently
+ * used are discarded.
+ */
+class SegmentCache {
+public:
+	SegmentCache();
+	~SegmentCache();
+	void Clear();
+	void SetBudget(size_t bytes);
+	size_t Budget() const;
+	size_t Used() const;
+	size_t Entries() const;
+	bool Retrieve(FontID font, unsigned int styleNumber, const char *s, unsigned int len, XYPOSITION *positions);
+	void Store(FontID font, unsigned int styleNumber, const char *s, unsigned int len, const XYPOSITION *positions);
+	size_t Hits() const { return hits; }
+	size_t Misses() const { return misses; }
+	/// Called when fonts may have been released so that their FontIDs may be reused.
+	/// Every SegmentCache forgets its entries before it is next used.
+	static void FontsChanged();
+private:
+	struct Cache;
+	Cache *cache;
+	size_t budget;
+	size_t used;
+	size_t hits;
+	size_t misses;
+	unsigned int generation;
+	static unsigned int fontGeneration;
+	void CheckGeneration();
+	void Discard();
+
+	// Private so SegmentCache objects can not be copied
+	SegmentCache(const SegmentCache &);
+	SegmentCache &operator=(const SegmentCache &);
+};
+
+#ifdef SCI_NAMESPACE
+}
+#endif
+
+#endif
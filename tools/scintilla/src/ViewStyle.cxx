@@ -5,6 +5,7 @@
 // Copyright 1998-2003 by Neil Hodgson <neilh@scintilla.org>
 // The License.txt file describes the conditions under which this software may be distributed.
 
+#include <stddef.h>
 #include <string.h>
 #include <assert.h>
 
@@ -14,6 +15,7 @@
 #include "Platform.h"
 
 #include "Scintilla.h"
+#include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
 #include "RunStyles.h"
@@ -22,6 +24,7 @@
 #include "LineMarker.h"
 #include "Style.h"
 #include "ViewStyle.h"
+#include "SegmentCache.h"
 
 #ifdef SCI_NAMESPACE
 using namespace Scintilla;
@@ -177,10 +180,18 @@ ViewStyle::ViewStyle(const ViewStyle &source) {
 
 ViewStyle::~ViewStyle() {
 	styles.clear();
+	ReleaseAllFonts();
+}
+
+// Releasing fonts lets their FontIDs be reused so segment positions measured with them are forgotten.
+void ViewStyle::ReleaseAllFonts() {
+	if (fonts.empty())
+		return;
 	for (FontMap::iterator it = fonts.begin(); it != fonts.end(); ++it) {
 		delete it->second;
 	}
 	fonts.clear();
+	SegmentCache::FontsChanged();
 }
 
 void ViewStyle::Init(size_t stylesSize_) {
@@ -293,10 +304,7 @@ void ViewStyle::Init(size_t stylesSize_) {
 }
 
 void ViewStyle::Refresh(Surface &surface, int tabInChars) {
-	for (FontMap::iterator it = fonts.begin(); it != fonts.end(); ++it) {
-		delete it->second;
-	}
-	fonts.clear();
+	ReleaseAllFonts();
 
 	selbar = Platform::Chrome();
 	selbarlight = Platform::ChromeHighlight();
@@ -183,6 +183,7 @@ public:
 
 private:
 	void AllocStyles(size_t sizeNew);
+	void ReleaseAllFonts();
 	void CreateAndAddFont(const FontSpecification &fs);
 	FontRealised *Find(const FontSpecification &fs);
 	void FindMaxAscentDescent();
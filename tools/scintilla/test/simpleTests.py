@@ -4,7 +4,7 @@
 from __future__ import with_statement
 from __future__ import unicode_literals
 
-import codecs, ctypes, os, sys, unittest
+import codecs, ctypes, os, sys, time, unittest
 
 if sys.platform == "win32":
 	import XiteWin as Xite
@@ -1748,6 +1748,49 @@ class TestLexer(unittest.TestCase):
 		wordSet = self.ed.DescribeKeyWordSets()
 		self.assertNotEquals(wordSet, b"")
 
+class TestIdleStyling(unittest.TestCase):
+	def setUp(self):
+		self.xite = Xite.xiteFrame
+		self.ed = self.xite.ed
+		self.ed.ClearAll()
+		self.ed.EmptyUndoBuffer()
+		self.ed.Lexer = self.ed.SCLEX_CPP
+		self.ed.IdleStyling = self.ed.SC_IDLESTYLING_ALL
+		text = b"int x = 1; // A comment long enough to wrap in narrow windows\n" * 20000
+		self.ed.AddText(len(text), text)
+
+	def tearDown(self):
+		self.ed.IdleStyling = self.ed.SC_IDLESTYLING_NONE
+		self.ed.WrapMode = self.ed.SC_WRAP_NONE
+		self.ed.Lexer = self.ed.SCLEX_CONTAINER
+		self.ed.ClearAll()
+		self.ed.EmptyUndoBuffer()
+
+	def styleInIdle(self):
+		# Idle styling continues while events are processed, allow it up to 10 seconds
+		for i in range(1000):
+			self.xite.DoEvents()
+			if self.ed.EndStyled == self.ed.Length:
+				break
+			time.sleep(0.01)
+
+	def testIdleStylingAll(self):
+		self.styleInIdle()
+		self.assertEquals(self.ed.EndStyled, self.ed.Length)
+
+	def testIdleStylingAfterWrapping(self):
+		# Idle styling starts once idle wrapping has finished
+		self.ed.WrapMode = self.ed.SC_WRAP_WORD
+		self.styleInIdle()
+		self.assertEquals(self.ed.EndStyled, self.ed.Length)
+
+	def testIdleStylingWithBackgroundWrapping(self):
+		self.ed.WrapThreads = 2
+		self.ed.WrapMode = self.ed.SC_WRAP_WORD
+		self.styleInIdle()
+		self.ed.WrapThreads = 0
+		self.assertEquals(self.ed.EndStyled, self.ed.Length)
+
 class TestSubStyles(unittest.TestCase):
 	''' These tests include knowledge of the current implementation in the cpp lexer
 	and may have to change when that implementation changes.
@@ -10,13 +10,34 @@ CXXFLAGS = /EHsc /wd 4805 $(INCLUDEDIRS)
 
 # Files in this directory containing tests
 TESTSRC=test*.cxx
-# Files being tested from scintilla/src directory
+# Files being tested from scintilla/src and lexlib directories and a lexer to benchmark
 TESTEDSRC=\
+ ../../src/BackgroundWrap.cxx \
+ ../../src/CaseConvert.cxx \
+ ../../src/CaseFolder.cxx \
  ../../src/CellBuffer.cxx \
  ../../src/CharClassify.cxx \
  ../../src/ContractionState.cxx \
+ ../../src/DFASearch.cxx \
  ../../src/Decoration.cxx \
- ../../src/RunStyles.cxx 
+ ../../src/Document.cxx \
+ ../../src/PerLine.cxx \
+ ../../src/PositionCache.cxx \
+ ../../src/RESearch.cxx \
+ ../../src/RunStyles.cxx \
+ ../../src/SegmentCache.cxx \
+ ../../src/Selection.cxx \
+ ../../src/Style.cxx \
+ ../../src/UniConversion.cxx \
+ ../../lexlib/Accessor.cxx \
+ ../../lexlib/CharacterSet.cxx \
+ ../../lexlib/LexerBase.cxx \
+ ../../lexlib/LexerModule.cxx \
+ ../../lexlib/LexerSimple.cxx \
+ ../../lexlib/PropSetSimple.cxx \
+ ../../lexlib/StyleContext.cxx \
+ ../../lexlib/WordList.cxx \
+ ../../lexers/LexCPP.cxx 
 
 TESTS=$(EXE)
 
@@ -25,6 +46,9 @@ all: $(TESTS)
 test: $(TESTS)
 	$(EXE)
 
+benchmark: $(TESTS)
+	$(EXE) "[benchmark]"
+
 clean:
 	$(DEL) $(TESTS) *.o *.obj *.exe
 
@@ -0,0 +1,156 @@
+// Unit Tests for Scintilla internal data structures
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include "Platform.h"
+
+#include "Scintilla.h"
+#include "BackgroundWrap.h"
+
+#include "catch.hpp"
+
+// Test WrapJob and WrapQueue.
+
+// Every character is 10 pixels wide except in the invisible style 2.
+class FixedMeasurer : public CharacterMeasurer {
+public:
+	int measured;
+	FixedMeasurer() : measured(0) {}
+	virtual int EncodingFamily() const {
+		return 1;	// efUnicode
+	}
+	virtual bool IsDBCSLeadByte(char) const {
+		return false;
+	}
+	virtual bool Visible(int style) const {
+		return style != 2;
+	}
+	virtual XYPOSITION Measure(int, const char *, int) {
+		measured++;
+		return 10.0f;
+	}
+};
+
+static WrapJob *MakeJob(const std::vector<std::string> &lines, int width, int wrapState, WrapWidths &widths, unsigned char style=0, int lineStart=5) {
+	FixedMeasurer measurer;
+	WrapParameters parameters;
+	parameters.width = width;
+	parameters.wrapState = wrapState;
+	parameters.aveCharWidth = 10.0f;
+	parameters.spaceWidth = 10.0f;
+	parameters.tabWidth = 80.0f;
+	for (size_t i = 0; i < lines.size(); i++) {
+		const std::vector<unsigned char> styles(lines[i].length() + 1, style);
+		widths.MeasureText(measurer, lines[i].c_str(), &styles[0], static_cast<int>(lines[i].length()));
+	}
+	WrapJob *job = new WrapJob(lineStart, parameters, widths);
+	for (size_t i = 0; i < lines.size(); i++) {
+		const std::vector<unsigned char> styles(lines[i].length() + 1, style);
+		const int length = static_cast<int>(lines[i].length());
+		job->AddLine(lines[i].c_str(), &styles[0], length, length);
+	}
+	return job;
+}
+
+TEST_CASE("BackgroundWrap") {
+
+	WrapWidths widths;
+	std::vector<std::string> lines;
+
+	SECTION("MeasuresEachCharacterOnce") {
+		FixedMeasurer measurer;
+		const char *text = "abab\xc3\xa9\xc3\xa9";
+		const unsigned char styles[8] = {};
+		widths.MeasureText(measurer, text, styles, 8);
+		REQUIRE(3 == measurer.measured);
+		REQUIRE(1 == widths.CharacterLength(text, 8));
+		REQUIRE(2 == widths.CharacterLength(text + 4, 4));
+		REQUIRE(10.0f == widths.Width(0, text + 4, 2));
+	}
+
+	SECTION("WordWrap") {
+		lines.push_back("");
+		lines.push_back("short");
+		lines.push_back("aaaa bbbb cccc dddd");	// 190 pixels
+		lines.push_back("aaaaaaaaaaaaaaaaaaaaaaaaa");	// 250 pixels without a break
+		lines.push_back("aaaaaaaaaaaaaaa bb");
+		WrapJob *job = MakeJob(lines, 100, 1, widths);
+		REQUIRE(5 == job->Lines());
+		REQUIRE(10 == job->lineEnd);
+		job->Wrap();
+		REQUIRE(1 == job->subLines[0]);
+		REQUIRE(1 == job->subLines[1]);
+		REQUIRE(3 == job->subLines[2]);
+		REQUIRE(3 == job->subLines[3]);
+		REQUIRE(2 == job->subLines[4]);
+		delete job;
+	}
+
+	SECTION("CharacterWrap") {
+		lines.push_back("aaaaaaaaaaaaaaa bb");
+		WrapJob *job = MakeJob(lines, 100, 2, widths);
+		job->Wrap();
+		REQUIRE(3 == job->subLines[0]);
+		delete job;
+	}
+
+	SECTION("Tabs") {
+		lines.push_back("\t\t\ta");	// Tab stops every 80 pixels so 250 wide
+		WrapJob *job = MakeJob(lines, 200, 1, widths);
+		job->Wrap();
+		REQUIRE(2 == job->subLines[0]);
+		delete job;
+	}
+
+	SECTION("InvisibleStyle") {
+		lines.push_back("aaaaaaaaaaaaaaaaaaaaaaaaa");
+		WrapJob *job = MakeJob(lines, 100, 1, widths, 2);
+		job->Wrap();
+		REQUIRE(1 == job->subLines[0]);
+		delete job;
+	}
+
+	SECTION("QueueReturnsJobsInOrder") {
+		WrapQueue queue(3);
+		for (int j = 0; j < 10; j++) {
+			// Later jobs are smaller so are likely to finish before earlier ones
+			std::vector<std::string> text(2000 - j * 150, "aaaa bbbb cccc dddd eeee ffff");
+			queue.Add(MakeJob(text, 100, 1, widths, 0, j * 1000));
+		}
+		REQUIRE(10 == queue.Length());
+		int taken = 0;
+		// Each wait is 100 milliseconds so this allows a minute for the jobs to finish
+		for (int attempt = 0; (attempt < 600) && (taken < 10); attempt++) {
+			WrapJob *job = queue.TakeFinished(100);
+			if (job) {
+				REQUIRE(WrapJob::jsFinished == job->state);
+				const int lineStartExpected = taken * 1000;
+				const int linesExpected = 2000 - taken * 150;
+				REQUIRE(lineStartExpected == job->lineStart);
+				REQUIRE(linesExpected == static_cast<int>(job->subLines.size()));
+				REQUIRE(5 == job->subLines.back());
+				delete job;
+				taken++;
+			}
+		}
+		REQUIRE(10 == taken);
+		REQUIRE(0 == queue.Length());
+		REQUIRE(0 == queue.TakeFinished(0));
+	}
+
+	SECTION("QueueClear") {
+		WrapQueue queue(2);
+		std::vector<std::string> text(2000, "aaaa bbbb cccc dddd eeee ffff");
+		for (int j = 0; j < 10; j++) {
+			queue.Add(MakeJob(text, 100, 1, widths));
+		}
+		queue.Clear();
+		REQUIRE(0 == queue.Length());
+		REQUIRE(0 == queue.TakeFinished(0));
+	}
+}
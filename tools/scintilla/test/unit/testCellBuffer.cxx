@@ -2,10 +2,14 @@
 
 #include <cstring>
 #include <stdexcept>
+#include <string>
+#include <vector>
 #include <algorithm>
 
 #include "Platform.h"
 
+#include "ILexer.h"
+#include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
 #include "RunStyles.h"
@@ -15,6 +19,61 @@
 
 // Test CellBuffer.
 
+// Text held by the test instead of a file mapping.
+class StringText : public IMappedText {
+public:
+	std::string text;
+	bool released;
+	explicit StringText(const std::string &text_) : text(text_), released(false) {}
+	virtual void SCI_METHOD Release() {
+		released = true;
+	}
+	virtual const char * SCI_METHOD Text() {
+		return text.c_str();
+	}
+	virtual int SCI_METHOD Length() {
+		return static_cast<int>(text.length());
+	}
+};
+
+static void IndexAllLines(CellBuffer &cb) {
+	while (cb.IndexingLines()) {
+		cb.IndexLines(10);
+	}
+}
+
+// Line starts found by examining one byte at a time.
+static std::vector<int> LineStartsOf(const std::string &text, bool utf8LineEnds) {
+	std::vector<int> starts(1, 0);
+	for (size_t i = 0; i < text.length(); i++) {
+		const unsigned char ch = text[i];
+		bool lineEnd = false;
+		if (ch == '\r') {
+			lineEnd = (i + 1 == text.length()) || (text[i + 1] != '\n');
+		} else if (ch == '\n') {
+			lineEnd = true;
+		} else if (utf8LineEnds) {
+			const bool nel = (i >= 1) && (ch == 0x85) && (static_cast<unsigned char>(text[i - 1]) == 0xc2);
+			const bool separator = (i >= 2) && ((ch == 0xa8) || (ch == 0xa9)) &&
+				(static_cast<unsigned char>(text[i - 1]) == 0x80) && (static_cast<unsigned char>(text[i - 2]) == 0xe2);
+			lineEnd = nel || separator;
+		}
+		if (lineEnd)
+			starts.push_back(static_cast<int>(i + 1));
+	}
+	return starts;
+}
+
+static bool SameLineStarts(const CellBuffer &cb, const std::vector<int> &starts) {
+	if (cb.Lines() != static_cast<int>(starts.size()))
+		return false;
+	for (size_t line = 0; line < starts.size(); line++) {
+		if (cb.LineStart(static_cast<int>(line)) != starts[line])
+			return false;
+	}
+	return true;
+}
+
 TEST_CASE("CellBuffer") {
 
 	const char sText[] = "Scintilla";
@@ -120,6 +179,74 @@ TEST_CASE("CellBuffer") {
 		REQUIRE(!cb.CanRedo());
 	}
 
+	SECTION("UndoReplacesRedo") {
+		bool startSequence = false;
+		cb.InsertString(0, "abc", 3, startSequence);
+		cb.StartUndo();
+		cb.PerformUndoStep();
+		REQUIRE(cb.CanRedo());
+		// The text of the redo action is discarded and replaced
+		const char *cpChange = cb.InsertString(0, "xyz", 3, startSequence);
+		REQUIRE(memcmp(cpChange, "xyz", 3) == 0);
+		REQUIRE(!cb.CanRedo());
+		cb.StartUndo();
+		cb.PerformUndoStep();
+		REQUIRE(0 == cb.Length());
+		cb.StartRedo();
+		cb.PerformRedoStep();
+		REQUIRE(memcmp(cb.BufferPointer(), "xyz", 3) == 0);
+	}
+
+	SECTION("UndoLargerThanChunks") {
+		const std::string large(3000000, 'L');
+		bool startSequence = false;
+		cb.InsertString(0, sText, sLength, startSequence);
+		cb.InsertString(0, large.c_str(), large.length(), startSequence);
+		cb.InsertString(0, sText, sLength, startSequence);
+		REQUIRE((large.length() + sLength * 2) == static_cast<size_t>(cb.Length()));
+		for (int operation = 0; operation < 3; operation++) {
+			cb.StartUndo();
+			cb.PerformUndoStep();
+		}
+		REQUIRE(0 == cb.Length());
+		for (int operation = 0; operation < 3; operation++) {
+			cb.StartRedo();
+			cb.PerformRedoStep();
+		}
+		REQUIRE(memcmp(cb.BufferPointer(), sText, sLength) == 0);
+		REQUIRE('L' == cb.CharAt(sLength));
+		REQUIRE('L' == cb.CharAt(sLength + large.length() - 1));
+	}
+
+	SECTION("UndoMemoryLimit") {
+		cb.SetUndoMemoryLimit(10000);
+		REQUIRE(10000 == cb.UndoMemoryLimit());
+		cb.SetSavePoint();
+		bool startSequence = false;
+		const int operations = 1000;
+		for (int i = 0; i < operations; i++) {
+			const std::string block(100, static_cast<char>('a' + i % 26));
+			cb.BeginUndoAction();
+			cb.InsertString(0, block.c_str(), 100, startSequence);
+			cb.EndUndoAction();
+		}
+		REQUIRE((operations * 100) == cb.Length());
+		// Each operation uses more than 100 bytes so fewer than 100 are kept
+		int undone = 0;
+		while (cb.CanUndo()) {
+			const int steps = cb.StartUndo();
+			for (int step = 0; step < steps; step++)
+				cb.PerformUndoStep();
+			undone++;
+		}
+		REQUIRE(undone > 10);
+		REQUIRE(undone < 100);
+		REQUIRE(((operations - undone) * 100) == cb.Length());
+		REQUIRE(static_cast<char>('a' + (operations - undone - 1) % 26) == cb.CharAt(0));
+		// The save point was discarded
+		REQUIRE(!cb.IsSavePoint());
+	}
+
 	SECTION("LineEndTypes") {
 		REQUIRE(cb.GetLineEndTypes() == 0);
 		cb.SetLineEndTypes(1);
@@ -128,6 +255,100 @@ TEST_CASE("CellBuffer") {
 		REQUIRE(cb.GetLineEndTypes() == 0);
 	}
 
+	SECTION("LineEndsInLargeInsertion") {
+		// Long enough to need several batches of line starts
+		std::string text;
+		for (int i = 0; i < 3000; i++) {
+			text += "line";
+			text += (i % 3 == 0) ? "\r\n" : ((i % 3 == 1) ? "\n" : "\r");
+		}
+		bool startSequence = false;
+		cb.InsertString(0, text.c_str(), static_cast<int>(text.length()), startSequence);
+		REQUIRE(3001 == cb.Lines());
+		int position = 0;
+		for (int line = 0; line < 3000; line++) {
+			REQUIRE(position == cb.LineStart(line));
+			position += (line % 3 == 0) ? 6 : 5;
+		}
+		REQUIRE(position == cb.LineStart(3000));
+		// Joining a CR at the end of a line with an inserted LF
+		cb.InsertString(cb.LineStart(3), "\nx", 2, startSequence);
+		REQUIRE(3001 == cb.Lines());
+		REQUIRE(17 == cb.LineStart(3));
+	}
+
+	SECTION("UTF8LineEnds") {
+		const char sUTF8Text[] = "a\xe2\x80\xa8" "b\xc2\x85" "c\xe2\x80\xa9" "d";
+		bool startSequence = false;
+		cb.InsertString(0, sUTF8Text, static_cast<int>(strlen(sUTF8Text)), startSequence);
+		REQUIRE(1 == cb.Lines());
+		cb.SetLineEndTypes(1);
+		REQUIRE(4 == cb.Lines());
+		REQUIRE(4 == cb.LineStart(1));
+		REQUIRE(7 == cb.LineStart(2));
+		REQUIRE(11 == cb.LineStart(3));
+		// Insertion completing a separator that starts in the buffer
+		cb.InsertString(12, "\xe2\x80", 2, startSequence);
+		cb.InsertString(14, "\xa8", 1, startSequence);
+		REQUIRE(5 == cb.Lines());
+		REQUIRE(15 == cb.LineStart(4));
+	}
+
+	SECTION("LineEndsAcrossBlocks") {
+		// Line ends are found 16 bytes at a time so place each kind of line end at every
+		// offset around block edges with long runs between them, then enough lines for
+		// several batches with the CR and LF of a CR LF in different batches.
+		std::string text;
+		for (int offset = 0; offset < 40; offset++) {
+			text.append(offset + 16, 'a');
+			text += "\r\n";
+			text.append(offset + 13, 'b');
+			text += "\r";
+			text.append(offset + 17, 'c');
+			text += "\n";
+			text.append(offset + 15, 'd');
+			text += "\xe2\x80\xa8";
+			text.append(offset + 14, 'e');
+			text += "\xc2\x85";
+			text.append(offset + 16, 'f');
+			text += "\xe2\x80\xa9";
+		}
+		for (int i = 0; i < 1100; i++) {
+			text += "g";
+			text += (i % 2 == 0) ? "\n" : "\r";
+		}
+		text += "\r\nhh\n";
+		for (int i = 0; i < 2100; i++) {
+			text += (i == 1023) ? "\r\n" : "\n";
+		}
+		const int length = static_cast<int>(text.length());
+		bool startSequence = false;
+		for (int utf8LineEnds = 0; utf8LineEnds < 2; utf8LineEnds++) {
+			const std::vector<int> starts = LineStartsOf(text, utf8LineEnds != 0);
+			INFO("utf8LineEnds " << utf8LineEnds);
+			// In one piece
+			CellBuffer cbWhole;
+			cbWhole.SetLineEndTypes(utf8LineEnds);
+			cbWhole.InsertString(0, text.c_str(), length, startSequence);
+			REQUIRE(SameLineStarts(cbWhole, starts));
+			// In two pieces split inside line ends
+			const int splits[] = { 1, 17, 18, 34, 35, 51, 52, 53, 70, 71, length / 2, length - 2100 + 1024 };
+			for (size_t i = 0; i < sizeof(splits) / sizeof(splits[0]); i++) {
+				CellBuffer cbSplit;
+				cbSplit.SetLineEndTypes(utf8LineEnds);
+				cbSplit.InsertString(0, text.c_str() + splits[i], length - splits[i], startSequence);
+				cbSplit.InsertString(0, text.c_str(), splits[i], startSequence);
+				INFO("split at " << splits[i]);
+				REQUIRE(SameLineStarts(cbSplit, starts));
+			}
+			// Found again when the line end types are changed
+			CellBuffer cbReset;
+			cbReset.InsertString(0, text.c_str(), length, startSequence);
+			cbReset.SetLineEndTypes(utf8LineEnds);
+			REQUIRE(SameLineStarts(cbReset, starts));
+		}
+	}
+
 	SECTION("ReadOnly") {
 		REQUIRE(!cb.IsReadOnly());
 		cb.SetReadOnly(true);
@@ -137,4 +358,145 @@ TEST_CASE("CellBuffer") {
 		REQUIRE(cb.Length() == 0);
 	}
 
+	SECTION("MappedText") {
+		StringText mapped("ab\ncd\r\nef\rgh");
+		// Declared after mapped so it is destroyed before the text
+		CellBuffer cbMapped;
+		cbMapped.SetMappedText(&mapped);
+		REQUIRE(cbMapped.IsMapped());
+		REQUIRE(cbMapped.IsReadOnly());
+		REQUIRE(12 == cbMapped.Length());
+		REQUIRE('c' == cbMapped.CharAt(3));
+		REQUIRE(0 == cbMapped.CharAt(12));
+		REQUIRE(mapped.text.c_str() == cbMapped.BufferPointer());
+		IndexAllLines(cbMapped);
+		REQUIRE(4 == cbMapped.Lines());
+		REQUIRE(3 == cbMapped.LineStart(1));
+		REQUIRE(7 == cbMapped.LineStart(2));
+		REQUIRE(10 == cbMapped.LineStart(3));
+		REQUIRE(1 == cbMapped.LineFromPosition(5));
+		char buffer[4] = "";
+		cbMapped.GetCharRange(buffer, 3, 3);
+		REQUIRE(0 == memcmp(buffer, "cd\r", 3));
+		// Mapped text can not be changed
+		cbMapped.SetReadOnly(false);
+		REQUIRE(cbMapped.IsReadOnly());
+		bool startSequence = false;
+		cbMapped.InsertString(0, sText, sLength, startSequence);
+		REQUIRE(12 == cbMapped.Length());
+		// Styles are stored only as far as they have been set
+		REQUIRE(0 == cbMapped.StyleAt(5));
+		REQUIRE(cbMapped.SetStyleFor(0, 4, 3));
+		REQUIRE(3 == cbMapped.StyleAt(3));
+		REQUIRE(0 == cbMapped.StyleAt(4));
+		unsigned char styles[6] = {9, 9, 9, 9, 9, 9};
+		cbMapped.GetStyleRange(styles, 2, 4);
+		REQUIRE(3 == styles[0]);
+		REQUIRE(3 == styles[1]);
+		REQUIRE(0 == styles[2]);
+		REQUIRE(0 == styles[3]);
+		REQUIRE(9 == styles[4]);
+	}
+
+	SECTION("MappedTextLineEnds") {
+		// Several blocks of lines with UTF-8 line ends and a CR LF split across a block
+		std::string text(1024 * 1024 - 1, 'a');
+		text += "\r\n";
+		for (int i = 0; i < 20000; i++) {
+			text += (i % 2) ? "line\xe2\x80\xa8" : "line\xc2\x85";
+		}
+		text += "end";
+		StringText mapped(text);
+		CellBuffer cbMapped;
+		cbMapped.SetMappedText(&mapped);
+		IndexAllLines(cbMapped);
+		REQUIRE(2 == cbMapped.Lines());
+		REQUIRE((1024 * 1024 + 1) == cbMapped.LineStart(1));
+		cbMapped.SetLineEndTypes(1);
+		REQUIRE(cbMapped.IndexingLines());
+		IndexAllLines(cbMapped);
+		REQUIRE(20002 == cbMapped.Lines());
+		REQUIRE((1024 * 1024 + 1 + 6) == cbMapped.LineStart(2));
+		REQUIRE((1024 * 1024 + 1 + 6 + 7) == cbMapped.LineStart(3));
+		REQUIRE((cbMapped.Length() - 3) == cbMapped.LineStart(20001));
+	}
+
+}
+
+TEST_CASE("CellBufferMappedTextReleased") {
+	StringText mapped("mapped");
+	{
+		CellBuffer cb;
+		cb.SetMappedText(&mapped);
+		REQUIRE(!mapped.released);
+	}
+	REQUIRE(mapped.released);
+}
+
+TEST_CASE("StyleBuffer") {
+
+	StyleBuffer sb;
+	sb.InsertSpace(0, 1000);
+
+	SECTION("NothingStoredForStyle0") {
+		REQUIRE(1000 == sb.Length());
+		REQUIRE(!sb.FillRange(0, 0, 1000));
+		REQUIRE(StyleBuffer::stNone == sb.GetStorage());
+		REQUIRE(0 == sb.ValueAt(999));
+		char styles[4] = { 1, 1, 1, 1 };
+		sb.GetRange(styles, 10, 4);
+		REQUIRE(0 == styles[3]);
+	}
+
+	SECTION("LongRuns") {
+		REQUIRE(sb.FillRange(100, 5, 200));
+		REQUIRE(!sb.FillRange(150, 5, 10));
+		REQUIRE(StyleBuffer::stRuns == sb.GetStorage());
+		REQUIRE(0 == sb.ValueAt(99));
+		REQUIRE(5 == sb.ValueAt(100));
+		REQUIRE(5 == sb.ValueAt(299));
+		REQUIRE(0 == sb.ValueAt(300));
+		char styles[4];
+		sb.GetRange(styles, 98, 4);
+		REQUIRE(0 == styles[1]);
+		REQUIRE(5 == styles[2]);
+		// Inserted text is not styled even inside a run
+		sb.InsertSpace(200, 10);
+		REQUIRE(1010 == sb.Length());
+		REQUIRE(5 == sb.ValueAt(199));
+		REQUIRE(0 == sb.ValueAt(200));
+		REQUIRE(5 == sb.ValueAt(210));
+		sb.DeleteRange(150, 200);
+		REQUIRE(810 == sb.Length());
+		REQUIRE(5 == sb.ValueAt(149));
+		REQUIRE(0 == sb.ValueAt(150));
+		// Back to storing nothing once every style is 0
+		REQUIRE(sb.FillRange(0, 0, 810));
+		REQUIRE(StyleBuffer::stNone == sb.GetStorage());
+	}
+
+	SECTION("ShortRunsStoredAsBytes") {
+		for (int i = 0; i < 50; i++) {
+			sb.FillRange(i * 4, static_cast<char>(i % 2 + 1), 2);
+		}
+		REQUIRE(StyleBuffer::stBytes == sb.GetStorage());
+		REQUIRE(1 == sb.ValueAt(0));
+		REQUIRE(0 == sb.ValueAt(2));
+		REQUIRE(2 == sb.ValueAt(197));
+		REQUIRE(0 == sb.ValueAt(500));
+		REQUIRE(sb.FillRange(900, 3, 2));
+		REQUIRE(3 == sb.ValueAt(901));
+		REQUIRE(0 == sb.ValueAt(899));
+		char styles[6];
+		sb.GetRange(styles, 898, 6);
+		REQUIRE(0 == styles[0]);
+		REQUIRE(3 == styles[3]);
+		REQUIRE(0 == styles[5]);
+		sb.InsertSpace(0, 2);
+		REQUIRE(0 == sb.ValueAt(0));
+		REQUIRE(1 == sb.ValueAt(2));
+		sb.DeleteRange(0, 1002);
+		REQUIRE(0 == sb.Length());
+		REQUIRE(StyleBuffer::stNone == sb.GetStorage());
+	}
 }
@@ -1,11 +1,13 @@
 // Unit Tests for Scintilla internal data structures
 
+#include <stddef.h>
 #include <string.h>
 
 #include <algorithm>
 
 #include "Platform.h"
 
+#include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
 #include "RunStyles.h"
@@ -0,0 +1,151 @@
+// Unit Tests for Scintilla internal data structures
+
+#include <string.h>
+#include <time.h>
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "Platform.h"
+
+#include "CharClassify.h"
+#include "RESearch.h"
+#include "DFASearch.h"
+
+#include "catch.hpp"
+
+// Test DFASearch.
+
+class StringIndexer : public CharacterIndexer {
+	const std::string &text;
+public:
+	explicit StringIndexer(const std::string &text_) : text(text_) {}
+	virtual char CharAt(int index) {
+		if (index < 0 || index >= static_cast<int>(text.length()))
+			return 0;
+		return text[index];
+	}
+private:
+	StringIndexer &operator=(const StringIndexer &);
+};
+
+// Find pattern in text returning "start,end" or "none" for easy comparison.
+template <typename Search>
+static std::string Find(Search &search, const char *pattern, const std::string &text, bool caseSensitive=true, bool posix=false) {
+	const char *errmsg = search.Compile(pattern, static_cast<int>(strlen(pattern)), caseSensitive, posix);
+	if (errmsg)
+		return errmsg;
+	StringIndexer si(text);
+	if (!search.Execute(si, 0, static_cast<int>(text.length())))
+		return "none";
+	char result[50];
+	sprintf(result, "%d,%d", search.bopat[0], search.eopat[0]);
+	return result;
+}
+
+TEST_CASE("DFASearch") {
+
+	CharClassify cc;
+	DFASearch dfa(&cc);
+
+	SECTION("Literal") {
+		REQUIRE(Find(dfa, "cd", "abcdcd") == "2,4");
+		REQUIRE(Find(dfa, "ce", "abcdcd") == "none");
+		REQUIRE(Find(dfa, "CD", "abcdcd", false) == "2,4");
+	}
+
+	SECTION("Closures") {
+		REQUIRE(Find(dfa, "b*", "aabb") == "0,0");
+		REQUIRE(Find(dfa, "b+", "aabb") == "2,4");
+		REQUIRE(Find(dfa, "ab?b", "aabb") == "1,4");
+		REQUIRE(Find(dfa, "a.*b", "xaxbxb") == "1,6");
+		REQUIRE(Find(dfa, "a.*?b", "xaxbxb") == "1,4");
+		REQUIRE(Find(dfa, "a.+?b", "xabxbxb") == "1,5");
+	}
+
+	SECTION("Sets") {
+		REQUIRE(Find(dfa, "[0-9]+", "ab123c") == "2,5");
+		REQUIRE(Find(dfa, "[^a-c]", "ab123c") == "2,3");
+		REQUIRE(Find(dfa, "[-]x]+", "a-]x") == "1,4");
+		REQUIRE(Find(dfa, "\\d\\s\\w", "a1 b") == "1,4");
+		REQUIRE(Find(dfa, "\\x41", "zA") == "1,2");
+	}
+
+	SECTION("Anchors") {
+		REQUIRE(Find(dfa, "^ab", "abab") == "0,2");
+		REQUIRE(Find(dfa, "^b", "abab") == "none");
+		REQUIRE(Find(dfa, "ab$", "abab") == "2,4");
+		REQUIRE(Find(dfa, "$", "abab") == "4,4");
+		REQUIRE(Find(dfa, "^$", "") == "0,0");
+		REQUIRE(Find(dfa, "\\<b", "ab b") == "3,4");
+		REQUIRE(Find(dfa, "a\\>", "aa ab") == "1,2");
+	}
+
+	SECTION("Tags") {
+		REQUIRE(Find(dfa, "\\(a+\\)\\(b+\\)", "xaabbb") == "1,6");
+		REQUIRE(dfa.bopat[1] == 1);
+		REQUIRE(dfa.eopat[1] == 3);
+		REQUIRE(dfa.bopat[2] == 3);
+		REQUIRE(dfa.eopat[2] == 6);
+		REQUIRE(Find(dfa, "(b+)", "xaabbb", true, true) == "3,6");
+		REQUIRE(dfa.bopat[1] == 3);
+	}
+
+	SECTION("Errors") {
+		REQUIRE(Find(dfa, "*a", "") == "Empty closure");
+		REQUIRE(Find(dfa, "[ab", "") == "Missing ]");
+		REQUIRE(Find(dfa, "\\(a", "") == "Unmatched \\(");
+		REQUIRE(Find(dfa, "(a", "", true, true) == "Unmatched (");
+		REQUIRE(Find(dfa, "\\(a\\)\\1", "") == "Back references not supported");
+	}
+
+	SECTION("SameAsRESearch") {
+		// Greedy closures on characters, sets and any, anchors, word boundaries and tags
+		// find the same matches as the backtracking implementation
+		RESearch re(&cc);
+		const char *atoms[] = { "a", "b", ".", "[ab]", "[^a]", "\\w", " ", "x" };
+		const char *closures[] = { "", "", "*", "+", "?" };
+		unsigned int seed = 1;
+		for (int iter = 0; iter < 3000; iter++) {
+			std::string pattern;
+			seed = seed * 1103515245 + 12345;
+			if ((seed >> 16) % 5 == 0)
+				pattern += "^";
+			seed = seed * 1103515245 + 12345;
+			const int pieces = 1 + (seed >> 16) % 5;
+			for (int piece = 0; piece < pieces; piece++) {
+				seed = seed * 1103515245 + 12345;
+				const char *atom = atoms[(seed >> 16) % 8];
+				seed = seed * 1103515245 + 12345;
+				const char *closure = closures[(seed >> 16) % 5];
+				// RESearch treats ? after a set as *
+				if (atom[0] == '[' || atom[0] == '\\')
+					closure = (closure[0] == '?') ? "" : closure;
+				if ((seed >> 20) % 9 == 0)
+					pattern += "\\<";
+				pattern += atom;
+				pattern += closure;
+			}
+			seed = seed * 1103515245 + 12345;
+			if ((seed >> 16) % 5 == 0)
+				pattern += "$";
+			std::string text;
+			seed = seed * 1103515245 + 12345;
+			const int lengthText = (seed >> 16) % 20;
+			for (int i = 0; i < lengthText; i++) {
+				seed = seed * 1103515245 + 12345;
+				text += "abx _"[(seed >> 16) % 5];
+			}
+			INFO(pattern << " in '" << text << "'");
+			REQUIRE(Find(re, pattern.c_str(), text) == Find(dfa, pattern.c_str(), text));
+		}
+	}
+
+	SECTION("Linear") {
+		// Backtracking takes time proportional to a power of the length for this pattern
+		const std::string text(2000, 'a');
+		REQUIRE(Find(dfa, "a*a*a*a*a*b", text) == "none");
+		REQUIRE(Find(dfa, "a*a*a*a*a*$", text) == "0,2000");
+	}
+}
@@ -7,6 +7,7 @@
 
 #include "Platform.h"
 
+#include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
 #include "RunStyles.h"
@@ -65,8 +66,8 @@ TEST_CASE("DecorationList") {
 		decol.SetCurrentIndicator(indicator);
 		decol.InsertSpace(0, 9);
 		const int value = 59;
-		int position = 4;
-		int fillLength = 3;
+		Sci::Position position = 4;
+		Sci::Position fillLength = 3;
 		bool changed = decol.FillRange(position, value, fillLength);
 		REQUIRE(changed);
 		REQUIRE(position == 4);
@@ -0,0 +1,280 @@
+// Unit Tests for Scintilla internal data structures
+
+#include <cstddef>
+#include <cstring>
+#include <cstdio>
+#include <cassert>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "Platform.h"
+
+#include "ILexer.h"
+#include "Scintilla.h"
+
+#include "CharacterSet.h"
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "CellBuffer.h"
+#include "CharClassify.h"
+#include "Decoration.h"
+#include "CaseFolder.h"
+#include "Document.h"
+
+#include "catch.hpp"
+
+// Test searching a Document.
+
+namespace {
+
+// Search as Editor does for SCI_SEARCHINTARGET returning "start,end" or "none" for easy comparison.
+std::string FindInDocument(Document &doc, const char *search, int minPos, int maxPos, int flags) {
+	int length = static_cast<int>(strlen(search));
+	const long pos = doc.FindText(minPos, maxPos, search,
+		(flags & SCFIND_MATCHCASE) != 0,
+		(flags & SCFIND_WHOLEWORD) != 0,
+		(flags & SCFIND_WORDSTART) != 0,
+		(flags & SCFIND_REGEXP) != 0,
+		flags, &length);
+	if (pos < 0)
+		return "none";
+	char result[50];
+	sprintf(result, "%ld,%ld", pos, pos + length);
+	return result;
+}
+
+// Place text into the document with the gap at split to make matches straddle the gap.
+void InsertSplit(Document &doc, const std::string &text, size_t split) {
+	const std::string after = text.substr(split);
+	doc.InsertString(0, after.c_str(), static_cast<int>(after.length()));
+	doc.InsertString(0, text.c_str(), static_cast<int>(split));
+}
+
+// What FindInDocument should return for a case sensitive search of a single byte document.
+std::string Expected(size_t pos, const char *search) {
+	if (pos == std::string::npos)
+		return "none";
+	char result[50];
+	sprintf(result, "%d,%d", static_cast<int>(pos), static_cast<int>(pos + strlen(search)));
+	return result;
+}
+
+// Give lines 1 to 3 markers, fold levels and line states.
+void SetPerLineData(Document &doc) {
+	const char *text = "zero\none\ntwo\nthree\nfour";
+	doc.InsertString(0, text, static_cast<int>(strlen(text)));
+	for (int line = 1; line <= 3; line++) {
+		doc.AddMark(line, line);
+		doc.SetLevel(line, (SC_FOLDLEVELBASE + line) | ((line == 2) ? SC_FOLDLEVELHEADERFLAG : 0));
+		doc.SetLineState(line, line * 100);
+	}
+}
+
+// Text of exactly length bytes made of whole UTF-8 characters that fold to themselves.
+std::string Filler(size_t length) {
+	// "ab \xc3\xa9 \xe2\x82\xac " is "ab e-acute Euro " so there are characters of 1, 2 and 3 bytes
+	const std::string unit = "ab \xc3\xa9 \xe2\x82\xac ";
+	std::string text;
+	while (text.length() + unit.length() <= length)
+		text += unit;
+	text.append(length - text.length(), 'z');
+	return text;
+}
+
+}
+
+TEST_CASE("DocumentFindLiteral") {
+
+	SECTION("MatchesStraddlingGap") {
+		const std::string text = "one two three twothree two-three xyzzy ttwo threethree";
+		const char *needles[] = { "t", "tw", "two", "three", "two-three", "ethree", "xyzzy", "twothree tw", "q", "ee" };
+		for (size_t split = 0; split <= text.length(); split++) {
+			Document doc;
+			InsertSplit(doc, text, split);
+			const int length = doc.Length();
+			for (size_t n = 0; n < sizeof(needles) / sizeof(needles[0]); n++) {
+				INFO(needles[n] << " split at " << split);
+				REQUIRE(FindInDocument(doc, needles[n], 0, length, SCFIND_MATCHCASE) ==
+					Expected(text.find(needles[n]), needles[n]));
+				REQUIRE(FindInDocument(doc, needles[n], length, 0, SCFIND_MATCHCASE) ==
+					Expected(text.rfind(needles[n]), needles[n]));
+				// Matches must lie completely inside the range
+				REQUIRE(FindInDocument(doc, needles[n], 5, 20, SCFIND_MATCHCASE) ==
+					Expected(text.substr(0, 20).find(needles[n], 5), needles[n]));
+				const size_t back = text.substr(0, 40).rfind(needles[n]);
+				REQUIRE(FindInDocument(doc, needles[n], 40, 10, SCFIND_MATCHCASE) ==
+					Expected((back != std::string::npos && back >= 10) ? back : std::string::npos, needles[n]));
+			}
+		}
+	}
+
+	SECTION("UTF8MatchesStartCharacters") {
+		// "\xc3\xa9" is e acute and "\xe2\x82\xac" is the Euro sign
+		const std::string text = "caf\xc3\xa9 \xe2\x82\xac" "5 \xc3\xa9t\xc3\xa9";
+		for (size_t split = 0; split <= text.length(); split++) {
+			Document doc;
+			doc.SetDBCSCodePage(SC_CP_UTF8);
+			InsertSplit(doc, text, split);
+			const int length = doc.Length();
+			INFO("split at " << split);
+			// Trail bytes alone do not start characters so are never found
+			REQUIRE(FindInDocument(doc, "\xa9", 0, length, SCFIND_MATCHCASE) == "none");
+			REQUIRE(FindInDocument(doc, "\x82\xac", length, 0, SCFIND_MATCHCASE) == "none");
+			REQUIRE(FindInDocument(doc, "\xc3\xa9", 0, length, SCFIND_MATCHCASE) == "3,5");
+			REQUIRE(FindInDocument(doc, "\xc3\xa9", length, 0, SCFIND_MATCHCASE) == "14,16");
+			REQUIRE(FindInDocument(doc, "\xe2\x82\xac" "5", 0, length, SCFIND_MATCHCASE) == "6,10");
+			REQUIRE(FindInDocument(doc, "\xe2\x82\xac" "5", length, 0, SCFIND_MATCHCASE) == "6,10");
+		}
+	}
+
+	SECTION("WordOptions") {
+		const std::string text = "concatenate cat category cat_x cat";
+		for (size_t split = 0; split <= text.length(); split++) {
+			Document doc;
+			InsertSplit(doc, text, split);
+			const int length = doc.Length();
+			INFO("split at " << split);
+			REQUIRE(FindInDocument(doc, "cat", 0, length, SCFIND_MATCHCASE) == "3,6");
+			REQUIRE(FindInDocument(doc, "cat", 0, length, SCFIND_MATCHCASE | SCFIND_WHOLEWORD) == "12,15");
+			REQUIRE(FindInDocument(doc, "cat", 13, length, SCFIND_MATCHCASE | SCFIND_WHOLEWORD) == "31,34");
+			REQUIRE(FindInDocument(doc, "cat", length, 0, SCFIND_MATCHCASE | SCFIND_WHOLEWORD) == "31,34");
+			REQUIRE(FindInDocument(doc, "cat", 30, 0, SCFIND_MATCHCASE | SCFIND_WHOLEWORD) == "12,15");
+			REQUIRE(FindInDocument(doc, "cat", 1, length, SCFIND_MATCHCASE | SCFIND_WORDSTART) == "12,15");
+			REQUIRE(FindInDocument(doc, "cat", 13, length, SCFIND_MATCHCASE | SCFIND_WORDSTART) == "16,19");
+			REQUIRE(FindInDocument(doc, "cat", 30, 0, SCFIND_MATCHCASE | SCFIND_WORDSTART) == "25,28");
+			REQUIRE(FindInDocument(doc, "ten", 0, length, SCFIND_MATCHCASE | SCFIND_WORDSTART) == "none");
+		}
+	}
+}
+
+TEST_CASE("DocumentFindRegex") {
+
+	Document doc;
+	const std::string text =
+		"fn alpha1 = beta22;\n"
+		"  end\n"
+		"ab abab abc aXc a.c\r\n"
+		"word words sword word\n"
+		"x=12 yy=345 end";
+	doc.InsertString(0, text.c_str(), static_cast<int>(text.length()));
+	const int length = doc.Length();
+
+	SECTION("DFAFindsInDocument") {
+		const int flags = SCFIND_REGEXP | SCFIND_DFAREGEX | SCFIND_MATCHCASE;
+		REQUIRE(FindInDocument(doc, "[a-z]+[0-9]+", 0, length, flags) == "3,9");
+		REQUIRE(FindInDocument(doc, "[a-z]+[0-9]+", 9, length, flags) == "12,18");
+		REQUIRE(FindInDocument(doc, "[a-z]+[0-9]+", length, 0, flags) == "15,18");
+		REQUIRE(FindInDocument(doc, "^ab", 0, length, flags) == "26,28");
+		REQUIRE(FindInDocument(doc, "end$", 0, length, flags) == "22,25");
+		REQUIRE(FindInDocument(doc, "end$", length, 0, flags) == "81,84");
+		REQUIRE(FindInDocument(doc, "a.c", 0, length, flags) == "34,37");
+		REQUIRE(FindInDocument(doc, "A.C", 0, length, SCFIND_REGEXP | SCFIND_DFAREGEX) == "34,37");
+		REQUIRE(FindInDocument(doc, "\\<word\\>", 0, length, flags) == "47,51");
+		REQUIRE(FindInDocument(doc, "\\<word\\>", length, 0, flags) == "64,68");
+		REQUIRE(FindInDocument(doc, "zzz", 0, length, flags) == "none");
+	}
+
+	SECTION("DFASameAsRESearch") {
+		const char *patterns[] = {
+			"[a-z]+[0-9]+", "^ab", "end$", "\\(ab\\)+", "a.c", "[^ ]*x", "\\<word", "word\\>",
+			"s*word", "[0-9][0-9]*", "^", "$", "[A-Z]", "b*", "y+=", "\\(a\\)\\1",
+		};
+		const int ranges[][2] = {
+			{ 0, length }, { length, 0 }, { 5, 60 }, { 60, 5 }, { 29, 30 }, { 47, 47 },
+		};
+		for (size_t p = 0; p < sizeof(patterns) / sizeof(patterns[0]); p++) {
+			for (size_t r = 0; r < sizeof(ranges) / sizeof(ranges[0]); r++) {
+				for (int caseSensitive = 0; caseSensitive < 2; caseSensitive++) {
+					const int flags = SCFIND_REGEXP | (caseSensitive ? SCFIND_MATCHCASE : 0);
+					const std::string expected = FindInDocument(doc, patterns[p], ranges[r][0], ranges[r][1], flags);
+					INFO(patterns[p] << " " << ranges[r][0] << "-" << ranges[r][1] << " " << caseSensitive);
+					REQUIRE(FindInDocument(doc, patterns[p], ranges[r][0], ranges[r][1], flags | SCFIND_DFAREGEX) == expected);
+				}
+			}
+		}
+	}
+
+	SECTION("DFATagsSubstituted") {
+		const int flags = SCFIND_REGEXP | SCFIND_DFAREGEX | SCFIND_MATCHCASE;
+		REQUIRE(FindInDocument(doc, "\\([a-z]+\\)=\\([0-9]+\\)", 0, length, flags) == "69,73");
+		int lengthReplace = 5;
+		const char *substituted = doc.SubstituteByPosition("\\2=\\1", &lengthReplace);
+		REQUIRE(std::string(substituted, lengthReplace) == "12=x");
+		REQUIRE(FindInDocument(doc, "\\([a-z]+\\)=\\([0-9]+\\)", 73, length, flags) == "74,80");
+		lengthReplace = 5;
+		substituted = doc.SubstituteByPosition("\\2=\\1", &lengthReplace);
+		REQUIRE(std::string(substituted, lengthReplace) == "345=yy");
+	}
+}
+
+TEST_CASE("DocumentFindFolded") {
+
+	// Case insensitive UTF-8 searches fold the document 0x10000 + 4 * (folded search length)
+	// bytes at a time so place the match around where chunks end in both directions.
+	// "Q\xc3\x89\xe2\x82\xacX" is "Q E-acute Euro X" and folds to the search string.
+	const char *needle = "Q\xc3\x89\xe2\x82\xacX";
+	const char *search = "q\xc3\xa9\xe2\x82\xacx";
+	const int lengthNeedle = static_cast<int>(strlen(needle));
+	const int lengthChunk = 0x10000 + lengthNeedle * 4;
+	const int lengthDocument = 3 * 0x10000;
+
+	SECTION("Forward") {
+		for (int posNeedle = lengthChunk - 16; posNeedle <= lengthChunk + 8; posNeedle++) {
+			Document doc;
+			doc.SetDBCSCodePage(SC_CP_UTF8);
+			doc.SetCaseFolder(new CaseFolderUnicode());
+			const std::string text = Filler(posNeedle) + needle + Filler(lengthDocument - posNeedle - lengthNeedle);
+			doc.InsertString(0, text.c_str(), static_cast<int>(text.length()));
+			INFO("needle at " << posNeedle);
+			REQUIRE(FindInDocument(doc, search, 0, doc.Length(), 0) == Expected(posNeedle, needle));
+			REQUIRE(FindInDocument(doc, search, 0, posNeedle + lengthNeedle - 1, 0) == "none");
+		}
+	}
+
+	SECTION("Backward") {
+		const int chunkStart = lengthDocument - lengthChunk;
+		for (int posNeedle = chunkStart - 16; posNeedle <= chunkStart + 8; posNeedle++) {
+			Document doc;
+			doc.SetDBCSCodePage(SC_CP_UTF8);
+			doc.SetCaseFolder(new CaseFolderUnicode());
+			const std::string text = Filler(posNeedle) + needle + Filler(lengthDocument - posNeedle - lengthNeedle);
+			doc.InsertString(0, text.c_str(), static_cast<int>(text.length()));
+			INFO("needle at " << posNeedle);
+			REQUIRE(FindInDocument(doc, search, doc.Length(), 0, 0) == Expected(posNeedle, needle));
+			REQUIRE(FindInDocument(doc, search, doc.Length(), posNeedle + 1, 0) == "none");
+		}
+	}
+}
+
+TEST_CASE("DocumentInsertLines") {
+
+	// Line starts are added in batches of up to 1024 so insert more lines than that into
+	// the middle of a line and check the markers, fold levels and line states around them.
+	std::string text;
+	for (int i = 0; i < 2500; i++) {
+		text += (i % 3 == 0) ? "x\r\n" : ((i % 3 == 1) ? "yy\n" : "z\r");
+	}
+	Document doc;
+	SetPerLineData(doc);
+	doc.InsertString(10, text.c_str(), static_cast<int>(text.length()));
+	REQUIRE(2505 == doc.LinesTotal());
+	// Line 2 is split so keeps its data with the lines inserted after it
+	REQUIRE((1 << 2) == doc.GetMark(2));
+	REQUIRE(((SC_FOLDLEVELBASE + 2) | SC_FOLDLEVELHEADERFLAG) == doc.GetLevel(2));
+	REQUIRE(200 == doc.GetLineState(2));
+	for (int line = 3; line < 2503; line++) {
+		INFO("line " << line);
+		REQUIRE(0 == doc.GetMark(line));
+	}
+	// Line 3 moved down by the number of lines inserted
+	REQUIRE(doc.LineStart(2503) == static_cast<int>(text.length()) + 13);
+	REQUIRE((1 << 3) == doc.GetMark(2503));
+	REQUIRE((SC_FOLDLEVELBASE + 3) == doc.GetLevel(2503));
+	REQUIRE(300 == doc.GetLineState(2503));
+	REQUIRE(0 == doc.GetLineState(2504));
+}
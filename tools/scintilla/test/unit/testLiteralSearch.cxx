@@ -0,0 +1,157 @@
+// Unit Tests for Scintilla internal data structures
+
+#include <string.h>
+#include <time.h>
+
+#include <string>
+#include <stdexcept>
+#include <algorithm>
+
+#include "Platform.h"
+
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "CellBuffer.h"
+#include "LiteralSearch.h"
+
+#include "catch.hpp"
+
+// Test LiteralSearch.
+
+// Straightforward search to compare against.
+static int NaiveFind(const std::string &text, const std::string &needle, bool forward) {
+	const size_t pos = forward ? text.find(needle) : text.rfind(needle);
+	return (pos == std::string::npos) ? -1 : static_cast<int>(pos);
+}
+
+TEST_CASE("LiteralSearch") {
+
+	SECTION("FindsFirstAndLast") {
+		const std::string text = "abcabcabc";
+		LiteralSearch ls("bca", 3);
+		REQUIRE(1 == ls.FindForward(text.c_str(), static_cast<int>(text.length())));
+		REQUIRE(4 == ls.FindBackward(text.c_str(), static_cast<int>(text.length())));
+	}
+
+	SECTION("NotFound") {
+		const std::string text = "abcabcabc";
+		LiteralSearch ls("cab!", 4);
+		REQUIRE(-1 == ls.FindForward(text.c_str(), static_cast<int>(text.length())));
+		REQUIRE(-1 == ls.FindBackward(text.c_str(), static_cast<int>(text.length())));
+	}
+
+	SECTION("NeedleLongerThanText") {
+		LiteralSearch ls("abcdef", 6);
+		REQUIRE(-1 == ls.FindForward("abc", 3));
+		REQUIRE(-1 == ls.FindBackward("abc", 3));
+	}
+
+	SECTION("MatchAtEnds") {
+		const std::string text = "needle in a haystack with a needle";
+		LiteralSearch ls("needle", 6);
+		REQUIRE(0 == ls.FindForward(text.c_str(), static_cast<int>(text.length())));
+		REQUIRE(28 == ls.FindBackward(text.c_str(), static_cast<int>(text.length())));
+	}
+
+	SECTION("EmbeddedNULs") {
+		const char text[] = "a\0b\0c\0b\0";
+		LiteralSearch ls("b\0", 2);
+		REQUIRE(2 == ls.FindForward(text, 8));
+		REQUIRE(6 == ls.FindBackward(text, 8));
+	}
+
+	SECTION("SameAsNaive") {
+		// Short needles take the memchr path, longer ones the skip tables
+		const char *needles[] = { "a", "ab", "aab", "abab", "baaab", "ababbab", "bbbbbbbb" };
+		std::string text;
+		unsigned int seed = 1;
+		for (int i = 0; i < 2000; i++) {
+			seed = seed * 1103515245 + 12345;
+			text += ((seed >> 16) % 3 == 0) ? 'b' : 'a';
+		}
+		for (size_t n = 0; n < sizeof(needles) / sizeof(needles[0]); n++) {
+			const std::string needle = needles[n];
+			LiteralSearch ls(needle.c_str(), static_cast<int>(needle.length()));
+			for (size_t length = 0; length < text.length(); length += 97) {
+				const std::string part = text.substr(0, length);
+				REQUIRE(NaiveFind(part, needle, true) == ls.FindForward(part.c_str(), static_cast<int>(length)));
+				REQUIRE(NaiveFind(part, needle, false) == ls.FindBackward(part.c_str(), static_cast<int>(length)));
+			}
+		}
+	}
+}
+
+// Benchmark literal search over both halves of a CellBuffer against comparing a byte at
+// a time through CharAt as Document::FindText used to. Hidden so only run when asked for:
+//   unitTest [benchmark]
+
+static int FindByCharAt(const CellBuffer &cb, const char *needle, int lengthNeedle) {
+	const int endSearch = cb.Length() - lengthNeedle + 1;
+	for (int pos = 0; pos < endSearch; pos++) {
+		if (cb.CharAt(pos) == needle[0]) {
+			bool found = true;
+			for (int i = 1; (i < lengthNeedle) && found; i++)
+				found = cb.CharAt(pos + i) == needle[i];
+			if (found)
+				return pos;
+		}
+	}
+	return -1;
+}
+
+static int FindInHalves(CellBuffer &cb, const LiteralSearch &ls) {
+	// The needle is placed so it does not straddle the gap
+	const int gap = cb.GapPosition();
+	int pos = ls.FindForward(cb.RangePointer(0, gap), gap);
+	if (pos < 0) {
+		pos = ls.FindForward(cb.RangePointer(gap, cb.Length() - gap), cb.Length() - gap);
+		if (pos >= 0)
+			pos += gap;
+	}
+	return pos;
+}
+
+static double MegabytesPerSecond(int length, int repeats, clock_t elapsed) {
+	const double seconds = static_cast<double>(elapsed) / CLOCKS_PER_SEC;
+	return seconds > 0 ? (static_cast<double>(length) * repeats / seconds / 1048576.0) : 0.0;
+}
+
+TEST_CASE("LiteralSearchBenchmark", "[.][benchmark]") {
+
+	const int lengthDocument = 32 * 1024 * 1024;
+	const char needle[] = "ERROR: disk quota exceeded";
+	const int lengthNeedle = static_cast<int>(strlen(needle));
+	const int repeats = 4;
+
+	std::string text;
+	text.reserve(lengthDocument);
+	const char line[] = "2015-06-01 12:00:00 INFO request served in 3 ms from the quota cache\n";
+	while (text.length() + sizeof(line) < static_cast<size_t>(lengthDocument))
+		text += line;
+	const int posNeedle = static_cast<int>(text.length());
+	text += needle;
+
+	CellBuffer cb;
+	bool startSequence = false;
+	cb.SetUndoCollection(false);
+	cb.InsertString(0, text.c_str(), static_cast<int>(text.length()), startSequence);
+	// Leave the gap in the middle of the document
+	const char *changed = cb.InsertString(static_cast<int>(text.length()) / 2, "x", 1, startSequence);
+	REQUIRE(changed);
+	cb.DeleteChars(static_cast<int>(text.length()) / 2, 1, startSequence);
+
+	clock_t start = clock();
+	for (int i = 0; i < repeats; i++)
+		REQUIRE(posNeedle == FindByCharAt(cb, needle, lengthNeedle));
+	const double rateCharAt = MegabytesPerSecond(cb.Length(), repeats, clock() - start);
+
+	LiteralSearch ls(needle, lengthNeedle);
+	start = clock();
+	for (int i = 0; i < repeats; i++)
+		REQUIRE(posNeedle == FindInHalves(cb, ls));
+	const double rateLiteral = MegabytesPerSecond(cb.Length(), repeats, clock() - start);
+
+	printf("LiteralSearch: CharAt %.0f MB/s, skip table %.0f MB/s\n", rateCharAt, rateLiteral);
+}
@@ -1,11 +1,13 @@
 // Unit Tests for Scintilla internal data structures
 
+#include <stddef.h>
 #include <string.h>
 
 #include <algorithm>
 
 #include "Platform.h"
 
+#include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
 
@@ -14,7 +16,7 @@
 const int growSize = 4;
 
 const int lengthTestArray = 8;
-static const int testArray[lengthTestArray] = {3, 4, 5, 6, 7, 8, 9, 10};
+static const Sci::Position testArray[lengthTestArray] = {3, 4, 5, 6, 7, 8, 9, 10};
 
 // Test SplitVectorWithRangeAdd.
 
@@ -66,6 +68,19 @@ TEST_CASE("Partitioning") {
 		REQUIRE(2 == part.PositionFromPartition(2));
 	}
 
+	SECTION("InsertPartitions") {
+		const Sci::Position starts[] = {2, 4, 6};
+		part.InsertText(0, 10);
+		part.InsertPartitions(1, starts, 3);
+		REQUIRE(4 == part.Partitions());
+		REQUIRE(0 == part.PositionFromPartition(0));
+		REQUIRE(2 == part.PositionFromPartition(1));
+		REQUIRE(4 == part.PositionFromPartition(2));
+		REQUIRE(6 == part.PositionFromPartition(3));
+		REQUIRE(10 == part.PositionFromPartition(4));
+		REQUIRE(2 == part.PartitionFromPosition(5));
+	}
+
 	SECTION("MoveStart") {
 		part.InsertText(0, 3);
 		part.InsertPartition(1, 2);
@@ -0,0 +1,97 @@
+// Unit Tests for Scintilla internal data structures
+
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+#include <algorithm>
+
+#include "Platform.h"
+
+#include "Scintilla.h"
+#include "ILexer.h"
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "CellBuffer.h"
+#include "PerLine.h"
+
+#include "catch.hpp"
+
+// Test PerLine.
+
+// InsertLines should have the same effect as the calls to InsertLine that CellBuffer
+// made for each line before line starts were added in batches.
+template <typename PerLineData>
+static void InsertLinesSingly(PerLineData &pl, int line, int lines) {
+	for (int i = 0; i < lines; i++) {
+		pl.InsertLine(line + i);
+	}
+}
+
+TEST_CASE("PerLine") {
+
+	const int insertions[][2] = { { 0, 3 }, { 2, 1 }, { 2, 1500 }, { 5, 1500 }, { 6, 20 }, { 9, 2 } };
+	const size_t countInsertions = sizeof(insertions) / sizeof(insertions[0]);
+
+	SECTION("Markers") {
+		for (size_t i = 0; i < countInsertions; i++) {
+			LineMarkers batched;
+			LineMarkers singly;
+			for (int line = 1; line < 6; line++) {
+				batched.AddMark(line, line, 10);
+				singly.AddMark(line, line, 10);
+			}
+			batched.InsertLines(insertions[i][0], insertions[i][1]);
+			InsertLinesSingly(singly, insertions[i][0], insertions[i][1]);
+			INFO("insert " << insertions[i][1] << " lines at " << insertions[i][0]);
+			for (int line = 0; line < 10 + insertions[i][1]; line++) {
+				REQUIRE(singly.MarkValue(line) == batched.MarkValue(line));
+			}
+		}
+	}
+
+	SECTION("MarkersNotAllocated") {
+		LineMarkers batched;
+		batched.InsertLines(0, 100);
+		REQUIRE(0 == batched.MarkValue(50));
+		REQUIRE(-1 == batched.MarkerNext(0, 0xff));
+	}
+
+	SECTION("Levels") {
+		for (size_t i = 0; i < countInsertions; i++) {
+			LineLevels batched;
+			LineLevels singly;
+			for (int line = 0; line < 10; line++) {
+				const int level = (SC_FOLDLEVELBASE + line % 4) | ((line % 4 == 0) ? SC_FOLDLEVELHEADERFLAG : 0);
+				batched.SetLevel(line, level, 10);
+				singly.SetLevel(line, level, 10);
+			}
+			batched.InsertLines(insertions[i][0], insertions[i][1]);
+			InsertLinesSingly(singly, insertions[i][0], insertions[i][1]);
+			INFO("insert " << insertions[i][1] << " lines at " << insertions[i][0]);
+			for (int line = 0; line < 10 + insertions[i][1]; line++) {
+				REQUIRE(singly.GetLevel(line) == batched.GetLevel(line));
+			}
+		}
+	}
+
+	SECTION("LineState") {
+		for (size_t i = 0; i < countInsertions; i++) {
+			LineState batched;
+			LineState singly;
+			// Only the first lines have states so insertions beyond them extend the states
+			for (int line = 0; line < 4; line++) {
+				batched.SetLineState(line, line * 100 + 1);
+				singly.SetLineState(line, line * 100 + 1);
+			}
+			batched.InsertLines(insertions[i][0], insertions[i][1]);
+			InsertLinesSingly(singly, insertions[i][0], insertions[i][1]);
+			INFO("insert " << insertions[i][1] << " lines at " << insertions[i][0]);
+			for (int line = 0; line < 10 + insertions[i][1]; line++) {
+				REQUIRE(singly.GetLineState(line) == batched.GetLineState(line));
+			}
+			REQUIRE(singly.GetMaxLineState() == batched.GetMaxLineState());
+		}
+	}
+}
@@ -0,0 +1,215 @@
+// Unit Tests for Scintilla internal data structures
+
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <map>
+#include <list>
+#include <algorithm>
+
+#include "Platform.h"
+
+#include "ILexer.h"
+#include "Scintilla.h"
+#include "Position.h"
+#include "SplitVector.h"
+#include "Partitioning.h"
+#include "RunStyles.h"
+#include "ContractionState.h"
+#include "CellBuffer.h"
+#include "KeyMap.h"
+#include "Indicator.h"
+#include "XPM.h"
+#include "LineMarker.h"
+#include "Style.h"
+#include "ViewStyle.h"
+#include "CharClassify.h"
+#include "Decoration.h"
+#include "CaseFolder.h"
+#include "Document.h"
+#include "Selection.h"
+#include "PositionCache.h"
+#include "SegmentCache.h"
+
+#include "catch.hpp"
+
+// Test LineLayoutCache.
+
+const int maxChars = 10;
+
+// Retrieve a layout and return it to the cache straight away as the views do after drawing.
+static LineLayout *Layout(LineLayoutCache &llc, int line, int lineCaret, int linesOnScreen, int linesInDoc) {
+	LineLayout *ll = llc.Retrieve(line, lineCaret, maxChars, linesOnScreen, linesInDoc);
+	llc.Dispose(ll);
+	return ll;
+}
+
+static LineLayout *Validated(LineLayoutCache &llc, int line, int linesInDoc) {
+	LineLayout *ll = Layout(llc, line, -1, 1, linesInDoc);
+	ll->validity = LineLayout::llLines;
+	return ll;
+}
+
+TEST_CASE("LineLayoutCache") {
+
+	LineLayoutCache llc;
+
+	SECTION("LeastRecentlyUsedReused") {
+		// Pages of 2 lines on screen hold 3 layouts
+		llc.SetLevel(LineLayoutCache::llcPage);
+		llc.SetPages(1);
+		LineLayout *ll0 = Layout(llc, 0, -1, 2, 100);
+		LineLayout *ll1 = Layout(llc, 1, -1, 2, 100);
+		LineLayout *ll2 = Layout(llc, 2, -1, 2, 100);
+		REQUIRE(llc.Lines() == 3);
+		REQUIRE(ll0 != ll1);
+		REQUIRE(ll1 != ll2);
+		ll1->validity = LineLayout::llLines;
+		REQUIRE(Layout(llc, 0, -1, 2, 100) == ll0);
+		// Line 1 is now the least recently used
+		LineLayout *ll3 = Layout(llc, 3, -1, 2, 100);
+		REQUIRE(ll3 == ll1);
+		REQUIRE(ll3->validity == LineLayout::llInvalid);
+		REQUIRE(llc.Lines() == 3);
+		REQUIRE(llc.LineOf(ll3) == 3);
+		REQUIRE(Layout(llc, 0, -1, 2, 100) == ll0);
+		REQUIRE(Layout(llc, 2, -1, 2, 100) == ll2);
+		REQUIRE(Layout(llc, 3, -1, 2, 100) == ll3);
+		// Line 1 reuses line 0 which is least recently used
+		REQUIRE(Layout(llc, 1, -1, 2, 100) == ll0);
+		REQUIRE(llc.LineOf(ll0) == 1);
+	}
+
+	SECTION("CaretLineRetained") {
+		llc.SetLevel(LineLayoutCache::llcPage);
+		llc.SetPages(1);
+		LineLayout *ll0 = Layout(llc, 0, 0, 2, 100);
+		LineLayout *ll1 = Layout(llc, 1, 0, 2, 100);
+		Layout(llc, 2, 0, 2, 100);
+		// Line 0 is least recently used but holds the caret so line 1 is reused
+		REQUIRE(Layout(llc, 3, 0, 2, 100) == ll1);
+		REQUIRE(Layout(llc, 0, 0, 2, 100) == ll0);
+		REQUIRE(llc.Lines() == 3);
+	}
+
+	SECTION("CaretLevelHoldsOneLine") {
+		llc.SetLevel(LineLayoutCache::llcCaret);
+		LineLayout *ll0 = Layout(llc, 0, 0, 2, 100);
+		REQUIRE(Layout(llc, 5, 5, 2, 100) == ll0);
+		REQUIRE(llc.Lines() == 1);
+		REQUIRE(llc.LineOf(ll0) == 5);
+	}
+
+	SECTION("Renumbered") {
+		llc.SetLevel(LineLayoutCache::llcDocument);
+		LineLayout *ll10 = Validated(llc, 10, 100);
+		LineLayout *ll20 = Validated(llc, 20, 100);
+		LineLayout *ll30 = Validated(llc, 30, 100);
+		llc.LinesAddedOrRemoved(15, 5);
+		REQUIRE(llc.LineOf(ll10) == 10);
+		REQUIRE(llc.LineOf(ll20) == 25);
+		REQUIRE(llc.LineOf(ll30) == 35);
+		REQUIRE(Layout(llc, 25, -1, 1, 105) == ll20);
+		REQUIRE(ll20->validity == LineLayout::llLines);
+		// An edit before the previous one
+		llc.LinesAddedOrRemoved(2, 3);
+		REQUIRE(llc.LineOf(ll10) == 13);
+		REQUIRE(llc.LineOf(ll20) == 28);
+		REQUIRE(llc.LineOf(ll30) == 38);
+		// Removing lines 26 to 29 drops the layout of line 28 for reuse
+		llc.LinesAddedOrRemoved(26, -4);
+		REQUIRE(llc.LineOf(ll10) == 13);
+		REQUIRE(llc.LineOf(ll20) == -1);
+		REQUIRE(ll20->validity == LineLayout::llInvalid);
+		REQUIRE(llc.LineOf(ll30) == 34);
+		REQUIRE(Layout(llc, 34, -1, 1, 104) == ll30);
+		REQUIRE(Layout(llc, 13, -1, 1, 104) == ll10);
+		REQUIRE(llc.Lines() == 3);
+		LineLayout *ll28 = Layout(llc, 28, -1, 1, 104);
+		REQUIRE(ll28 != ll10);
+		REQUIRE(ll28 != ll30);
+		REQUIRE(ll28->validity == LineLayout::llInvalid);
+	}
+
+	SECTION("InvalidateLines") {
+		llc.SetLevel(LineLayoutCache::llcDocument);
+		LineLayout *layouts[6];
+		for (int line = 0; line < 6; line++) {
+			layouts[line] = Validated(llc, line * 2, 100);
+		}
+		// Lines are now 0, 2, 4, 13, 15, 17
+		llc.LinesAddedOrRemoved(5, 7);
+		llc.InvalidateLines(4, 14, LineLayout::llCheckTextAndStyle);
+		REQUIRE(layouts[0]->validity == LineLayout::llLines);
+		REQUIRE(layouts[1]->validity == LineLayout::llLines);
+		REQUIRE(layouts[2]->validity == LineLayout::llCheckTextAndStyle);
+		REQUIRE(layouts[3]->validity == LineLayout::llCheckTextAndStyle);
+		REQUIRE(layouts[4]->validity == LineLayout::llLines);
+		REQUIRE(layouts[5]->validity == LineLayout::llLines);
+	}
+
+	SECTION("RenumberedLikeLines") {
+		// Layouts follow their lines through many edits in different places
+		llc.SetLevel(LineLayoutCache::llcDocument);
+		const int linesInDoc = 2000;
+		std::vector<LineLayout *> lines(linesInDoc);
+		for (int line = 0; line < linesInDoc; line += 3) {
+			lines[line] = Layout(llc, line, -1, 1, linesInDoc);
+		}
+		unsigned int seed = 1;
+		for (int edit = 0; edit < 300; edit++) {
+			seed = seed * 1103515245 + 12345;
+			const int lineOfPos = static_cast<int>((seed >> 8) % (lines.size() - 20));
+			const int linesChanged = static_cast<int>((seed >> 4) % 15) + 1;
+			if (edit % 3 == 2) {
+				std::vector<LineLayout *> removed(lines.begin() + lineOfPos, lines.begin() + lineOfPos + linesChanged);
+				lines.erase(lines.begin() + lineOfPos, lines.begin() + lineOfPos + linesChanged);
+				lines.insert(lines.end(), linesChanged, static_cast<LineLayout *>(0));
+				llc.LinesAddedOrRemoved(lineOfPos, -linesChanged);
+				for (size_t i = 0; i < removed.size(); i++) {
+					if (removed[i]) {
+						REQUIRE(llc.LineOf(removed[i]) == -1);
+					}
+				}
+			} else {
+				// Lines pushed past the end are no longer checked
+				lines.insert(lines.begin() + lineOfPos, linesChanged, static_cast<LineLayout *>(0));
+				lines.resize(linesInDoc);
+				llc.LinesAddedOrRemoved(lineOfPos, linesChanged);
+			}
+			for (int line = 0; line < linesInDoc; line++) {
+				if (lines[line]) {
+					REQUIRE(llc.LineOf(lines[line]) == line);
+				}
+			}
+			// Retrieving a line between edits moves the step
+			const int lineRetrieved = static_cast<int>((seed >> 12) % linesInDoc);
+			LineLayout *ll = Layout(llc, lineRetrieved, -1, 1, linesInDoc * 2);
+			if (lines[lineRetrieved]) {
+				REQUIRE(ll == lines[lineRetrieved]);
+			}
+			lines[lineRetrieved] = ll;
+		}
+	}
+}
+
+// Test PositionCache.
+
+TEST_CASE("PositionCache") {
+
+	SECTION("ClearKeepsSegments") {
+		// Clearing one view's cache, as when its styles change, leaves the segments of documents alone
+		PositionCache pc;
+		SegmentCache sc;
+		FontID font = reinterpret_cast<FontID>(0x1000);
+		const std::string text = "a_long_identifier_from_a_minified_file";
+		const unsigned int len = static_cast<unsigned int>(text.length());
+		std::vector<XYPOSITION> positions(len, 7.0f);
+		sc.Store(font, 0, text.c_str(), len, &positions[0]);
+		pc.Clear();
+		pc.SetSize(0x400);
+		REQUIRE(sc.Retrieve(font, 0, text.c_str(), len, &positions[0]));
+		REQUIRE(1 == sc.Entries());
+	}
+}
@@ -7,6 +7,7 @@
 
 #include "Platform.h"
 
+#include "Position.h"
 #include "SplitVector.h"
 #include "Partitioning.h"
 #include "RunStyles.h"
@@ -85,8 +86,8 @@ TEST_CASE("RunStyles") {
 
 	SECTION("FillRange") {
 		rs.InsertSpace(0, 5);
-		int startFill = 1;
-		int lengthFill = 3;
+		Sci::Position startFill = 1;
+		Sci::Position lengthFill = 3;
 		REQUIRE(true == rs.FillRange(startFill, 99, lengthFill));
 		REQUIRE(1 == startFill);
 		REQUIRE(3 == lengthFill);
@@ -106,14 +107,14 @@ TEST_CASE("RunStyles") {
 
 	SECTION("FillRangeAlreadyFilled") {
 		rs.InsertSpace(0, 5);
-		int startFill = 1;
-		int lengthFill = 3;
+		Sci::Position startFill = 1;
+		Sci::Position lengthFill = 3;
 		REQUIRE(true == rs.FillRange(startFill, 99, lengthFill));
 		REQUIRE(1 == startFill);
 		REQUIRE(3 == lengthFill);
 
-		int startFill2 = 2;
-		int lengthFill2 = 1;
+		Sci::Position startFill2 = 2;
+		Sci::Position lengthFill2 = 1;
 		// Compiler warnings if 'false' used instead of '0' as expected value:
 		REQUIRE(0 == rs.FillRange(startFill2, 99, lengthFill2));
 		REQUIRE(2 == startFill2);
@@ -128,14 +129,14 @@ TEST_CASE("RunStyles") {
 
 	SECTION("FillRangeAlreadyPartFilled") {
 		rs.InsertSpace(0, 5);
-		int startFill = 1;
-		int lengthFill = 2;
+		Sci::Position startFill = 1;
+		Sci::Position lengthFill = 2;
 		REQUIRE(true == rs.FillRange(startFill, 99, lengthFill));
 		REQUIRE(1 == startFill);
 		REQUIRE(2 == lengthFill);
 
-		int startFill2 = 2;
-		int lengthFill2 = 2;
+		Sci::Position startFill2 = 2;
+		Sci::Position lengthFill2 = 2;
 		REQUIRE(true == rs.FillRange(startFill2, 99, lengthFill2));
 		REQUIRE(3 == startFill2);
 		REQUIRE(1 == lengthFill2);
@@ -166,8 +167,8 @@ TEST_CASE("RunStyles") {
 
 	SECTION("Find") {
 		rs.InsertSpace(0, 5);
-		int startFill = 1;
-		int lengthFill = 3;
+		Sci::Position startFill = 1;
+		Sci::Position lengthFill = 3;
 		REQUIRE(true == rs.FillRange(startFill, 99, lengthFill));
 		REQUIRE(1 == startFill);
 		REQUIRE(3 == lengthFill);
@@ -203,8 +204,8 @@ TEST_CASE("RunStyles") {
 		REQUIRE(true == rs.AllSame());
 		REQUIRE(0 == rs.AllSameAs(88));
 		REQUIRE(true == rs.AllSameAs(0));
-		int startFill = 1;
-		int lengthFill = 3;
+		Sci::Position startFill = 1;
+		Sci::Position lengthFill = 3;
 		REQUIRE(true == rs.FillRange(startFill, 99, lengthFill));
 		REQUIRE(0 == rs.AllSame());
 		REQUIRE(0 == rs.AllSameAs(88));
@@ -219,8 +220,8 @@ TEST_CASE("RunStyles") {
 		rs.InsertSpace(0, 5);
 		REQUIRE(1 == rs.Runs());
 
-		int startFill = 1;
-		int lengthFill = 1;
+		Sci::Position startFill = 1;
+		Sci::Position lengthFill = 1;
 		REQUIRE(true == rs.FillRange(startFill, 99, lengthFill));
 		REQUIRE(1 == startFill);
 		REQUIRE(1 == lengthFill);
@@ -276,8 +277,8 @@ TEST_CASE("RunStyles") {
 
 	SECTION("DeleteSecond") {
 		rs.InsertSpace(0, 3);
-		int startFill = 1;
-		int lengthFill = 1;
+		Sci::Position startFill = 1;
+		Sci::Position lengthFill = 1;
 		REQUIRE(true == rs.FillRange(startFill, 99, lengthFill));
 		REQUIRE(3 == rs.Length());
 		REQUIRE(3 == rs.Runs());
@@ -288,8 +289,8 @@ TEST_CASE("RunStyles") {
 
 	SECTION("DeleteEndRun") {
 		rs.InsertSpace(0, 2);
-		int startFill = 1;
-		int lengthFill = 1;
+		Sci::Position startFill = 1;
+		Sci::Position lengthFill = 1;
 		REQUIRE(true == rs.FillRange(startFill, 99, lengthFill));
 		REQUIRE(2 == rs.Length());
 		REQUIRE(2 == rs.Runs());
@@ -309,8 +310,8 @@ TEST_CASE("RunStyles") {
 
 	SECTION("OutsideBounds") {
 		rs.InsertSpace(0, 1);
-		int startFill = 1;
-		int lengthFill = 1;
+		Sci::Position startFill = 1;
+		Sci::Position lengthFill = 1;
 		rs.FillRange(startFill, 99, lengthFill);
 		REQUIRE(1 == rs.Length());
 		REQUIRE(1 == rs.Runs());
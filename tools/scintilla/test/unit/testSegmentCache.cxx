@@ -0,0 +1,97 @@
+// Unit Tests for Scintilla internal data structures
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "Platform.h"
+
+#include "SegmentCache.h"
+
+#include "catch.hpp"
+
+// Test SegmentCache.
+
+static std::vector<XYPOSITION> Positions(size_t len, XYPOSITION width) {
+	std::vector<XYPOSITION> positions(len);
+	for (size_t i = 0; i < len; i++) {
+		positions[i] = width * (i + 1);
+	}
+	return positions;
+}
+
+TEST_CASE("SegmentCache") {
+
+	SegmentCache sc;
+	FontID font = reinterpret_cast<FontID>(0x1000);
+	FontID otherFont = reinterpret_cast<FontID>(0x2000);
+	const std::string text = "a_long_identifier_from_a_minified_file";
+	const unsigned int len = static_cast<unsigned int>(text.length());
+	const std::vector<XYPOSITION> positions = Positions(len, 7.0f);
+	std::vector<XYPOSITION> retrieved(len);
+
+	SECTION("IsEmpty") {
+		REQUIRE(0 == sc.Entries());
+		REQUIRE(0 == sc.Used());
+		REQUIRE(!sc.Retrieve(font, 0, text.c_str(), len, &retrieved[0]));
+		REQUIRE(0 == sc.Hits());
+		REQUIRE(1 == sc.Misses());
+	}
+
+	SECTION("StoreAndRetrieve") {
+		sc.Store(font, 0, text.c_str(), len, &positions[0]);
+		REQUIRE(1 == sc.Entries());
+		REQUIRE(sc.Used() > len);
+		REQUIRE(sc.Retrieve(font, 0, text.c_str(), len, &retrieved[0]));
+		REQUIRE(positions == retrieved);
+		REQUIRE(1 == sc.Hits());
+		REQUIRE(0 == sc.Misses());
+	}
+
+	SECTION("MissesOtherFontStyleOrText") {
+		sc.Store(font, 0, text.c_str(), len, &positions[0]);
+		REQUIRE(!sc.Retrieve(otherFont, 0, text.c_str(), len, &retrieved[0]));
+		REQUIRE(!sc.Retrieve(font, 1, text.c_str(), len, &retrieved[0]));
+		std::string changed = text;
+		changed[len - 1] = 'x';
+		REQUIRE(!sc.Retrieve(font, 0, changed.c_str(), len, &retrieved[0]));
+		REQUIRE(!sc.Retrieve(font, 0, text.c_str(), len - 1, &retrieved[0]));
+		REQUIRE(0 == sc.Hits());
+		REQUIRE(4 == sc.Misses());
+	}
+
+	SECTION("DiscardsLeastRecentlyUsed") {
+		sc.Store(font, 0, text.c_str(), len, &positions[0]);
+		const size_t entryBytes = sc.Used();
+		sc.SetBudget(entryBytes * 2);
+		sc.Store(font, 1, text.c_str(), len, &positions[0]);
+		REQUIRE(2 == sc.Entries());
+		// Use the first so the second is least recently used
+		REQUIRE(sc.Retrieve(font, 0, text.c_str(), len, &retrieved[0]));
+		sc.Store(font, 2, text.c_str(), len, &positions[0]);
+		REQUIRE(2 == sc.Entries());
+		REQUIRE(sc.Used() <= sc.Budget());
+		REQUIRE(sc.Retrieve(font, 0, text.c_str(), len, &retrieved[0]));
+		REQUIRE(!sc.Retrieve(font, 1, text.c_str(), len, &retrieved[0]));
+		REQUIRE(sc.Retrieve(font, 2, text.c_str(), len, &retrieved[0]));
+	}
+
+	SECTION("SetBudgetDiscards") {
+		for (unsigned int style = 0; style < 10; style++) {
+			sc.Store(font, style, text.c_str(), len, &positions[0]);
+		}
+		REQUIRE(10 == sc.Entries());
+		sc.SetBudget(0);
+		REQUIRE(0 == sc.Entries());
+		REQUIRE(0 == sc.Used());
+	}
+
+	SECTION("FontsChanged") {
+		sc.Store(font, 0, text.c_str(), len, &positions[0]);
+		SegmentCache::FontsChanged();
+		REQUIRE(!sc.Retrieve(font, 0, text.c_str(), len, &retrieved[0]));
+		REQUIRE(0 == sc.Entries());
+	}
+}
@@ -0,0 +1,316 @@
+// Unit Tests for Scintilla internal data structures
+
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <string>
+#include <vector>
+#include <set>
+#include <algorithm>
+
+#include "Platform.h"
+
+#include "ILexer.h"
+#include "Scintilla.h"
+#include "SciLexer.h"
+
+#include "WordList.h"
+#include "LexerModule.h"
+
+#include "catch.hpp"
+
+// Test WordList.
+
+TEST_CASE("WordList") {
+
+	WordList wl;
+
+	SECTION("IsEmpty") {
+		REQUIRE(!wl);
+		REQUIRE(0 == wl.Length());
+		REQUIRE(!wl.InList("int"));
+		REQUIRE(!wl.InListAbbreviated("int", '~'));
+	}
+
+	SECTION("ExactWords") {
+		wl.Set("int char\tlong\r\nunsigned  int");
+		REQUIRE(wl);
+		REQUIRE(5 == wl.Length());
+		REQUIRE(wl.InList("int"));
+		REQUIRE(wl.InList("char"));
+		REQUIRE(wl.InList("long"));
+		REQUIRE(wl.InList("unsigned"));
+		REQUIRE(!wl.InList("in"));
+		REQUIRE(!wl.InList("integer"));
+		REQUIRE(!wl.InList("Int"));
+		REQUIRE(!wl.InList(""));
+		REQUIRE(!wl.InList("double"));
+	}
+
+	SECTION("Sorted") {
+		wl.Set("while do if");
+		REQUIRE(0 == strcmp(wl.WordAt(0), "do"));
+		REQUIRE(0 == strcmp(wl.WordAt(1), "if"));
+		REQUIRE(0 == strcmp(wl.WordAt(2), "while"));
+	}
+
+	SECTION("Prefixes") {
+		wl.Set("^GTK_ int");
+		REQUIRE(wl.InList("GTK_X"));
+		REQUIRE(wl.InList("GTK_MAJOR_VERSION"));
+		REQUIRE(wl.InList("GTK_"));
+		REQUIRE(wl.InList("^GTK_"));
+		REQUIRE(!wl.InList("GTK"));
+		REQUIRE(!wl.InList("GDK_X"));
+		REQUIRE(wl.InList("int"));
+	}
+
+	SECTION("Abbreviated") {
+		wl.Set("def~ine ^GTK_ int");
+		REQUIRE(wl.InListAbbreviated("def", '~'));
+		REQUIRE(wl.InListAbbreviated("defi", '~'));
+		REQUIRE(wl.InListAbbreviated("define", '~'));
+		REQUIRE(!wl.InListAbbreviated("de", '~'));
+		REQUIRE(!wl.InListAbbreviated("defines", '~'));
+		REQUIRE(wl.InListAbbreviated("int", '~'));
+		REQUIRE(wl.InListAbbreviated("GTK_X", '~'));
+		REQUIRE(!wl.InList("define"));
+	}
+
+	SECTION("OnlyLineEnds") {
+		WordList wlLines(true);
+		wlLines.Set("unsigned int\nlong long\n");
+		REQUIRE(2 == wlLines.Length());
+		REQUIRE(wlLines.InList("unsigned int"));
+		REQUIRE(wlLines.InList("long long"));
+		REQUIRE(!wlLines.InList("unsigned"));
+	}
+
+	SECTION("Replace") {
+		wl.Set("alpha beta");
+		WordList wlOther;
+		wlOther.Set("beta alpha");
+		REQUIRE(!(wl != wlOther));
+		wl.Set("gamma");
+		REQUIRE(wl != wlOther);
+		REQUIRE(!wl.InList("alpha"));
+		REQUIRE(wl.InList("gamma"));
+		wl.Clear();
+		REQUIRE(!wl.InList("gamma"));
+	}
+
+	SECTION("Large") {
+		// Many words with the same first character as generated from a database schema
+		std::set<std::string> words;
+		std::string list;
+		for (int i = 0; i < 25000; i++) {
+			char word[40];
+			sprintf(word, "tbl_%d_%x", i * 7, i * 13);
+			words.insert(word);
+			list += word;
+			list += ' ';
+		}
+		wl.Set(list.c_str());
+		REQUIRE(static_cast<int>(words.size()) == wl.Length());
+		for (std::set<std::string>::const_iterator it = words.begin(); it != words.end(); ++it) {
+			REQUIRE(wl.InList(it->c_str()));
+			const std::string longer = *it + "0";
+			REQUIRE(words.count(longer) == static_cast<size_t>(wl.InList(longer.c_str())));
+			const std::string shorter = it->substr(0, it->length() - 1);
+			REQUIRE(words.count(shorter) == static_cast<size_t>(wl.InList(shorter.c_str())));
+		}
+	}
+}
+
+// Benchmark lexing identifiers against large keyword lists. Hidden so only run when asked for:
+//   unitTest [benchmark]
+
+namespace {
+
+// Just enough of a document for a lexer to style text held in a string.
+class BenchmarkDocument : public IDocumentWithLineEnd {
+	std::string text;
+	std::vector<char> styles;
+	std::vector<int> lineStarts;
+	std::vector<int> lineStates;
+	int endStyled;
+public:
+	explicit BenchmarkDocument(const std::string &text_) : text(text_), styles(text_.length()), endStyled(0) {
+		lineStarts.push_back(0);
+		for (size_t i = 0; i < text.length(); i++) {
+			if (text[i] == '\n')
+				lineStarts.push_back(static_cast<int>(i + 1));
+		}
+		lineStates.resize(lineStarts.size() + 1);
+	}
+	virtual ~BenchmarkDocument() {
+	}
+	int SCI_METHOD Version() const {
+		return dvLineEnd;
+	}
+	void SCI_METHOD SetErrorStatus(int) {
+	}
+	int SCI_METHOD Length() const {
+		return static_cast<int>(text.length());
+	}
+	void SCI_METHOD GetCharRange(char *buffer, int position, int lengthRetrieve) const {
+		memcpy(buffer, text.c_str() + position, lengthRetrieve);
+	}
+	char SCI_METHOD StyleAt(int position) const {
+		return styles[position];
+	}
+	int SCI_METHOD LineFromPosition(int position) const {
+		return static_cast<int>(std::upper_bound(lineStarts.begin(), lineStarts.end(), position) - lineStarts.begin()) - 1;
+	}
+	int SCI_METHOD LineStart(int line) const {
+		if (line >= static_cast<int>(lineStarts.size()))
+			return Length();
+		return lineStarts[line];
+	}
+	int SCI_METHOD GetLevel(int) const {
+		return SC_FOLDLEVELBASE;
+	}
+	int SCI_METHOD SetLevel(int, int) {
+		return SC_FOLDLEVELBASE;
+	}
+	int SCI_METHOD GetLineState(int line) const {
+		return lineStates[line];
+	}
+	int SCI_METHOD SetLineState(int line, int state) {
+		lineStates[line] = state;
+		return 0;
+	}
+	void SCI_METHOD StartStyling(int position, char) {
+		endStyled = position;
+	}
+	bool SCI_METHOD SetStyleFor(int length, char style) {
+		std::fill(styles.begin() + endStyled, styles.begin() + endStyled + length, style);
+		endStyled += length;
+		return true;
+	}
+	bool SCI_METHOD SetStyles(int length, const char *stylesSet) {
+		std::copy(stylesSet, stylesSet + length, styles.begin() + endStyled);
+		endStyled += length;
+		return true;
+	}
+	void SCI_METHOD DecorationSetCurrentIndicator(int) {
+	}
+	void SCI_METHOD DecorationFillRange(int, int, int) {
+	}
+	void SCI_METHOD ChangeLexerState(int, int) {
+	}
+	int SCI_METHOD CodePage() const {
+		return 0;
+	}
+	bool SCI_METHOD IsDBCSLeadByte(char) const {
+		return false;
+	}
+	const char * SCI_METHOD BufferPointer() {
+		return text.c_str();
+	}
+	int SCI_METHOD GetLineIndentation(int) {
+		return 0;
+	}
+	int SCI_METHOD LineEnd(int line) const {
+		const int end = LineStart(line + 1);
+		return (end > LineStart(line)) && (text[end - 1] == '\n') ? end - 1 : end;
+	}
+	int SCI_METHOD GetRelativePosition(int positionStart, int characterOffset) const {
+		return positionStart + characterOffset;
+	}
+	int SCI_METHOD GetCharacterAndWidth(int position, int *pWidth) const {
+		if (pWidth)
+			*pWidth = 1;
+		return static_cast<unsigned char>(text[position]);
+	}
+	int CountStyle(int style) const {
+		return static_cast<int>(std::count(styles.begin(), styles.end(), static_cast<char>(style)));
+	}
+};
+
+// The bucket scan InList used before words were hashed
+bool InListLinear(const std::vector<std::string> &sorted, const char *s) {
+	std::vector<std::string>::const_iterator it = std::lower_bound(sorted.begin(), sorted.end(), std::string(1, s[0]));
+	for (; (it != sorted.end()) && ((*it)[0] == s[0]); ++it) {
+		if (((*it)[1] == s[1]) && (strcmp(it->c_str(), s) == 0))
+			return true;
+	}
+	return false;
+}
+
+double MicrosecondsEach(size_t count, clock_t elapsed) {
+	return static_cast<double>(elapsed) / CLOCKS_PER_SEC * 1000000.0 / count;
+}
+
+double MegabytesPerSecond(size_t length, int repeats, clock_t elapsed) {
+	const double seconds = static_cast<double>(elapsed) / CLOCKS_PER_SEC;
+	return seconds > 0 ? (static_cast<double>(length) * repeats / seconds / 1048576.0) : 0.0;
+}
+
+}
+
+extern LexerModule lmCPP;
+
+TEST_CASE("WordListBenchmark", "[.][benchmark]") {
+
+	const int keywordCount = 20000;
+	const int repeats = 4;
+
+	// Keywords from a generated SDK header all share a prefix and so a first character bucket
+	std::vector<std::string> keywords;
+	std::string list;
+	for (int i = 0; i < keywordCount; i++) {
+		char word[40];
+		sprintf(word, "sdk_symbol_%05d", i * 3);
+		keywords.push_back(word);
+		list += word;
+		list += ' ';
+	}
+	std::sort(keywords.begin(), keywords.end());
+
+	std::string text;
+	for (int line = 0; text.length() < 8 * 1024 * 1024; line++) {
+		char statement[100];
+		sprintf(statement, "\tresult = sdk_symbol_%05d(sdk_symbol_%05d, value%d);\n",
+			(line * 7) % (keywordCount * 3), (line * 11) % (keywordCount * 3), line % 10);
+		text += statement;
+	}
+
+	WordList wl;
+	wl.Set(list.c_str());
+	std::vector<std::string> identifiers;
+	for (int i = 0; i < 200000; i++) {
+		char identifier[40];
+		sprintf(identifier, "sdk_symbol_%05d", (i * 7) % (keywordCount * 3));
+		identifiers.push_back(identifier);
+	}
+	// The bucket scan is too slow to check every identifier
+	const size_t identifiersLinear = identifiers.size() / 100;
+	int found = 0;
+	clock_t start = clock();
+	for (size_t i = 0; i < identifiersLinear; i++)
+		found += InListLinear(keywords, identifiers[i].c_str());
+	const double timeLinear = MicrosecondsEach(identifiersLinear, clock() - start);
+	int foundHashed = 0;
+	start = clock();
+	for (size_t i = 0; i < identifiers.size(); i++)
+		foundHashed += wl.InList(identifiers[i].c_str());
+	const double timeHashed = MicrosecondsEach(identifiers.size(), clock() - start);
+	for (size_t i = 0; i < identifiersLinear; i++)
+		REQUIRE(InListLinear(keywords, identifiers[i].c_str()) == wl.InList(identifiers[i].c_str()));
+	REQUIRE(foundHashed > found);
+
+	ILexer *lexer = lmCPP.Create();
+	REQUIRE(lexer->WordListSet(1, list.c_str()) >= 0);
+	BenchmarkDocument doc(text);
+	start = clock();
+	for (int i = 0; i < repeats; i++)
+		lexer->Lex(0, doc.Length(), SCE_C_DEFAULT, &doc);
+	const double rateLexing = MegabytesPerSecond(text.length(), repeats, clock() - start);
+	REQUIRE(doc.CountStyle(SCE_C_WORD2) > 0);
+	lexer->Release();
+
+	printf("WordList: %d words, bucket scan %.3f us, hashed %.3f us per lookup, LexCPP %.1f MB/s\n",
+		keywordCount, timeLinear, timeHashed, rateLexing);
+}
@@ -10,13 +10,22 @@
         Decoration
         DecorationList
         CellBuffer
+        LiteralSearch
+        DFASearch
+        WrapJob
+        WrapQueue
+        SegmentCache
+        WordList
+        Document
+        LineMarkers
+        LineLevels
+        LineState
 
     To do:
         PerLine *
         Range
         StyledText
         CaseFolder ...
-        Document
         RESearch
         Selection
         UniConversion
@@ -29,11 +38,11 @@
         OptionSet
         PropSetSimple
         StyleContext
-        WordList
 */
 
 #include <cstdio>
 #include <cstdarg>
+#include <ctime>
 
 #include "Platform.h"
 
@@ -55,3 +64,53 @@ void Platform::DebugPrintf(const char *format, ...) {
 	va_end(pArguments);
 	fprintf(stderr, "%s", buffer);
 }
+
+int Platform::Minimum(int a, int b) {
+	return (a < b) ? a : b;
+}
+
+int Platform::Maximum(int a, int b) {
+	return (a > b) ? a : b;
+}
+
+int Platform::Clamp(int val, int minVal, int maxVal) {
+	if (val > maxVal)
+		val = maxVal;
+	if (val < minVal)
+		val = minVal;
+	return val;
+}
+
+// Needed for timing styling in Document
+
+ElapsedTime::ElapsedTime() {
+	bigBit = static_cast<long>(clock());
+	littleBit = 0;
+}
+
+double ElapsedTime::Duration(bool reset) {
+	const long endBigBit = static_cast<long>(clock());
+	const double result = static_cast<double>(endBigBit - bigBit) / CLOCKS_PER_SEC;
+	if (reset)
+		bigBit = endBigBit;
+	return result;
+}
+
+// Needed for the fonts of styles used by PositionCache
+
+Font::Font() : fid(0) {
+}
+
+Font::~Font() {
+}
+
+void Font::Create(const FontParameters &) {
+}
+
+void Font::Release() {
+	fid = 0;
+}
+
+int Platform::DefaultFontSize() {
+	return 10;
+}
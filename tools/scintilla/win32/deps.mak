@@ -3,7 +3,7 @@ PlatWin.o: PlatWin.cxx ../include/Platform.h ../lexlib/StringCopy.h \
  ../src/XPM.h ../src/UniConversion.h ../src/FontQuality.h
 ScintillaWin.o: ScintillaWin.cxx ../include/Platform.h \
  ../include/ILexer.h ../include/Scintilla.h ../lexlib/StringCopy.h \
- ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
+ ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
  ../src/ContractionState.h ../src/CellBuffer.h ../src/CallTip.h \
  ../src/KeyMap.h ../src/Indicator.h ../src/XPM.h ../src/LineMarker.h \
  ../src/Style.h ../src/ViewStyle.h ../src/CharClassify.h \
@@ -14,6 +14,13 @@ ScintillaWin.o: ScintillaWin.cxx ../include/Platform.h \
  ../src/ScintillaBase.h PlatWin.h
 AutoComplete.o: ../src/AutoComplete.cxx ../include/Platform.h \
  ../include/Scintilla.h ../lexlib/CharacterSet.h ../src/AutoComplete.h
+BackgroundWrap.o: ../src/BackgroundWrap.cxx ../include/Platform.h \
+ ../include/ILexer.h ../include/Scintilla.h ../src/Position.h ../src/SplitVector.h \
+ ../src/Partitioning.h ../src/RunStyles.h ../src/CellBuffer.h \
+ ../src/KeyMap.h ../src/Indicator.h ../src/XPM.h ../src/LineMarker.h \
+ ../src/Style.h ../src/ViewStyle.h ../src/CharClassify.h \
+ ../src/Decoration.h ../src/CaseFolder.h ../src/Document.h \
+ ../src/UniConversion.h ../src/BackgroundWrap.h
 CallTip.o: ../src/CallTip.cxx ../include/Platform.h \
  ../include/Scintilla.h ../lexlib/StringCopy.h ../src/CallTip.h
 CaseConvert.o: ../src/CaseConvert.cxx ../lexlib/StringCopy.h \
@@ -24,40 +31,43 @@ Catalogue.o: ../src/Catalogue.cxx ../include/ILexer.h \
  ../include/Scintilla.h ../include/SciLexer.h ../lexlib/LexerModule.h \
  ../src/Catalogue.h
 CellBuffer.o: ../src/CellBuffer.cxx ../include/Platform.h \
- ../include/Scintilla.h ../src/SplitVector.h ../src/Partitioning.h \
- ../src/CellBuffer.h ../src/UniConversion.h
+ ../include/ILexer.h ../include/Scintilla.h ../src/Position.h ../src/SplitVector.h \
+ ../src/Partitioning.h ../src/RunStyles.h ../src/CellBuffer.h ../src/UniConversion.h
 CharClassify.o: ../src/CharClassify.cxx ../src/CharClassify.h
 ContractionState.o: ../src/ContractionState.cxx ../include/Platform.h \
- ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
+ ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
  ../src/ContractionState.h
 Decoration.o: ../src/Decoration.cxx ../include/Platform.h \
- ../include/Scintilla.h ../src/SplitVector.h ../src/Partitioning.h \
+ ../include/Scintilla.h ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h \
  ../src/RunStyles.h ../src/Decoration.h
+DFASearch.o: ../src/DFASearch.cxx ../src/CharClassify.h ../src/RESearch.h \
+ ../src/DFASearch.h
 Document.o: ../src/Document.cxx ../include/Platform.h ../include/ILexer.h \
- ../include/Scintilla.h ../lexlib/CharacterSet.h ../src/SplitVector.h \
+ ../include/Scintilla.h ../lexlib/CharacterSet.h ../src/Position.h ../src/SplitVector.h \
  ../src/Partitioning.h ../src/RunStyles.h ../src/CellBuffer.h \
  ../src/PerLine.h ../src/CharClassify.h ../src/Decoration.h \
  ../src/CaseFolder.h ../src/Document.h ../src/RESearch.h \
- ../src/UniConversion.h
+ ../src/DFASearch.h ../src/LiteralSearch.h ../src/UniConversion.h \
+ ../src/SegmentCache.h
 EditModel.o: ../src/EditModel.cxx ../include/Platform.h \
  ../include/ILexer.h ../include/Scintilla.h ../lexlib/StringCopy.h \
- ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
+ ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
  ../src/ContractionState.h ../src/CellBuffer.h ../src/KeyMap.h \
  ../src/Indicator.h ../src/XPM.h ../src/LineMarker.h ../src/Style.h \
  ../src/ViewStyle.h ../src/CharClassify.h ../src/Decoration.h \
  ../src/CaseFolder.h ../src/Document.h ../src/UniConversion.h \
  ../src/Selection.h ../src/PositionCache.h ../src/EditModel.h
 Editor.o: ../src/Editor.cxx ../include/Platform.h ../include/ILexer.h \
- ../include/Scintilla.h ../lexlib/StringCopy.h ../src/SplitVector.h \
+ ../include/Scintilla.h ../lexlib/StringCopy.h ../src/Position.h ../src/SplitVector.h \
  ../src/Partitioning.h ../src/RunStyles.h ../src/ContractionState.h \
  ../src/CellBuffer.h ../src/KeyMap.h ../src/Indicator.h ../src/XPM.h \
  ../src/LineMarker.h ../src/Style.h ../src/ViewStyle.h \
  ../src/CharClassify.h ../src/Decoration.h ../src/CaseFolder.h \
  ../src/Document.h ../src/UniConversion.h ../src/Selection.h \
- ../src/PositionCache.h ../src/EditModel.h ../src/MarginView.h \
- ../src/EditView.h ../src/Editor.h
+ ../src/PositionCache.h ../src/SegmentCache.h ../src/EditModel.h \
+ ../src/MarginView.h ../src/EditView.h ../src/BackgroundWrap.h ../src/Editor.h
 EditView.o: ../src/EditView.cxx ../include/Platform.h ../include/ILexer.h \
- ../include/Scintilla.h ../lexlib/StringCopy.h ../src/SplitVector.h \
+ ../include/Scintilla.h ../lexlib/StringCopy.h ../src/Position.h ../src/SplitVector.h \
  ../src/Partitioning.h ../src/RunStyles.h ../src/ContractionState.h \
  ../src/CellBuffer.h ../src/KeyMap.h ../src/Indicator.h ../src/XPM.h \
  ../src/LineMarker.h ../src/Style.h ../src/ViewStyle.h \
@@ -77,7 +87,7 @@ LineMarker.o: ../src/LineMarker.cxx ../include/Platform.h \
  ../src/LineMarker.h
 MarginView.o: ../src/MarginView.cxx ../include/Platform.h \
  ../include/ILexer.h ../include/Scintilla.h ../lexlib/StringCopy.h \
- ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
+ ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
  ../src/ContractionState.h ../src/CellBuffer.h ../src/KeyMap.h \
  ../src/Indicator.h ../src/XPM.h ../src/LineMarker.h ../src/Style.h \
  ../src/ViewStyle.h ../src/CharClassify.h ../src/Decoration.h \
@@ -85,23 +95,23 @@ MarginView.o: ../src/MarginView.cxx ../include/Platform.h \
  ../src/Selection.h ../src/PositionCache.h ../src/EditModel.h \
  ../src/MarginView.h ../src/EditView.h
 PerLine.o: ../src/PerLine.cxx ../include/Platform.h \
- ../include/Scintilla.h ../src/SplitVector.h ../src/Partitioning.h \
+ ../include/Scintilla.h ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h \
  ../src/CellBuffer.h ../src/PerLine.h
 PositionCache.o: ../src/PositionCache.cxx ../include/Platform.h \
- ../include/ILexer.h ../include/Scintilla.h ../src/SplitVector.h \
+ ../include/ILexer.h ../include/Scintilla.h ../src/Position.h ../src/SplitVector.h \
  ../src/Partitioning.h ../src/RunStyles.h ../src/ContractionState.h \
  ../src/CellBuffer.h ../src/KeyMap.h ../src/Indicator.h ../src/XPM.h \
  ../src/LineMarker.h ../src/Style.h ../src/ViewStyle.h \
  ../src/CharClassify.h ../src/Decoration.h ../src/CaseFolder.h \
  ../src/Document.h ../src/UniConversion.h ../src/Selection.h \
- ../src/PositionCache.h
+ ../src/PositionCache.h ../src/SegmentCache.h
 RESearch.o: ../src/RESearch.cxx ../src/CharClassify.h ../src/RESearch.h
 RunStyles.o: ../src/RunStyles.cxx ../include/Platform.h \
- ../include/Scintilla.h ../src/SplitVector.h ../src/Partitioning.h \
+ ../include/Scintilla.h ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h \
  ../src/RunStyles.h
 ScintillaBase.o: ../src/ScintillaBase.cxx ../include/Platform.h \
  ../include/ILexer.h ../include/Scintilla.h ../lexlib/PropSetSimple.h \
- ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
+ ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h ../src/RunStyles.h \
  ../src/ContractionState.h ../src/CellBuffer.h ../src/CallTip.h \
  ../src/KeyMap.h ../src/Indicator.h ../src/XPM.h ../src/LineMarker.h \
  ../src/Style.h ../src/ViewStyle.h ../src/CharClassify.h \
@@ -109,13 +119,15 @@ ScintillaBase.o: ../src/ScintillaBase.cxx ../include/Platform.h \
  ../src/Selection.h ../src/PositionCache.h ../src/EditModel.h \
  ../src/MarginView.h ../src/EditView.h ../src/Editor.h \
  ../src/AutoComplete.h ../src/ScintillaBase.h
+SegmentCache.o: ../src/SegmentCache.cxx ../include/Platform.h \
+ ../src/SegmentCache.h
 Selection.o: ../src/Selection.cxx ../include/Platform.h \
  ../include/Scintilla.h ../src/Selection.h
 Style.o: ../src/Style.cxx ../include/Platform.h ../include/Scintilla.h \
  ../src/Style.h
 UniConversion.o: ../src/UniConversion.cxx ../src/UniConversion.h
 ViewStyle.o: ../src/ViewStyle.cxx ../include/Platform.h \
- ../include/Scintilla.h ../src/SplitVector.h ../src/Partitioning.h \
+ ../include/Scintilla.h ../src/Position.h ../src/SplitVector.h ../src/Partitioning.h \
  ../src/RunStyles.h ../src/Indicator.h ../src/XPM.h ../src/LineMarker.h \
  ../src/Style.h ../src/ViewStyle.h
 XPM.o: ../src/XPM.cxx ../include/Platform.h ../src/XPM.h
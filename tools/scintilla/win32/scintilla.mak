@@ -66,6 +66,7 @@ clean:
 
 SHAREDOBJS=\
 	$(DIR_O)\AutoComplete.obj \
+	$(DIR_O)\BackgroundWrap.obj \
 	$(DIR_O)\CallTip.obj \
 	$(DIR_O)\CaseConvert.obj \
 	$(DIR_O)\CaseFolder.obj \
@@ -75,6 +76,7 @@ SHAREDOBJS=\
 	$(DIR_O)\CharClassify.obj \
 	$(DIR_O)\ContractionState.obj \
 	$(DIR_O)\Decoration.obj \
+	$(DIR_O)\DFASearch.obj \
 	$(DIR_O)\Document.obj \
 	$(DIR_O)\EditModel.obj \
 	$(DIR_O)\Editor.obj \
@@ -89,6 +91,7 @@ SHAREDOBJS=\
 	$(DIR_O)\PropSetSimple.obj \
 	$(DIR_O)\RESearch.obj \
 	$(DIR_O)\RunStyles.obj \
+	$(DIR_O)\SegmentCache.obj \
 	$(DIR_O)\Selection.obj \
 	$(DIR_O)\Style.obj \
 	$(DIR_O)\UniConversion.obj \
@@ -281,6 +284,28 @@ $(DIR_O)\AutoComplete.obj: \
 	../include/Scintilla.h \
 	../lexlib/CharacterSet.h \
 	../src/AutoComplete.h
+$(DIR_O)\BackgroundWrap.obj: \
+	../src/BackgroundWrap.cxx \
+	../include/Platform.h \
+	../include/ILexer.h \
+	../include/Scintilla.h \
+	../src/Position.h \
+	../src/SplitVector.h \
+	../src/Partitioning.h \
+	../src/RunStyles.h \
+	../src/CellBuffer.h \
+	../src/KeyMap.h \
+	../src/Indicator.h \
+	../src/XPM.h \
+	../src/LineMarker.h \
+	../src/Style.h \
+	../src/ViewStyle.h \
+	../src/CharClassify.h \
+	../src/Decoration.h \
+	../src/CaseFolder.h \
+	../src/Document.h \
+	../src/UniConversion.h \
+	../src/BackgroundWrap.h
 $(DIR_O)\CallTip.obj: \
 	../src/CallTip.cxx \
 	../include/Platform.h \
@@ -308,9 +333,12 @@ $(DIR_O)\Catalogue.obj: \
 $(DIR_O)\CellBuffer.obj: \
 	../src/CellBuffer.cxx \
 	../include/Platform.h \
+	../include/ILexer.h \
 	../include/Scintilla.h \
+	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
+	../src/RunStyles.h \
 	../src/CellBuffer.h \
 	../src/UniConversion.h
 $(DIR_O)\CharacterCategory.obj: \
@@ -326,6 +354,7 @@ $(DIR_O)\CharClassify.obj: \
 $(DIR_O)\ContractionState.obj: \
 	../src/ContractionState.cxx \
 	../include/Platform.h \
+	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
 	../src/RunStyles.h \
@@ -334,6 +363,7 @@ $(DIR_O)\Decoration.obj: \
 	../src/Decoration.cxx \
 	../include/Platform.h \
 	../include/Scintilla.h \
+	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
 	../src/RunStyles.h \
@@ -344,6 +374,7 @@ $(DIR_O)\Document.obj: \
 	../include/ILexer.h \
 	../include/Scintilla.h \
 	../lexlib/CharacterSet.h \
+	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
 	../src/RunStyles.h \
@@ -354,13 +385,17 @@ $(DIR_O)\Document.obj: \
 	../src/CaseFolder.h \
 	../src/Document.h \
 	../src/RESearch.h \
-	../src/UniConversion.h
+	../src/DFASearch.h \
+	../src/LiteralSearch.h \
+	../src/UniConversion.h \
+	../src/SegmentCache.h
 $(DIR_O)\EditModel.obj: \
 	../src/EditModel.cxx \
 	../include/Platform.h \
 	../include/ILexer.h \
 	../include/Scintilla.h \
 	../lexlib/StringCopy.h \
+	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
 	../src/RunStyles.h \
@@ -386,6 +421,7 @@ $(DIR_O)\Editor.obj: \
 	../include/ILexer.h \
 	../include/Scintilla.h \
 	../lexlib/StringCopy.h \
+	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
 	../src/RunStyles.h \
@@ -404,9 +440,11 @@ $(DIR_O)\Editor.obj: \
 	../src/UniConversion.h \
 	../src/Selection.h \
 	../src/PositionCache.h \
+	../src/SegmentCache.h \
 	../src/EditModel.h \
 	../src/MarginView.h \
 	../src/EditView.h \
+	../src/BackgroundWrap.h \
 	../src/Editor.h
 $(DIR_O)\EditView.obj: \
 	../src/EditView.cxx \
@@ -414,6 +452,7 @@ $(DIR_O)\EditView.obj: \
 	../include/ILexer.h \
 	../include/Scintilla.h \
 	../lexlib/StringCopy.h \
+	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
 	../src/RunStyles.h \
@@ -714,6 +753,7 @@ $(DIR_O)\MarginView.obj: \
 	../include/ILexer.h \
 	../include/Scintilla.h \
 	../lexlib/StringCopy.h \
+	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
 	../src/RunStyles.h \
@@ -739,6 +779,7 @@ $(DIR_O)\PerLine.obj: \
 	../src/PerLine.cxx \
 	../include/Platform.h \
 	../include/Scintilla.h \
+	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
 	../src/CellBuffer.h \
@@ -755,6 +796,7 @@ $(DIR_O)\PositionCache.obj: \
 	../include/Platform.h \
 	../include/ILexer.h \
 	../include/Scintilla.h \
+	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
 	../src/RunStyles.h \
@@ -772,10 +814,16 @@ $(DIR_O)\PositionCache.obj: \
 	../src/Document.h \
 	../src/UniConversion.h \
 	../src/Selection.h \
-	../src/PositionCache.h
+	../src/PositionCache.h \
+	../src/SegmentCache.h
 $(DIR_O)\PropSetSimple.obj: \
 	../lexlib/PropSetSimple.cxx \
 	../lexlib/PropSetSimple.h
+$(DIR_O)\DFASearch.obj: \
+	../src/DFASearch.cxx \
+	../src/CharClassify.h \
+	../src/RESearch.h \
+	../src/DFASearch.h
 $(DIR_O)\RESearch.obj: \
 	../src/RESearch.cxx \
 	../src/CharClassify.h \
@@ -784,6 +832,7 @@ $(DIR_O)\RunStyles.obj: \
 	../src/RunStyles.cxx \
 	../include/Platform.h \
 	../include/Scintilla.h \
+	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
 	../src/RunStyles.h
@@ -793,6 +842,7 @@ $(DIR_O)\ScintillaBase.obj: \
 	../include/ILexer.h \
 	../include/Scintilla.h \
 	../lexlib/PropSetSimple.h \
+	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
 	../src/RunStyles.h \
@@ -823,6 +873,7 @@ $(DIR_O)\ScintillaBaseL.obj: \
 	../include/ILexer.h \
 	../include/Scintilla.h \
 	../lexlib/PropSetSimple.h \
+	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
 	../src/RunStyles.h \
@@ -853,6 +904,7 @@ $(DIR_O)\ScintillaWin.obj: \
 	../include/ILexer.h \
 	../include/Scintilla.h \
 	../lexlib/StringCopy.h \
+	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
 	../src/RunStyles.h \
@@ -886,6 +938,7 @@ $(DIR_O)\ScintillaWinL.obj: \
 	../include/ILexer.h \
 	../include/Scintilla.h \
 	../lexlib/StringCopy.h \
+	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
 	../src/RunStyles.h \
@@ -919,6 +972,7 @@ $(DIR_O)\ScintillaWinS.obj: \
 	../include/ILexer.h \
 	../include/Scintilla.h \
 	../lexlib/StringCopy.h \
+	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
 	../src/RunStyles.h \
@@ -946,6 +1000,10 @@ $(DIR_O)\ScintillaWinS.obj: \
 	../src/AutoComplete.h \
 	../src/ScintillaBase.h \
 	PlatWin.h
+$(DIR_O)\SegmentCache.obj: \
+	../src/SegmentCache.cxx \
+	../include/Platform.h \
+	../src/SegmentCache.h
 $(DIR_O)\Selection.obj: \
 	../src/Selection.cxx \
 	../include/Platform.h \
@@ -969,6 +1027,7 @@ $(DIR_O)\ViewStyle.obj: \
 	../src/ViewStyle.cxx \
 	../include/Platform.h \
 	../include/Scintilla.h \
+	../src/Position.h \
 	../src/SplitVector.h \
 	../src/Partitioning.h \
 	../src/RunStyles.h \
@@ -24,6 +24,11 @@ SciTEGTK.o: SciTEGTK.cxx \
 Widget.o: Widget.cxx \
  ../../scintilla/include/Scintilla.h ../src/GUI.h ../src/StringHelpers.h \
  Widget.h
+APIRepository.o: ../src/APIRepository.cxx \
+ ../../scintilla/include/Scintilla.h ../../scintilla/include/ILexer.h \
+ ../src/GUI.h ../src/SString.h ../src/StringList.h ../src/StringHelpers.h \
+ ../src/FilePath.h ../src/Mutex.h ../src/Cookie.h ../src/Worker.h \
+ ../src/FileWorker.h ../src/APIRepository.h
 Cookie.o: ../src/Cookie.cxx ../src/SString.h ../src/Cookie.h
 Credits.o: ../src/Credits.cxx \
  ../../scintilla/include/Scintilla.h ../../scintilla/include/ILexer.h \
@@ -59,7 +64,13 @@ LuaExtension.o: ../src/LuaExtension.cxx \
 mrubyExtension.o: ../src/mrubyExtension.cxx \
  ../../scintilla/include/Scintilla.h ../src/GUI.h ../src/SString.h \
  ../src/FilePath.h ../src/StyleWriter.h ../src/Extender.h \
- ../src/mrubyExtension.h ../src/IFaceTable.h ../src/SciTEKeys.h
+ ../src/mrubyExtension.h ../src/TableLexer.h ../src/IFaceTable.h \
+ ../src/SciTEKeys.h ../../scintilla/lexlib/WordList.h \
+ ../../scintilla/src/CharClassify.h ../../scintilla/src/RESearch.h
+TableLexer.o: ../src/TableLexer.cxx ../../scintilla/include/Scintilla.h \
+ ../src/GUI.h ../src/StyleWriter.h ../src/TableLexer.h \
+ ../../scintilla/lexlib/WordList.h ../../scintilla/src/CharClassify.h \
+ ../../scintilla/src/RESearch.h
 MatchMarker.o: ../src/MatchMarker.cxx ../../scintilla/include/Scintilla.h \
  ../src/GUI.h ../src/MatchMarker.h
 MultiplexExtension.o: ../src/MultiplexExtension.cxx \
@@ -74,7 +85,7 @@ SciTEBase.o: ../src/SciTEBase.cxx \
  ../src/StringList.h ../src/StringHelpers.h ../src/FilePath.h \
  ../src/StyleDefinition.h ../src/PropSetFile.h ../src/StyleWriter.h \
  ../src/Extender.h ../src/SciTE.h ../src/Mutex.h ../src/JobQueue.h \
- ../src/Cookie.h ../src/Worker.h ../src/FileWorker.h ../src/MatchMarker.h \
+ ../src/Cookie.h ../src/Worker.h ../src/FileWorker.h ../src/APIRepository.h ../src/MatchMarker.h ../src/WordIndex.h \
  ../src/SciTEBase.h
 SciTEBuffers.o: ../src/SciTEBuffers.cxx \
  ../../scintilla/include/Scintilla.h ../../scintilla/include/SciLexer.h \
@@ -82,7 +93,7 @@ SciTEBuffers.o: ../src/SciTEBuffers.cxx \
  ../src/StringList.h ../src/StringHelpers.h ../src/FilePath.h \
  ../src/StyleDefinition.h ../src/PropSetFile.h ../src/StyleWriter.h \
  ../src/Extender.h ../src/SciTE.h ../src/Mutex.h ../src/JobQueue.h \
- ../src/Cookie.h ../src/Worker.h ../src/FileWorker.h ../src/MatchMarker.h \
+ ../src/Cookie.h ../src/Worker.h ../src/FileWorker.h ../src/MatchMarker.h ../src/WordIndex.h \
  ../src/SciTEBase.h
 SciTEIO.o: ../src/SciTEIO.cxx \
  ../../scintilla/include/Scintilla.h ../../scintilla/include/ILexer.h \
@@ -97,7 +108,7 @@ SciTEProps.o: ../src/SciTEProps.cxx ../../scintilla/include/Scintilla.h \
  ../src/StringList.h ../src/StringHelpers.h ../src/FilePath.h \
  ../src/StyleDefinition.h ../src/PropSetFile.h ../src/StyleWriter.h \
  ../src/Extender.h ../src/SciTE.h ../src/IFaceTable.h ../src/Mutex.h \
- ../src/JobQueue.h ../src/Cookie.h ../src/Worker.h ../src/MatchMarker.h \
+ ../src/JobQueue.h ../src/Cookie.h ../src/Worker.h ../src/APIRepository.h ../src/MatchMarker.h \
  ../src/SciTEBase.h
 StringHelpers.o: ../src/StringHelpers.cxx \
  ../../scintilla/include/Scintilla.h ../src/GUI.h ../src/StringHelpers.h
@@ -108,3 +119,5 @@ StyleDefinition.o: ../src/StyleDefinition.cxx \
 StyleWriter.o: ../src/StyleWriter.cxx ../../scintilla/include/Scintilla.h \
  ../src/GUI.h ../src/StyleWriter.h
 Utf8_16.o: ../src/Utf8_16.cxx ../src/Utf8_16.h
+WordIndex.o: ../src/WordIndex.cxx ../../scintilla/include/Scintilla.h \
+ ../src/GUI.h ../src/WordIndex.h
@@ -251,10 +251,58 @@ def printIFaceTableCXXFile(faceAndIDs):
 	else:
 		out.append('{"", 0, iface_void, iface_void} };')
 
+	# Indexes so that lookups by constant name or by message number do not
+	# need a sequential search.
+
+	out.append("static const int ifaceFunctionsByConstantName[] = {")
+	if functions:
+		order = sorted(range(len(functions)), key=lambda i: functions[i][0].upper())
+		for i in order:
+			comma = "" if i == order[-1] else ","
+			out.append('\t%d%s // SCI_%s' % (i, comma, functions[i][0].upper()))
+		out.append("};")
+	else:
+		out.append('-1 };')
+
+	messages = []
+	for i, (name, features) in enumerate(functions):
+		messages.append((int(features["Value"], base=0), i, -1))
+	for i, (propname, property) in enumerate(properties):
+		for value in (property["GetterValue"], property["SetterValue"]):
+			if value:
+				messages.append((int(value, base=0), -1, i))
+	messages.sort()
+
+	out.append("")
+	out.append("static IFaceMessage ifaceMessages[] = {")
+	if messages:
+		for value, function, prop in messages:
+			comma = "" if (value, function, prop) == messages[-1] else ","
+			out.append('\t{%d, %d, %d}%s' % (value, function, prop, comma))
+		out.append("};")
+	else:
+		out.append('{0, -1, -1} };')
+
+	out.append("")
+	out.append("static const int ifaceConstantsByValue[] = {")
+	if constants:
+		def signedValue(i):
+			val = int(constants[i][1]["Value"], base=0)
+			return val - 0x100000000 if val >= 0x80000000 else val
+		order = sorted(range(len(constants)), key=lambda i: (signedValue(i), i))
+		for i in order:
+			comma = "" if i == order[-1] else ","
+			out.append('\t%d%s // %s' % (i, comma, constants[i][0]))
+		out.append("};")
+	else:
+		out.append('-1 };')
+	out.append("")
+
 	out.append("enum {")
 	out.append("\tifaceFunctionCount = %d," % len(functions))
 	out.append("\tifaceConstantCount = %d," % len(constants))
-	out.append("\tifacePropertyCount = %d" % len(properties))
+	out.append("\tifacePropertyCount = %d," % len(properties))
+	out.append("\tifaceMessageCount = %d" % len(messages))
 	out.append("};")
 	out.append("")
 	return out
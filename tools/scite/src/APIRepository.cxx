@@ -0,0 +1,175 @@
+// SciTE - Scintilla based Text Editor
+/** @file APIRepository.cxx
+ ** Sets of API files read in the background and shared by all buffers.
+ **/
+// Copyright 1998-2014 by Neil Hodgson <neilh@scintilla.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <limits.h>
+#include <time.h>
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "Scintilla.h"
+#include "ILexer.h"
+
+#include "GUI.h"
+#include "SString.h"
+#include "StringList.h"
+#include "StringHelpers.h"
+#include "FilePath.h"
+#include "Mutex.h"
+#include "Cookie.h"
+#include "Worker.h"
+#include "FileWorker.h"
+#include "APIRepository.h"
+
+// Sets not used recently are discarded as API files may be large
+static const size_t maxSets = 8;
+
+APIFileStamp::APIFileStamp(const FilePath &path_) : path(path_), size(-1), modified(0) {
+	path.Status(size, modified);
+}
+
+bool APIFileStamp::Current() const {
+	long long sizeNow = -1;
+	time_t modifiedNow = 0;
+	path.Status(sizeNow, modifiedNow);
+	return (sizeNow == size) && (modifiedNow == modified);
+}
+
+APILoader::APILoader(WorkerListener *pListener_, const std::string &fileNames_) :
+	pListener(pListener_), fileNames(fileNames_), list(0) {
+}
+
+APILoader::~APILoader() {
+	delete list;
+	list = 0;
+}
+
+void APILoader::Execute() {
+	std::vector<std::string> names = StringSplit(fileNames, ';');
+	long long total = 0;
+	for (size_t i = 0; i < names.size(); i++) {
+		if (!names[i].empty()) {
+			stamps.push_back(APIFileStamp(GUI::StringFromUTF8(names[i].c_str())));
+			if (stamps.back().size > 0)
+				total += stamps.back().size;
+		}
+	}
+	SetSizeJob(total);
+	if ((total > 0) && (total < INT_MAX) && !Cancelling()) {
+		list = new StringList(true);
+		char *buffer = list->Allocate(static_cast<int>(total));
+		long long used = 0;
+		for (size_t i = 0; (i < stamps.size()) && !Cancelling(); i++) {
+			FILE *fp = stamps[i].path.Open(fileRead);
+			if (fp) {
+				// Files may have grown since measured so only read what fits
+				used += fread(buffer + used, 1, static_cast<size_t>(total - used), fp);
+				fclose(fp);
+			}
+			IncrementProgress(stamps[i].size);
+		}
+		buffer[used] = '\0';
+		list->SetFromAllocated();
+		if (*list) {
+			list->Sort();
+		} else {
+			delete list;
+			list = 0;
+		}
+	}
+	// After SetCompleted, Cancel may return and this object be deleted
+	WorkerListener *pListenerCompleted = Cancelling() ? 0 : pListener;
+	SetCompleted();
+	if (pListenerCompleted)
+		pListenerCompleted->PostOnMainThread(WORK_APILOADED, this);
+}
+
+APIRepository::APIRepository() : uses(0) {
+}
+
+APIRepository::~APIRepository() {
+	for (SetMap::iterator it = sets.begin(); it != sets.end(); ++it) {
+		if (it->second.loader) {
+			it->second.loader->Cancel();
+			delete it->second.loader;
+		}
+		delete it->second.list;
+	}
+	sets.clear();
+}
+
+/**
+ * Returns true when the set of files has been read and none of them has changed since.
+ * list is then the entries of the files or NULL when they have none.
+ */
+bool APIRepository::Find(const std::string &fileNames, StringList *&list) {
+	list = 0;
+	SetMap::iterator it = sets.find(fileNames);
+	if ((it == sets.end()) || it->second.loader)
+		return false;
+	for (size_t i = 0; i < it->second.stamps.size(); i++) {
+		if (!it->second.stamps[i].Current()) {
+			delete it->second.list;
+			sets.erase(it);
+			return false;
+		}
+	}
+	it->second.lastUse = ++uses;
+	list = it->second.list;
+	return true;
+}
+
+bool APIRepository::Loading(const std::string &fileNames) const {
+	SetMap::const_iterator it = sets.find(fileNames);
+	return (it != sets.end()) && it->second.loader;
+}
+
+/// Returns a loader that the caller should run, preferably on a new thread.
+APILoader *APIRepository::Load(WorkerListener *pListener, const std::string &fileNames) {
+	APISet &set = sets[fileNames];
+	delete set.list;
+	set.list = 0;
+	set.stamps.clear();
+	set.loader = new APILoader(pListener, fileNames);
+	return set.loader;
+}
+
+/// Called on the main thread once a loader has finished to take its results.
+void APIRepository::Loaded(APILoader *loader) {
+	SetMap::iterator it = sets.find(loader->fileNames);
+	if ((it != sets.end()) && (it->second.loader == loader)) {
+		it->second.list = loader->list;
+		loader->list = 0;
+		it->second.stamps = loader->stamps;
+		it->second.loader = 0;
+		it->second.lastUse = ++uses;
+	}
+	delete loader;
+	Discard();
+}
+
+void APIRepository::Discard() {
+	for (;;) {
+		size_t loaded = 0;
+		SetMap::iterator itOldest = sets.end();
+		for (SetMap::iterator it = sets.begin(); it != sets.end(); ++it) {
+			if (!it->second.loader) {
+				loaded++;
+				if ((itOldest == sets.end()) || (it->second.lastUse < itOldest->second.lastUse))
+					itOldest = it;
+			}
+		}
+		if (loaded <= maxSets)
+			return;
+		delete itOldest->second.list;
+		sets.erase(itOldest);
+	}
+}
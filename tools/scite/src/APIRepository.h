@@ -0,0 +1,68 @@
+// SciTE - Scintilla based Text Editor
+/** @file APIRepository.h
+ ** Sets of API files read in the background and shared by all buffers.
+ **/
+// Copyright 1998-2014 by Neil Hodgson <neilh@scintilla.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef APIREPOSITORY_H
+#define APIREPOSITORY_H
+
+/// The size and modification time of an API file when it was read.
+struct APIFileStamp {
+	FilePath path;
+	long long size;
+	time_t modified;
+	explicit APIFileStamp(const FilePath &path_);
+	bool Current() const;
+};
+
+/// Reads and sorts a set of API files, named by a ';' separated list, on a background thread.
+class APILoader : public Worker {
+public:
+	WorkerListener *pListener;
+	std::string fileNames;
+	std::vector<APIFileStamp> stamps;
+	StringList *list;	///< NULL when the files have no entries
+
+	APILoader(WorkerListener *pListener_, const std::string &fileNames_);
+	virtual ~APILoader();
+	virtual void Execute();
+private:
+	// Private so APILoader objects can not be copied
+	APILoader(const APILoader &);
+	APILoader &operator=(const APILoader &);
+};
+
+/**
+ * Keeps each set of API files that has been used so that switching between buffers of
+ * different languages does not read and sort the files again. A set is read again once
+ * one of its files changes. Only the most recently used sets are kept.
+ */
+class APIRepository {
+	struct APISet {
+		StringList *list;
+		APILoader *loader;	///< Set while the files are being read
+		std::vector<APIFileStamp> stamps;
+		unsigned int lastUse;
+		APISet() : list(0), loader(0), lastUse(0) {
+		}
+	};
+	typedef std::map<std::string, APISet> SetMap;
+	SetMap sets;
+	unsigned int uses;
+	void Discard();
+public:
+	APIRepository();
+	~APIRepository();
+	bool Find(const std::string &fileNames, StringList *&list);
+	bool Loading(const std::string &fileNames) const;
+	APILoader *Load(WorkerListener *pListener, const std::string &fileNames);
+	void Loaded(APILoader *loader);
+private:
+	// Private so APIRepository objects can not be copied
+	APIRepository(const APIRepository &);
+	APIRepository &operator=(const APIRepository &);
+};
+
+#endif
@@ -18,6 +18,7 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <algorithm>
 #include <sstream>
 
 #include "Scintilla.h"
@@ -38,9 +39,187 @@
 #include "JobQueue.h"
 #include "Cookie.h"
 #include "Worker.h"
+#include "FileWorker.h"
 #include "MatchMarker.h"
 #include "SciTEBase.h"
 
+// Style only the text not yet styled as the document may already have been styled
+// in the background so there is no need to lex it all again.
+static void StyleRemainder(GUI::ScintillaWindow &wEditor) {
+	const int endStyled = wEditor.Call(SCI_GETENDSTYLED);
+	if (endStyled < wEditor.Call(SCI_GETLENGTH)) {
+		const int lineEndStyled = wEditor.Call(SCI_LINEFROMPOSITION, endStyled);
+		wEditor.Call(SCI_COLOURISE, wEditor.Call(SCI_POSITIONFROMLINE, lineEndStyled), -1);
+	}
+}
+
+// Exporters write many small pieces so give the file a large buffer.
+static void SetExportBuffer(FILE *fp) {
+	setvbuf(fp, NULL, _IOFBF, 0x40000);
+}
+
+/**
+ * Writes an export from copies of the text, styles and properties taken when it starts
+ * so it can run on a worker thread while the document is edited or closed.
+ */
+class Exporter : public FileWorker {
+public:
+	enum Format { fmtRTF, fmtHTML, fmtPDF, fmtTEX, fmtXML };
+	Format format;
+	PropSetFile props;
+	SString language;
+	int codePage;
+	FilePath filePath;
+	bool useMonoFont;
+	StyledTextReader acc;
+	int rangeStart;
+	int rangeEnd;
+	int nextCheck;
+
+	Exporter(WorkerListener *pListener_, Format format_, FilePath path_, PropSetFile &propsSource,
+		const SString &language_, int codePage_, FilePath filePath_, bool useMonoFont_,
+		int rangeStart_=0, int rangeEnd_=-1);
+	void Snapshot(GUI::ScintillaWindow &wEditor);
+	virtual void Execute();
+	virtual bool IsLoading() const {
+		return false;
+	}
+	bool Continuing(int position);
+	void SaveToStreamRTF(std::ostream &os, int start, int end);
+	void SaveToRTF();
+	void SaveToHTML();
+	void SaveToPDF();
+	void SaveToTEX();
+	void SaveToXML();
+};
+
+Exporter::Exporter(WorkerListener *pListener_, Format format_, FilePath path_, PropSetFile &propsSource,
+	const SString &language_, int codePage_, FilePath filePath_, bool useMonoFont_,
+	int rangeStart_, int rangeEnd_) :
+	FileWorker(pListener_, path_, 0, 0), format(format_), language(language_), codePage(codePage_),
+	filePath(filePath_), useMonoFont(useMonoFont_), rangeStart(rangeStart_), rangeEnd(rangeEnd_),
+	nextCheck(0) {
+	// Lookups resolve through the super sets which the main thread may change so
+	// copy the whole chain into one set, applying the nearest set last
+	std::vector<PropSetFile *> chain;
+	for (PropSetFile *ps = &propsSource; ps; ps = ps->superPS)
+		chain.push_back(ps);
+	for (std::vector<PropSetFile *>::reverse_iterator it = chain.rbegin(); it != chain.rend(); ++it) {
+		const char *key = 0;
+		const char *val = 0;
+		bool more = (*it)->GetFirst(key, val);
+		while (more) {
+			props.Set(key, val);
+			more = (*it)->GetNext(key, val);
+		}
+	}
+}
+
+// Copies the range to export from the styled document on the main thread.
+void Exporter::Snapshot(GUI::ScintillaWindow &wEditor) {
+	const bool folding = (format == fmtHTML) && props.GetInt("export.html.folding", 0);
+	acc.Fill(wEditor, rangeStart, rangeEnd, folding);
+	if ((rangeEnd < 0) || (rangeEnd > acc.Length()))
+		rangeEnd = acc.Length();
+	rangeStart = std::min(rangeStart, rangeEnd);
+	size = rangeEnd - rangeStart;
+	SetSizeJob(size);
+	nextCheck = rangeStart;
+}
+
+void Exporter::Execute() {
+	switch (format) {
+	case fmtRTF:
+		SaveToRTF();
+		break;
+	case fmtHTML:
+		SaveToHTML();
+		break;
+	case fmtPDF:
+		SaveToPDF();
+		break;
+	case fmtTEX:
+		SaveToTEX();
+		break;
+	case fmtXML:
+		SaveToXML();
+		break;
+	}
+	if (Cancelling()) {
+		// Do not leave a partial export behind
+		path.Remove();
+	}
+	// After SetCompleted, Cancel may return and this object be deleted
+	WorkerListener *pListenerCompleted = Cancelling() ? 0 : pListener;
+	SetCompleted();
+	if (pListenerCompleted)
+		pListenerCompleted->PostOnMainThread(WORK_EXPORTED, this);
+}
+
+/**
+ * Called by the exporters as they reach @a position. Once per block, updates progress and
+ * returns false when the export has been cancelled so the exporter stops early.
+ */
+bool Exporter::Continuing(int position) {
+	if (position < nextCheck)
+		return true;
+	nextCheck = position + blockSize;
+	IncrementProgress(position - rangeStart - ProgressMade());
+	if (pListener && (et.Duration() > nextProgress)) {
+		nextProgress = et.Duration() + timeBetweenProgress;
+		pListener->PostOnMainThread(WORK_FILEPROGRESS, this);
+	}
+	return !Cancelling();
+}
+
+/**
+ * Copies the current document for @a pExporter then writes the export on another thread,
+ * showing progress and cancelled by Stop Executing. Small documents, as decided by
+ * background.save.size, and @a synchronous exports are written before returning.
+ */
+void SciTEBase::Export(Exporter *pExporter, bool synchronous) {
+	RemoveFindMarks();
+	StyleRemainder(wEditor);
+	pExporter->Snapshot(wEditor);
+	exporters.push_back(pExporter);
+	if (synchronous || (LengthDocument() <= props.GetInt("background.save.size", -1)) ||
+		!PerformOnNewThread(pExporter)) {
+		pExporter->pListener = 0;
+		pExporter->Execute();
+		Exported(pExporter);
+	} else {
+		UpdateProgress(pExporter);
+		CheckMenus();
+	}
+}
+
+void SciTEBase::Exported(FileWorker *pExporter) {
+	std::vector<FileWorker *>::iterator it = std::find(exporters.begin(), exporters.end(), pExporter);
+	if (it == exporters.end()) {
+		// Already cancelled and deleted
+		return;
+	}
+	exporters.erase(it);
+	if (pExporter->err) {
+		GUI::gui_string msg = LocaliseMessage("Could not save file '^0'.", pExporter->path.AsInternal());
+		WindowMessageBox(wSciTE, msg);
+	}
+	delete pExporter;
+	UpdateProgress(0);
+	CheckMenus();
+}
+
+void SciTEBase::CancelExports() {
+	if (exporters.empty())
+		return;
+	for (size_t i = 0; i < exporters.size(); i++) {
+		exporters[i]->Cancel();
+		delete exporters[i];
+	}
+	exporters.clear();
+	UpdateProgress(0);
+	CheckMenus();
+}
 
 //---------- Save to RTF ----------
 
@@ -108,11 +287,15 @@ void GetRTFStyleChange(char *delta, char *last, char *current) { // \f0\fs20\cf0
 }
 
 void SciTEBase::SaveToStreamRTF(std::ostream &os, int start, int end) {
-	int lengthDoc = LengthDocument();
-	if (end < 0)
-		end = lengthDoc;
+	Exporter exporter(0, Exporter::fmtRTF, FilePath(), props, language, codePage, filePath,
+		CurrentBuffer()->useMonoFont, start, end);
 	RemoveFindMarks();
-	wEditor.Call(SCI_COLOURISE, 0, -1);
+	StyleRemainder(wEditor);
+	exporter.Snapshot(wEditor);
+	exporter.SaveToStreamRTF(os, exporter.rangeStart, exporter.rangeEnd);
+}
+
+void Exporter::SaveToStreamRTF(std::ostream &os, int start, int end) {
 
 	// Read the default settings
 	char key[200];
@@ -241,9 +424,8 @@ void SciTEBase::SaveToStreamRTF(std::ostream &os, int start, int end) {
 		RTF_BOLD_OFF RTF_ITALIC_OFF, defaultStyle.size);
 	bool prevCR = false;
 	int styleCurrent = -1;
-	TextReader acc(wEditor);
 	int column = 0;
-	for (i = start; i < end; i++) {
+	for (i = start; i < end && Continuing(i); i++) {
 		char ch = acc[i];
 		int style = acc.StyleAt(i);
 		if (style > STYLE_MAX)
@@ -278,34 +460,46 @@ void SciTEBase::SaveToStreamRTF(std::ostream &os, int start, int end) {
 		} else if (ch == '\r') {
 			os << RTF_EOLN;
 			column = -1;
-		} else
-			os << ch;
+		} else {
+			// Write the run of plain characters in this style at once
+			const int runEnd = acc.RunEnd(i, end, "{}\\\t\n\r");
+			os.write(acc.RangePointer(i), runEnd - i);
+			column += runEnd - i - 1;
+			i = runEnd - 1;
+		}
 		column++;
 		prevCR = ch == '\r';
 	}
 	os << RTF_BODYCLOSE;
 }
 
-void SciTEBase::SaveToRTF(FilePath saveName, int start, int end) {
-	FILE *fp = saveName.Open(GUI_TEXT("wt"));
+void SciTEBase::SaveToRTF(FilePath saveName, int start, int end, bool synchronous) {
+	Export(new Exporter(this, Exporter::fmtRTF, saveName, props, language, codePage, filePath,
+		CurrentBuffer()->useMonoFont, start, end), synchronous);
+}
+
+void Exporter::SaveToRTF() {
+	FILE *fp = path.Open(GUI_TEXT("wt"));
 	if (fp) {
 		std::ostringstream oss;
-		SaveToStreamRTF(oss, start, end);
+		SaveToStreamRTF(oss, rangeStart, rangeEnd);
 		std::string rtf = oss.str();
 		fwrite(rtf.c_str(), 1, rtf.length(), fp);
 		fclose(fp);
 	} else {
-		GUI::gui_string msg = LocaliseMessage("Could not save file '^0'.", filePath.AsInternal());
-		WindowMessageBox(wSciTE, msg);
+		err = 1;
 	}
 }
 
 
 //---------- Save to HTML ----------
 
-void SciTEBase::SaveToHTML(FilePath saveName) {
-	RemoveFindMarks();
-	wEditor.Call(SCI_COLOURISE, 0, -1);
+void SciTEBase::SaveToHTML(FilePath saveName, bool synchronous) {
+	Export(new Exporter(this, Exporter::fmtHTML, saveName, props, language, codePage, filePath,
+		CurrentBuffer()->useMonoFont), synchronous);
+}
+
+void Exporter::SaveToHTML() {
 	int tabSize = props.GetInt("tabsize");
 	if (tabSize == 0)
 		tabSize = 4;
@@ -315,8 +509,7 @@ void SciTEBase::SaveToHTML(FilePath saveName) {
 	int onlyStylesUsed = props.GetInt("export.html.styleused", 0);
 	int titleFullPath = props.GetInt("export.html.title.fullpath", 0);
 
-	int lengthDoc = LengthDocument();
-	TextReader acc(wEditor);
+	int lengthDoc = acc.Length();
 
 	bool styleIsUsed[STYLE_MAX + 1];
 	if (onlyStylesUsed) {
@@ -335,8 +528,9 @@ void SciTEBase::SaveToHTML(FilePath saveName) {
 	}
 	styleIsUsed[STYLE_DEFAULT] = true;
 
-	FILE *fp = saveName.Open(GUI_TEXT("wt"));
+	FILE *fp = path.Open(GUI_TEXT("wt"));
 	if (fp) {
+		SetExportBuffer(fp);
 		fputs("<!DOCTYPE html PUBLIC \"-//W3C//DTD XHTML 1.0 Transitional//EN\" \"http://www.w3.org/TR/xhtml1/DTD/xhtml1-transitional.dtd\">\n", fp);
 		fputs("<html xmlns=\"http://www.w3.org/1999/xhtml\">\n", fp);
 		fputs("<head>\n", fp);
@@ -411,7 +605,7 @@ void SciTEBase::SaveToHTML(FilePath saveName) {
 				StyleDefinition sd(valdef);
 				sd.ParseStyleDefinition(val);
 
-				if (CurrentBuffer()->useMonoFont && sd.font.length() && sdmono.font.length()) {
+				if (useMonoFont && sd.font.length() && sdmono.font.length()) {
 					sd.font = sdmono.font;
 					sd.size = sdmono.size;
 					sd.italics = sdmono.italics;
@@ -497,7 +691,7 @@ void SciTEBase::SaveToHTML(FilePath saveName) {
 		// no span for it, except the global one
 
 		int column = 0;
-		for (int i = 0; i < lengthDoc; i++) {
+		for (int i = 0; i < lengthDoc && Continuing(i); i++) {
 			char ch = acc[i];
 			int style = acc.StyleAt(i);
 
@@ -615,8 +809,12 @@ void SciTEBase::SaveToHTML(FilePath saveName) {
 				case '&':
 					fputs("&amp;", fp);
 					break;
-				default:
-					fputc(ch, fp);
+				default: {
+						const int runEnd = acc.RunEnd(i, lengthDoc, " \t\r\n<>&");
+						fwrite(acc.RangePointer(i), 1, runEnd - i, fp);
+						column += runEnd - i - 1;
+						i = runEnd - 1;
+					}
 				}
 				column++;
 			}
@@ -642,9 +840,7 @@ void SciTEBase::SaveToHTML(FilePath saveName) {
 		fputs("\n</body>\n</html>\n", fp);
 		fclose(fp);
 	} else {
-		GUI::gui_string msg = LocaliseMessage(
-		            "Could not save file \"^0\".", filePath.AsInternal());
-		WindowMessageBox(wSciTE, msg);
+		err = 1;
 	}
 }
 
@@ -705,7 +901,12 @@ inline void getPDFRGB(char* pdfcolour, const char* stylecolour) {
 	}
 }
 
-void SciTEBase::SaveToPDF(FilePath saveName) {
+void SciTEBase::SaveToPDF(FilePath saveName, bool synchronous) {
+	Export(new Exporter(this, Exporter::fmtPDF, saveName, props, language, codePage, filePath,
+		CurrentBuffer()->useMonoFont), synchronous);
+}
+
+void Exporter::SaveToPDF() {
 	// This class conveniently handles the tracking of PDF objects
 	// so that the cross-reference table can be built (PDF1.4Ref(p39))
 	// All writes to fp passes through a PDFObjectTracker object.
@@ -1024,8 +1225,6 @@ void SciTEBase::SaveToPDF(FilePath saveName) {
 	};
 	PDFRender pr;
 
-	RemoveFindMarks();
-	wEditor.Call(SCI_COLOURISE, 0, -1);
 	// read exporter flags
 	int tabSize = props.GetInt("tabsize", PDF_TAB_DEFAULT);
 	if (tabSize < 0) {
@@ -1048,11 +1247,11 @@ void SciTEBase::SaveToPDF(FilePath saveName) {
 	propItem = props.GetExpanded("export.pdf.pagesize");
 	char *buffer = new char[200];
 	char *ps = StringDup(propItem.c_str());
-	const char *next = GetNextPropItem(ps, buffer, 32);
+	const char *next = SciTEBase::GetNextPropItem(ps, buffer, 32);
 	if (0 >= (pr.pageWidth = atol(buffer))) {
 		pr.pageWidth = PDF_WIDTH_DEFAULT;
 	}
-	GetNextPropItem(next, buffer, 32);
+	SciTEBase::GetNextPropItem(next, buffer, 32);
 	if (0 >= (pr.pageHeight = atol(buffer))) {
 		pr.pageHeight = PDF_HEIGHT_DEFAULT;
 	}
@@ -1060,19 +1259,19 @@ void SciTEBase::SaveToPDF(FilePath saveName) {
 	// page margins: left, right, top, bottom
 	propItem = props.GetExpanded("export.pdf.margins");
 	ps = StringDup(propItem.c_str());
-	next = GetNextPropItem(ps, buffer, 32);
+	next = SciTEBase::GetNextPropItem(ps, buffer, 32);
 	if (0 >= (pr.pageMargin.left = static_cast<int>(atol(buffer)))) {
 		pr.pageMargin.left = PDF_MARGIN_DEFAULT;
 	}
-	next = GetNextPropItem(next, buffer, 32);
+	next = SciTEBase::GetNextPropItem(next, buffer, 32);
 	if (0 >= (pr.pageMargin.right = static_cast<int>(atol(buffer)))) {
 		pr.pageMargin.right = PDF_MARGIN_DEFAULT;
 	}
-	next = GetNextPropItem(next, buffer, 32);
+	next = SciTEBase::GetNextPropItem(next, buffer, 32);
 	if (0 >= (pr.pageMargin.top = static_cast<int>(atol(buffer)))) {
 		pr.pageMargin.top = PDF_MARGIN_DEFAULT;
 	}
-	GetNextPropItem(next, buffer, 32);
+	SciTEBase::GetNextPropItem(next, buffer, 32);
 	if (0 >= (pr.pageMargin.bottom = static_cast<int>(atol(buffer)))) {
 		pr.pageMargin.bottom = PDF_MARGIN_DEFAULT;
 	}
@@ -1120,27 +1319,26 @@ void SciTEBase::SaveToPDF(FilePath saveName) {
 	}
 	delete []buffer;
 
-	FILE *fp = saveName.Open(GUI_TEXT("wb"));
+	FILE *fp = path.Open(GUI_TEXT("wb"));
 	if (!fp) {
-		// couldn't open the file for saving, issue an error message
-		GUI::gui_string msg = LocaliseMessage("Could not save file '^0'.", filePath.AsInternal());
-		WindowMessageBox(wSciTE, msg);
+		// couldn't open the file for saving, the error is shown on the main thread
+		err = 1;
 		return;
 	}
+	SetExportBuffer(fp);
 	// initialise PDF rendering
 	PDFObjectTracker ot(fp);
 	pr.oT = &ot;
 	pr.startPDF();
 
 	// do here all the writing
-	int lengthDoc = LengthDocument();
-	TextReader acc(wEditor);
+	int lengthDoc = acc.Length();
 
 	if (!lengthDoc) {	// enable zero length docs
 		pr.nextLine();
 	} else {
 		int lineIndex = 0;
-		for (int i = 0; i < lengthDoc; i++) {
+		for (int i = 0; i < lengthDoc && Continuing(i); i++) {
 			char ch = acc[i];
 			int style = acc.StyleAt(i);
 
@@ -1225,15 +1423,17 @@ static void defineTexStyle(StyleDefinition &style, FILE* fp, int istyle) {
 	fputc('\n', fp);
 }
 
-void SciTEBase::SaveToTEX(FilePath saveName) {
-	RemoveFindMarks();
-	wEditor.Call(SCI_COLOURISE, 0, -1);
+void SciTEBase::SaveToTEX(FilePath saveName, bool synchronous) {
+	Export(new Exporter(this, Exporter::fmtTEX, saveName, props, language, codePage, filePath,
+		CurrentBuffer()->useMonoFont), synchronous);
+}
+
+void Exporter::SaveToTEX() {
 	int tabSize = props.GetInt("tabsize");
 	if (tabSize == 0)
 		tabSize = 4;
 
-	int lengthDoc = LengthDocument();
-	TextReader acc(wEditor);
+	int lengthDoc = acc.Length();
 	bool styleIsUsed[STYLE_MAX + 1];
 
 	int titleFullPath = props.GetInt("export.tex.title.fullpath", 0);
@@ -1247,8 +1447,9 @@ void SciTEBase::SaveToTEX(FilePath saveName) {
 	}
 	styleIsUsed[STYLE_DEFAULT] = true;
 
-	FILE *fp = saveName.Open(GUI_TEXT("wt"));
+	FILE *fp = path.Open(GUI_TEXT("wt"));
 	if (fp) {
+		SetExportBuffer(fp);
 		fputs("\\documentclass[a4paper]{article}\n"
 		      "\\usepackage[a4paper,margin=2cm]{geometry}\n"
 		      "\\usepackage[T1]{fontenc}\n"
@@ -1284,7 +1485,7 @@ void SciTEBase::SaveToTEX(FilePath saveName) {
 
 		int lineIdx = 0;
 
-		for (i = 0; i < lengthDoc; i++) { //here process each character of the document
+		for (i = 0; i < lengthDoc && Continuing(i); i++) { //here process each character of the document
 			char ch = acc[i];
 			int style = acc.StyleAt(i);
 
@@ -1334,24 +1535,31 @@ void SciTEBase::SaveToTEX(FilePath saveName) {
 					fputc(' ', fp);
 				}
 				break;
-			default:
-				fputc(ch, fp);
+			default: {
+					const int runEnd = acc.RunEnd(i, lengthDoc, "\t\\><@{}^_&$#%~\r\n ");
+					fwrite(acc.RangePointer(i), 1, runEnd - i, fp);
+					lineIdx += runEnd - i - 1;
+					i = runEnd - 1;
+				}
 			}
 			lineIdx++;
 		}
 		fputs("}\n} %end small\n\n\\end{document}\n", fp); //close last empty style macros and document too
 		fclose(fp);
 	} else {
-		GUI::gui_string msg = LocaliseMessage(
-		            "Could not save file \"^0\".", filePath.AsInternal());
-		WindowMessageBox(wSciTE, msg);
+		err = 1;
 	}
 }
 
 
 //---------- Save to XML ----------
 
-void SciTEBase::SaveToXML(FilePath saveName) {
+void SciTEBase::SaveToXML(FilePath saveName, bool synchronous) {
+	Export(new Exporter(this, Exporter::fmtXML, saveName, props, language, codePage, filePath,
+		CurrentBuffer()->useMonoFont), synchronous);
+}
+
+void Exporter::SaveToXML() {
 
 	// Author: Hans Hagen / PRAGMA ADE / www.pragma-ade.com
 	// Version: 1.0 / august 18, 2003
@@ -1381,21 +1589,17 @@ void SciTEBase::SaveToXML(FilePath saveName) {
 	// We don't use entities, but empty elements for special characters
 	// but will eventually use utf-8 (once i know how to get them out).
 
-	RemoveFindMarks();
-	wEditor.Call(SCI_COLOURISE, 0, -1);
-
 	int tabSize = props.GetInt("tabsize");
 	if (tabSize == 0) {
 		tabSize = 4;
 	}
 
-	int lengthDoc = LengthDocument();
+	int lengthDoc = acc.Length();
 
-	TextReader acc(wEditor);
-
-	FILE *fp = saveName.Open(GUI_TEXT("wt"));
+	FILE *fp = path.Open(GUI_TEXT("wt"));
 
 	if (fp) {
+		SetExportBuffer(fp);
 
 		bool collapseSpaces = (props.GetInt("export.xml.collapse.spaces", 1) == 1);
 		bool collapseLines  = (props.GetInt("export.xml.collapse.lines", 1) == 1);
@@ -1423,7 +1627,7 @@ void SciTEBase::SaveToXML(FilePath saveName) {
 		int spaceLen = 0;
 		int emptyLines = 0;
 
-		for (int i = 0; i < lengthDoc; i++) {
+		for (int i = 0; i < lengthDoc && Continuing(i); i++) {
 			char ch = acc[i];
 			int style = acc.StyleAt(i);
 			if (style != styleCurrent) {
@@ -1500,8 +1704,12 @@ void SciTEBase::SaveToXML(FilePath saveName) {
 				case '#' :
 					fputs("<h/>", fp);
 					break;
-				default  :
-					fputc(ch, fp);
+				default  : {
+						const int runEnd = acc.RunEnd(i, lengthDoc, " \t\f\r\n><&#");
+						fwrite(acc.RangePointer(i), 1, runEnd - i, fp);
+						lineIndex += runEnd - i - 1;
+						i = runEnd - 1;
+					}
 				}
 				charDone = true;
 			}
@@ -1522,7 +1730,6 @@ void SciTEBase::SaveToXML(FilePath saveName) {
 
 		fclose(fp);
 	} else {
-		GUI::gui_string msg = LocaliseMessage("Could not save file \"^0\".", filePath.AsInternal());
-		WindowMessageBox(wSciTE, msg);
+		err = 1;
 	}
 }
@@ -219,7 +219,7 @@ FilePath FilePath::Directory() const {
 	}
 }
 
-#ifdef _WIN32
+#ifdef WIN32
 
 // Substitute functions that take wchar_t arguments but have the same name
 // as char functions so that the compiler will choose the right form.
@@ -431,7 +431,7 @@ time_t FilePath::ModifiedTime() const {
 		return 0;
 	if (access(AsInternal(), R_OK) == -1)
 		return 0;
-#ifdef _WIN32
+#ifdef WIN32
 #if defined(_MSC_VER) && (_MSC_VER > 1310)
 	struct _stat64i32 statusFile;
 #else
@@ -446,13 +446,19 @@ time_t FilePath::ModifiedTime() const {
 		return 0;
 }
 
-long FilePath::GetFileLength() const {
-	long size = -1;
+long long FilePath::GetFileLength() const {
+	long long size = -1;
 	if (IsSet()) {
 		FILE *fp = Open(fileRead);
 		if (fp) {
-			fseek(fp, 0, SEEK_END);
-			size = ftell(fp);
+			// ftell returns a 32-bit long on Windows so use the 64-bit variants
+#ifdef WIN32
+			_fseeki64(fp, 0, SEEK_END);
+			size = _ftelli64(fp);
+#else
+			fseeko(fp, 0, SEEK_END);
+			size = ftello(fp);
+#endif
 			fseek(fp, 0, SEEK_SET);
 			fclose(fp);
 		}
@@ -460,6 +466,29 @@ long FilePath::GetFileLength() const {
 	return size;
 }
 
+// Size and modification time with a single call which is quicker on network drives.
+// Returns false when the file can not be found.
+bool FilePath::Status(long long &size, time_t &modified) const {
+	size = -1;
+	modified = 0;
+	if (!IsSet())
+		return false;
+#ifdef WIN32
+#if defined(_MSC_VER) && (_MSC_VER > 1310)
+	struct _stat64i32 statusFile;
+#else
+	struct _stat statusFile;
+#endif
+#else
+	struct stat statusFile;
+#endif
+	if (stat(AsInternal(), &statusFile) == -1)
+		return false;
+	size = statusFile.st_size;
+	modified = statusFile.st_mtime;
+	return true;
+}
+
 bool FilePath::Exists() const {
 	bool ret = false;
 	if (IsSet()) {
@@ -473,7 +502,7 @@ bool FilePath::Exists() const {
 }
 
 bool FilePath::IsDirectory() const {
-#ifdef _WIN32
+#ifdef WIN32
 #if defined(_MSC_VER) && (_MSC_VER > 1310)
 	struct _stat64i32 statusFile;
 #else
@@ -492,7 +521,7 @@ bool FilePath::IsDirectory() const {
 		return false;
 }
 
-#ifdef _WIN32
+#ifdef WIN32
 static void Lowercase(GUI::gui_string &s) {
 	int chars = ::LCMapString(LOCALE_SYSTEM_DEFAULT, LCMAP_LOWERCASE, s.c_str(), static_cast<int>(s.size())+1, NULL, 0);
 	std::vector<wchar_t> vc(chars);
@@ -509,7 +538,7 @@ static bool EndMatches(GUI::gui_string const &s, GUI::gui_string const &end) {
 bool FilePath::Matches(const GUI::gui_char *pattern) const {
 	GUI::gui_string pat(pattern);
 	GUI::gui_string nameCopy(Name().fileName);
-#ifdef _WIN32
+#ifdef WIN32
 	Lowercase(pat);
 	Lowercase(nameCopy);
 #endif
@@ -593,7 +622,7 @@ void FilePath::FixName() {
 
 std::string CommandExecute(const GUI::gui_char *command, const GUI::gui_char *directoryForRun) {
 	std::string output;
-#ifdef _WIN32
+#ifdef WIN32
 	SECURITY_ATTRIBUTES sa = {sizeof(SECURITY_ATTRIBUTES), 0, 0};
 	sa.bInheritHandle = TRUE;
 	sa.lpSecurityDescriptor = NULL;
@@ -60,7 +60,8 @@ public:
 	FILE *Open(const GUI::gui_char *mode) const;
 	void Remove() const;
 	time_t ModifiedTime() const;
-	long GetFileLength() const;
+	long long GetFileLength() const;
+	bool Status(long long &size, time_t &modified) const;
 	bool Exists() const;
 	bool IsDirectory() const;
 	bool Matches(const GUI::gui_char *pattern) const;
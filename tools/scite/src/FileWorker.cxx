@@ -7,20 +7,27 @@
 
 #include <stdlib.h>
 #include <string.h>
+#include <limits.h>
 
 #include <string>
 #include <vector>
+#include <algorithm>
 
 #if defined(__unix__)
 
 #include <unistd.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #else
 
-// Only include <windows.h> for Sleep.
+// Only include <windows.h> for Sleep and file mapping.
 
 #undef _WIN32_WINNT
 #define _WIN32_WINNT  0x0500
+#define NOMINMAX
 #include <windows.h>
 
 #endif
@@ -39,9 +46,7 @@
 #include "FileWorker.h"
 #include "Utf8_16.h"
 
-const double timeBetweenProgress = 0.4;
-
-FileWorker::FileWorker(WorkerListener *pListener_, FilePath path_, long size_, FILE *fp_) :
+FileWorker::FileWorker(WorkerListener *pListener_, FilePath path_, long long size_, FILE *fp_) :
 	pListener(pListener_), path(path_), size(size_), err(0), fp(fp_), sleepTime(0), nextProgress(timeBetweenProgress) {
 }
 
@@ -52,9 +57,9 @@ double FileWorker::Duration() {
 	return et.Duration();
 }
 
-FileLoader::FileLoader(WorkerListener *pListener_, ILoader *pLoader_, FilePath path_, long size_, FILE *fp_) :
+FileLoader::FileLoader(WorkerListener *pListener_, ILoader *pLoader_, FilePath path_, long long size_, FILE *fp_) :
 	FileWorker(pListener_, path_, size_, fp_), pLoader(pLoader_), readSoFar(0), unicodeMode(uni8Bit) {
-	SetSizeJob(static_cast<int>(size));
+	SetSizeJob(size);
 }
 
 FileLoader::~FileLoader() {
@@ -75,7 +80,7 @@ void FileLoader::Execute() {
 			lenFile = convert.convert(&data[0], lenFile);
 			char *dataBlock = convert.getNewBuf();
 			err = pLoader->AddData(dataBlock, static_cast<int>(lenFile));
-			IncrementProgress(static_cast<int>(lenFile));
+			IncrementProgress(lenFile);
 			if (et.Duration() > nextProgress) {
 				nextProgress = et.Duration() + timeBetweenProgress;
 				pListener->PostOnMainThread(WORK_FILEPROGRESS, this);
@@ -102,10 +107,10 @@ void FileLoader::Cancel() {
 }
 
 FileStorer::FileStorer(WorkerListener *pListener_, const char *documentBytes_, FilePath path_,
-	long size_, FILE *fp_, UniMode unicodeMode_, bool visibleProgress_) :
+	long long size_, FILE *fp_, UniMode unicodeMode_, bool visibleProgress_) :
 	FileWorker(pListener_, path_, size_, fp_), documentBytes(documentBytes_), writtenSoFar(0),
 		unicodeMode(unicodeMode_), visibleProgress(visibleProgress_) {
-	SetSizeJob(static_cast<int>(size));
+	SetSizeJob(size);
 }
 
 FileStorer::~FileStorer() {
@@ -124,17 +129,15 @@ void FileStorer::Execute() {
 		}
 		convert.setfile(fp);
 		std::vector<char> data(blockSize + 1);
-		int lengthDoc = static_cast<int>(size);
+		const long long lengthDoc = size;
 		int grabSize;
-		for (int i = 0; i < lengthDoc && (!Cancelling()); i += grabSize) {
+		for (long long i = 0; i < lengthDoc && (!Cancelling()); i += grabSize) {
 #ifdef __unix__
 			usleep(sleepTime * 1000);
 #else
 			::Sleep(sleepTime);
 #endif
-			grabSize = lengthDoc - i;
-			if (grabSize > blockSize)
-				grabSize = blockSize;
+			grabSize = (lengthDoc - i > blockSize) ? blockSize : static_cast<int>(lengthDoc - i);
 			if ((unicodeMode != uni8Bit) && (i + grabSize < lengthDoc)) {
 				// Round down so only whole characters retrieved.
 				int startLast = grabSize;
@@ -164,3 +167,190 @@ void FileStorer::Execute() {
 void FileStorer::Cancel() {
 	FileWorker::Cancel();
 }
+
+#if defined(__unix__)
+
+// Reading a shared mapping beyond the end of a file that has been truncated since it was
+// mapped raises SIGBUS. The views are registered so that the handler can replace the
+// pages after the fault with zeroed memory and let reading continue. Any other SIGBUS
+// restores the previous handling and happens again.
+// This relies on Linux and the BSDs where mmap is a plain system call that is safe in a
+// handler for a synchronous fault even though POSIX does not list it as async-signal-safe.
+// The handler is only installed while there are views and the previous one is restored
+// after the last view is unmapped.
+// Views are registered and unregistered on the main thread. Each entry is written before
+// the bounds of all views are widened and the bounds narrowed before an entry is removed
+// so a fault outside the bounds is never looked up in the table.
+enum { viewsMax = 64 };
+static char * volatile viewStarts[viewsMax];
+static volatile size_t viewLengths[viewsMax];
+static char * volatile viewsLow = 0;
+static char * volatile viewsHigh = 0;
+static int viewsRegistered = 0;
+static size_t pageSize = 0;
+static struct sigaction previousBusAction;
+
+static void MappedBusError(int, siginfo_t *info, void *) {
+	char *address = static_cast<char *>(info->si_addr);
+	if ((info->si_code == BUS_ADRERR) && (address >= viewsLow) && (address < viewsHigh)) {
+		for (int i = 0; i < viewsMax; i++) {
+			char *start = viewStarts[i];
+			const size_t length = viewLengths[i];
+			if (start && (address >= start) && (address < start + length)) {
+				char *page = start + (address - start) / pageSize * pageSize;
+				if (mmap(page, start + length - page, PROT_READ,
+					MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED, -1, 0) != MAP_FAILED)
+					return;
+			}
+		}
+	}
+	sigaction(SIGBUS, &previousBusAction, 0);
+}
+
+// Sets the bounds to cover the registered views.
+static void BoundViews() {
+	char *low = 0;
+	char *high = 0;
+	for (int i = 0; i < viewsMax; i++) {
+		if (viewStarts[i]) {
+			if (!low || (viewStarts[i] < low))
+				low = viewStarts[i];
+			if (viewStarts[i] + viewLengths[i] > high)
+				high = viewStarts[i] + viewLengths[i];
+		}
+	}
+	// Empty while changing so the handler never sees a low bound from one set of
+	// views and a high bound from another
+	viewsHigh = 0;
+	viewsLow = low;
+	viewsHigh = high;
+}
+
+// Returns false when too many views are mapped to guard another.
+static bool RegisterView(void *view, size_t lengthView) {
+	for (int i = 0; i < viewsMax; i++) {
+		if (!viewStarts[i]) {
+			if (viewsRegistered == 0) {
+				pageSize = sysconf(_SC_PAGESIZE);
+				struct sigaction action;
+				memset(&action, 0, sizeof(action));
+				action.sa_sigaction = MappedBusError;
+				action.sa_flags = SA_SIGINFO;
+				sigemptyset(&action.sa_mask);
+				sigaction(SIGBUS, &action, &previousBusAction);
+			}
+			viewsRegistered++;
+			viewLengths[i] = lengthView;
+			viewStarts[i] = static_cast<char *>(view);
+			BoundViews();
+			return true;
+		}
+	}
+	return false;
+}
+
+static void UnregisterView(void *view) {
+	for (int i = 0; i < viewsMax; i++) {
+		if (viewStarts[i] == view) {
+			viewsHigh = 0;
+			viewStarts[i] = 0;
+			BoundViews();
+			viewsRegistered--;
+			if (viewsRegistered == 0)
+				sigaction(SIGBUS, &previousBusAction, 0);
+			return;
+		}
+	}
+}
+
+#endif
+
+MappedFile::MappedFile(void *view_, size_t lengthView_) :
+	unicodeMode(uni8Bit), view(view_), lengthView(lengthView_), offset(0), file(0) {
+}
+
+MappedFile::~MappedFile() {
+#if defined(__unix__)
+	UnregisterView(view);
+	munmap(view, lengthView);
+#else
+	::UnmapViewOfFile(view);
+	::CloseHandle(file);
+#endif
+}
+
+MappedFile *MappedFile::Map(const FilePath &path) {
+	void *view = 0;
+	size_t lengthView = 0;
+#if defined(__unix__)
+	const int fd = open(path.AsInternal(), O_RDONLY);
+	if (fd < 0)
+		return 0;
+	struct stat st;
+	if ((fstat(fd, &st) == 0) && (st.st_size > 0) && (st.st_size <= INT_MAX)) {
+		lengthView = static_cast<size_t>(st.st_size);
+		view = mmap(0, lengthView, PROT_READ, MAP_SHARED, fd, 0);
+		if (view == MAP_FAILED) {
+			view = 0;
+		} else if (!RegisterView(view, lengthView)) {
+			// Unguarded views could fault so read the file normally
+			munmap(view, lengthView);
+			view = 0;
+		}
+	}
+	// The mapping remains after the file is closed
+	close(fd);
+#else
+	// Not shared for writing, and kept open while mapped, so that other processes can not
+	// change the text underneath the document
+	HANDLE hFile = ::CreateFileW(path.AsInternal(), GENERIC_READ, FILE_SHARE_READ,
+		NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (hFile == INVALID_HANDLE_VALUE)
+		return 0;
+	LARGE_INTEGER size;
+	if (::GetFileSizeEx(hFile, &size) && (size.QuadPart > 0) && (size.QuadPart <= INT_MAX)) {
+		HANDLE hMapping = ::CreateFileMappingW(hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (hMapping) {
+			lengthView = static_cast<size_t>(size.QuadPart);
+			view = ::MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+			// The view keeps the mapping open
+			::CloseHandle(hMapping);
+		}
+	}
+	if (!view) {
+		::CloseHandle(hFile);
+		return 0;
+	}
+#endif
+	if (!view)
+		return 0;
+	MappedFile *mappedFile = new MappedFile(view, lengthView);
+#if !defined(__unix__)
+	mappedFile->file = hFile;
+#endif
+	const unsigned char *bytes = static_cast<const unsigned char *>(view);
+	if ((lengthView >= 2) && (((bytes[0] == 0xFE) && (bytes[1] == 0xFF)) || ((bytes[0] == 0xFF) && (bytes[1] == 0xFE)))) {
+		mappedFile->Release();
+		return 0;
+	}
+	if ((lengthView >= 3) && (bytes[0] == 0xEF) && (bytes[1] == 0xBB) && (bytes[2] == 0xBF)) {
+		mappedFile->offset = 3;
+		mappedFile->unicodeMode = uniUTF8;
+	} else {
+		mappedFile->unicodeMode = CodingCookieValue(static_cast<const char *>(view),
+			std::min(lengthView, static_cast<size_t>(blockSize)));
+	}
+	return mappedFile;
+}
+
+void SCI_METHOD MappedFile::Release() {
+	delete this;
+}
+
+const char * SCI_METHOD MappedFile::Text() {
+	return static_cast<const char *>(view) + offset;
+}
+
+int SCI_METHOD MappedFile::Length() {
+	return static_cast<int>(lengthView - offset);
+}
@@ -8,17 +8,20 @@
 /// Base size of file I/O operations.
 const int blockSize = 131072;
 
+/// Seconds between progress updates from a worker.
+const double timeBetweenProgress = 0.4;
+
 struct FileWorker : public Worker {
 	WorkerListener *pListener;
 	FilePath path;
-	long size;
+	long long size;
 	int err;
 	FILE *fp;
 	GUI::ElapsedTime et;
 	int sleepTime;
 	double nextProgress;
 
-	FileWorker(WorkerListener *pListener_, FilePath path_, long size_, FILE *fp_);
+	FileWorker(WorkerListener *pListener_, FilePath path_, long long size_, FILE *fp_);
 	virtual ~FileWorker();
 	virtual double Duration();
 	virtual void Cancel() {
@@ -29,15 +32,16 @@ struct FileWorker : public Worker {
 
 #ifdef SCI_NAMESPACE
 using Scintilla::ILoader;
+using Scintilla::IMappedText;
 #endif
 
 class FileLoader : public FileWorker {
 public:
 	ILoader *pLoader;
-	long readSoFar;
+	long long readSoFar;
 	UniMode unicodeMode;
 
-	FileLoader(WorkerListener *pListener_, ILoader *pLoader_, FilePath path_, long size_, FILE *fp_);
+	FileLoader(WorkerListener *pListener_, ILoader *pLoader_, FilePath path_, long long size_, FILE *fp_);
 	virtual ~FileLoader();
 	virtual void Execute();
 	virtual void Cancel();
@@ -49,12 +53,12 @@ public:
 class FileStorer : public FileWorker {
 public:
 	const char *documentBytes;
-	long writtenSoFar;
+	long long writtenSoFar;
 	UniMode unicodeMode;
 	bool visibleProgress;
 
 	FileStorer(WorkerListener *pListener_, const char *documentBytes_, FilePath path_,
-		long size_, FILE *fp_, UniMode unicodeMode_, bool visibleProgress_);
+		long long size_, FILE *fp_, UniMode unicodeMode_, bool visibleProgress_);
 	virtual ~FileStorer();
 	virtual void Execute();
 	virtual void Cancel();
@@ -63,9 +67,34 @@ public:
 	}
 };
 
+/// A file mapped into memory so that a read only document can show it without a copy.
+class MappedFile : public IMappedText {
+public:
+	UniMode unicodeMode;
+
+	/// Returns NULL if the file can not be mapped or is UTF-16 which has to be converted.
+	static MappedFile *Map(const FilePath &path);
+	virtual void SCI_METHOD Release();
+	virtual const char * SCI_METHOD Text();
+	virtual int SCI_METHOD Length();
+private:
+	void *view;
+	size_t lengthView;
+	size_t offset;	///< Skips a UTF-8 byte order mark
+	void *file;	///< File handle held open on Windows to stop writing
+
+	MappedFile(void *view_, size_t lengthView_);
+	virtual ~MappedFile();
+	// Private so MappedFile objects can not be copied
+	MappedFile(const MappedFile &);
+	MappedFile &operator=(const MappedFile &);
+};
+
 enum {
 	WORK_FILEREAD = 1,
 	WORK_FILEWRITTEN = 2,
 	WORK_FILEPROGRESS = 3,
+	WORK_APILOADED = 4,
+	WORK_EXPORTED = 5,
 	WORK_PLATFORM = 100
 };
@@ -162,6 +162,7 @@ public:
 		case SCI_GETDIRECTPOINTER:
 		case SCI_GETDOCPOINTER:
 		case SCI_GETCHARACTERPOINTER:
+		case SCI_GETRANGEPOINTER:
 			throw ScintillaFailure(SC_STATUS_FAILURE);
 		}
 		if (!fn)
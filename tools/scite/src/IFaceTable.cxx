@@ -46,21 +46,30 @@ int IFaceTable::FindFunction(const char *name) {
 	return -1;
 }
 
+static int CompareConstantName(const char *name, const char *functionName) {
+	// Function names are mixed case, whereas the constants are all-caps.
+	while (*name && (*name == toupper(*functionName))) {
+		++name;
+		++functionName;
+	}
+	return static_cast<unsigned char>(*name) - toupper(static_cast<unsigned char>(*functionName));
+}
+
 int IFaceTable::FindFunctionByConstantName(const char *name) {
 	if (strncmp(name, "SCI_", 4)==0) {
-		// This looks like a constant for an iface function.  This requires
-		// a sequential search.  Take special care since the function names
-		// are mixed case, whereas the constants are all-caps.
-
-		for (int idx = 0; idx < functionCount; ++idx) {
-			const char *nm = name+4;
-			const char *fn = IFaceTable::functions[idx].name;
-			while (*nm && *fn && (*nm == toupper(*fn))) {
-				++nm;
-				++fn;
-			}
-			if (!*nm && !*fn) {
-				return idx;
+		// This looks like a constant for an iface function.  Search the
+		// index of functions sorted by their upper-cased names.
+		int lo = 0;
+		int hi = functionCount - 1;
+		while (lo <= hi) {
+			int idx = (lo+hi)/2;
+			int cmp = CompareConstantName(name+4, functions[functionsByConstantName[idx]].name);
+			if (cmp > 0) {
+				lo = idx + 1;
+			} else if (cmp < 0) {
+				hi = idx - 1;
+			} else {
+				return functionsByConstantName[idx];
 			}
 		}
 	}
@@ -86,40 +95,76 @@ int IFaceTable::FindProperty(const char *name) {
 	return -1;
 }
 
+int IFaceTable::FindMessage(int value) {
+	int lo = 0;
+	int hi = messageCount - 1;
+	while (lo <= hi) {
+		int idx = (lo+hi)/2;
+		if (value > messages[idx].value) {
+			lo = idx + 1;
+		} else if (value < messages[idx].value) {
+			hi = idx - 1;
+		} else {
+			return idx;
+		}
+	}
+	return -1;
+}
+
+int IFaceTable::FindFunctionByValue(int value) {
+	int idx = FindMessage(value);
+	return (idx >= 0) ? messages[idx].function : -1;
+}
+
+int IFaceTable::FindPropertyByValue(int value) {
+	int idx = FindMessage(value);
+	return (idx >= 0) ? messages[idx].property : -1;
+}
+
 int IFaceTable::GetConstantName(int value, char *nameOut, unsigned nameBufferLen) {
 	if (nameOut && nameBufferLen > 0) {
 		*nameOut = '\0';
 	}
 
 	// Look in both the constants table and the functions table.  Start with functions.
-	for (int funcIdx = 0; funcIdx < functionCount; ++funcIdx) {
-		if (functions[funcIdx].value == value) {
-			int len = static_cast<int>(strlen(functions[funcIdx].name)) + 4;
-			if (nameOut && (static_cast<int>(nameBufferLen) > len)) {
-				strcpy(nameOut, "SCI_");
-				strcat(nameOut, functions[funcIdx].name);
-				// fix case
-				for (char *nm = nameOut + 4; *nm; ++nm) {
-					if (*nm >= 'a' && *nm <= 'z') {
-						*nm = static_cast<char>(*nm - 'a' + 'A');
-					}
+	int funcIdx = FindFunctionByValue(value);
+	if (funcIdx >= 0) {
+		int len = static_cast<int>(strlen(functions[funcIdx].name)) + 4;
+		if (nameOut && (static_cast<int>(nameBufferLen) > len)) {
+			strcpy(nameOut, "SCI_");
+			strcat(nameOut, functions[funcIdx].name);
+			// fix case
+			for (char *nm = nameOut + 4; *nm; ++nm) {
+				if (*nm >= 'a' && *nm <= 'z') {
+					*nm = static_cast<char>(*nm - 'a' + 'A');
 				}
-				return len;
-			} else {
-				return -1 - len;
 			}
+			return len;
+		} else {
+			return -1 - len;
 		}
 	}
 
-	for (int constIdx = 0; constIdx < constantCount; ++constIdx) {
-		if (constants[constIdx].value == value) {
-			int len = static_cast<int>(strlen(constants[constIdx].name));
-			if (nameOut && (static_cast<int>(nameBufferLen) > len)) {
-				strcpy(nameOut, constants[constIdx].name);
-				return len;
-			} else {
-				return -1 - len;
-			}
+	// Find the first constant with this value; constantsByValue keeps
+	// constants with equal values in name order.
+	int lo = 0;
+	int hi = constantCount;
+	while (lo < hi) {
+		int idx = (lo+hi)/2;
+		if (constants[constantsByValue[idx]].value < value) {
+			lo = idx + 1;
+		} else {
+			hi = idx;
+		}
+	}
+	if ((lo < constantCount) && (constants[constantsByValue[lo]].value == value)) {
+		int constIdx = constantsByValue[lo];
+		int len = static_cast<int>(strlen(constants[constIdx].name));
+		if (nameOut && (static_cast<int>(nameBufferLen) > len)) {
+			strcpy(nameOut, constants[constIdx].name);
+			return len;
+		} else {
+			return -1 - len;
 		}
 	}
 
@@ -1943,6 +1988,7 @@ static IFaceConstant ifaceConstants[] = {
 	{"SCE_YAML_REFERENCE",5},
 	{"SCE_YAML_TEXT",7},
 	{"SCFIND_CXX11REGEX",0x00800000},
+	{"SCFIND_DFAREGEX",0x01000000},
 	{"SCFIND_MATCHCASE",0x4},
 	{"SCFIND_POSIX",0x00400000},
 	{"SCFIND_REGEXP",0x00200000},
@@ -2042,13 +2088,17 @@ static IFaceConstant ifaceConstants[] = {
 	{"SCI_GETHOTSPOTSINGLELINE",2497},
 	{"SCI_GETHSCROLLBAR",2131},
 	{"SCI_GETIDENTIFIER",2623},
+	{"SCI_GETIDLESTYLING",2693},
+	{"SCI_GETIDLESTYLINGBUDGET",2695},
 	{"SCI_GETIMEINTERACTION",2678},
 	{"SCI_GETINDENT",2123},
 	{"SCI_GETINDENTATIONGUIDES",2133},
+	{"SCI_GETINDEXINGLINES",2697},
 	{"SCI_GETINDICATORCURRENT",2501},
 	{"SCI_GETINDICATORVALUE",2503},
 	{"SCI_GETKEYSUNICODE",2522},
 	{"SCI_GETLAYOUTCACHE",2273},
+	{"SCI_GETLAYOUTCACHEPAGES",2704},
 	{"SCI_GETLENGTH",2006},
 	{"SCI_GETLEXER",4002},
 	{"SCI_GETLEXERLANGUAGE",4012},
@@ -2082,6 +2132,7 @@ static IFaceConstant ifaceConstants[] = {
 	{"SCI_GETPASTECONVERTENDINGS",2468},
 	{"SCI_GETPHASESDRAW",2673},
 	{"SCI_GETPOSITIONCACHE",2515},
+	{"SCI_GETPOSITIONCACHESTATISTIC",2702},
 	{"SCI_GETPRIMARYSTYLEFROMSTYLE",4028},
 	{"SCI_GETPRINTCOLOURMODE",2149},
 	{"SCI_GETPRINTMAGNIFICATION",2147},
@@ -2100,6 +2151,7 @@ static IFaceConstant ifaceConstants[] = {
 	{"SCI_GETSCROLLWIDTH",2275},
 	{"SCI_GETSCROLLWIDTHTRACKING",2517},
 	{"SCI_GETSEARCHFLAGS",2199},
+	{"SCI_GETSEGMENTCACHEBUDGET",2701},
 	{"SCI_GETSELALPHA",2477},
 	{"SCI_GETSELECTIONEMPTY",2650},
 	{"SCI_GETSELECTIONEND",2145},
@@ -2130,6 +2182,7 @@ static IFaceConstant ifaceConstants[] = {
 	{"SCI_GETTEXTLENGTH",2183},
 	{"SCI_GETTWOPHASEDRAW",2283},
 	{"SCI_GETUNDOCOLLECTION",2019},
+	{"SCI_GETUNDOMEMORYLIMIT",2699},
 	{"SCI_GETUSETABS",2125},
 	{"SCI_GETVIEWEOL",2355},
 	{"SCI_GETVIEWWS",2020},
@@ -2141,6 +2194,7 @@ static IFaceConstant ifaceConstants[] = {
 	{"SCI_GETWRAPINDENTMODE",2473},
 	{"SCI_GETWRAPMODE",2269},
 	{"SCI_GETWRAPSTARTINDENT",2465},
+	{"SCI_GETWRAPTHREADS",2681},
 	{"SCI_GETWRAPVISUALFLAGS",2461},
 	{"SCI_GETWRAPVISUALFLAGSLOCATION",2463},
 	{"SCI_GETXOFFSET",2398},
@@ -2218,6 +2272,8 @@ static IFaceConstant ifaceConstants[] = {
 	{"SCI_SETHSCROLLBAR",2130},
 	{"SCI_SETIDENTIFIER",2622},
 	{"SCI_SETIDENTIFIERS",4024},
+	{"SCI_SETIDLESTYLING",2692},
+	{"SCI_SETIDLESTYLINGBUDGET",2694},
 	{"SCI_SETIMEINTERACTION",2679},
 	{"SCI_SETINDENT",2122},
 	{"SCI_SETINDENTATIONGUIDES",2132},
@@ -2226,6 +2282,7 @@ static IFaceConstant ifaceConstants[] = {
 	{"SCI_SETKEYSUNICODE",2521},
 	{"SCI_SETKEYWORDS",4005},
 	{"SCI_SETLAYOUTCACHE",2272},
+	{"SCI_SETLAYOUTCACHEPAGES",2703},
 	{"SCI_SETLEXER",4001},
 	{"SCI_SETLEXERLANGUAGE",4006},
 	{"SCI_SETLINEENDTYPESALLOWED",2656},
@@ -2265,6 +2322,7 @@ static IFaceConstant ifaceConstants[] = {
 	{"SCI_SETSCROLLWIDTH",2274},
 	{"SCI_SETSCROLLWIDTHTRACKING",2516},
 	{"SCI_SETSEARCHFLAGS",2198},
+	{"SCI_SETSEGMENTCACHEBUDGET",2700},
 	{"SCI_SETSELALPHA",2478},
 	{"SCI_SETSELECTIONEND",2144},
 	{"SCI_SETSELECTIONMODE",2422},
@@ -2285,6 +2343,7 @@ static IFaceConstant ifaceConstants[] = {
 	{"SCI_SETTECHNOLOGY",2630},
 	{"SCI_SETTWOPHASEDRAW",2284},
 	{"SCI_SETUNDOCOLLECTION",2012},
+	{"SCI_SETUNDOMEMORYLIMIT",2698},
 	{"SCI_SETUSETABS",2124},
 	{"SCI_SETVIEWEOL",2356},
 	{"SCI_SETVIEWWS",2021},
@@ -2296,6 +2355,7 @@ static IFaceConstant ifaceConstants[] = {
 	{"SCI_SETWRAPINDENTMODE",2472},
 	{"SCI_SETWRAPMODE",2268},
 	{"SCI_SETWRAPSTARTINDENT",2464},
+	{"SCI_SETWRAPTHREADS",2680},
 	{"SCI_SETWRAPVISUALFLAGS",2460},
 	{"SCI_SETWRAPVISUALFLAGSLOCATION",2462},
 	{"SCI_SETXOFFSET",2397},
@@ -2545,6 +2605,10 @@ static IFaceConstant ifaceConstants[] = {
 	{"SC_FOLDLEVELNUMBERMASK",0x0FFF},
 	{"SC_FOLDLEVELWHITEFLAG",0x1000},
 	{"SC_FONT_SIZE_MULTIPLIER",100},
+	{"SC_IDLESTYLING_AFTERVISIBLE",2},
+	{"SC_IDLESTYLING_ALL",3},
+	{"SC_IDLESTYLING_NONE",0},
+	{"SC_IDLESTYLING_TOVISIBLE",1},
 	{"SC_IME_INLINE",1},
 	{"SC_IME_WINDOWED",0},
 	{"SC_IV_LOOKBOTH",3},
@@ -2604,7 +2668,7 @@ static IFaceConstant ifaceConstants[] = {
 	{"SC_MARK_VLINE",9},
 	{"SC_MASK_FOLDERS",static_cast<int>(0xFE000000)},
 	{"SC_MAX_MARGIN",4},
-	{"SC_MODEVENTMASKALL",0x3FFFFF},
+	{"SC_MODEVENTMASKALL",0x7FFFFF},
 	{"SC_MOD_BEFOREDELETE",0x800},
 	{"SC_MOD_BEFOREINSERT",0x400},
 	{"SC_MOD_CHANGEANNOTATION",0x20000},
@@ -2620,6 +2684,7 @@ static IFaceConstant ifaceConstants[] = {
 	{"SC_MOD_INSERTCHECK",0x100000},
 	{"SC_MOD_INSERTTEXT",0x1},
 	{"SC_MOD_LEXERSTATE",0x80000},
+	{"SC_MOD_LINESINDEXED",0x400000},
 	{"SC_MULTIAUTOC_EACH",1},
 	{"SC_MULTIAUTOC_ONCE",0},
 	{"SC_MULTILINEUNDOREDO",0x1000},
@@ -2635,6 +2700,12 @@ static IFaceConstant ifaceConstants[] = {
 	{"SC_PHASES_MULTIPLE",2},
 	{"SC_PHASES_ONE",0},
 	{"SC_PHASES_TWO",1},
+	{"SC_POSITIONCACHE_HITS",0},
+	{"SC_POSITIONCACHE_MISSES",1},
+	{"SC_POSITIONCACHE_SEGMENTBYTES",4},
+	{"SC_POSITIONCACHE_SEGMENTENTRIES",5},
+	{"SC_POSITIONCACHE_SEGMENTHITS",2},
+	{"SC_POSITIONCACHE_SEGMENTMISSES",3},
 	{"SC_PRINT_BLACKONWHITE",2},
 	{"SC_PRINT_COLOURONWHITE",3},
 	{"SC_PRINT_COLOURONWHITEDEFAULTBG",4},
@@ -2759,6 +2830,7 @@ static IFaceFunction ifaceFunctions[] = {
 	{"CountCharacters", 2633, iface_int, {iface_int, iface_int}},
 	{"CreateDocument", 2375, iface_int, {iface_void, iface_void}},
 	{"CreateLoader", 2632, iface_int, {iface_int, iface_void}},
+	{"CreateMappedDocument", 2696, iface_int, {iface_void, iface_int}},
 	{"Cut", 2177, iface_void, {iface_void, iface_void}},
 	{"DelLineLeft", 2395, iface_void, {iface_void, iface_void}},
 	{"DelLineRight", 2396, iface_void, {iface_void, iface_void}},
@@ -3067,8 +3139,11 @@ static IFaceProperty ifaceProperties[] = {
 	{"IMEInteraction", 2678, 2679, iface_int, iface_void},
 	{"Identifier", 2623, 2622, iface_int, iface_void},
 	{"Identifiers", 0, 4024, iface_string, iface_int},
+	{"IdleStyling", 2693, 2692, iface_int, iface_void},
+	{"IdleStylingBudget", 2695, 2694, iface_int, iface_void},
 	{"Indent", 2123, 2122, iface_int, iface_void},
 	{"IndentationGuides", 2133, 2132, iface_int, iface_void},
+	{"IndexingLines", 2697, 0, iface_bool, iface_void},
 	{"IndicAlpha", 2524, 2523, iface_int, iface_int},
 	{"IndicFore", 2083, 2082, iface_colour, iface_int},
 	{"IndicOutlineAlpha", 2559, 2558, iface_int, iface_int},
@@ -3079,6 +3154,7 @@ static IFaceProperty ifaceProperties[] = {
 	{"KeyWords", 0, 4005, iface_string, iface_int},
 	{"KeysUnicode", 2522, 2521, iface_bool, iface_void},
 	{"LayoutCache", 2273, 2272, iface_int, iface_void},
+	{"LayoutCachePages", 2704, 2703, iface_int, iface_void},
 	{"Length", 2006, 0, iface_int, iface_void},
 	{"Lexer", 4002, 4001, iface_int, iface_void},
 	{"LexerLanguage", 4012, 4006, iface_stringresult, iface_void},
@@ -3121,6 +3197,7 @@ static IFaceProperty ifaceProperties[] = {
 	{"PasteConvertEndings", 2468, 2467, iface_bool, iface_void},
 	{"PhasesDraw", 2673, 2674, iface_int, iface_void},
 	{"PositionCache", 2515, 2514, iface_int, iface_void},
+	{"PositionCacheStatistic", 2702, 0, iface_int, iface_int},
 	{"PrimaryStyleFromStyle", 4028, 0, iface_int, iface_int},
 	{"PrintColourMode", 2149, 2148, iface_int, iface_void},
 	{"PrintMagnification", 2147, 2146, iface_int, iface_void},
@@ -3142,6 +3219,7 @@ static IFaceProperty ifaceProperties[] = {
 	{"ScrollWidth", 2275, 2274, iface_int, iface_void},
 	{"ScrollWidthTracking", 2517, 2516, iface_bool, iface_void},
 	{"SearchFlags", 2199, 2198, iface_int, iface_void},
+	{"SegmentCacheBudget", 2701, 2700, iface_int, iface_void},
 	{"SelAlpha", 2477, 2478, iface_int, iface_void},
 	{"SelEOLFilled", 2479, 2480, iface_bool, iface_void},
 	{"SelectionEmpty", 2650, 0, iface_bool, iface_void},
@@ -3188,6 +3266,7 @@ static IFaceProperty ifaceProperties[] = {
 	{"TextLength", 2183, 0, iface_int, iface_void},
 	{"TwoPhaseDraw", 2283, 2284, iface_bool, iface_void},
 	{"UndoCollection", 2019, 2012, iface_bool, iface_void},
+	{"UndoMemoryLimit", 2699, 2698, iface_int, iface_void},
 	{"UseTabs", 2125, 2124, iface_bool, iface_void},
 	{"VScrollBar", 2281, 2280, iface_bool, iface_void},
 	{"ViewEOL", 2355, 2356, iface_bool, iface_void},
@@ -3199,16 +3278,3581 @@ static IFaceProperty ifaceProperties[] = {
 	{"WrapIndentMode", 2473, 2472, iface_int, iface_void},
 	{"WrapMode", 2269, 2268, iface_int, iface_void},
 	{"WrapStartIndent", 2465, 2464, iface_int, iface_void},
+	{"WrapThreads", 2681, 2680, iface_int, iface_void},
 	{"WrapVisualFlags", 2461, 2460, iface_int, iface_void},
 	{"WrapVisualFlagsLocation", 2463, 2462, iface_int, iface_void},
 	{"XOffset", 2398, 2397, iface_int, iface_void},
 	{"Zoom", 2374, 2373, iface_int, iface_void}
 };
 
+static const int ifaceFunctionsByConstantName[] = {
+	0, // SCI_ADDREFDOCUMENT
+	1, // SCI_ADDSELECTION
+	2, // SCI_ADDSTYLEDTEXT
+	3, // SCI_ADDTABSTOP
+	4, // SCI_ADDTEXT
+	5, // SCI_ADDUNDOACTION
+	6, // SCI_ALLOCATE
+	7, // SCI_ALLOCATEEXTENDEDSTYLES
+	8, // SCI_ALLOCATESUBSTYLES
+	9, // SCI_ANNOTATIONCLEARALL
+	10, // SCI_APPENDTEXT
+	11, // SCI_ASSIGNCMDKEY
+	12, // SCI_AUTOCACTIVE
+	13, // SCI_AUTOCCANCEL
+	14, // SCI_AUTOCCOMPLETE
+	15, // SCI_AUTOCPOSSTART
+	16, // SCI_AUTOCSELECT
+	17, // SCI_AUTOCSHOW
+	18, // SCI_AUTOCSTOPS
+	19, // SCI_BACKTAB
+	20, // SCI_BEGINUNDOACTION
+	21, // SCI_BRACEBADLIGHT
+	22, // SCI_BRACEBADLIGHTINDICATOR
+	23, // SCI_BRACEHIGHLIGHT
+	24, // SCI_BRACEHIGHLIGHTINDICATOR
+	25, // SCI_BRACEMATCH
+	26, // SCI_CALLTIPACTIVE
+	27, // SCI_CALLTIPCANCEL
+	28, // SCI_CALLTIPPOSSTART
+	29, // SCI_CALLTIPSETHLT
+	30, // SCI_CALLTIPSHOW
+	34, // SCI_CANCEL
+	31, // SCI_CANPASTE
+	32, // SCI_CANREDO
+	33, // SCI_CANUNDO
+	35, // SCI_CHANGEINSERTION
+	36, // SCI_CHANGELEXERSTATE
+	37, // SCI_CHARLEFT
+	38, // SCI_CHARLEFTEXTEND
+	39, // SCI_CHARLEFTRECTEXTEND
+	40, // SCI_CHARPOSITIONFROMPOINT
+	41, // SCI_CHARPOSITIONFROMPOINTCLOSE
+	42, // SCI_CHARRIGHT
+	43, // SCI_CHARRIGHTEXTEND
+	44, // SCI_CHARRIGHTRECTEXTEND
+	45, // SCI_CHOOSECARETX
+	46, // SCI_CLEAR
+	47, // SCI_CLEARALL
+	48, // SCI_CLEARALLCMDKEYS
+	49, // SCI_CLEARCMDKEY
+	50, // SCI_CLEARDOCUMENTSTYLE
+	51, // SCI_CLEARREGISTEREDIMAGES
+	52, // SCI_CLEARREPRESENTATION
+	53, // SCI_CLEARSELECTIONS
+	54, // SCI_CLEARTABSTOPS
+	55, // SCI_COLOURISE
+	56, // SCI_CONTRACTEDFOLDNEXT
+	57, // SCI_CONVERTEOLS
+	58, // SCI_COPY
+	59, // SCI_COPYALLOWLINE
+	60, // SCI_COPYRANGE
+	61, // SCI_COPYTEXT
+	62, // SCI_COUNTCHARACTERS
+	63, // SCI_CREATEDOCUMENT
+	64, // SCI_CREATELOADER
+	65, // SCI_CREATEMAPPEDDOCUMENT
+	66, // SCI_CUT
+	72, // SCI_DELETEBACK
+	73, // SCI_DELETEBACKNOTLINE
+	74, // SCI_DELETERANGE
+	67, // SCI_DELLINELEFT
+	68, // SCI_DELLINERIGHT
+	69, // SCI_DELWORDLEFT
+	70, // SCI_DELWORDRIGHT
+	71, // SCI_DELWORDRIGHTEND
+	75, // SCI_DESCRIBEKEYWORDSETS
+	76, // SCI_DESCRIBEPROPERTY
+	77, // SCI_DOCLINEFROMVISIBLE
+	78, // SCI_DOCUMENTEND
+	79, // SCI_DOCUMENTENDEXTEND
+	80, // SCI_DOCUMENTSTART
+	81, // SCI_DOCUMENTSTARTEXTEND
+	82, // SCI_DROPSELECTIONN
+	83, // SCI_EDITTOGGLEOVERTYPE
+	84, // SCI_EMPTYUNDOBUFFER
+	85, // SCI_ENCODEDFROMUTF8
+	86, // SCI_ENDUNDOACTION
+	87, // SCI_ENSUREVISIBLE
+	88, // SCI_ENSUREVISIBLEENFORCEPOLICY
+	89, // SCI_EXPANDCHILDREN
+	90, // SCI_FINDCOLUMN
+	91, // SCI_FINDINDICATORFLASH
+	92, // SCI_FINDINDICATORHIDE
+	93, // SCI_FINDINDICATORSHOW
+	94, // SCI_FINDTEXT
+	95, // SCI_FOLDALL
+	96, // SCI_FOLDCHILDREN
+	97, // SCI_FOLDLINE
+	99, // SCI_FORMATRANGE
+	98, // SCI_FORMFEED
+	100, // SCI_FREESUBSTYLES
+	101, // SCI_GETCURLINE
+	102, // SCI_GETHOTSPOTACTIVEBACK
+	103, // SCI_GETHOTSPOTACTIVEFORE
+	104, // SCI_GETLASTCHILD
+	105, // SCI_GETLINE
+	106, // SCI_GETLINESELENDPOSITION
+	107, // SCI_GETLINESELSTARTPOSITION
+	108, // SCI_GETNEXTTABSTOP
+	109, // SCI_GETRANGEPOINTER
+	110, // SCI_GETSELTEXT
+	111, // SCI_GETSTYLEDTEXT
+	112, // SCI_GETTEXT
+	113, // SCI_GETTEXTRANGE
+	114, // SCI_GOTOLINE
+	115, // SCI_GOTOPOS
+	116, // SCI_GRABFOCUS
+	117, // SCI_HIDELINES
+	118, // SCI_HIDESELECTION
+	119, // SCI_HOME
+	120, // SCI_HOMEDISPLAY
+	121, // SCI_HOMEDISPLAYEXTEND
+	122, // SCI_HOMEEXTEND
+	123, // SCI_HOMERECTEXTEND
+	124, // SCI_HOMEWRAP
+	125, // SCI_HOMEWRAPEXTEND
+	126, // SCI_INDICATORALLONFOR
+	127, // SCI_INDICATORCLEARRANGE
+	128, // SCI_INDICATOREND
+	129, // SCI_INDICATORFILLRANGE
+	130, // SCI_INDICATORSTART
+	131, // SCI_INDICATORVALUEAT
+	132, // SCI_INSERTTEXT
+	133, // SCI_LINECOPY
+	134, // SCI_LINECUT
+	135, // SCI_LINEDELETE
+	136, // SCI_LINEDOWN
+	137, // SCI_LINEDOWNEXTEND
+	138, // SCI_LINEDOWNRECTEXTEND
+	139, // SCI_LINEDUPLICATE
+	140, // SCI_LINEEND
+	141, // SCI_LINEENDDISPLAY
+	142, // SCI_LINEENDDISPLAYEXTEND
+	143, // SCI_LINEENDEXTEND
+	144, // SCI_LINEENDRECTEXTEND
+	145, // SCI_LINEENDWRAP
+	146, // SCI_LINEENDWRAPEXTEND
+	147, // SCI_LINEFROMPOSITION
+	148, // SCI_LINELENGTH
+	149, // SCI_LINESCROLL
+	150, // SCI_LINESCROLLDOWN
+	151, // SCI_LINESCROLLUP
+	156, // SCI_LINESJOIN
+	157, // SCI_LINESSPLIT
+	152, // SCI_LINETRANSPOSE
+	153, // SCI_LINEUP
+	154, // SCI_LINEUPEXTEND
+	155, // SCI_LINEUPRECTEXTEND
+	158, // SCI_LOADLEXERLIBRARY
+	159, // SCI_LOWERCASE
+	160, // SCI_MARGINTEXTCLEARALL
+	161, // SCI_MARKERADD
+	162, // SCI_MARKERADDSET
+	163, // SCI_MARKERDEFINE
+	164, // SCI_MARKERDEFINEPIXMAP
+	165, // SCI_MARKERDEFINERGBAIMAGE
+	166, // SCI_MARKERDELETE
+	167, // SCI_MARKERDELETEALL
+	168, // SCI_MARKERDELETEHANDLE
+	169, // SCI_MARKERENABLEHIGHLIGHT
+	170, // SCI_MARKERGET
+	171, // SCI_MARKERLINEFROMHANDLE
+	172, // SCI_MARKERNEXT
+	173, // SCI_MARKERPREVIOUS
+	174, // SCI_MARKERSYMBOLDEFINED
+	175, // SCI_MOVECARETINSIDEVIEW
+	176, // SCI_MOVESELECTEDLINESDOWN
+	177, // SCI_MOVESELECTEDLINESUP
+	178, // SCI_NEWLINE
+	179, // SCI_NULL
+	180, // SCI_PAGEDOWN
+	181, // SCI_PAGEDOWNEXTEND
+	182, // SCI_PAGEDOWNRECTEXTEND
+	183, // SCI_PAGEUP
+	184, // SCI_PAGEUPEXTEND
+	185, // SCI_PAGEUPRECTEXTEND
+	186, // SCI_PARADOWN
+	187, // SCI_PARADOWNEXTEND
+	188, // SCI_PARAUP
+	189, // SCI_PARAUPEXTEND
+	190, // SCI_PASTE
+	191, // SCI_POINTXFROMPOSITION
+	192, // SCI_POINTYFROMPOSITION
+	193, // SCI_POSITIONAFTER
+	194, // SCI_POSITIONBEFORE
+	195, // SCI_POSITIONFROMLINE
+	196, // SCI_POSITIONFROMPOINT
+	197, // SCI_POSITIONFROMPOINTCLOSE
+	198, // SCI_POSITIONRELATIVE
+	199, // SCI_PRIVATELEXERCALL
+	200, // SCI_PROPERTYNAMES
+	201, // SCI_PROPERTYTYPE
+	202, // SCI_REDO
+	203, // SCI_REGISTERIMAGE
+	204, // SCI_REGISTERRGBAIMAGE
+	205, // SCI_RELEASEALLEXTENDEDSTYLES
+	206, // SCI_RELEASEDOCUMENT
+	207, // SCI_REPLACESEL
+	208, // SCI_REPLACETARGET
+	209, // SCI_REPLACETARGETRE
+	210, // SCI_ROTATESELECTION
+	211, // SCI_SCROLLCARET
+	212, // SCI_SCROLLRANGE
+	213, // SCI_SCROLLTOEND
+	214, // SCI_SCROLLTOSTART
+	215, // SCI_SEARCHANCHOR
+	216, // SCI_SEARCHINTARGET
+	217, // SCI_SEARCHNEXT
+	218, // SCI_SEARCHPREV
+	219, // SCI_SELECTALL
+	220, // SCI_SELECTIONDUPLICATE
+	221, // SCI_SETCHARSDEFAULT
+	222, // SCI_SETEMPTYSELECTION
+	223, // SCI_SETFOLDMARGINCOLOUR
+	224, // SCI_SETFOLDMARGINHICOLOUR
+	225, // SCI_SETHOTSPOTACTIVEBACK
+	226, // SCI_SETHOTSPOTACTIVEFORE
+	227, // SCI_SETLENGTHFORENCODE
+	228, // SCI_SETSAVEPOINT
+	229, // SCI_SETSEL
+	230, // SCI_SETSELBACK
+	232, // SCI_SETSELECTION
+	231, // SCI_SETSELFORE
+	233, // SCI_SETSTYLING
+	234, // SCI_SETSTYLINGEX
+	235, // SCI_SETTEXT
+	236, // SCI_SETVISIBLEPOLICY
+	237, // SCI_SETWHITESPACEBACK
+	238, // SCI_SETWHITESPACEFORE
+	239, // SCI_SETXCARETPOLICY
+	240, // SCI_SETYCARETPOLICY
+	241, // SCI_SHOWLINES
+	242, // SCI_STARTRECORD
+	243, // SCI_STARTSTYLING
+	244, // SCI_STOPRECORD
+	245, // SCI_STUTTEREDPAGEDOWN
+	246, // SCI_STUTTEREDPAGEDOWNEXTEND
+	247, // SCI_STUTTEREDPAGEUP
+	248, // SCI_STUTTEREDPAGEUPEXTEND
+	249, // SCI_STYLECLEARALL
+	250, // SCI_STYLERESETDEFAULT
+	251, // SCI_SWAPMAINANCHORCARET
+	252, // SCI_TAB
+	253, // SCI_TARGETASUTF8
+	254, // SCI_TARGETFROMSELECTION
+	255, // SCI_TEXTHEIGHT
+	256, // SCI_TEXTWIDTH
+	257, // SCI_TOGGLECARETSTICKY
+	258, // SCI_TOGGLEFOLD
+	259, // SCI_UNDO
+	260, // SCI_UPPERCASE
+	261, // SCI_USEPOPUP
+	262, // SCI_USERLISTSHOW
+	263, // SCI_VCHOME
+	264, // SCI_VCHOMEDISPLAY
+	265, // SCI_VCHOMEDISPLAYEXTEND
+	266, // SCI_VCHOMEEXTEND
+	267, // SCI_VCHOMERECTEXTEND
+	268, // SCI_VCHOMEWRAP
+	269, // SCI_VCHOMEWRAPEXTEND
+	270, // SCI_VERTICALCENTRECARET
+	271, // SCI_VISIBLEFROMDOCLINE
+	272, // SCI_WORDENDPOSITION
+	273, // SCI_WORDLEFT
+	274, // SCI_WORDLEFTEND
+	275, // SCI_WORDLEFTENDEXTEND
+	276, // SCI_WORDLEFTEXTEND
+	277, // SCI_WORDPARTLEFT
+	278, // SCI_WORDPARTLEFTEXTEND
+	279, // SCI_WORDPARTRIGHT
+	280, // SCI_WORDPARTRIGHTEXTEND
+	281, // SCI_WORDRIGHT
+	282, // SCI_WORDRIGHTEND
+	283, // SCI_WORDRIGHTENDEXTEND
+	284, // SCI_WORDRIGHTEXTEND
+	285, // SCI_WORDSTARTPOSITION
+	286, // SCI_WRAPCOUNT
+	287, // SCI_ZOOMIN
+	288 // SCI_ZOOMOUT
+};
+
+static IFaceMessage ifaceMessages[] = {
+	{2001, 4, -1},
+	{2002, 2, -1},
+	{2003, 132, -1},
+	{2004, 47, -1},
+	{2005, 50, -1},
+	{2006, -1, 98},
+	{2007, -1, 48},
+	{2008, -1, 53},
+	{2009, -1, 8},
+	{2010, -1, 178},
+	{2011, 202, -1},
+	{2012, -1, 208},
+	{2013, 219, -1},
+	{2014, 228, -1},
+	{2015, 111, -1},
+	{2016, 32, -1},
+	{2017, 171, -1},
+	{2018, 168, -1},
+	{2019, -1, 208},
+	{2020, -1, 213},
+	{2021, -1, 213},
+	{2022, 196, -1},
+	{2023, 197, -1},
+	{2024, 114, -1},
+	{2025, 115, -1},
+	{2026, -1, 8},
+	{2027, 101, -1},
+	{2028, -1, 64},
+	{2029, 57, -1},
+	{2030, -1, 59},
+	{2031, -1, 59},
+	{2032, 243, -1},
+	{2033, 233, -1},
+	{2034, -1, 32},
+	{2035, -1, 32},
+	{2036, -1, 201},
+	{2037, -1, 50},
+	{2040, 163, -1},
+	{2041, -1, 127},
+	{2042, -1, 125},
+	{2043, 161, -1},
+	{2044, 166, -1},
+	{2045, 167, -1},
+	{2046, 170, -1},
+	{2047, 172, -1},
+	{2048, 173, -1},
+	{2049, 164, -1},
+	{2050, 249, -1},
+	{2051, -1, 188},
+	{2052, -1, 179},
+	{2053, -1, 182},
+	{2054, -1, 191},
+	{2055, -1, 192},
+	{2056, -1, 187},
+	{2057, -1, 186},
+	{2058, 250, -1},
+	{2059, -1, 194},
+	{2060, -1, 183},
+	{2061, -1, 193},
+	{2062, -1, 193},
+	{2063, -1, 196},
+	{2064, -1, 196},
+	{2066, -1, 185},
+	{2067, 231, -1},
+	{2068, 230, -1},
+	{2069, -1, 39},
+	{2070, 11, -1},
+	{2071, 49, -1},
+	{2072, 48, -1},
+	{2073, 234, -1},
+	{2074, -1, 195},
+	{2075, -1, 44},
+	{2076, -1, 44},
+	{2077, -1, 217},
+	{2078, 20, -1},
+	{2079, 86, -1},
+	{2080, -1, 90},
+	{2081, -1, 90},
+	{2082, -1, 88},
+	{2083, -1, 88},
+	{2084, 238, -1},
+	{2085, 237, -1},
+	{2086, -1, 216},
+	{2087, -1, 216},
+	{2090, -1, 180},
+	{2091, -1, 180},
+	{2092, -1, 108},
+	{2093, -1, 108},
+	{2094, -1, 128},
+	{2095, -1, 42},
+	{2096, -1, 42},
+	{2097, -1, 40},
+	{2098, -1, 40},
+	{2099, -1, 184},
+	{2100, 17, -1},
+	{2101, 13, -1},
+	{2102, 12, -1},
+	{2103, 15, -1},
+	{2104, 14, -1},
+	{2105, 18, -1},
+	{2106, -1, 28},
+	{2107, -1, 28},
+	{2108, 16, -1},
+	{2110, -1, 16},
+	{2111, -1, 16},
+	{2112, -1, 22},
+	{2113, -1, 18},
+	{2114, -1, 18},
+	{2115, -1, 23},
+	{2116, -1, 23},
+	{2117, 262, -1},
+	{2118, -1, 15},
+	{2119, -1, 15},
+	{2121, -1, 201},
+	{2122, -1, 84},
+	{2123, -1, 84},
+	{2124, -1, 210},
+	{2125, -1, 210},
+	{2126, -1, 107},
+	{2127, -1, 107},
+	{2128, -1, 106},
+	{2129, -1, 51},
+	{2130, -1, 75},
+	{2131, -1, 75},
+	{2132, -1, 85},
+	{2133, -1, 85},
+	{2134, -1, 76},
+	{2135, -1, 76},
+	{2136, -1, 102},
+	{2137, -1, 50},
+	{2138, -1, 39},
+	{2140, -1, 152},
+	{2141, -1, 53},
+	{2142, -1, 175},
+	{2143, -1, 175},
+	{2144, -1, 166},
+	{2145, -1, 166},
+	{2146, -1, 143},
+	{2147, -1, 143},
+	{2148, -1, 142},
+	{2149, -1, 142},
+	{2150, 94, -1},
+	{2151, 99, -1},
+	{2152, -1, 67},
+	{2153, 105, -1},
+	{2154, -1, 101},
+	{2155, -1, 113},
+	{2156, -1, 113},
+	{2157, -1, 116},
+	{2158, -1, 116},
+	{2159, -1, 130},
+	{2160, 229, -1},
+	{2161, 110, -1},
+	{2162, 113, -1},
+	{2163, 118, -1},
+	{2164, 191, -1},
+	{2165, 192, -1},
+	{2166, 147, -1},
+	{2167, 195, -1},
+	{2168, 149, -1},
+	{2169, 211, -1},
+	{2170, 207, -1},
+	{2171, -1, 152},
+	{2172, 179, -1},
+	{2173, 31, -1},
+	{2174, 33, -1},
+	{2175, 84, -1},
+	{2176, 259, -1},
+	{2177, 66, -1},
+	{2178, 58, -1},
+	{2179, 190, -1},
+	{2180, 46, -1},
+	{2181, 235, -1},
+	{2182, 112, -1},
+	{2183, -1, 206},
+	{2184, -1, 55},
+	{2185, -1, 56},
+	{2186, -1, 136},
+	{2187, -1, 136},
+	{2188, -1, 47},
+	{2189, -1, 47},
+	{2190, -1, 204},
+	{2191, -1, 204},
+	{2192, -1, 203},
+	{2193, -1, 203},
+	{2194, 208, -1},
+	{2195, 209, -1},
+	{2197, 216, -1},
+	{2198, -1, 161},
+	{2199, -1, 161},
+	{2200, 30, -1},
+	{2201, 27, -1},
+	{2202, 26, -1},
+	{2203, 28, -1},
+	{2204, 29, -1},
+	{2205, -1, 33},
+	{2206, -1, 34},
+	{2207, -1, 35},
+	{2208, -1, 25},
+	{2209, -1, 25},
+	{2210, -1, 24},
+	{2211, -1, 24},
+	{2212, -1, 38},
+	{2213, -1, 37},
+	{2214, -1, 36},
+	{2220, 271, -1},
+	{2221, 77, -1},
+	{2222, -1, 71},
+	{2223, -1, 71},
+	{2224, 104, -1},
+	{2225, -1, 72},
+	{2226, 241, -1},
+	{2227, 117, -1},
+	{2228, -1, 109},
+	{2229, -1, 69},
+	{2230, -1, 69},
+	{2231, 258, -1},
+	{2232, 87, -1},
+	{2233, -1, 70},
+	{2234, 88, -1},
+	{2235, 286, -1},
+	{2236, -1, 7},
+	{2237, 97, -1},
+	{2238, 96, -1},
+	{2239, 89, -1},
+	{2240, -1, 122},
+	{2241, -1, 122},
+	{2242, -1, 123},
+	{2243, -1, 123},
+	{2244, -1, 114},
+	{2245, -1, 114},
+	{2246, -1, 117},
+	{2247, -1, 117},
+	{2248, -1, 112},
+	{2249, -1, 112},
+	{2260, -1, 200},
+	{2261, -1, 200},
+	{2262, -1, 31},
+	{2263, -1, 31},
+	{2264, -1, 132},
+	{2265, -1, 132},
+	{2266, 285, -1},
+	{2267, 272, -1},
+	{2268, -1, 219},
+	{2269, -1, 219},
+	{2270, -1, 21},
+	{2271, -1, 21},
+	{2272, -1, 96},
+	{2273, -1, 96},
+	{2274, -1, 159},
+	{2275, -1, 159},
+	{2276, 256, -1},
+	{2277, -1, 63},
+	{2278, -1, 63},
+	{2279, 255, -1},
+	{2280, -1, 211},
+	{2281, -1, 211},
+	{2282, 10, -1},
+	{2283, -1, 207},
+	{2284, -1, 207},
+	{2285, -1, 29},
+	{2286, -1, 29},
+	{2287, 254, -1},
+	{2288, 156, -1},
+	{2289, 157, -1},
+	{2290, 223, -1},
+	{2291, 224, -1},
+	{2292, -1, 126},
+	{2293, 169, -1},
+	{2300, 136, -1},
+	{2301, 137, -1},
+	{2302, 153, -1},
+	{2303, 154, -1},
+	{2304, 37, -1},
+	{2305, 38, -1},
+	{2306, 42, -1},
+	{2307, 43, -1},
+	{2308, 273, -1},
+	{2309, 276, -1},
+	{2310, 281, -1},
+	{2311, 284, -1},
+	{2312, 119, -1},
+	{2313, 122, -1},
+	{2314, 140, -1},
+	{2315, 143, -1},
+	{2316, 80, -1},
+	{2317, 81, -1},
+	{2318, 78, -1},
+	{2319, 79, -1},
+	{2320, 183, -1},
+	{2321, 184, -1},
+	{2322, 180, -1},
+	{2323, 181, -1},
+	{2324, 83, -1},
+	{2325, 34, -1},
+	{2326, 72, -1},
+	{2327, 252, -1},
+	{2328, 19, -1},
+	{2329, 178, -1},
+	{2330, 98, -1},
+	{2331, 263, -1},
+	{2332, 266, -1},
+	{2333, 287, -1},
+	{2334, 288, -1},
+	{2335, 69, -1},
+	{2336, 70, -1},
+	{2337, 134, -1},
+	{2338, 135, -1},
+	{2339, 152, -1},
+	{2340, 159, -1},
+	{2341, 260, -1},
+	{2342, 150, -1},
+	{2343, 151, -1},
+	{2344, 73, -1},
+	{2345, 120, -1},
+	{2346, 121, -1},
+	{2347, 141, -1},
+	{2348, 142, -1},
+	{2349, 124, -1},
+	{2350, 148, -1},
+	{2351, 23, -1},
+	{2352, 21, -1},
+	{2353, 25, -1},
+	{2355, -1, 212},
+	{2356, -1, 212},
+	{2357, -1, 58},
+	{2358, -1, 58},
+	{2359, -1, 129},
+	{2360, -1, 61},
+	{2361, -1, 61},
+	{2362, -1, 62},
+	{2363, -1, 62},
+	{2364, -1, 60},
+	{2365, -1, 60},
+	{2366, 215, -1},
+	{2367, 217, -1},
+	{2368, 218, -1},
+	{2370, -1, 110},
+	{2371, 261, -1},
+	{2372, -1, 167},
+	{2373, -1, 225},
+	{2374, -1, 225},
+	{2375, 63, -1},
+	{2376, 0, -1},
+	{2377, 206, -1},
+	{2378, -1, 129},
+	{2380, -1, 68},
+	{2381, -1, 68},
+	{2382, -1, 177},
+	{2383, -1, 177},
+	{2384, -1, 131},
+	{2385, -1, 131},
+	{2386, -1, 54},
+	{2387, -1, 54},
+	{2388, -1, 52},
+	{2389, -1, 52},
+	{2390, 277, -1},
+	{2391, 278, -1},
+	{2392, 279, -1},
+	{2393, 280, -1},
+	{2394, 236, -1},
+	{2395, 67, -1},
+	{2396, 68, -1},
+	{2397, -1, 224},
+	{2398, -1, 224},
+	{2399, 45, -1},
+	{2400, 116, -1},
+	{2401, 175, -1},
+	{2402, 239, -1},
+	{2403, 240, -1},
+	{2404, 139, -1},
+	{2405, 203, -1},
+	{2406, -1, 144},
+	{2407, -1, 144},
+	{2408, 51, -1},
+	{2409, -1, 190},
+	{2410, 226, -1},
+	{2411, 225, -1},
+	{2412, -1, 77},
+	{2413, 186, -1},
+	{2414, 187, -1},
+	{2415, 188, -1},
+	{2416, 189, -1},
+	{2417, 194, -1},
+	{2418, 193, -1},
+	{2419, 60, -1},
+	{2420, 61, -1},
+	{2421, -1, 78},
+	{2422, -1, 168},
+	{2423, -1, 168},
+	{2424, 107, -1},
+	{2425, 106, -1},
+	{2426, 138, -1},
+	{2427, 155, -1},
+	{2428, 39, -1},
+	{2429, 44, -1},
+	{2430, 123, -1},
+	{2431, 267, -1},
+	{2432, 144, -1},
+	{2433, 185, -1},
+	{2434, 182, -1},
+	{2435, 247, -1},
+	{2436, 248, -1},
+	{2437, 245, -1},
+	{2438, 246, -1},
+	{2439, 274, -1},
+	{2440, 275, -1},
+	{2441, 282, -1},
+	{2442, 283, -1},
+	{2443, -1, 215},
+	{2444, 221, -1},
+	{2445, -1, 19},
+	{2446, 6, -1},
+	{2447, 253, -1},
+	{2448, 227, -1},
+	{2449, 85, -1},
+	{2450, 125, -1},
+	{2451, 145, -1},
+	{2452, 146, -1},
+	{2453, 268, -1},
+	{2454, 269, -1},
+	{2455, 133, -1},
+	{2456, 90, -1},
+	{2457, -1, 45},
+	{2458, -1, 45},
+	{2459, 257, -1},
+	{2460, -1, 222},
+	{2461, -1, 222},
+	{2462, -1, 223},
+	{2463, -1, 223},
+	{2464, -1, 220},
+	{2465, -1, 220},
+	{2466, 162, -1},
+	{2467, -1, 137},
+	{2468, -1, 137},
+	{2469, 220, -1},
+	{2470, -1, 41},
+	{2471, -1, 41},
+	{2472, -1, 218},
+	{2473, -1, 218},
+	{2476, -1, 124},
+	{2477, -1, 163},
+	{2478, -1, 163},
+	{2479, -1, 164},
+	{2480, -1, 164},
+	{2481, -1, 188},
+	{2482, -1, 179},
+	{2483, -1, 182},
+	{2484, -1, 191},
+	{2485, -1, 192},
+	{2486, -1, 187},
+	{2487, -1, 186},
+	{2488, -1, 194},
+	{2489, -1, 183},
+	{2490, -1, 185},
+	{2491, -1, 195},
+	{2492, -1, 184},
+	{2493, -1, 190},
+	{2494, 103, -1},
+	{2495, 102, -1},
+	{2496, -1, 77},
+	{2497, -1, 78},
+	{2498, 24, -1},
+	{2499, 22, -1},
+	{2500, -1, 92},
+	{2501, -1, 92},
+	{2502, -1, 93},
+	{2503, -1, 93},
+	{2504, 129, -1},
+	{2505, 127, -1},
+	{2506, 126, -1},
+	{2507, 131, -1},
+	{2508, 130, -1},
+	{2509, 128, -1},
+	{2510, -1, 91},
+	{2511, -1, 91},
+	{2512, -1, 46},
+	{2513, -1, 46},
+	{2514, -1, 139},
+	{2515, -1, 139},
+	{2516, -1, 160},
+	{2517, -1, 160},
+	{2518, 71, -1},
+	{2519, 59, -1},
+	{2520, -1, 49},
+	{2521, -1, 95},
+	{2522, -1, 95},
+	{2523, -1, 87},
+	{2524, -1, 87},
+	{2525, -1, 65},
+	{2526, -1, 65},
+	{2527, -1, 66},
+	{2528, -1, 66},
+	{2529, 174, -1},
+	{2530, -1, 121},
+	{2531, -1, 121},
+	{2532, -1, 118},
+	{2533, -1, 118},
+	{2534, -1, 120},
+	{2535, -1, 120},
+	{2536, 160, -1},
+	{2537, -1, 119},
+	{2538, -1, 119},
+	{2539, -1, 115},
+	{2540, -1, 13},
+	{2541, -1, 13},
+	{2542, -1, 10},
+	{2543, -1, 10},
+	{2544, -1, 12},
+	{2545, -1, 12},
+	{2546, -1, 9},
+	{2547, 9, -1},
+	{2548, -1, 14},
+	{2549, -1, 14},
+	{2550, -1, 11},
+	{2551, -1, 11},
+	{2552, 205, -1},
+	{2553, 7, -1},
+	{2556, 222, -1},
+	{2557, -1, 115},
+	{2558, -1, 89},
+	{2559, -1, 89},
+	{2560, 5, -1},
+	{2561, 40, -1},
+	{2562, 41, -1},
+	{2563, -1, 135},
+	{2564, -1, 135},
+	{2565, -1, 6},
+	{2566, -1, 6},
+	{2567, -1, 1},
+	{2568, -1, 1},
+	{2569, 212, -1},
+	{2570, -1, 176},
+	{2571, 53, -1},
+	{2572, 232, -1},
+	{2573, 1, -1},
+	{2574, -1, 111},
+	{2575, -1, 111},
+	{2576, -1, 171},
+	{2577, -1, 171},
+	{2578, -1, 169},
+	{2579, -1, 169},
+	{2580, -1, 172},
+	{2581, -1, 172},
+	{2582, -1, 170},
+	{2583, -1, 170},
+	{2584, -1, 174},
+	{2585, -1, 174},
+	{2586, -1, 173},
+	{2587, -1, 173},
+	{2588, -1, 155},
+	{2589, -1, 155},
+	{2590, -1, 153},
+	{2591, -1, 153},
+	{2592, -1, 156},
+	{2593, -1, 156},
+	{2594, -1, 154},
+	{2595, -1, 154},
+	{2596, -1, 214},
+	{2597, -1, 214},
+	{2598, -1, 157},
+	{2599, -1, 157},
+	{2600, -1, 5},
+	{2601, -1, 4},
+	{2602, -1, 3},
+	{2603, -1, 3},
+	{2604, -1, 0},
+	{2605, -1, 0},
+	{2606, 210, -1},
+	{2607, 251, -1},
+	{2608, -1, 2},
+	{2609, -1, 2},
+	{2610, -1, 20},
+	{2611, -1, 73},
+	{2612, -1, 73},
+	{2613, -1, 67},
+	{2614, -1, 134},
+	{2615, -1, 134},
+	{2616, -1, 202},
+	{2617, 36, -1},
+	{2618, 56, -1},
+	{2619, 270, -1},
+	{2620, 177, -1},
+	{2621, 176, -1},
+	{2622, -1, 80},
+	{2623, -1, 80},
+	{2624, -1, 151},
+	{2625, -1, 149},
+	{2626, 165, -1},
+	{2627, 204, -1},
+	{2628, 214, -1},
+	{2629, 213, -1},
+	{2630, -1, 205},
+	{2631, -1, 205},
+	{2632, 64, -1},
+	{2633, 62, -1},
+	{2634, -1, 17},
+	{2635, -1, 17},
+	{2636, -1, 26},
+	{2637, -1, 26},
+	{2640, 93, -1},
+	{2641, 91, -1},
+	{2642, 92, -1},
+	{2643, 109, -1},
+	{2644, -1, 74},
+	{2645, 74, -1},
+	{2646, -1, 217},
+	{2647, -1, 215},
+	{2648, -1, 148},
+	{2649, -1, 148},
+	{2650, -1, 165},
+	{2651, -1, 150},
+	{2652, 264, -1},
+	{2653, 265, -1},
+	{2654, -1, 43},
+	{2655, -1, 43},
+	{2656, -1, 104},
+	{2657, -1, 104},
+	{2658, -1, 103},
+	{2660, -1, 27},
+	{2661, -1, 27},
+	{2662, 95, -1},
+	{2663, -1, 30},
+	{2664, -1, 30},
+	{2665, -1, 158},
+	{2666, -1, 158},
+	{2667, 52, -1},
+	{2668, -1, 133},
+	{2669, -1, 133},
+	{2670, 198, -1},
+	{2671, 82, -1},
+	{2672, 35, -1},
+	{2673, -1, 138},
+	{2674, -1, 138},
+	{2675, 54, -1},
+	{2676, 3, -1},
+	{2677, 108, -1},
+	{2678, -1, 79},
+	{2679, -1, 79},
+	{2680, -1, 221},
+	{2681, -1, 221},
+	{2692, -1, 82},
+	{2693, -1, 82},
+	{2694, -1, 83},
+	{2695, -1, 83},
+	{2696, 65, -1},
+	{2697, -1, 86},
+	{2698, -1, 209},
+	{2699, -1, 209},
+	{2700, -1, 162},
+	{2701, -1, 162},
+	{2702, -1, 140},
+	{2703, -1, 97},
+	{2704, -1, 97},
+	{3001, 242, -1},
+	{3002, 244, -1},
+	{4001, -1, 99},
+	{4002, -1, 99},
+	{4003, 55, -1},
+	{4004, -1, 145},
+	{4005, -1, 94},
+	{4006, -1, 100},
+	{4007, 158, -1},
+	{4008, -1, 145},
+	{4009, -1, 146},
+	{4010, -1, 147},
+	{4011, -1, 181},
+	{4012, -1, 100},
+	{4013, 199, -1},
+	{4014, 200, -1},
+	{4015, 201, -1},
+	{4016, 76, -1},
+	{4017, 75, -1},
+	{4018, -1, 105},
+	{4020, 8, -1},
+	{4021, -1, 199},
+	{4022, -1, 198},
+	{4023, 100, -1},
+	{4024, -1, 81},
+	{4025, -1, 57},
+	{4026, -1, 197},
+	{4027, -1, 189},
+	{4028, -1, 141}
+};
+
+static const int ifaceConstantsByValue[] = {
+	2486, // SC_MASK_FOLDERS
+	190, // INVALID_POSITION
+	2400, // SC_CURSORNORMAL
+	1, // ANNOTATION_HIDDEN
+	5, // CARETSTYLE_INVISIBLE
+	13, // EDGE_NONE
+	182, // INDIC_PLAIN
+	212, // SCE_4GL_DEFAULT
+	233, // SCE_A68K_DEFAULT
+	251, // SCE_ABAQUS_DEFAULT
+	263, // SCE_ADA_DEFAULT
+	276, // SCE_APDL_DEFAULT
+	290, // SCE_ASM_DEFAULT
+	303, // SCE_ASN1_DEFAULT
+	316, // SCE_ASY_DEFAULT
+	327, // SCE_AU3_DEFAULT
+	341, // SCE_AVE_DEFAULT
+	359, // SCE_AVS_DEFAULT
+	372, // SCE_BAAN_DEFAULT
+	383, // SCE_BAT_DEFAULT
+	390, // SCE_BIBTEX_DEFAULT
+	402, // SCE_B_DEFAULT
+	424, // SCE_CAML_DEFAULT
+	439, // SCE_CLW_DEFAULT
+	454, // SCE_CMAKE_DEFAULT
+	475, // SCE_COFFEESCRIPT_DEFAULT
+	493, // SCE_CONF_DEFAULT
+	505, // SCE_CSOUND_DEFAULT
+	521, // SCE_CSS_DEFAULT
+	549, // SCE_C_DEFAULT
+	574, // SCE_DIFF_DEFAULT
+	579, // SCE_DMAP_DEFAULT
+	590, // SCE_DMIS_DEFAULT
+	607, // SCE_D_DEFAULT
+	631, // SCE_ECL_DEFAULT
+	652, // SCE_EIFFEL_DEFAULT
+	668, // SCE_ERLANG_DEFAULT
+	689, // SCE_ERR_DEFAULT
+	712, // SCE_ESCRIPT_DEFAULT
+	723, // SCE_FORTH_DEFAULT
+	742, // SCE_FS_DEFAULT
+	766, // SCE_F_DEFAULT
+	781, // SCE_GAP_DEFAULT
+	796, // SCE_GC_DEFAULT
+	809, // SCE_HA_DEFAULT
+	909, // SCE_H_DEFAULT
+	937, // SCE_INNO_DEFAULT
+	950, // SCE_KIX_DEFAULT
+	962, // SCE_KVIRC_DEFAULT
+	974, // SCE_LISP_DEFAULT
+	987, // SCE_LOT_DEFAULT
+	993, // SCE_LOUT_DEFAULT
+	1007, // SCE_LUA_DEFAULT
+	1028, // SCE_L_DEFAULT
+	1042, // SCE_MAGIK_DEFAULT
+	1055, // SCE_MAKE_DEFAULT
+	1065, // SCE_MARKDOWN_DEFAULT
+	1085, // SCE_MATLAB_DEFAULT
+	1093, // SCE_METAPOST_DEFAULT
+	1104, // SCE_MMIXAL_LEADWS
+	1122, // SCE_MODULA_DEFAULT
+	1139, // SCE_MSSQL_DEFAULT
+	1155, // SCE_MYSQL_DEFAULT
+	1177, // SCE_NNCRONTAB_DEFAULT
+	1188, // SCE_NSIS_DEFAULT
+	1213, // SCE_OPAL_SPACE
+	1217, // SCE_OSCRIPT_DEFAULT
+	1239, // SCE_PAS_DEFAULT
+	1251, // SCE_PLM_DEFAULT
+	1263, // SCE_PL_DEFAULT
+	1305, // SCE_POV_DEFAULT
+	1322, // SCE_POWERPRO_DEFAULT
+	1342, // SCE_POWERSHELL_DEFAULT
+	1354, // SCE_PO_DEFAULT
+	1371, // SCE_PROPS_DEFAULT
+	1378, // SCE_PS_DEFAULT
+	1396, // SCE_P_DEFAULT
+	1413, // SCE_RB_DEFAULT
+	1447, // SCE_REBOL_DEFAULT
+	1472, // SCE_REG_DEFAULT
+	1491, // SCE_RUST_DEFAULT
+	1509, // SCE_R_DEFAULT
+	1524, // SCE_SCRIPTOL_DEFAULT
+	1538, // SCE_SH_DEFAULT
+	1554, // SCE_SML_DEFAULT
+	1567, // SCE_SN_DEFAULT
+	1583, // SCE_SORCUS_DEFAULT
+	1591, // SCE_SPICE_DEFAULT
+	1606, // SCE_SQL_DEFAULT
+	1626, // SCE_STTXT_DEFAULT
+	1646, // SCE_ST_DEFAULT
+	1660, // SCE_T3_DEFAULT
+	1683, // SCE_TCL_DEFAULT
+	1704, // SCE_TCMD_DEFAULT
+	1713, // SCE_TEX_DEFAULT
+	1723, // SCE_TXT2TAGS_DEFAULT
+	1748, // SCE_VHDL_DEFAULT
+	1768, // SCE_VISUALPROLOG_DEFAULT
+	1786, // SCE_V_DEFAULT
+	1798, // SCE_YAML_DEFAULT
+	2256, // SCLEX_CONTAINER
+	2350, // SCMOD_NORM
+	2353, // SCVS_NONE
+	2356, // SCWS_INVISIBLE
+	2361, // SC_ALPHA_TRANSPARENT
+	2367, // SC_CACHE_NONE
+	2369, // SC_CARETSTICKY_OFF
+	2373, // SC_CASEINSENSITIVEBEHAVIOUR_RESPECTCASE
+	2375, // SC_CASE_MIXED
+	2378, // SC_CHARSET_ANSI
+	2404, // SC_EFF_QUALITY_DEFAULT
+	2409, // SC_EOL_CRLF
+	2411, // SC_FOLDACTION_CONTRACT
+	2427, // SC_IDLESTYLING_NONE
+	2430, // SC_IME_WINDOWED
+	2433, // SC_IV_NONE
+	2436, // SC_LINE_END_TYPE_DEFAULT
+	2438, // SC_MARGINOPTION_NONE
+	2444, // SC_MARGIN_SYMBOL
+	2464, // SC_MARK_CIRCLE
+	2506, // SC_MULTIAUTOC_ONCE
+	2509, // SC_MULTIPASTE_ONCE
+	2513, // SC_ORDER_PRESORTED
+	2518, // SC_PHASES_ONE
+	2520, // SC_POSITIONCACHE_HITS
+	2530, // SC_PRINT_NORMAL
+	2533, // SC_SEL_STREAM
+	2538, // SC_STATUS_OK
+	2541, // SC_TECHNOLOGY_DEFAULT
+	2546, // SC_TYPE_BOOLEAN
+	2556, // SC_WRAPINDENT_FIXED
+	2559, // SC_WRAPVISUALFLAGLOC_DEFAULT
+	2564, // SC_WRAPVISUALFLAG_NONE
+	2567, // SC_WRAP_NONE
+	3, // ANNOTATION_STANDARD
+	6, // CARETSTYLE_LINE
+	9, // CARET_SLOP
+	12, // EDGE_LINE
+	184, // INDIC_SQUIGGLE
+	218, // SCE_4GL_NUMBER
+	228, // SCE_A68K_COMMENT
+	249, // SCE_ABAQUS_COMMENT
+	271, // SCE_ADA_WORD
+	274, // SCE_APDL_COMMENT
+	286, // SCE_ASM_COMMENT
+	302, // SCE_ASN1_COMMENT
+	313, // SCE_ASY_COMMENT
+	324, // SCE_AU3_COMMENT
+	340, // SCE_AVE_COMMENT
+	356, // SCE_AVS_COMMENTBLOCK
+	370, // SCE_BAAN_COMMENT
+	382, // SCE_BAT_COMMENT
+	391, // SCE_BIBTEX_ENTRY
+	398, // SCE_B_COMMENT
+	425, // SCE_CAML_IDENTIFIER
+	444, // SCE_CLW_LABEL
+	453, // SCE_CMAKE_COMMENT
+	468, // SCE_COFFEESCRIPT_COMMENT
+	492, // SCE_CONF_COMMENT
+	503, // SCE_CSOUND_COMMENT
+	537, // SCE_CSS_TAG
+	543, // SCE_C_COMMENT
+	573, // SCE_DIFF_COMMENT
+	578, // SCE_DMAP_COMMENT
+	589, // SCE_DMIS_COMMENT
+	600, // SCE_D_COMMENT
+	625, // SCE_ECL_COMMENT
+	651, // SCE_EIFFEL_COMMENTLINE
+	663, // SCE_ERLANG_COMMENT
+	705, // SCE_ERR_PYTHON
+	709, // SCE_ESCRIPT_COMMENT
+	720, // SCE_FORTH_COMMENT
+	732, // SCE_FS_COMMENT
+	764, // SCE_F_COMMENT
+	782, // SCE_GAP_IDENTIFIER
+	794, // SCE_GC_COMMENTLINE
+	810, // SCE_HA_IDENTIFIER
+	928, // SCE_H_TAG
+	935, // SCE_INNO_COMMENT
+	948, // SCE_KIX_COMMENT
+	960, // SCE_KVIRC_COMMENT
+	973, // SCE_LISP_COMMENT
+	989, // SCE_LOT_HEADER
+	992, // SCE_LOUT_COMMENT
+	1004, // SCE_LUA_COMMENT
+	1025, // SCE_L_COMMAND
+	1040, // SCE_MAGIK_COMMENT
+	1054, // SCE_MAKE_COMMENT
+	1075, // SCE_MARKDOWN_LINE_BEGIN
+	1084, // SCE_MATLAB_COMMENT
+	1096, // SCE_METAPOST_SPECIAL
+	1100, // SCE_MMIXAL_COMMENT
+	1121, // SCE_MODULA_COMMENT
+	1137, // SCE_MSSQL_COMMENT
+	1152, // SCE_MYSQL_COMMENT
+	1176, // SCE_NNCRONTAB_COMMENT
+	1186, // SCE_NSIS_COMMENT
+	1206, // SCE_OPAL_COMMENT_BLOCK
+	1225, // SCE_OSCRIPT_LINE_COMMENT
+	1241, // SCE_PAS_IDENTIFIER
+	1249, // SCE_PLM_COMMENT
+	1264, // SCE_PL_ERROR
+	1303, // SCE_POV_COMMENT
+	1320, // SCE_POWERPRO_COMMENTBLOCK
+	1339, // SCE_POWERSHELL_COMMENT
+	1353, // SCE_PO_COMMENT
+	1370, // SCE_PROPS_COMMENT
+	1377, // SCE_PS_COMMENT
+	1394, // SCE_P_COMMENTLINE
+	1415, // SCE_RB_ERROR
+	1445, // SCE_REBOL_COMMENTLINE
+	1471, // SCE_REG_COMMENT
+	1487, // SCE_RUST_COMMENTBLOCK
+	1508, // SCE_R_COMMENT
+	1534, // SCE_SCRIPTOL_WHITE
+	1539, // SCE_SH_ERROR
+	1555, // SCE_SML_IDENTIFIER
+	1564, // SCE_SN_CODE
+	1580, // SCE_SORCUS_COMMAND
+	1593, // SCE_SPICE_IDENTIFIER
+	1600, // SCE_SQL_COMMENT
+	1623, // SCE_STTXT_COMMENT
+	1655, // SCE_ST_STRING
+	1677, // SCE_T3_X_DEFAULT
+	1680, // SCE_TCL_COMMENT
+	1703, // SCE_TCMD_COMMENT
+	1715, // SCE_TEX_SPECIAL
+	1733, // SCE_TXT2TAGS_LINE_BEGIN
+	1746, // SCE_VHDL_COMMENT
+	1771, // SCE_VISUALPROLOG_KEY_MAJOR
+	1783, // SCE_V_COMMENT
+	1797, // SCE_YAML_COMMENT
+	2301, // SCLEX_NULL
+	2351, // SCMOD_SHIFT
+	2354, // SCVS_RECTANGULARSELECTION
+	2358, // SCWS_VISIBLEALWAYS
+	2364, // SC_AUTOMATICFOLD_SHOW
+	2365, // SC_CACHE_CARET
+	2370, // SC_CARETSTICKY_ON
+	2372, // SC_CASEINSENSITIVEBEHAVIOUR_IGNORECASE
+	2376, // SC_CASE_UPPER
+	2383, // SC_CHARSET_DEFAULT
+	2407, // SC_EFF_QUALITY_NON_ANTIALIASED
+	2408, // SC_EOL_CR
+	2412, // SC_FOLDACTION_EXPAND
+	2428, // SC_IDLESTYLING_TOVISIBLE
+	2429, // SC_IME_INLINE
+	2434, // SC_IV_REAL
+	2437, // SC_LINE_END_TYPE_UNICODE
+	2439, // SC_MARGINOPTION_SUBLINESELECT
+	2442, // SC_MARGIN_NUMBER
+	2479, // SC_MARK_ROUNDRECT
+	2502, // SC_MOD_INSERTTEXT
+	2505, // SC_MULTIAUTOC_EACH
+	2508, // SC_MULTIPASTE_EACH
+	2512, // SC_ORDER_PERFORMSORT
+	2519, // SC_PHASES_TWO
+	2521, // SC_POSITIONCACHE_MISSES
+	2529, // SC_PRINT_INVERTLIGHT
+	2532, // SC_SEL_RECTANGLE
+	2537, // SC_STATUS_FAILURE
+	2542, // SC_TECHNOLOGY_DIRECTWRITE
+	2547, // SC_TYPE_INTEGER
+	2549, // SC_UPDATE_CONTENT
+	2558, // SC_WRAPINDENT_SAME
+	2560, // SC_WRAPVISUALFLAGLOC_END_BY_TEXT
+	2562, // SC_WRAPVISUALFLAG_END
+	2569, // SC_WRAP_WORD
+	2579, // UNDO_MAY_COALESCE
+	2580, // VISIBLE_SLOP
+	0, // ANNOTATION_BOXED
+	4, // CARETSTYLE_BLOCK
+	11, // EDGE_BACKGROUND
+	189, // INDIC_TT
+	226, // SCE_4GL_WORD
+	241, // SCE_A68K_NUMBER_DEC
+	250, // SCE_ABAQUS_COMMENTBLOCK
+	265, // SCE_ADA_IDENTIFIER
+	275, // SCE_APDL_COMMENTBLOCK
+	296, // SCE_ASM_NUMBER
+	305, // SCE_ASN1_IDENTIFIER
+	314, // SCE_ASY_COMMENTLINE
+	325, // SCE_AU3_COMMENTBLOCK
+	344, // SCE_AVE_NUMBER
+	357, // SCE_AVS_COMMENTBLOCKN
+	371, // SCE_BAAN_COMMENTDOC
+	388, // SCE_BAT_WORD
+	394, // SCE_BIBTEX_UNKNOWN_ENTRY
+	414, // SCE_B_NUMBER
+	433, // SCE_CAML_TAGNAME
+	437, // SCE_CLW_COMMENT
+	460, // SCE_CMAKE_STRINGDQ
+	473, // SCE_COFFEESCRIPT_COMMENTLINE
+	498, // SCE_CONF_NUMBER
+	512, // SCE_CSOUND_NUMBER
+	519, // SCE_CSS_CLASS
+	547, // SCE_C_COMMENTLINE
+	572, // SCE_DIFF_COMMAND
+	581, // SCE_DMAP_NUMBER
+	596, // SCE_DMIS_STRING
+	604, // SCE_D_COMMENTLINE
+	629, // SCE_ECL_COMMENTLINE
+	654, // SCE_EIFFEL_NUMBER
+	684, // SCE_ERLANG_VARIABLE
+	695, // SCE_ERR_GCC
+	711, // SCE_ESCRIPT_COMMENTLINE
+	721, // SCE_FORTH_COMMENT_ML
+	737, // SCE_FS_COMMENTLINE
+	769, // SCE_F_NUMBER
+	783, // SCE_GAP_KEYWORD
+	793, // SCE_GC_COMMENTBLOCK
+	813, // SCE_HA_KEYWORD
+	930, // SCE_H_TAGUNKNOWN
+	940, // SCE_INNO_KEYWORD
+	957, // SCE_KIX_STRING1
+	961, // SCE_KVIRC_COMMENTBLOCK
+	979, // SCE_LISP_NUMBER
+	986, // SCE_LOT_BREAK
+	995, // SCE_LOUT_NUMBER
+	1006, // SCE_LUA_COMMENTLINE
+	1034, // SCE_L_TAG
+	1051, // SCE_MAGIK_STRING
+	1059, // SCE_MAKE_PREPROCESSOR
+	1080, // SCE_MARKDOWN_STRONG1
+	1083, // SCE_MATLAB_COMMAND
+	1095, // SCE_METAPOST_GROUP
+	1103, // SCE_MMIXAL_LABEL
+	1123, // SCE_MODULA_DOXYCOMM
+	1144, // SCE_MSSQL_LINE_COMMENT
+	1153, // SCE_MYSQL_COMMENTLINE
+	1185, // SCE_NNCRONTAB_TASK
+	1198, // SCE_NSIS_STRINGDQ
+	1207, // SCE_OPAL_COMMENT_LINE
+	1215, // SCE_OSCRIPT_BLOCK_COMMENT
+	1236, // SCE_PAS_COMMENT
+	1256, // SCE_PLM_STRING
+	1261, // SCE_PL_COMMENTLINE
+	1304, // SCE_POV_COMMENTLINE
+	1321, // SCE_POWERPRO_COMMENTLINE
+	1350, // SCE_POWERSHELL_STRING
+	1361, // SCE_PO_MSGID
+	1374, // SCE_PROPS_SECTION
+	1379, // SCE_PS_DSC_COMMENT
+	1399, // SCE_P_NUMBER
+	1411, // SCE_RB_COMMENTLINE
+	1444, // SCE_REBOL_COMMENTBLOCK
+	1481, // SCE_REG_VALUENAME
+	1489, // SCE_RUST_COMMENTLINE
+	1513, // SCE_R_KWORD
+	1522, // SCE_SCRIPTOL_COMMENTLINE
+	1537, // SCE_SH_COMMENTLINE
+	1563, // SCE_SML_TAGNAME
+	1565, // SCE_SN_COMMENTLINE
+	1587, // SCE_SORCUS_PARAMETER
+	1594, // SCE_SPICE_KEYWORD
+	1604, // SCE_SQL_COMMENTLINE
+	1624, // SCE_STTXT_COMMENTLINE
+	1650, // SCE_ST_NUMBER
+	1672, // SCE_T3_PREPROCESSOR
+	1681, // SCE_TCL_COMMENTLINE
+	1711, // SCE_TCMD_WORD
+	1714, // SCE_TEX_GROUP
+	1741, // SCE_TXT2TAGS_STRONG1
+	1747, // SCE_VHDL_COMMENTLINEBANG
+	1772, // SCE_VISUALPROLOG_KEY_MINOR
+	1784, // SCE_V_COMMENTLINE
+	1801, // SCE_YAML_IDENTIFIER
+	1812, // SCFIND_WHOLEWORD
+	2318, // SCLEX_PYTHON
+	2348, // SCMOD_CTRL
+	2355, // SCVS_USERACCESSIBLE
+	2357, // SCWS_VISIBLEAFTERINDENT
+	2363, // SC_AUTOMATICFOLD_CLICK
+	2368, // SC_CACHE_PAGE
+	2371, // SC_CARETSTICKY_WHITESPACE
+	2374, // SC_CASE_LOWER
+	2394, // SC_CHARSET_SYMBOL
+	2399, // SC_CURSORARROW
+	2403, // SC_EFF_QUALITY_ANTIALIASED
+	2410, // SC_EOL_LF
+	2413, // SC_FOLDACTION_TOGGLE
+	2418, // SC_FOLDFLAG_LINEBEFORE_EXPANDED
+	2425, // SC_IDLESTYLING_AFTERVISIBLE
+	2432, // SC_IV_LOOKFORWARD
+	2440, // SC_MARGIN_BACK
+	2453, // SC_MARK_ARROW
+	2500, // SC_MOD_DELETETEXT
+	2511, // SC_ORDER_CUSTOM
+	2517, // SC_PHASES_MULTIPLE
+	2524, // SC_POSITIONCACHE_SEGMENTHITS
+	2526, // SC_PRINT_BLACKONWHITE
+	2531, // SC_SEL_LINES
+	2536, // SC_STATUS_BADALLOC
+	2544, // SC_TECHNOLOGY_DIRECTWRITERETAIN
+	2548, // SC_TYPE_STRING
+	2551, // SC_UPDATE_SELECTION
+	2557, // SC_WRAPINDENT_INDENT
+	2561, // SC_WRAPVISUALFLAGLOC_START_BY_TEXT
+	2565, // SC_WRAPVISUALFLAG_START
+	2566, // SC_WRAP_CHAR
+	2, // ANNOTATION_INDENTED
+	175, // INDIC_DIAGONAL
+	224, // SCE_4GL_STRING
+	240, // SCE_A68K_NUMBER_BIN
+	253, // SCE_ABAQUS_NUMBER
+	268, // SCE_ADA_NUMBER
+	278, // SCE_APDL_NUMBER
+	299, // SCE_ASM_STRING
+	310, // SCE_ASN1_STRING
+	318, // SCE_ASY_NUMBER
+	332, // SCE_AU3_NUMBER
+	348, // SCE_AVE_WORD
+	358, // SCE_AVS_COMMENTLINE
+	374, // SCE_BAAN_NUMBER
+	386, // SCE_BAT_LABEL
+	392, // SCE_BIBTEX_KEY
+	409, // SCE_B_KEYWORD
+	426, // SCE_CAML_KEYWORD
+	449, // SCE_CLW_STRING
+	461, // SCE_CMAKE_STRINGLQ
+	470, // SCE_COFFEESCRIPT_COMMENTDOC
+	496, // SCE_CONF_IDENTIFIER
+	514, // SCE_CSOUND_OPERATOR
+	534, // SCE_CSS_PSEUDOCLASS
+	544, // SCE_C_COMMENTDOC
+	576, // SCE_DIFF_HEADER
+	583, // SCE_DMAP_STRING1
+	595, // SCE_DMIS_NUMBER
+	601, // SCE_D_COMMENTDOC
+	635, // SCE_ECL_NUMBER
+	658, // SCE_EIFFEL_WORD
+	677, // SCE_ERLANG_NUMBER
+	701, // SCE_ERR_MS
+	710, // SCE_ESCRIPT_COMMENTDOC
+	725, // SCE_FORTH_IDENTIFIER
+	733, // SCE_FS_COMMENTDOC
+	773, // SCE_F_STRING1
+	784, // SCE_GAP_KEYWORD2
+	798, // SCE_GC_GLOBAL
+	817, // SCE_HA_NUMBER
+	905, // SCE_H_ATTRIBUTE
+	943, // SCE_INNO_PARAMETER
+	958, // SCE_KIX_STRING2
+	968, // SCE_KVIRC_STRING
+	976, // SCE_LISP_KEYWORD
+	991, // SCE_LOT_SET
+	999, // SCE_LOUT_WORD
+	1005, // SCE_LUA_COMMENTDOC
+	1030, // SCE_L_MATH
+	1039, // SCE_MAGIK_CHARACTER
+	1056, // SCE_MAKE_IDENTIFIER
+	1081, // SCE_MARKDOWN_STRONG2
+	1089, // SCE_MATLAB_NUMBER
+	1097, // SCE_METAPOST_SYMBOL
+	1106, // SCE_MMIXAL_OPCODE
+	1124, // SCE_MODULA_DOXYKEY
+	1145, // SCE_MSSQL_NUMBER
+	1174, // SCE_MYSQL_VARIABLE
+	1183, // SCE_NNCRONTAB_SECTION
+	1199, // SCE_NSIS_STRINGLQ
+	1209, // SCE_OPAL_INTEGER
+	1218, // SCE_OSCRIPT_DOC_COMMENT
+	1237, // SCE_PAS_COMMENT2
+	1254, // SCE_PLM_NUMBER
+	1278, // SCE_PL_POD
+	1308, // SCE_POV_NUMBER
+	1327, // SCE_POWERPRO_NUMBER
+	1337, // SCE_POWERSHELL_CHARACTER
+	1362, // SCE_PO_MSGID_TEXT
+	1369, // SCE_PROPS_ASSIGNMENT
+	1380, // SCE_PS_DSC_VALUE
+	1401, // SCE_P_STRING
+	1426, // SCE_RB_POD
+	1456, // SCE_REBOL_PREFACE
+	1479, // SCE_REG_STRING
+	1488, // SCE_RUST_COMMENTBLOCKDOC
+	1507, // SCE_R_BASEKWORD
+	1529, // SCE_SCRIPTOL_PERSISTENT
+	1543, // SCE_SH_NUMBER
+	1556, // SCE_SML_KEYWORD
+	1566, // SCE_SN_COMMENTLINEBANG
+	1581, // SCE_SORCUS_COMMENTLINE
+	1595, // SCE_SPICE_KEYWORD2
+	1601, // SCE_SQL_COMMENTDOC
+	1631, // SCE_STTXT_KEYWORD
+	1645, // SCE_ST_COMMENT
+	1658, // SCE_T3_BLOCK_COMMENT
+	1688, // SCE_TCL_NUMBER
+	1709, // SCE_TCMD_LABEL
+	1716, // SCE_TEX_SYMBOL
+	1742, // SCE_TXT2TAGS_STRONG2
+	1751, // SCE_VHDL_NUMBER
+	1770, // SCE_VISUALPROLOG_KEY_DIRECTIVE
+	1785, // SCE_V_COMMENTLINEBANG
+	1802, // SCE_YAML_KEYWORD
+	2257, // SCLEX_CPP
+	2366, // SC_CACHE_DOCUMENT
+	2405, // SC_EFF_QUALITY_LCD_OPTIMIZED
+	2426, // SC_IDLESTYLING_ALL
+	2431, // SC_IV_LOOKBOTH
+	2441, // SC_MARGIN_FORE
+	2481, // SC_MARK_SMALLRECT
+	2525, // SC_POSITIONCACHE_SEGMENTMISSES
+	2527, // SC_PRINT_COLOURONWHITE
+	2534, // SC_SEL_THIN
+	2543, // SC_TECHNOLOGY_DIRECTWRITEDC
+	2568, // SC_WRAP_WHITESPACE
+	10, // CARET_STRICT
+	188, // INDIC_STRIKE
+	198, // SCE_4GL_CHARACTER
+	242, // SCE_A68K_NUMBER_HEX
+	258, // SCE_ABAQUS_STRING
+	264, // SCE_ADA_DELIMITER
+	283, // SCE_APDL_STRING
+	297, // SCE_ASM_OPERATOR
+	307, // SCE_ASN1_OID
+	322, // SCE_ASY_WORD
+	329, // SCE_AU3_FUNCTION
+	364, // SCE_AVS_NUMBER
+	379, // SCE_BAAN_WORD
+	384, // SCE_BAT_HIDE
+	393, // SCE_BIBTEX_PARAMETER
+	417, // SCE_B_STRING
+	427, // SCE_CAML_KEYWORD2
+	451, // SCE_CLW_USER_IDENTIFIER
+	462, // SCE_CMAKE_STRINGRQ
+	478, // SCE_COFFEESCRIPT_NUMBER
+	495, // SCE_CONF_EXTENSION
+	509, // SCE_CSOUND_INSTR
+	539, // SCE_CSS_UNKNOWN_PSEUDOCLASS
+	554, // SCE_C_NUMBER
+	577, // SCE_DIFF_POSITION
+	584, // SCE_DMAP_STRING2
+	591, // SCE_DMIS_KEYWORD
+	606, // SCE_D_COMMENTNESTED
+	639, // SCE_ECL_STRING
+	656, // SCE_EIFFEL_STRING
+	670, // SCE_ERLANG_KEYWORD
+	687, // SCE_ERR_CMD
+	714, // SCE_ESCRIPT_NUMBER
+	722, // SCE_FORTH_CONTROL
+	738, // SCE_FS_COMMENTLINEDOC
+	774, // SCE_F_STRING2
+	785, // SCE_GAP_KEYWORD3
+	797, // SCE_GC_EVENT
+	822, // SCE_HA_STRING
+	906, // SCE_H_ATTRIBUTEUNKNOWN
+	945, // SCE_INNO_SECTION
+	955, // SCE_KIX_NUMBER
+	972, // SCE_KVIRC_WORD
+	977, // SCE_LISP_KEYWORD_KW
+	990, // SCE_LOT_PASS
+	1000, // SCE_LOUT_WORD2
+	1011, // SCE_LUA_NUMBER
+	1026, // SCE_L_COMMENT
+	1047, // SCE_MAGIK_NUMBER
+	1058, // SCE_MAKE_OPERATOR
+	1066, // SCE_MARKDOWN_EM1
+	1088, // SCE_MATLAB_KEYWORD
+	1092, // SCE_METAPOST_COMMAND
+	1108, // SCE_MMIXAL_OPCODE_PRE
+	1126, // SCE_MODULA_KEYWORD
+	1149, // SCE_MSSQL_STRING
+	1170, // SCE_MYSQL_SYSTEMVARIABLE
+	1180, // SCE_NNCRONTAB_KEYWORD
+	1200, // SCE_NSIS_STRINGRQ
+	1210, // SCE_OPAL_KEYWORD
+	1230, // SCE_OSCRIPT_PREPROCESSOR
+	1238, // SCE_PAS_COMMENTLINE
+	1252, // SCE_PLM_IDENTIFIER
+	1276, // SCE_PL_NUMBER
+	1309, // SCE_POV_OPERATOR
+	1332, // SCE_POWERPRO_WORD
+	1348, // SCE_POWERSHELL_NUMBER
+	1364, // SCE_PO_MSGSTR
+	1372, // SCE_PROPS_DEFVAL
+	1386, // SCE_PS_NUMBER
+	1391, // SCE_P_CHARACTER
+	1424, // SCE_RB_NUMBER
+	1454, // SCE_REBOL_OPERATOR
+	1475, // SCE_REG_HEXDIGIT
+	1490, // SCE_RUST_COMMENTLINEDOC
+	1516, // SCE_R_OTHERKWORD
+	1523, // SCE_SCRIPTOL_CSTYLE
+	1548, // SCE_SH_WORD
+	1557, // SCE_SML_KEYWORD2
+	1569, // SCE_SN_NUMBER
+	1588, // SCE_SORCUS_STRING
+	1596, // SCE_SPICE_KEYWORD3
+	1608, // SCE_SQL_NUMBER
+	1639, // SCE_STTXT_TYPE
+	1657, // SCE_ST_SYMBOL
+	1668, // SCE_T3_LINE_COMMENT
+	1700, // SCE_TCL_WORD_IN_QUOTE
+	1707, // SCE_TCMD_HIDE
+	1712, // SCE_TEX_COMMAND
+	1724, // SCE_TXT2TAGS_EM1
+	1757, // SCE_VHDL_STRING
+	1764, // SCE_VISUALPROLOG_COMMENT_BLOCK
+	1788, // SCE_V_NUMBER
+	1803, // SCE_YAML_NUMBER
+	1809, // SCFIND_MATCHCASE
+	2279, // SCLEX_HTML
+	2347, // SCMOD_ALT
+	2362, // SC_AUTOMATICFOLD_CHANGE
+	2402, // SC_CURSORWAIT
+	2417, // SC_FOLDFLAG_LINEBEFORE_CONTRACTED
+	2445, // SC_MARGIN_TEXT
+	2480, // SC_MARK_SHORTARROW
+	2487, // SC_MAX_MARGIN
+	2497, // SC_MOD_CHANGESTYLE
+	2522, // SC_POSITIONCACHE_SEGMENTBYTES
+	2528, // SC_PRINT_COLOURONWHITEDEFAULTBG
+	2552, // SC_UPDATE_V_SCROLL
+	2563, // SC_WRAPVISUALFLAG_MARGIN
+	2581, // VISIBLE_STRICT
+	178, // INDIC_HIDDEN
+	222, // SCE_4GL_PREPROCESSOR
+	245, // SCE_A68K_STRING1
+	254, // SCE_ABAQUS_OPERATOR
+	260, // SCE_ADA_CHARACTER
+	279, // SCE_APDL_OPERATOR
+	294, // SCE_ASM_IDENTIFIER
+	309, // SCE_ASN1_SCALAR
+	320, // SCE_ASY_STRING
+	330, // SCE_AU3_KEYWORD
+	365, // SCE_AVS_OPERATOR
+	377, // SCE_BAAN_STRING
+	381, // SCE_BAT_COMMAND
+	395, // SCE_BIBTEX_VALUE
+	416, // SCE_B_PREPROCESSOR
+	428, // SCE_CAML_KEYWORD3
+	442, // SCE_CLW_INTEGER_CONSTANT
+	452, // SCE_CMAKE_COMMANDS
+	490, // SCE_COFFEESCRIPT_WORD
+	500, // SCE_CONF_PARAMETER
+	508, // SCE_CSOUND_IDENTIFIER
+	533, // SCE_CSS_OPERATOR
+	568, // SCE_C_WORD
+	575, // SCE_DIFF_DELETED
+	585, // SCE_DMAP_STRINGEOL
+	593, // SCE_DMIS_MAJORWORD
+	609, // SCE_D_NUMBER
+	644, // SCE_ECL_WORD0
+	650, // SCE_EIFFEL_CHARACTER
+	682, // SCE_ERLANG_STRING
+	686, // SCE_ERR_BORLAND
+	717, // SCE_ESCRIPT_WORD
+	726, // SCE_FORTH_KEYWORD
+	734, // SCE_FS_COMMENTDOCKEYWORD
+	775, // SCE_F_STRINGEOL
+	786, // SCE_GAP_KEYWORD4
+	791, // SCE_GC_ATTRIBUTE
+	802, // SCE_HA_CHARACTER
+	912, // SCE_H_NUMBER
+	944, // SCE_INNO_PREPROC
+	959, // SCE_KIX_VAR
+	965, // SCE_KVIRC_KEYWORD
+	984, // SCE_LISP_SYMBOL
+	988, // SCE_LOT_FAIL
+	1001, // SCE_LOUT_WORD3
+	1016, // SCE_LUA_WORD
+	1035, // SCE_L_TAG2
+	1045, // SCE_MAGIK_IDENTIFIER
+	1060, // SCE_MAKE_TARGET
+	1067, // SCE_MARKDOWN_EM2
+	1091, // SCE_MATLAB_STRING
+	1098, // SCE_METAPOST_TEXT
+	1110, // SCE_MMIXAL_OPCODE_VALID
+	1132, // SCE_MODULA_RESERVED
+	1146, // SCE_MSSQL_OPERATOR
+	1161, // SCE_MYSQL_KNOWNSYSTEMVARIABLE
+	1181, // SCE_NNCRONTAB_MODIFIER
+	1189, // SCE_NSIS_FUNCTION
+	1212, // SCE_OPAL_SORT
+	1227, // SCE_OSCRIPT_NUMBER
+	1244, // SCE_PAS_PREPROCESSOR
+	1255, // SCE_PLM_OPERATOR
+	1300, // SCE_PL_WORD
+	1307, // SCE_POV_IDENTIFIER
+	1333, // SCE_POWERPRO_WORD2
+	1352, // SCE_POWERSHELL_VARIABLE
+	1365, // SCE_PO_MSGSTR_TEXT
+	1373, // SCE_PROPS_KEY
+	1385, // SCE_PS_NAME
+	1405, // SCE_P_WORD
+	1439, // SCE_RB_WORD
+	1443, // SCE_REBOL_CHARACTER
+	1482, // SCE_REG_VALUETYPE
+	1496, // SCE_RUST_NUMBER
+	1514, // SCE_R_NUMBER
+	1521, // SCE_SCRIPTOL_COMMENTBLOCK
+	1547, // SCE_SH_STRING
+	1558, // SCE_SML_KEYWORD3
+	1577, // SCE_SN_WORD
+	1589, // SCE_SORCUS_STRINGEOL
+	1597, // SCE_SPICE_NUMBER
+	1620, // SCE_SQL_WORD
+	1628, // SCE_STTXT_FUNCTION
+	1642, // SCE_ST_BINARY
+	1671, // SCE_T3_OPERATOR
+	1686, // SCE_TCL_IN_QUOTE
+	1702, // SCE_TCMD_COMMAND
+	1717, // SCE_TEX_TEXT
+	1725, // SCE_TXT2TAGS_EM2
+	1752, // SCE_VHDL_OPERATOR
+	1767, // SCE_VISUALPROLOG_COMMENT_LINE
+	1794, // SCE_V_WORD
+	1805, // SCE_YAML_REFERENCE
+	2345, // SCLEX_XML
+	2443, // SC_MARGIN_RTEXT
+	2470, // SC_MARK_EMPTY
+	2523, // SC_POSITIONCACHE_SEGMENTENTRIES
+	171, // INDIC_BOX
+	220, // SCE_4GL_OPERATOR
+	243, // SCE_A68K_OPERATOR
+	259, // SCE_ABAQUS_WORD
+	261, // SCE_ADA_CHARACTEREOL
+	284, // SCE_APDL_WORD
+	289, // SCE_ASM_CPUINSTRUCTION
+	306, // SCE_ASN1_KEYWORD
+	312, // SCE_ASY_CHARACTER
+	331, // SCE_AU3_MACRO
+	346, // SCE_AVE_STRING
+	362, // SCE_AVS_IDENTIFIER
+	376, // SCE_BAAN_PREPROCESSOR
+	385, // SCE_BAT_IDENTIFIER
+	389, // SCE_BIBTEX_COMMENT
+	415, // SCE_B_OPERATOR
+	429, // SCE_CAML_LINENUM
+	446, // SCE_CLW_REAL_CONSTANT
+	459, // SCE_CMAKE_PARAMETERS
+	482, // SCE_COFFEESCRIPT_STRING
+	501, // SCE_CONF_STRING
+	513, // SCE_CSOUND_OPCODE
+	528, // SCE_CSS_IDENTIFIER
+	560, // SCE_C_STRING
+	570, // SCE_DIFF_ADDED
+	582, // SCE_DMAP_OPERATOR
+	594, // SCE_DMIS_MINORWORD
+	616, // SCE_D_WORD
+	636, // SCE_ECL_OPERATOR
+	655, // SCE_EIFFEL_OPERATOR
+	678, // SCE_ERLANG_OPERATOR
+	703, // SCE_ERR_PERL
+	716, // SCE_ESCRIPT_STRING
+	724, // SCE_FORTH_DEFWORD
+	735, // SCE_FS_COMMENTDOCKEYWORDERROR
+	770, // SCE_F_OPERATOR
+	789, // SCE_GAP_STRING
+	795, // SCE_GC_CONTROL
+	803, // SCE_HA_CLASS
+	910, // SCE_H_DOUBLESTRING
+	939, // SCE_INNO_INLINE_EXPANSION
+	954, // SCE_KIX_MACRO
+	964, // SCE_KVIRC_FUNCTION_KEYWORD
+	982, // SCE_LISP_STRING
+	985, // SCE_LOT_ABORT
+	1002, // SCE_LOUT_WORD4
+	1014, // SCE_LUA_STRING
+	1031, // SCE_L_MATH2
+	1048, // SCE_MAGIK_OPERATOR
+	1068, // SCE_MARKDOWN_HEADER1
+	1090, // SCE_MATLAB_OPERATOR
+	1094, // SCE_METAPOST_EXTRA
+	1109, // SCE_MMIXAL_OPCODE_UNKNOWN
+	1127, // SCE_MODULA_NUMBER
+	1143, // SCE_MSSQL_IDENTIFIER
+	1163, // SCE_MYSQL_NUMBER
+	1175, // SCE_NNCRONTAB_ASTERISK
+	1204, // SCE_NSIS_VARIABLE
+	1214, // SCE_OPAL_STRING
+	1232, // SCE_OSCRIPT_SINGLEQUOTE_STRING
+	1245, // SCE_PAS_PREPROCESSOR2
+	1250, // SCE_PLM_CONTROL
+	1287, // SCE_PL_STRING
+	1310, // SCE_POV_STRING
+	1334, // SCE_POWERPRO_WORD3
+	1349, // SCE_POWERSHELL_OPERATOR
+	1358, // SCE_PO_MSGCTXT
+	1383, // SCE_PS_KEYWORD
+	1403, // SCE_P_TRIPLE
+	1431, // SCE_RB_STRING
+	1457, // SCE_REBOL_QUOTEDSTRING
+	1470, // SCE_REG_ADDEDKEY
+	1500, // SCE_RUST_WORD
+	1517, // SCE_R_STRING
+	1527, // SCE_SCRIPTOL_NUMBER
+	1536, // SCE_SH_CHARACTER
+	1559, // SCE_SML_LINENUM
+	1574, // SCE_SN_STRING
+	1584, // SCE_SORCUS_IDENTIFIER
+	1592, // SCE_SPICE_DELIMITER
+	1615, // SCE_SQL_STRING
+	1627, // SCE_STTXT_FB
+	1643, // SCE_ST_BOOL
+	1666, // SCE_T3_KEYWORD
+	1689, // SCE_TCL_OPERATOR
+	1708, // SCE_TCMD_IDENTIFIER
+	1726, // SCE_TXT2TAGS_HEADER1
+	1749, // SCE_VHDL_IDENTIFIER
+	1765, // SCE_VISUALPROLOG_COMMENT_KEY
+	1791, // SCE_V_STRING
+	1799, // SCE_YAML_DOCUMENT
+	2306, // SCLEX_PERL
+	2454, // SC_MARK_ARROWDOWN
+	183, // INDIC_ROUNDBOX
+	216, // SCE_4GL_IDENTIFIER
+	232, // SCE_A68K_CPUINSTRUCTION
+	255, // SCE_ABAQUS_PROCESSOR
+	269, // SCE_ADA_STRING
+	280, // SCE_APDL_PROCESSOR
+	295, // SCE_ASM_MATHINSTRUCTION
+	301, // SCE_ASN1_ATTRIBUTE
+	319, // SCE_ASY_OPERATOR
+	337, // SCE_AU3_STRING
+	342, // SCE_AVE_ENUM
+	367, // SCE_AVS_STRING
+	375, // SCE_BAAN_OPERATOR
+	387, // SCE_BAT_OPERATOR
+	408, // SCE_B_IDENTIFIER
+	431, // SCE_CAML_OPERATOR
+	445, // SCE_CLW_PICTURE_STRING
+	465, // SCE_CMAKE_VARIABLE
+	467, // SCE_COFFEESCRIPT_CHARACTER
+	499, // SCE_CONF_OPERATOR
+	507, // SCE_CSOUND_HEADERSTMT
+	538, // SCE_CSS_UNKNOWN_IDENTIFIER
+	542, // SCE_C_CHARACTER
+	571, // SCE_DIFF_CHANGED
+	580, // SCE_DMAP_IDENTIFIER
+	597, // SCE_DMIS_UNSUPPORTED_MAJOR
+	617, // SCE_D_WORD2
+	624, // SCE_ECL_CHARACTER
+	653, // SCE_EIFFEL_IDENTIFIER
+	659, // SCE_ERLANG_ATOM
+	702, // SCE_ERR_NET
+	715, // SCE_ESCRIPT_OPERATOR
+	729, // SCE_FORTH_PREWORD1
+	747, // SCE_FS_KEYWORD
+	767, // SCE_F_IDENTIFIER
+	779, // SCE_GAP_CHAR
+	792, // SCE_GC_COMMAND
+	816, // SCE_HA_MODULE
+	927, // SCE_H_SINGLESTRING
+	936, // SCE_INNO_COMMENT_PASCAL
+	953, // SCE_KIX_KEYWORD
+	963, // SCE_KVIRC_FUNCTION
+	997, // SCE_LOUT_STRING
+	1003, // SCE_LUA_CHARACTER
+	1027, // SCE_L_COMMENT2
+	1043, // SCE_MAGIK_FLOW
+	1069, // SCE_MARKDOWN_HEADER2
+	1087, // SCE_MATLAB_IDENTIFIER
+	1107, // SCE_MMIXAL_OPCODE_POST
+	1118, // SCE_MODULA_BASENUM
+	1151, // SCE_MSSQL_VARIABLE
+	1162, // SCE_MYSQL_MAJORKEYWORD
+	1182, // SCE_NNCRONTAB_NUMBER
+	1192, // SCE_NSIS_LABEL
+	1211, // SCE_OPAL_PAR
+	1219, // SCE_OSCRIPT_DOUBLEQUOTE_STRING
+	1242, // SCE_PAS_NUMBER
+	1253, // SCE_PLM_KEYWORD
+	1260, // SCE_PL_CHARACTER
+	1311, // SCE_POV_STRINGEOL
+	1335, // SCE_POWERPRO_WORD4
+	1346, // SCE_POWERSHELL_IDENTIFIER
+	1359, // SCE_PO_MSGCTXT_TEXT
+	1384, // SCE_PS_LITERAL
+	1404, // SCE_P_TRIPLEDOUBLE
+	1408, // SCE_RB_CHARACTER
+	1442, // SCE_REBOL_BRACEDSTRING
+	1473, // SCE_REG_DELETEDKEY
+	1501, // SCE_RUST_WORD2
+	1518, // SCE_R_STRING2
+	1531, // SCE_SCRIPTOL_STRING
+	1544, // SCE_SH_OPERATOR
+	1561, // SCE_SML_OPERATOR
+	1578, // SCE_SN_WORD2
+	1586, // SCE_SORCUS_OPERATOR
+	1598, // SCE_SPICE_VALUE
+	1599, // SCE_SQL_CHARACTER
+	1632, // SCE_STTXT_NUMBER
+	1652, // SCE_ST_SELF
+	1670, // SCE_T3_NUMBER
+	1685, // SCE_TCL_IDENTIFIER
+	1710, // SCE_TCMD_OPERATOR
+	1727, // SCE_TXT2TAGS_HEADER2
+	1758, // SCE_VHDL_STRINGEOL
+	1766, // SCE_VISUALPROLOG_COMMENT_KEY_ERROR
+	1795, // SCE_V_WORD2
+	1806, // SCE_YAML_TEXT
+	2217, // SCK_ESCAPE
+	2330, // SCLEX_SQL
+	2401, // SC_CURSORREVERSEARROW
+	2475, // SC_MARK_MINUS
+	7, // CARET_EVEN
+	173, // INDIC_CONTAINER
+	187, // INDIC_STRAIGHTBOX
+	191, // KEYWORDSET_MAX
+	196, // SCE_4GL_BLOCK
+	235, // SCE_A68K_EXTINSTRUCTION
+	248, // SCE_ABAQUS_COMMAND
+	270, // SCE_ADA_STRINGEOL
+	273, // SCE_APDL_COMMAND
+	298, // SCE_ASM_REGISTER
+	304, // SCE_ASN1_DESCRIPTOR
+	317, // SCE_ASY_IDENTIFIER
+	333, // SCE_AU3_OPERATOR
+	347, // SCE_AVE_STRINGEOL
+	368, // SCE_AVS_TRIPLESTRING
+	373, // SCE_BAAN_IDENTIFIER
+	401, // SCE_B_DATE
+	430, // SCE_CAML_NUMBER
+	443, // SCE_CLW_KEYWORD
+	464, // SCE_CMAKE_USERDEFINED
+	486, // SCE_COFFEESCRIPT_UUID
+	497, // SCE_CONF_IP
+	517, // SCE_CSOUND_USERKEYWORD
+	540, // SCE_CSS_VALUE
+	566, // SCE_C_UUID
+	586, // SCE_DMAP_WORD
+	598, // SCE_DMIS_UNSUPPORTED_MINOR
+	618, // SCE_D_WORD3
+	642, // SCE_ECL_UUID
+	657, // SCE_EIFFEL_STRINGEOL
+	669, // SCE_ERLANG_FUNCTION_NAME
+	700, // SCE_ERR_LUA
+	713, // SCE_ESCRIPT_IDENTIFIER
+	730, // SCE_FORTH_PREWORD2
+	748, // SCE_FS_KEYWORD2
+	776, // SCE_F_WORD
+	788, // SCE_GAP_OPERATOR
+	800, // SCE_GC_STRING
+	801, // SCE_HA_CAPITAL
+	913, // SCE_H_OTHER
+	941, // SCE_INNO_KEYWORD_PASCAL
+	951, // SCE_KIX_FUNCTIONS
+	971, // SCE_KVIRC_VARIABLE
+	983, // SCE_LISP_STRINGEOL
+	996, // SCE_LOUT_OPERATOR
+	1010, // SCE_LUA_LITERALSTRING
+	1036, // SCE_L_VERBATIM
+	1041, // SCE_MAGIK_CONTAINER
+	1070, // SCE_MARKDOWN_HEADER3
+	1086, // SCE_MATLAB_DOUBLEQUOTESTRING
+	1111, // SCE_MMIXAL_OPERANDS
+	1125, // SCE_MODULA_FLOAT
+	1135, // SCE_MSSQL_COLUMN_NAME
+	1160, // SCE_MYSQL_KEYWORD
+	1184, // SCE_NNCRONTAB_STRING
+	1203, // SCE_NSIS_USERDEFINED
+	1205, // SCE_OPAL_BOOL_CONST
+	1216, // SCE_OSCRIPT_CONSTANT
+	1240, // SCE_PAS_HEXNUMBER
+	1281, // SCE_PL_PUNCTUATION
+	1306, // SCE_POV_DIRECTIVE
+	1323, // SCE_POWERPRO_DOUBLEQUOTEDSTRING
+	1347, // SCE_POWERSHELL_KEYWORD
+	1357, // SCE_PO_FUZZY
+	1382, // SCE_PS_IMMEVAL
+	1392, // SCE_P_CLASSNAME
+	1409, // SCE_RB_CLASSNAME
+	1453, // SCE_REBOL_NUMBER
+	1474, // SCE_REG_ESCAPED
+	1502, // SCE_RUST_WORD3
+	1515, // SCE_R_OPERATOR
+	1519, // SCE_SCRIPTOL_CHARACTER
+	1542, // SCE_SH_IDENTIFIER
+	1560, // SCE_SML_NUMBER
+	1579, // SCE_SN_WORD3
+	1585, // SCE_SORCUS_NUMBER
+	1590, // SCE_SPICE_COMMENTLINE
+	1612, // SCE_SQL_SQLPLUS
+	1629, // SCE_STTXT_HEXNUMBER
+	1656, // SCE_ST_SUPER
+	1665, // SCE_T3_IDENTIFIER
+	1690, // SCE_TCL_SUBSTITUTION
+	1705, // SCE_TCMD_ENVIRONMENT
+	1728, // SCE_TXT2TAGS_HEADER3
+	1750, // SCE_VHDL_KEYWORD
+	1769, // SCE_VISUALPROLOG_IDENTIFIER
+	1796, // SCE_V_WORD3
+	1800, // SCE_YAML_ERROR
+	2212, // SCK_BACK
+	2339, // SCLEX_VB
+	2352, // SCMOD_SUPER
+	2416, // SC_FOLDFLAG_LINEAFTER_EXPANDED
+	2477, // SC_MARK_PLUS
+	2492, // SC_MOD_CHANGEFOLD
+	2550, // SC_UPDATE_H_SCROLL
+	174, // INDIC_DASH
+	214, // SCE_4GL_END
+	244, // SCE_A68K_REGISTER
+	256, // SCE_ABAQUS_SLASHCOMMAND
+	267, // SCE_ADA_LABEL
+	281, // SCE_APDL_SLASHCOMMAND
+	291, // SCE_ASM_DIRECTIVE
+	311, // SCE_ASN1_TYPE
+	321, // SCE_ASY_STRINGEOL
+	339, // SCE_AU3_VARIABLE
+	343, // SCE_AVE_IDENTIFIER
+	363, // SCE_AVS_KEYWORD
+	378, // SCE_BAAN_STRINGEOL
+	418, // SCE_B_STRINGEOL
+	419, // SCE_CAML_CHAR
+	438, // SCE_CLW_COMPILER_DIRECTIVE
+	466, // SCE_CMAKE_WHILEDEF
+	480, // SCE_COFFEESCRIPT_PREPROCESSOR
+	494, // SCE_CONF_DIRECTIVE
+	504, // SCE_CSOUND_COMMENTBLOCK
+	520, // SCE_CSS_COMMENT
+	556, // SCE_C_PREPROCESSOR
+	587, // SCE_DMAP_WORD2
+	592, // SCE_DMIS_LABEL
+	615, // SCE_D_TYPEDEF
+	637, // SCE_ECL_PREPROCESSOR
+	662, // SCE_ERLANG_CHARACTER
+	688, // SCE_ERR_CTAG
+	708, // SCE_ESCRIPT_BRACE
+	728, // SCE_FORTH_NUMBER
+	750, // SCE_FS_KEYWORD3
+	777, // SCE_F_WORD2
+	780, // SCE_GAP_COMMENT
+	799, // SCE_GC_OPERATOR
+	808, // SCE_HA_DATA
+	908, // SCE_H_COMMENT
+	942, // SCE_INNO_KEYWORD_USER
+	956, // SCE_KIX_OPERATOR
+	966, // SCE_KVIRC_NUMBER
+	975, // SCE_LISP_IDENTIFIER
+	994, // SCE_LOUT_IDENTIFIER
+	1013, // SCE_LUA_PREPROCESSOR
+	1032, // SCE_L_SHORTCMD
+	1038, // SCE_MAGIK_BRACKET_BLOCK
+	1057, // SCE_MAKE_IDEOL
+	1071, // SCE_MARKDOWN_HEADER4
+	1105, // SCE_MMIXAL_NUMBER
+	1133, // SCE_MODULA_STRING
+	1147, // SCE_MSSQL_STATEMENT
+	1154, // SCE_MYSQL_DATABASEOBJECT
+	1178, // SCE_NNCRONTAB_ENVIRONMENT
+	1196, // SCE_NSIS_SECTIONDEF
+	1222, // SCE_OSCRIPT_IDENTIFIER
+	1248, // SCE_PAS_WORD
+	1280, // SCE_PL_PREPROCESSOR
+	1302, // SCE_POV_BADDIRECTIVE
+	1329, // SCE_POWERPRO_SINGLEQUOTEDSTRING
+	1338, // SCE_POWERSHELL_CMDLET
+	1367, // SCE_PO_PROGRAMMER_COMMENT
+	1387, // SCE_PS_PAREN_ARRAY
+	1397, // SCE_P_DEFNAME
+	1414, // SCE_RB_DEFNAME
+	1455, // SCE_REBOL_PAIR
+	1476, // SCE_REG_KEYPATH_GUID
+	1503, // SCE_RUST_WORD4
+	1510, // SCE_R_IDENTIFIER
+	1532, // SCE_SCRIPTOL_STRINGEOL
+	1546, // SCE_SH_SCALAR
+	1549, // SCE_SML_CHAR
+	1571, // SCE_SN_PREPROCESSOR
+	1582, // SCE_SORCUS_CONSTANT
+	1614, // SCE_SQL_SQLPLUS_PROMPT
+	1634, // SCE_STTXT_PRAGMA
+	1649, // SCE_ST_NIL
+	1673, // SCE_T3_S_STRING
+	1691, // SCE_TCL_SUB_BRACE
+	1706, // SCE_TCMD_EXPANSION
+	1729, // SCE_TXT2TAGS_HEADER4
+	1754, // SCE_VHDL_STDOPERATOR
+	1782, // SCE_VISUALPROLOG_VARIABLE
+	1790, // SCE_V_PREPROCESSOR
+	1804, // SCE_YAML_OPERATOR
+	2228, // SCK_TAB
+	2315, // SCLEX_PROPERTIES
+	2485, // SC_MARK_VLINE
+	177, // INDIC_DOTS
+	200, // SCE_4GL_COMMENT1
+	234, // SCE_A68K_DIRECTIVE
+	257, // SCE_ABAQUS_STARCOMMAND
+	262, // SCE_ADA_COMMENTLINE
+	282, // SCE_APDL_STARCOMMAND
+	292, // SCE_ASM_DIRECTIVEOPERAND
+	308, // SCE_ASN1_OPERATOR
+	315, // SCE_ASY_COMMENTLINEDOC
+	335, // SCE_AU3_SENT
+	345, // SCE_AVE_OPERATOR
+	360, // SCE_AVS_FILTER
+	380, // SCE_BAAN_WORD2
+	410, // SCE_B_KEYWORD2
+	434, // SCE_CAML_WHITE
+	447, // SCE_CLW_RUNTIME_EXPRESSIONS
+	455, // SCE_CMAKE_FOREACHDEF
+	479, // SCE_COFFEESCRIPT_OPERATOR
+	515, // SCE_CSOUND_PARAM
+	527, // SCE_CSS_ID
+	555, // SCE_C_OPERATOR
+	588, // SCE_DMAP_WORD3
+	611, // SCE_D_STRING
+	641, // SCE_ECL_UNKNOWN
+	671, // SCE_ERLANG_MACRO
+	691, // SCE_ERR_DIFF_CHANGED
+	718, // SCE_ESCRIPT_WORD2
+	731, // SCE_FORTH_STRING
+	751, // SCE_FS_KEYWORD4
+	778, // SCE_F_WORD3
+	787, // SCE_GAP_NUMBER
+	811, // SCE_HA_IMPORT
+	911, // SCE_H_ENTITY
+	946, // SCE_INNO_STRING_DOUBLE
+	949, // SCE_KIX_COMMENTSTREAM
+	967, // SCE_KVIRC_OPERATOR
+	980, // SCE_LISP_OPERATOR
+	998, // SCE_LOUT_STRINGEOL
+	1012, // SCE_LUA_OPERATOR
+	1033, // SCE_L_SPECIAL
+	1037, // SCE_MAGIK_BRACE_BLOCK
+	1072, // SCE_MARKDOWN_HEADER5
+	1113, // SCE_MMIXAL_REF
+	1134, // SCE_MODULA_STRSPEC
+	1138, // SCE_MSSQL_DATATYPE
+	1166, // SCE_MYSQL_PROCEDUREKEYWORD
+	1179, // SCE_NNCRONTAB_IDENTIFIER
+	1202, // SCE_NSIS_SUBSECTIONDEF
+	1221, // SCE_OSCRIPT_GLOBAL
+	1246, // SCE_PAS_STRING
+	1277, // SCE_PL_OPERATOR
+	1312, // SCE_POV_WORD2
+	1326, // SCE_POWERPRO_LINECONTINUE
+	1336, // SCE_POWERSHELL_ALIAS
+	1368, // SCE_PO_REFERENCE
+	1388, // SCE_PS_PAREN_DICT
+	1400, // SCE_P_OPERATOR
+	1425, // SCE_RB_OPERATOR
+	1460, // SCE_REBOL_TUPLE
+	1480, // SCE_REG_STRING_GUID
+	1504, // SCE_RUST_WORD5
+	1511, // SCE_R_INFIX
+	1526, // SCE_SCRIPTOL_KEYWORD
+	1545, // SCE_SH_PARAM
+	1570, // SCE_SN_OPERATOR
+	1609, // SCE_SQL_OPERATOR
+	1633, // SCE_STTXT_OPERATOR
+	1647, // SCE_ST_GLOBAL
+	1661, // SCE_T3_D_STRING
+	1687, // SCE_TCL_MODIFIER
+	1701, // SCE_TCMD_CLABEL
+	1730, // SCE_TXT2TAGS_HEADER5
+	1744, // SCE_VHDL_ATTRIBUTE
+	1760, // SCE_VISUALPROLOG_ANONYMOUS
+	1789, // SCE_V_OPERATOR
+	2269, // SCLEX_ERRORLIST
+	2472, // SC_MARK_LCORNER
+	185, // INDIC_SQUIGGLELOW
+	202, // SCE_4GL_COMMENT2
+	238, // SCE_A68K_MACRO_ARG
+	247, // SCE_ABAQUS_ARGUMENT
+	266, // SCE_ADA_ILLEGAL
+	272, // SCE_APDL_ARGUMENT
+	287, // SCE_ASM_COMMENTBLOCK
+	323, // SCE_ASY_WORD2
+	334, // SCE_AU3_PREPROCESSOR
+	349, // SCE_AVE_WORD1
+	366, // SCE_AVS_PLUGIN
+	411, // SCE_B_KEYWORD3
+	432, // SCE_CAML_STRING
+	436, // SCE_CLW_BUILTIN_PROCEDURES_FUNCTION
+	456, // SCE_CMAKE_IFDEFINEDEF
+	477, // SCE_COFFEESCRIPT_IDENTIFIER
+	502, // SCE_CSOUND_ARATE_VAR
+	531, // SCE_CSS_IMPORTANT
+	553, // SCE_C_IDENTIFIER
+	613, // SCE_D_STRINGEOL
+	633, // SCE_ECL_IDENTIFIER
+	680, // SCE_ERLANG_RECORD
+	690, // SCE_ERR_DIFF_ADDITION
+	719, // SCE_ESCRIPT_WORD3
+	727, // SCE_FORTH_LOCALE
+	753, // SCE_FS_NUMBER
+	772, // SCE_F_PREPROCESSOR
+	790, // SCE_GAP_STRINGEOL
+	818, // SCE_HA_OPERATOR
+	929, // SCE_H_TAGEND
+	947, // SCE_INNO_STRING_SINGLE
+	969, // SCE_KVIRC_STRING_FUNCTION
+	981, // SCE_LISP_SPECIAL
+	1008, // SCE_LUA_IDENTIFIER
+	1024, // SCE_L_CMDOPT
+	1050, // SCE_MAGIK_SQBRACKET_BLOCK
+	1073, // SCE_MARKDOWN_HEADER6
+	1099, // SCE_MMIXAL_CHAR
+	1119, // SCE_MODULA_CHAR
+	1150, // SCE_MSSQL_SYSTABLE
+	1169, // SCE_MYSQL_STRING
+	1191, // SCE_NSIS_IFDEFINEDEF
+	1223, // SCE_OSCRIPT_KEYWORD
+	1247, // SCE_PAS_STRINGEOL
+	1274, // SCE_PL_IDENTIFIER
+	1313, // SCE_POV_WORD3
+	1328, // SCE_POWERPRO_OPERATOR
+	1343, // SCE_POWERSHELL_FUNCTION
+	1356, // SCE_PO_FLAGS
+	1389, // SCE_PS_PAREN_PROC
+	1398, // SCE_P_IDENTIFIER
+	1421, // SCE_RB_IDENTIFIER
+	1441, // SCE_REBOL_BINARY
+	1478, // SCE_REG_PARAMETER
+	1505, // SCE_RUST_WORD6
+	1512, // SCE_R_INFIXEOL
+	1528, // SCE_SCRIPTOL_OPERATOR
+	1535, // SCE_SH_BACKTICKS
+	1562, // SCE_SML_STRING
+	1568, // SCE_SN_IDENTIFIER
+	1607, // SCE_SQL_IDENTIFIER
+	1622, // SCE_STTXT_CHARACTER
+	1651, // SCE_ST_RETURN
+	1678, // SCE_T3_X_STRING
+	1684, // SCE_TCL_EXPAND
+	1731, // SCE_TXT2TAGS_HEADER6
+	1753, // SCE_VHDL_STDFUNCTION
+	1773, // SCE_VISUALPROLOG_NUMBER
+	1787, // SCE_V_IDENTIFIER
+	2290, // SCLEX_MAKEFILE
+	2482, // SC_MARK_TCORNER
+	176, // INDIC_DOTBOX
+	204, // SCE_4GL_COMMENT3
+	237, // SCE_A68K_LABEL
+	252, // SCE_ABAQUS_FUNCTION
+	277, // SCE_APDL_FUNCTION
+	285, // SCE_ASM_CHARACTER
+	336, // SCE_AU3_SPECIAL
+	350, // SCE_AVE_WORD2
+	361, // SCE_AVS_FUNCTION
+	412, // SCE_B_KEYWORD4
+	420, // SCE_CAML_COMMENT
+	450, // SCE_CLW_STRUCTURE_DATA_TYPE
+	457, // SCE_CMAKE_MACRODEF
+	483, // SCE_COFFEESCRIPT_STRINGEOL
+	511, // SCE_CSOUND_KRATE_VAR
+	522, // SCE_CSS_DIRECTIVE
+	561, // SCE_C_STRINGEOL
+	599, // SCE_D_CHARACTER
+	640, // SCE_ECL_STRINGEOL
+	679, // SCE_ERLANG_PREPROC
+	692, // SCE_ERR_DIFF_DELETION
+	759, // SCE_FS_STRING
+	771, // SCE_F_OPERATOR2
+	812, // SCE_HA_INSTANCE
+	934, // SCE_H_XMLSTART
+	938, // SCE_INNO_IDENTIFIER
+	970, // SCE_KVIRC_STRING_VARIABLE
+	978, // SCE_LISP_MULTI_COMMENT
+	1015, // SCE_LUA_STRINGEOL
+	1029, // SCE_L_ERROR
+	1053, // SCE_MAGIK_UNKNOWN_KEYWORD
+	1078, // SCE_MARKDOWN_PRECHAR
+	1115, // SCE_MMIXAL_STRING
+	1120, // SCE_MODULA_CHARSPEC
+	1142, // SCE_MSSQL_GLOBAL_VARIABLE
+	1168, // SCE_MYSQL_SQSTRING
+	1193, // SCE_NSIS_MACRODEF
+	1229, // SCE_OSCRIPT_OPERATOR
+	1235, // SCE_PAS_CHARACTER
+	1286, // SCE_PL_SCALAR
+	1314, // SCE_POV_WORD4
+	1325, // SCE_POWERPRO_IDENTIFIER
+	1351, // SCE_POWERSHELL_USER1
+	1363, // SCE_PO_MSGID_TEXT_EOL
+	1390, // SCE_PS_TEXT
+	1393, // SCE_P_COMMENTBLOCK
+	1427, // SCE_RB_REGEX
+	1452, // SCE_REBOL_MONEY
+	1477, // SCE_REG_OPERATOR
+	1506, // SCE_RUST_WORD7
+	1525, // SCE_SCRIPTOL_IDENTIFIER
+	1540, // SCE_SH_HERE_DELIM
+	1550, // SCE_SML_COMMENT
+	1575, // SCE_SN_STRINGEOL
+	1636, // SCE_STTXT_STRING1
+	1653, // SCE_ST_SPECIAL
+	1667, // SCE_T3_LIB_DIRECTIVE
+	1692, // SCE_TCL_WORD
+	1738, // SCE_TXT2TAGS_PRECHAR
+	1755, // SCE_VHDL_STDPACKAGE
+	1774, // SCE_VISUALPROLOG_OPERATOR
+	1792, // SCE_V_STRINGEOL
+	2245, // SCLEX_BATCH
+	2461, // SC_MARK_BOXPLUS
+	186, // INDIC_SQUIGGLEPIXMAP
+	206, // SCE_4GL_COMMENT4
+	246, // SCE_A68K_STRING2
+	300, // SCE_ASM_STRINGEOL
+	328, // SCE_AU3_EXPAND
+	351, // SCE_AVE_WORD3
+	355, // SCE_AVS_CLIPPROP
+	400, // SCE_B_CONSTANT
+	421, // SCE_CAML_COMMENT1
+	435, // SCE_CLW_ATTRIBUTE
+	463, // SCE_CMAKE_STRINGVAR
+	487, // SCE_COFFEESCRIPT_VERBATIM
+	510, // SCE_CSOUND_IRATE_VAR
+	523, // SCE_CSS_DOUBLESTRING
+	567, // SCE_C_VERBATIM
+	610, // SCE_D_OPERATOR
+	643, // SCE_ECL_VERBATIM
+	675, // SCE_ERLANG_NODE_NAME
+	693, // SCE_ERR_DIFF_MESSAGE
+	757, // SCE_FS_PREPROCESSOR
+	768, // SCE_F_LABEL
+	807, // SCE_HA_COMMENTLINE
+	933, // SCE_H_XMLEND
+	1017, // SCE_LUA_WORD2
+	1046, // SCE_MAGIK_KEYWORD
+	1082, // SCE_MARKDOWN_ULIST_ITEM
+	1114, // SCE_MMIXAL_REGISTER
+	1131, // SCE_MODULA_PROC
+	1141, // SCE_MSSQL_FUNCTION
+	1156, // SCE_MYSQL_DQSTRING
+	1201, // SCE_NSIS_STRINGVAR
+	1224, // SCE_OSCRIPT_LABEL
+	1243, // SCE_PAS_OPERATOR
+	1257, // SCE_PL_ARRAY
+	1315, // SCE_POV_WORD5
+	1330, // SCE_POWERPRO_STRINGEOL
+	1341, // SCE_POWERSHELL_COMMENTSTREAM
+	1366, // SCE_PO_MSGSTR_TEXT_EOL
+	1381, // SCE_PS_HEXSTRING
+	1402, // SCE_P_STRINGEOL
+	1416, // SCE_RB_GLOBAL
+	1451, // SCE_REBOL_ISSUE
+	1498, // SCE_RUST_STRING
+	1533, // SCE_SCRIPTOL_TRIPLE
+	1541, // SCE_SH_HERE_Q
+	1551, // SCE_SML_COMMENT1
+	1572, // SCE_SN_REGEXTAG
+	1613, // SCE_SQL_SQLPLUS_COMMENT
+	1637, // SCE_STTXT_STRING2
+	1648, // SCE_ST_KWSEND
+	1669, // SCE_T3_MSG_PARAM
+	1693, // SCE_TCL_WORD2
+	1743, // SCE_TXT2TAGS_ULIST_ITEM
+	1756, // SCE_VHDL_STDTYPE
+	1761, // SCE_VISUALPROLOG_CHARACTER
+	2224, // SCK_RETURN
+	2344, // SCLEX_XCODE
+	2462, // SC_MARK_BOXPLUSCONNECTED
+	172, // INDIC_COMPOSITIONTHICK
+	208, // SCE_4GL_COMMENT5
+	236, // SCE_A68K_IDENTIFIER
+	293, // SCE_ASM_EXTINSTRUCTION
+	326, // SCE_AU3_COMOBJ
+	352, // SCE_AVE_WORD4
+	369, // SCE_AVS_USERDFN
+	396, // SCE_B_ASM
+	422, // SCE_CAML_COMMENT2
+	448, // SCE_CLW_STANDARD_EQUATE
+	458, // SCE_CMAKE_NUMBER
+	481, // SCE_COFFEESCRIPT_REGEX
+	506, // SCE_CSOUND_GLOBAL_VAR
+	536, // SCE_CSS_SINGLESTRING
+	559, // SCE_C_REGEX
+	608, // SCE_D_IDENTIFIER
+	638, // SCE_ECL_REGEX
+	666, // SCE_ERLANG_COMMENT_FUNCTION
+	704, // SCE_ERR_PHP
+	755, // SCE_FS_OPERATOR
+	765, // SCE_F_CONTINUATION
+	804, // SCE_HA_COMMENTBLOCK
+	915, // SCE_H_SCRIPT
+	1018, // SCE_LUA_WORD3
+	1049, // SCE_MAGIK_PRAGMA
+	1077, // SCE_MARKDOWN_OLIST_ITEM
+	1101, // SCE_MMIXAL_HEX
+	1129, // SCE_MODULA_PRAGMA
+	1148, // SCE_MSSQL_STORED_PROCEDURE
+	1164, // SCE_MYSQL_OPERATOR
+	1194, // SCE_NSIS_NUMBER
+	1233, // SCE_OSCRIPT_TYPE
+	1234, // SCE_PAS_ASM
+	1267, // SCE_PL_HASH
+	1316, // SCE_POV_WORD6
+	1331, // SCE_POWERPRO_VERBATIM
+	1345, // SCE_POWERSHELL_HERE_STRING
+	1360, // SCE_PO_MSGCTXT_TEXT_EOL
+	1376, // SCE_PS_BASE85STRING
+	1406, // SCE_P_WORD2
+	1437, // SCE_RB_SYMBOL
+	1458, // SCE_REBOL_TAG
+	1499, // SCE_RUST_STRINGR
+	1520, // SCE_SCRIPTOL_CLASSNAME
+	1552, // SCE_SML_COMMENT2
+	1573, // SCE_SN_SIGNAL
+	1638, // SCE_STTXT_STRINGEOL
+	1641, // SCE_ST_ASSIGN
+	1664, // SCE_T3_HTML_TAG
+	1694, // SCE_TCL_WORD3
+	1735, // SCE_TXT2TAGS_OLIST_ITEM
+	1759, // SCE_VHDL_USERWORD
+	1763, // SCE_VISUALPROLOG_CHARACTER_TOO_MANY
+	2283, // SCLEX_LATEX
+	2459, // SC_MARK_BOXMINUS
+	210, // SCE_4GL_COMMENT6
+	239, // SCE_A68K_MACRO_DECLARATION
+	288, // SCE_ASM_COMMENTDIRECTIVE
+	338, // SCE_AU3_UDF
+	353, // SCE_AVE_WORD5
+	413, // SCE_B_LABEL
+	423, // SCE_CAML_COMMENT3
+	441, // SCE_CLW_ERROR
+	474, // SCE_COFFEESCRIPT_COMMENTLINEDOC
+	516, // SCE_CSOUND_STRINGEOL
+	529, // SCE_CSS_IDENTIFIER2
+	548, // SCE_C_COMMENTLINEDOC
+	605, // SCE_D_COMMENTLINEDOC
+	630, // SCE_ECL_COMMENTLINEDOC
+	667, // SCE_ERLANG_COMMENT_MODULE
+	694, // SCE_ERR_ELF
+	745, // SCE_FS_IDENTIFIER
+	805, // SCE_HA_COMMENTBLOCK2
+	903, // SCE_H_ASP
+	1019, // SCE_LUA_WORD4
+	1052, // SCE_MAGIK_SYMBOL
+	1061, // SCE_MARKDOWN_BLOCKQUOTE
+	1112, // SCE_MMIXAL_OPERATOR
+	1130, // SCE_MODULA_PRGKEY
+	1140, // SCE_MSSQL_DEFAULT_PREF_DATATYPE
+	1157, // SCE_MYSQL_FUNCTION
+	1197, // SCE_NSIS_SECTIONGROUP
+	1220, // SCE_OSCRIPT_FUNCTION
+	1298, // SCE_PL_SYMBOLTABLE
+	1317, // SCE_POV_WORD7
+	1319, // SCE_POWERPRO_ALTQUOTE
+	1344, // SCE_POWERSHELL_HERE_CHARACTER
+	1355, // SCE_PO_ERROR
+	1375, // SCE_PS_BADSTRINGCHAR
+	1395, // SCE_P_DECORATOR
+	1423, // SCE_RB_MODULE_NAME
+	1449, // SCE_REBOL_FILE
+	1486, // SCE_RUST_CHARACTER
+	1530, // SCE_SCRIPTOL_PREPROCESSOR
+	1553, // SCE_SML_COMMENT3
+	1605, // SCE_SQL_COMMENTLINEDOC
+	1630, // SCE_STTXT_IDENTIFIER
+	1644, // SCE_ST_CHARACTER
+	1662, // SCE_T3_HTML_DEFAULT
+	1695, // SCE_TCL_WORD4
+	1718, // SCE_TXT2TAGS_BLOCKQUOTE
+	1745, // SCE_VHDL_BLOCK_COMMENT
+	1762, // SCE_VISUALPROLOG_CHARACTER_ESCAPE_ERROR
+	2288, // SCLEX_LUA
+	2406, // SC_EFF_QUALITY_MASK
+	2460, // SC_MARK_BOXMINUSCONNECTED
+	8, // CARET_JUMPS
+	213, // SCE_4GL_DEFAULT_
+	231, // SCE_A68K_COMMENT_WORD
+	354, // SCE_AVE_WORD6
+	406, // SCE_B_ERROR
+	440, // SCE_CLW_DEPRECATED
+	491, // SCE_COFFEESCRIPT_WORD2
+	518, // SCE_CSS_ATTRIBUTE
+	569, // SCE_C_WORD2
+	602, // SCE_D_COMMENTDOCKEYWORD
+	645, // SCE_ECL_WORD1
+	664, // SCE_ERLANG_COMMENT_DOC
+	697, // SCE_ERR_IFC
+	741, // SCE_FS_DATE
+	806, // SCE_HA_COMMENTBLOCK3
+	904, // SCE_H_ASPAT
+	1020, // SCE_LUA_WORD5
+	1044, // SCE_MAGIK_HYPER_COMMENT
+	1079, // SCE_MARKDOWN_STRIKEOUT
+	1116, // SCE_MMIXAL_SYMBOL
+	1128, // SCE_MODULA_OPERATOR
+	1136, // SCE_MSSQL_COLUMN_NAME_2
+	1159, // SCE_MYSQL_IDENTIFIER
+	1195, // SCE_NSIS_PAGEEX
+	1228, // SCE_OSCRIPT_OBJECT
+	1299, // SCE_PL_VARIABLE_INDEXER
+	1318, // SCE_POV_WORD8
+	1324, // SCE_POWERPRO_FUNCTION
+	1340, // SCE_POWERSHELL_COMMENTDOCKEYWORD
+	1422, // SCE_RB_INSTANCE_VAR
+	1448, // SCE_REBOL_EMAIL
+	1497, // SCE_RUST_OPERATOR
+	1621, // SCE_SQL_WORD2
+	1625, // SCE_STTXT_DATETIME
+	1654, // SCE_ST_SPEC_SEL
+	1663, // SCE_T3_HTML_STRING
+	1696, // SCE_TCL_WORD5
+	1740, // SCE_TXT2TAGS_STRIKEOUT
+	1775, // SCE_VISUALPROLOG_STRING
+	2262, // SCLEX_DIFF
+	2349, // SCMOD_META
+	2415, // SC_FOLDFLAG_LINEAFTER_CONTRACTED
+	2473, // SC_MARK_LCORNERCURVE
+	2516, // SC_PERFORMED_USER
+	219, // SCE_4GL_NUMBER_
+	230, // SCE_A68K_COMMENT_SPECIAL
+	407, // SCE_B_HEXNUMBER
+	471, // SCE_COFFEESCRIPT_COMMENTDOCKEYWORD
+	530, // SCE_CSS_IDENTIFIER3
+	545, // SCE_C_COMMENTDOCKEYWORD
+	603, // SCE_D_COMMENTDOCKEYWORDERROR
+	627, // SCE_ECL_COMMENTDOCKEYWORD
+	665, // SCE_ERLANG_COMMENT_DOC_MACRO
+	698, // SCE_ERR_IFORT
+	760, // SCE_FS_STRINGEOL
+	819, // SCE_HA_PRAGMA
+	907, // SCE_H_CDATA
+	1021, // SCE_LUA_WORD6
+	1074, // SCE_MARKDOWN_HRULE
+	1102, // SCE_MMIXAL_INCLUDE
+	1117, // SCE_MODULA_BADSTR
+	1167, // SCE_MYSQL_QUOTEDIDENTIFIER
+	1190, // SCE_NSIS_FUNCTIONDEF
+	1231, // SCE_OSCRIPT_PROPERTY
+	1282, // SCE_PL_REGEX
+	1410, // SCE_RB_CLASS_VAR
+	1461, // SCE_REBOL_URL
+	1492, // SCE_RUST_IDENTIFIER
+	1602, // SCE_SQL_COMMENTDOCKEYWORD
+	1640, // SCE_STTXT_VARS
+	1674, // SCE_T3_USER1
+	1697, // SCE_TCL_WORD6
+	1732, // SCE_TXT2TAGS_HRULE
+	1777, // SCE_VISUALPROLOG_STRING_ESCAPE
+	2255, // SCLEX_CONF
+	2483, // SC_MARK_TCORNERCURVE
+	227, // SCE_4GL_WORD_
+	229, // SCE_A68K_COMMENT_DOXYGEN
+	397, // SCE_B_BINNUMBER
+	472, // SCE_COFFEESCRIPT_COMMENTDOCKEYWORDERROR
+	535, // SCE_CSS_PSEUDOELEMENT
+	546, // SCE_C_COMMENTDOCKEYWORDERROR
+	612, // SCE_D_STRINGB
+	628, // SCE_ECL_COMMENTDOCKEYWORDERROR
+	660, // SCE_ERLANG_ATOM_QUOTED
+	685, // SCE_ERR_ABSF
+	740, // SCE_FS_CONSTANT
+	820, // SCE_HA_PREPROCESSOR
+	914, // SCE_H_QUESTION
+	1022, // SCE_LUA_WORD7
+	1076, // SCE_MARKDOWN_LINK
+	1171, // SCE_MYSQL_USER1
+	1187, // SCE_NSIS_COMMENTBOX
+	1226, // SCE_OSCRIPT_METHOD
+	1284, // SCE_PL_REGSUBST
+	1407, // SCE_RB_BACKTICKS
+	1446, // SCE_REBOL_DATE
+	1494, // SCE_RUST_LIFETIME
+	1603, // SCE_SQL_COMMENTDOCKEYWORDERROR
+	1635, // SCE_STTXT_PRAGMAS
+	1675, // SCE_T3_USER2
+	1698, // SCE_TCL_WORD7
+	1734, // SCE_TXT2TAGS_LINK
+	1778, // SCE_VISUALPROLOG_STRING_ESCAPE_ERROR
+	2305, // SCLEX_PASCAL
+	2467, // SC_MARK_CIRCLEPLUS
+	225, // SCE_4GL_STRING_
+	399, // SCE_B_COMMENTBLOCK
+	476, // SCE_COFFEESCRIPT_GLOBALCLASS
+	524, // SCE_CSS_EXTENDED_IDENTIFIER
+	551, // SCE_C_GLOBALCLASS
+	614, // SCE_D_STRINGR
+	646, // SCE_ECL_WORD2
+	672, // SCE_ERLANG_MACRO_QUOTED
+	706, // SCE_ERR_TIDY
+	763, // SCE_FS_WORDOPERATOR
+	823, // SCE_HA_STRINGEOL
+	931, // SCE_H_VALUE
+	1023, // SCE_LUA_WORD8
+	1062, // SCE_MARKDOWN_CODE
+	1172, // SCE_MYSQL_USER2
+	1275, // SCE_PL_LONGQUOTE
+	1412, // SCE_RB_DATASECTION
+	1459, // SCE_REBOL_TIME
+	1495, // SCE_RUST_MACRO
+	1576, // SCE_SN_USER
+	1616, // SCE_SQL_USER1
+	1676, // SCE_T3_USER3
+	1699, // SCE_TCL_WORD8
+	1719, // SCE_TXT2TAGS_CODE
+	1776, // SCE_VISUALPROLOG_STRING_EOL_OPEN
+	1793, // SCE_V_USER
+	2241, // SCLEX_AVE
+	2468, // SC_MARK_CIRCLEPLUSCONNECTED
+	199, // SCE_4GL_CHARACTER_
+	405, // SCE_B_DOCLINE
+	484, // SCE_COFFEESCRIPT_STRINGRAW
+	525, // SCE_CSS_EXTENDED_PSEUDOCLASS
+	562, // SCE_C_STRINGRAW
+	619, // SCE_D_WORD5
+	647, // SCE_ECL_WORD3
+	681, // SCE_ERLANG_RECORD_QUOTED
+	699, // SCE_ERR_JAVA_STACK
+	744, // SCE_FS_DISABLEDCODE
+	821, // SCE_HA_RESERVED_OPERATOR
+	932, // SCE_H_XCCOMMENT
+	1009, // SCE_LUA_LABEL
+	1063, // SCE_MARKDOWN_CODE2
+	1173, // SCE_MYSQL_USER3
+	1258, // SCE_PL_BACKTICKS
+	1417, // SCE_RB_HERE_DELIM
+	1450, // SCE_REBOL_IDENTIFIER
+	1493, // SCE_RUST_LEXERROR
+	1617, // SCE_SQL_USER2
+	1659, // SCE_T3_BRACE
+	1682, // SCE_TCL_COMMENT_BOX
+	1720, // SCE_TXT2TAGS_CODE2
+	1779, // SCE_VISUALPROLOG_STRING_VERBATIM
+	2233, // SCLEX_ADA
+	2465, // SC_MARK_CIRCLEMINUS
+	223, // SCE_4GL_PREPROCESSOR_
+	403, // SCE_B_DOCBLOCK
+	485, // SCE_COFFEESCRIPT_TRIPLEVERBATIM
+	526, // SCE_CSS_EXTENDED_PSEUDOELEMENT
+	564, // SCE_C_TRIPLEVERBATIM
+	620, // SCE_D_WORD6
+	648, // SCE_ECL_WORD4
+	676, // SCE_ERLANG_NODE_NAME_QUOTED
+	707, // SCE_ERR_VALUE
+	743, // SCE_FS_DEFAULT_C
+	815, // SCE_HA_LITERATE_COMMENT
+	921, // SCE_H_SGML_DEFAULT
+	1064, // SCE_MARKDOWN_CODEBK
+	1158, // SCE_MYSQL_HIDDENCOMMAND
+	1262, // SCE_PL_DATASECTION
+	1418, // SCE_RB_HERE_Q
+	1462, // SCE_REBOL_WORD
+	1484, // SCE_RUST_BYTESTRING
+	1618, // SCE_SQL_USER3
+	1679, // SCE_TCL_BLOCK_COMMENT
+	1721, // SCE_TXT2TAGS_CODEBK
+	1781, // SCE_VISUALPROLOG_STRING_VERBATIM_SPECIAL
+	2284, // SCLEX_LISP
+	2466, // SC_MARK_CIRCLEMINUSCONNECTED
+	221, // SCE_4GL_OPERATOR_
+	404, // SCE_B_DOCKEYWORD
+	469, // SCE_COFFEESCRIPT_COMMENTBLOCK
+	532, // SCE_CSS_MEDIA
+	552, // SCE_C_HASHQUOTEDSTRING
+	621, // SCE_D_WORD7
+	649, // SCE_ECL_WORD5
+	661, // SCE_ERLANG_BIFS
+	696, // SCE_ERR_GCC_INCLUDED_FROM
+	736, // SCE_FS_COMMENTDOC_C
+	814, // SCE_HA_LITERATE_CODEDELIM
+	919, // SCE_H_SGML_COMMAND
+	1165, // SCE_MYSQL_PLACEHOLDER
+	1268, // SCE_PL_HERE_DELIM
+	1419, // SCE_RB_HERE_QQ
+	1463, // SCE_REBOL_WORD2
+	1485, // SCE_RUST_BYTESTRINGR
+	1619, // SCE_SQL_USER4
+	1722, // SCE_TXT2TAGS_COMMENT
+	1780, // SCE_VISUALPROLOG_STRING_VERBATIM_EOL
+	2322, // SCLEX_RUBY
+	2457, // SC_MARK_BACKGROUND
+	217, // SCE_4GL_IDENTIFIER_
+	488, // SCE_COFFEESCRIPT_VERBOSE_REGEX
+	541, // SCE_CSS_VARIABLE
+	557, // SCE_C_PREPROCESSORCOMMENT
+	626, // SCE_ECL_COMMENTDOC
+	673, // SCE_ERLANG_MODULES
+	739, // SCE_FS_COMMENTLINEDOC_C
+	916, // SCE_H_SGML_1ST_PARAM
+	1269, // SCE_PL_HERE_Q
+	1420, // SCE_RB_HERE_QX
+	1464, // SCE_REBOL_WORD3
+	1483, // SCE_RUST_BYTECHARACTER
+	1611, // SCE_SQL_QUOTEDIDENTIFIER
+	1736, // SCE_TXT2TAGS_OPTION
+	2266, // SCLEX_EIFFEL
+	2469, // SC_MARK_DOTDOTDOT
+	197, // SCE_4GL_BLOCK_
+	489, // SCE_COFFEESCRIPT_VERBOSE_REGEX_COMMENT
+	558, // SCE_C_PREPROCESSORCOMMENTDOC
+	622, // SCE_ECL_ADDED
+	674, // SCE_ERLANG_MODULES_ATT
+	752, // SCE_FS_KEYWORD_C
+	922, // SCE_H_SGML_DOUBLESTRING
+	1270, // SCE_PL_HERE_QQ
+	1432, // SCE_RB_STRING_Q
+	1465, // SCE_REBOL_WORD4
+	1610, // SCE_SQL_QOPERATOR
+	1739, // SCE_TXT2TAGS_PREPROC
+	2267, // SCLEX_EIFFELKW
+	2455, // SC_MARK_ARROWS
+	215, // SCE_4GL_END_
+	565, // SCE_C_USERLITERAL
+	632, // SCE_ECL_DELETED
+	749, // SCE_FS_KEYWORD2_C
+	925, // SCE_H_SGML_SIMPLESTRING
+	1272, // SCE_PL_HERE_QX
+	1433, // SCE_RB_STRING_QQ
+	1466, // SCE_REBOL_WORD5
+	1737, // SCE_TXT2TAGS_POSTPROC
+	2335, // SCLEX_TCL
+	2447, // SC_MARKNUM_FOLDEREND
+	2476, // SC_MARK_PIXMAP
+	201, // SCE_4GL_COMMENT1_
+	563, // SCE_C_TASKMARKER
+	623, // SCE_ECL_CHANGED
+	754, // SCE_FS_NUMBER_C
+	924, // SCE_H_SGML_ERROR
+	1288, // SCE_PL_STRING_Q
+	1436, // SCE_RB_STRING_QX
+	1467, // SCE_REBOL_WORD6
+	2299, // SCLEX_NNCRONTAB
+	2450, // SC_MARKNUM_FOLDEROPENMID
+	2471, // SC_MARK_FULLRECT
+	203, // SCE_4GL_COMMENT2_
+	550, // SCE_C_ESCAPESEQUENCE
+	634, // SCE_ECL_MOVED
+	762, // SCE_FS_STRING_C
+	926, // SCE_H_SGML_SPECIAL
+	1289, // SCE_PL_STRING_QQ
+	1434, // SCE_RB_STRING_QR
+	1468, // SCE_REBOL_WORD7
+	2248, // SCLEX_BULLANT
+	2448, // SC_MARKNUM_FOLDERMIDTAIL
+	2474, // SC_MARK_LEFTRECT
+	205, // SCE_4GL_COMMENT3_
+	758, // SCE_FS_PREPROCESSOR_C
+	923, // SCE_H_SGML_ENTITY
+	1294, // SCE_PL_STRING_QX
+	1435, // SCE_RB_STRING_QW
+	1469, // SCE_REBOL_WORD8
+	2340, // SCLEX_VBSCRIPT
+	2452, // SC_MARKNUM_FOLDERTAIL
+	2456, // SC_MARK_AVAILABLE
+	207, // SCE_4GL_COMMENT4_
+	756, // SCE_FS_OPERATOR_C
+	920, // SCE_H_SGML_COMMENT
+	1291, // SCE_PL_STRING_QR
+	1440, // SCE_RB_WORD_DEMOTED
+	2451, // SC_MARKNUM_FOLDERSUB
+	2484, // SC_MARK_UNDERLINE
+	209, // SCE_4GL_COMMENT5_
+	746, // SCE_FS_IDENTIFIER_C
+	917, // SCE_H_SGML_1ST_PARAM_COMMENT
+	1293, // SCE_PL_STRING_QW
+	1429, // SCE_RB_STDIN
+	2446, // SC_MARKNUM_FOLDER
+	2478, // SC_MARK_RGBAIMAGE
+	192, // MARKER_MAX
+	211, // SCE_4GL_COMMENT6_
+	683, // SCE_ERLANG_UNKNOWN
+	761, // SCE_FS_STRINGEOL_C
+	918, // SCE_H_SGML_BLOCK_DEFAULT
+	952, // SCE_KIX_IDENTIFIER
+	1279, // SCE_PL_POD_VERB
+	1430, // SCE_RB_STDOUT
+	2243, // SCLEX_BAAN
+	2449, // SC_MARKNUM_FOLDEROPEN
+	2458, // SC_MARK_BOOKMARK
+	167, // INDIC0_MASK
+	179, // INDIC_IME
+	1208, // SCE_OPAL_DEFAULT
+	2292, // SCLEX_MATLAB
+	2515, // SC_PERFORMED_UNDO
+	2574, // STYLE_DEFAULT
+	2324, // SCLEX_SCRIPTOL
+	2577, // STYLE_LINENUMBER
+	2236, // SCLEX_ASM
+	2571, // STYLE_BRACELIGHT
+	180, // INDIC_IME_MAX
+	181, // INDIC_MAX
+	2258, // SCLEX_CPPNOCASE
+	2570, // STYLE_BRACEBAD
+	2274, // SCLEX_FORTRAN
+	2573, // STYLE_CONTROLCHAR
+	2271, // SCLEX_F77
+	2575, // STYLE_INDENTGUIDE
+	2260, // SCLEX_CSS
+	2572, // STYLE_CALLTIP
+	2310, // SCLEX_POV
+	2576, // STYLE_LASTPREDEFINED
+	862, // SCE_HJ_START
+	1297, // SCE_PL_SUB_PROTOTYPE
+	1428, // SCE_RB_STDERR
+	2287, // SCLEX_LOUT
+	856, // SCE_HJ_DEFAULT
+	1266, // SCE_PL_FORMAT_IDENT
+	1438, // SCE_RB_UPPER_BOUND
+	2270, // SCLEX_ESCRIPT
+	853, // SCE_HJ_COMMENT
+	1265, // SCE_PL_FORMAT
+	2316, // SCLEX_PS
+	855, // SCE_HJ_COMMENTLINE
+	1296, // SCE_PL_STRING_VAR
+	2300, // SCLEX_NSIS
+	854, // SCE_HJ_COMMENTDOC
+	1301, // SCE_PL_XLAT
+	2294, // SCLEX_MMIXAL
+	859, // SCE_HJ_NUMBER
+	2250, // SCLEX_CLW
+	865, // SCE_HJ_WORD
+	2251, // SCLEX_CLWNOCASE
+	858, // SCE_HJ_KEYWORD
+	2286, // SCLEX_LOT
+	857, // SCE_HJ_DOUBLESTRING
+	2346, // SCLEX_YAML
+	861, // SCE_HJ_SINGLESTRING
+	2337, // SCLEX_TEX
+	864, // SCE_HJ_SYMBOLS
+	2293, // SCLEX_METAPOST
+	863, // SCE_HJ_STRINGEOL
+	2311, // SCLEX_POWERBASIC
+	860, // SCE_HJ_REGEX
+	2273, // SCLEX_FORTH
+	2268, // SCLEX_ERLANG
+	1283, // SCE_PL_REGEX_VAR
+	2302, // SCLEX_OCTAVE
+	849, // SCE_HJA_START
+	1285, // SCE_PL_REGSUBST_VAR
+	2296, // SCLEX_MSSQL
+	843, // SCE_HJA_DEFAULT
+	2341, // SCLEX_VERILOG
+	840, // SCE_HJA_COMMENT
+	1259, // SCE_PL_BACKTICKS_VAR
+	2281, // SCLEX_KIX
+	842, // SCE_HJA_COMMENTLINE
+	2277, // SCLEX_GUI4CLI
+	841, // SCE_HJA_COMMENTDOC
+	2328, // SCLEX_SPECMAN
+	846, // SCE_HJA_NUMBER
+	2239, // SCLEX_AU3
+	852, // SCE_HJA_WORD
+	1271, // SCE_PL_HERE_QQ_VAR
+	2234, // SCLEX_APDL
+	845, // SCE_HJA_KEYWORD
+	1273, // SCE_PL_HERE_QX_VAR
+	2244, // SCLEX_BASH
+	844, // SCE_HJA_DOUBLESTRING
+	2237, // SCLEX_ASN1
+	168, // INDIC1_MASK
+	848, // SCE_HJA_SINGLESTRING
+	1290, // SCE_PL_STRING_QQ_VAR
+	2342, // SCLEX_VHDL
+	2414, // SC_FOLDFLAG_LEVELNUMBERS
+	2514, // SC_PERFORMED_REDO
+	851, // SCE_HJA_SYMBOLS
+	1295, // SCE_PL_STRING_QX_VAR
+	2249, // SCLEX_CAML
+	850, // SCE_HJA_STRINGEOL
+	1292, // SCE_PL_STRING_QR_VAR
+	2247, // SCLEX_BLITZBASIC
+	847, // SCE_HJA_REGEX
+	2317, // SCLEX_PUREBASIC
+	2278, // SCLEX_HASKELL
+	2307, // SCLEX_PHPSCRIPT
+	836, // SCE_HB_START
+	2333, // SCLEX_TADS3
+	833, // SCE_HB_DEFAULT
+	2320, // SCLEX_REBOL
+	832, // SCE_HB_COMMENTLINE
+	2325, // SCLEX_SMALLTALK
+	835, // SCE_HB_NUMBER
+	2272, // SCLEX_FLAGSHIP
+	839, // SCE_HB_WORD
+	2259, // SCLEX_CSOUND
+	837, // SCE_HB_STRING
+	2275, // SCLEX_FREEBASIC
+	834, // SCE_HB_IDENTIFIER
+	2280, // SCLEX_INNOSETUP
+	838, // SCE_HB_STRINGEOL
+	2303, // SCLEX_OPAL
+	2390, // SC_CHARSET_MAC
+	2329, // SCLEX_SPICE
+	2261, // SCLEX_D
+	828, // SCE_HBA_START
+	2252, // SCLEX_CMAKE
+	825, // SCE_HBA_DEFAULT
+	2276, // SCLEX_GAP
+	824, // SCE_HBA_COMMENTLINE
+	2308, // SCLEX_PLM
+	827, // SCE_HBA_NUMBER
+	2314, // SCLEX_PROGRESS
+	831, // SCE_HBA_WORD
+	2232, // SCLEX_ABAQUS
+	829, // SCE_HBA_STRING
+	2238, // SCLEX_ASYMPTOTE
+	826, // SCE_HBA_IDENTIFIER
+	2319, // SCLEX_R
+	830, // SCE_HBA_STRINGEOL
+	2289, // SCLEX_MAGIK
+	2313, // SCLEX_POWERSHELL
+	2297, // SCLEX_MYSQL
+	898, // SCE_HP_START
+	2309, // SCLEX_PO
+	893, // SCE_HP_DEFAULT
+	2334, // SCLEX_TAL
+	892, // SCE_HP_COMMENTLINE
+	2253, // SCLEX_COBOL
+	896, // SCE_HP_NUMBER
+	2332, // SCLEX_TACL
+	899, // SCE_HP_STRING
+	2327, // SCLEX_SORCUS
+	890, // SCE_HP_CHARACTER
+	2312, // SCLEX_POWERPRO
+	902, // SCE_HP_WORD
+	2298, // SCLEX_NIMROD
+	900, // SCE_HP_TRIPLE
+	2326, // SCLEX_SML
+	901, // SCE_HP_TRIPLEDOUBLE
+	2291, // SCLEX_MARKDOWN
+	891, // SCE_HP_CLASSNAME
+	2338, // SCLEX_TXT2TAGS
+	894, // SCE_HP_DEFNAME
+	2231, // SCLEX_A68K
+	2424, // SC_FONT_SIZE_MULTIPLIER
+	91, // IDM_NEW
+	897, // SCE_HP_OPERATOR
+	2295, // SCLEX_MODULA
+	97, // IDM_OPEN
+	895, // SCE_HP_IDENTIFIER
+	2254, // SCLEX_COFFEESCRIPT
+	105, // IDM_OPENSELECTED
+	2336, // SCLEX_TCMD
+	120, // IDM_REVERT
+	881, // SCE_HPHP_COMPLEX_VARIABLE
+	2242, // SCLEX_AVS
+	32, // IDM_CLOSE
+	874, // SCE_HPA_START
+	2265, // SCLEX_ECL
+	122, // IDM_SAVE
+	869, // SCE_HPA_DEFAULT
+	2304, // SCLEX_OSCRIPT
+	868, // SCE_HPA_COMMENTLINE
+	2343, // SCLEX_VISUALPROLOG
+	872, // SCE_HPA_NUMBER
+	2285, // SCLEX_LITERATEHASKELL
+	875, // SCE_HPA_STRING
+	2331, // SCLEX_STTXT
+	125, // IDM_SAVEAS
+	866, // SCE_HPA_CHARACTER
+	2282, // SCLEX_KVIRC
+	126, // IDM_SAVEASHTML
+	878, // SCE_HPA_WORD
+	2323, // SCLEX_RUST
+	128, // IDM_SAVEASRTF
+	876, // SCE_HPA_TRIPLE
+	2263, // SCLEX_DMAP
+	127, // IDM_SAVEASPDF
+	877, // SCE_HPA_TRIPLEDOUBLE
+	2235, // SCLEX_AS
+	56, // IDM_FILER
+	867, // SCE_HPA_CLASSNAME
+	2264, // SCLEX_DMIS
+	129, // IDM_SAVEASTEX
+	870, // SCE_HPA_DEFNAME
+	2321, // SCLEX_REGISTRY
+	123, // IDM_SAVEACOPY
+	873, // SCE_HPA_OPERATOR
+	2246, // SCLEX_BIBTEX
+	130, // IDM_SAVEASXML
+	871, // SCE_HPA_IDENTIFIER
+	39, // IDM_COPYPATH
+	882, // SCE_HPHP_DEFAULT
+	17, // IDM_ALLOWACCESS
+	883, // SCE_HPHP_HSTRING
+	89, // IDM_MRU_SEP
+	887, // SCE_HPHP_SIMPLESTRING
+	90, // IDM_MRU_SUB
+	889, // SCE_HPHP_WORD
+	885, // SCE_HPHP_NUMBER
+	888, // SCE_HPHP_VARIABLE
+	879, // SCE_HPHP_COMMENT
+	880, // SCE_HPHP_COMMENTLINE
+	884, // SCE_HPHP_HSTRING_VARIABLE
+	886, // SCE_HPHP_OPERATOR
+	169, // INDIC2_MASK
+	2393, // SC_CHARSET_SHIFTJIS
+	2419, // SC_FOLDFLAG_LINESTATE
+	2510, // SC_MULTISTEPUNDOREDO
+	2387, // SC_CHARSET_HANGUL
+	114, // IDM_PRINTSETUP
+	2389, // SC_CHARSET_JOHAB
+	113, // IDM_PRINT
+	76, // IDM_LOADSESSION
+	131, // IDM_SAVESESSION
+	2385, // SC_CHARSET_GB2312
+	2381, // SC_CHARSET_CHINESEBIG5
+	115, // IDM_QUIT
+	44, // IDM_ENCODING_DEFAULT
+	46, // IDM_ENCODING_UCS2BE
+	47, // IDM_ENCODING_UCS2LE
+	48, // IDM_ENCODING_UTF8
+	45, // IDM_ENCODING_UCOOKIE
+	2386, // SC_CHARSET_GREEK
+	2396, // SC_CHARSET_TURKISH
+	2397, // SC_CHARSET_VIETNAMESE
+	2388, // SC_CHARSET_HEBREW
+	2379, // SC_CHARSET_ARABIC
+	2380, // SC_CHARSET_BALTIC
+	154, // IDM_UNDO
+	117, // IDM_REDO
+	40, // IDM_CUT
+	37, // IDM_COPY
+	2392, // SC_CHARSET_RUSSIAN
+	107, // IDM_PASTE
+	30, // IDM_CLEAR
+	132, // IDM_SELECTALL
+	108, // IDM_PASTEANDDOWN
+	57, // IDM_FIND
+	59, // IDM_FINDNEXT
+	60, // IDM_FINDNEXTBACK
+	62, // IDM_FINDNEXTSEL
+	61, // IDM_FINDNEXTBACKSEL
+	58, // IDM_FINDINFILES
+	119, // IDM_REPLACE
+	133, // IDM_SELECTION_FOR_FIND
+	67, // IDM_GOTO
+	20, // IDM_BOOKMARK_NEXT
+	24, // IDM_BOOKMARK_TOGGLE
+	2395, // SC_CHARSET_THAI
+	22, // IDM_BOOKMARK_PREV
+	19, // IDM_BOOKMARK_CLEARALL
+	170, // INDICS_MASK
+	21, // IDM_BOOKMARK_NEXT_SELECT
+	23, // IDM_BOOKMARK_PREV_SELECT
+	83, // IDM_MATCHBRACE
+	134, // IDM_SELECTTOBRACE
+	138, // IDM_SHOWCALLTIP
+	35, // IDM_COMPLETE
+	36, // IDM_COMPLETEWORD
+	54, // IDM_EXPAND
+	150, // IDM_TOGGLE_FOLDALL
+	151, // IDM_TOGGLE_FOLDRECURSIVE
+	55, // IDM_EXPAND_ENSURECHILDRENVISIBLE
+	2384, // SC_CHARSET_EASTEUROPE
+	156, // IDM_UPRCASE
+	77, // IDM_LWRCASE
+	14, // IDM_ABBREV
+	18, // IDM_BLOCK_COMMENT
+	144, // IDM_STREAM_COMMENT
+	38, // IDM_COPYASRTF
+	25, // IDM_BOX_COMMENT
+	72, // IDM_INS_ABBREV
+	73, // IDM_JOIN
+	139, // IDM_SPLIT
+	43, // IDM_DUPLICATE
+	71, // IDM_INCSEARCH
+	2360, // SC_ALPHA_OPAQUE
+	2391, // SC_CHARSET_OEM
+	2578, // STYLE_MAX
+	49, // IDM_ENTERSELECTION
+	194, // SCEN_KILLFOCUS
+	2359, // SC_ALPHA_NOALPHA
+	2435, // SC_LASTSTEPINUNDOREDO
+	111, // IDM_PREVMATCHPPC
+	136, // IDM_SELECTTOPREVMATCHPPC
+	94, // IDM_NEXTMATCHPPC
+	135, // IDM_SELECTTONEXTMATCHPPC
+	2215, // SCK_DOWN
+	34, // IDM_COMPILE
+	2229, // SCK_UP
+	28, // IDM_BUILD
+	2220, // SCK_LEFT
+	66, // IDM_GO
+	2225, // SCK_RIGHT
+	143, // IDM_STOPEXECUTE
+	2218, // SCK_HOME
+	63, // IDM_FINISHEDEXECUTE
+	2216, // SCK_END
+	95, // IDM_NEXTMSG
+	2223, // SCK_PRIOR
+	112, // IDM_PREVMSG
+	2222, // SCK_NEXT
+	29, // IDM_CLEAN
+	2213, // SCK_DELETE
+	2219, // SCK_INSERT
+	82, // IDM_MACRO_SEP
+	2211, // SCK_ADD
+	80, // IDM_MACRORECORD
+	2227, // SCK_SUBTRACT
+	81, // IDM_MACROSTOPRECORD
+	2214, // SCK_DIVIDE
+	79, // IDM_MACROPLAY
+	2230, // SCK_WIN
+	78, // IDM_MACROLIST
+	2226, // SCK_RWIN
+	2221, // SCK_MENU
+	16, // IDM_ACTIVATE
+	141, // IDM_SRCWIN
+	121, // IDM_RUNWIN
+	153, // IDM_TOOLWIN
+	142, // IDM_STATUSWIN
+	147, // IDM_TABWIN
+	2554, // SC_WEIGHT_NORMAL
+	140, // IDM_SPLITVERTICAL
+	159, // IDM_VIEWSPACE
+	157, // IDM_VIEWEOL
+	158, // IDM_VIEWGUIDES
+	137, // IDM_SELMARGIN
+	64, // IDM_FOLDMARGIN
+	75, // IDM_LINENUMBERMARGIN
+	162, // IDM_VIEWTOOLBAR
+	148, // IDM_TOGGLEOUTPUT
+	161, // IDM_VIEWTABBAR
+	160, // IDM_VIEWSTATUSBAR
+	149, // IDM_TOGGLEPARAMETERS
+	100, // IDM_OPENFILESHERE
+	164, // IDM_WRAP
+	166, // IDM_WRAPOUTPUT
+	116, // IDM_READONLY
+	31, // IDM_CLEAROUTPUT
+	145, // IDM_SWITCHPANE
+	52, // IDM_EOL_CRLF
+	51, // IDM_EOL_CR
+	53, // IDM_EOL_LF
+	50, // IDM_EOL_CONVERT
+	146, // IDM_TABSIZE
+	85, // IDM_MONOFONT
+	102, // IDM_OPENLOCALPROPERTIES
+	106, // IDM_OPENUSERPROPERTIES
+	101, // IDM_OPENGLOBALPROPERTIES
+	98, // IDM_OPENABBREVPROPERTIES
+	103, // IDM_OPENLUAEXTERNALFILE
+	99, // IDM_OPENDIRECTORYPROPERTIES
+	104, // IDM_OPENMRUBYEXTERNALFILE
+	109, // IDM_PREVFILE
+	92, // IDM_NEXTFILE
+	33, // IDM_CLOSEALL
+	124, // IDM_SAVEALL
+	27, // IDM_BUFFERSEP
+	110, // IDM_PREVFILESTACK
+	93, // IDM_NEXTFILESTACK
+	87, // IDM_MOVETABRIGHT
+	86, // IDM_MOVETABLEFT
+	195, // SCEN_SETFOCUS
+	2496, // SC_MOD_CHANGEMARKER
+	2555, // SC_WEIGHT_SEMIBOLD
+	2553, // SC_WEIGHT_BOLD
+	193, // SCEN_CHANGE
+	163, // IDM_WHOLEWORD
+	84, // IDM_MATCHCASE
+	118, // IDM_REGEXP
+	165, // IDM_WRAPAROUND
+	155, // IDM_UNSLASH
+	42, // IDM_DIRECTIONUP
+	41, // IDM_DIRECTIONDOWN
+	68, // IDM_HELP
+	15, // IDM_ABOUT
+	69, // IDM_HELP_SCITE
+	96, // IDM_ONTOP
+	65, // IDM_FULLSCREEN
+	88, // IDM_MRUFILE
+	2240, // SCLEX_AUTOMATIC
+	2377, // SC_CHARSET_8859_15
+	2540, // SC_STATUS_WARN_START
+	2539, // SC_STATUS_WARN_REGEX
+	2420, // SC_FOLDLEVELBASE
+	2490, // SC_MOD_BEFOREINSERT
+	152, // IDM_TOOLS
+	26, // IDM_BUFFER
+	2382, // SC_CHARSET_CYRILLIC
+	70, // IDM_IMPORT
+	74, // IDM_LANGUAGE
+	2180, // SCI_START
+	1919, // SCI_GETLENGTH
+	1879, // SCI_GETCHARAT
+	1883, // SCI_GETCURRENTPOS
+	1865, // SCI_GETANCHOR
+	1986, // SCI_GETSTYLEAT
+	2162, // SCI_SETUNDOCOLLECTION
+	2001, // SCI_GETUNDOCOLLECTION
+	2005, // SCI_GETVIEWWS
+	2166, // SCI_SETVIEWWS
+	2055, // SCI_SETANCHOR
+	1892, // SCI_GETENDSTYLED
+	1893, // SCI_GETEOLMODE
+	2077, // SCI_SETEOLMODE
+	1868, // SCI_GETBUFFEREDDRAW
+	2058, // SCI_SETBUFFEREDDRAW
+	2157, // SCI_SETTABWIDTH
+	2068, // SCI_SETCODEPAGE
+	2042, // SCI_MARKERSETFORE
+	2040, // SCI_MARKERSETBACK
+	2489, // SC_MOD_BEFOREDELETE
+	2203, // SCI_STYLESETFORE
+	2196, // SCI_STYLESETBACK
+	2197, // SCI_STYLESETBOLD
+	2205, // SCI_STYLESETITALIC
+	2206, // SCI_STYLESETSIZE
+	2202, // SCI_STYLESETFONT
+	2201, // SCI_STYLESETEOLFILLED
+	2208, // SCI_STYLESETUNDERLINE
+	2198, // SCI_STYLESETCASE
+	2207, // SCI_STYLESETSIZEFRACTIONAL
+	2192, // SCI_STYLEGETSIZEFRACTIONAL
+	2210, // SCI_STYLESETWEIGHT
+	2195, // SCI_STYLEGETWEIGHT
+	2200, // SCI_STYLESETCHARACTERSET
+	2059, // SCI_SETCARETFORE
+	2209, // SCI_STYLESETVISIBLE
+	1874, // SCI_GETCARETPERIOD
+	2064, // SCI_SETCARETPERIOD
+	2171, // SCI_SETWORDCHARS
+	2027, // SCI_INDICSETSTYLE
+	2022, // SCI_INDICGETSTYLE
+	2025, // SCI_INDICSETFORE
+	2020, // SCI_INDICGETFORE
+	2170, // SCI_SETWHITESPACESIZE
+	2009, // SCI_GETWHITESPACESIZE
+	2155, // SCI_SETSTYLEBITS
+	1987, // SCI_GETSTYLEBITS
+	2107, // SCI_SETLINESTATE
+	1929, // SCI_GETLINESTATE
+	1940, // SCI_GETMAXLINESTATE
+	1872, // SCI_GETCARETLINEVISIBLE
+	2062, // SCI_SETCARETLINEVISIBLE
+	1870, // SCI_GETCARETLINEBACK
+	2060, // SCI_SETCARETLINEBACK
+	2199, // SCI_STYLESETCHANGEABLE
+	1850, // SCI_AUTOCSETSEPARATOR
+	1837, // SCI_AUTOCGETSEPARATOR
+	1840, // SCI_AUTOCSETCANCELATSTART
+	1826, // SCI_AUTOCGETCANCELATSTART
+	1844, // SCI_AUTOCSETFILLUPS
+	1842, // SCI_AUTOCSETCHOOSESINGLE
+	1828, // SCI_AUTOCGETCHOOSESINGLE
+	1845, // SCI_AUTOCSETIGNORECASE
+	1832, // SCI_AUTOCGETIGNORECASE
+	1839, // SCI_AUTOCSETAUTOHIDE
+	1825, // SCI_AUTOCGETAUTOHIDE
+	1994, // SCI_GETTABWIDTH
+	2095, // SCI_SETINDENT
+	1911, // SCI_GETINDENT
+	2164, // SCI_SETUSETABS
+	2003, // SCI_GETUSETABS
+	2106, // SCI_SETLINEINDENTATION
+	1927, // SCI_GETLINEINDENTATION
+	1928, // SCI_GETLINEINDENTPOSITION
+	1881, // SCI_GETCOLUMN
+	2089, // SCI_SETHSCROLLBAR
+	1906, // SCI_GETHSCROLLBAR
+	2096, // SCI_SETINDENTATIONGUIDES
+	1912, // SCI_GETINDENTATIONGUIDES
+	2086, // SCI_SETHIGHLIGHTGUIDE
+	1903, // SCI_GETHIGHLIGHTGUIDE
+	1923, // SCI_GETLINEENDPOSITION
+	1880, // SCI_GETCODEPAGE
+	1869, // SCI_GETCARETFORE
+	1961, // SCI_GETREADONLY
+	2070, // SCI_SETCURRENTPOS
+	2152, // SCI_SETSELECTIONSTART
+	1983, // SCI_GETSELECTIONSTART
+	2144, // SCI_SETSELECTIONEND
+	1974, // SCI_GETSELECTIONEND
+	2128, // SCI_SETPRINTMAGNIFICATION
+	1955, // SCI_GETPRINTMAGNIFICATION
+	2127, // SCI_SETPRINTCOLOURMODE
+	1954, // SCI_GETPRINTCOLOURMODE
+	1896, // SCI_GETFIRSTVISIBLELINE
+	1922, // SCI_GETLINECOUNT
+	2110, // SCI_SETMARGINLEFT
+	1933, // SCI_GETMARGINLEFT
+	2113, // SCI_SETMARGINRIGHT
+	1936, // SCI_GETMARGINRIGHT
+	1942, // SCI_GETMODIFY
+	2132, // SCI_SETREADONLY
+	1999, // SCI_GETTEXTLENGTH
+	1885, // SCI_GETDIRECTFUNCTION
+	1886, // SCI_GETDIRECTPOINTER
+	2123, // SCI_SETOVERTYPE
+	1948, // SCI_GETOVERTYPE
+	2067, // SCI_SETCARETWIDTH
+	1877, // SCI_GETCARETWIDTH
+	2159, // SCI_SETTARGETSTART
+	1997, // SCI_GETTARGETSTART
+	2158, // SCI_SETTARGETEND
+	1996, // SCI_GETTARGETEND
+	2141, // SCI_SETSEARCHFLAGS
+	1970, // SCI_GETSEARCHFLAGS
+	1852, // SCI_CALLTIPSETBACK
+	1853, // SCI_CALLTIPSETFORE
+	1854, // SCI_CALLTIPSETFOREHLT
+	1847, // SCI_AUTOCSETMAXWIDTH
+	1834, // SCI_AUTOCGETMAXWIDTH
+	1846, // SCI_AUTOCSETMAXHEIGHT
+	1833, // SCI_AUTOCGETMAXHEIGHT
+	1857, // SCI_CALLTIPUSESTYLE
+	1855, // SCI_CALLTIPSETPOSITION
+	1856, // SCI_CALLTIPSETPOSSTART
+	2084, // SCI_SETFOLDLEVEL
+	1899, // SCI_GETFOLDLEVEL
+	1900, // SCI_GETFOLDPARENT
+	1930, // SCI_GETLINEVISIBLE
+	2082, // SCI_SETFOLDEXPANDED
+	1898, // SCI_GETFOLDEXPANDED
+	2083, // SCI_SETFOLDFLAGS
+	1864, // SCI_GETALLLINESVISIBLE
+	2115, // SCI_SETMARGINTYPEN
+	1938, // SCI_GETMARGINTYPEN
+	2116, // SCI_SETMARGINWIDTHN
+	1939, // SCI_GETMARGINWIDTHN
+	2111, // SCI_SETMARGINMASKN
+	1934, // SCI_GETMARGINMASKN
+	2114, // SCI_SETMARGINSENSITIVEN
+	1937, // SCI_GETMARGINSENSITIVEN
+	2109, // SCI_SETMARGINCURSORN
+	1932, // SCI_GETMARGINCURSORN
+	2156, // SCI_SETTABINDENTS
+	1993, // SCI_GETTABINDENTS
+	2057, // SCI_SETBACKSPACEUNINDENTS
+	1867, // SCI_GETBACKSPACEUNINDENTS
+	2119, // SCI_SETMOUSEDWELLTIME
+	1944, // SCI_GETMOUSEDWELLTIME
+	2173, // SCI_SETWRAPMODE
+	2012, // SCI_GETWRAPMODE
+	1843, // SCI_AUTOCSETDROPRESTOFWORD
+	1831, // SCI_AUTOCGETDROPRESTOFWORD
+	2101, // SCI_SETLAYOUTCACHE
+	1917, // SCI_GETLAYOUTCACHE
+	2139, // SCI_SETSCROLLWIDTH
+	1968, // SCI_GETSCROLLWIDTH
+	2076, // SCI_SETENDATLASTLINE
+	1891, // SCI_GETENDATLASTLINE
+	2168, // SCI_SETVSCROLLBAR
+	2007, // SCI_GETVSCROLLBAR
+	2000, // SCI_GETTWOPHASEDRAW
+	2161, // SCI_SETTWOPHASEDRAW
+	1838, // SCI_AUTOCGETTYPESEPARATOR
+	1851, // SCI_AUTOCSETTYPESEPARATOR
+	2041, // SCI_MARKERSETBACKSELECTED
+	2004, // SCI_GETVIEWEOL
+	2165, // SCI_SETVIEWEOL
+	1887, // SCI_GETDOCPOINTER
+	2072, // SCI_SETDOCPOINTER
+	2117, // SCI_SETMODEVENTMASK
+	1889, // SCI_GETEDGECOLUMN
+	2074, // SCI_SETEDGECOLUMN
+	1890, // SCI_GETEDGEMODE
+	2075, // SCI_SETEDGEMODE
+	1888, // SCI_GETEDGECOLOUR
+	2073, // SCI_SETEDGECOLOUR
+	2030, // SCI_LINESONSCREEN
+	2047, // SCI_SELECTIONISRECTANGLE
+	2179, // SCI_SETZOOM
+	2018, // SCI_GETZOOM
+	1941, // SCI_GETMODEVENTMASK
+	2081, // SCI_SETFOCUS
+	1897, // SCI_GETFOCUS
+	2154, // SCI_SETSTATUS
+	1985, // SCI_GETSTATUS
+	2118, // SCI_SETMOUSEDOWNCAPTURES
+	1943, // SCI_GETMOUSEDOWNCAPTURES
+	2071, // SCI_SETCURSOR
+	1884, // SCI_GETCURSOR
+	2069, // SCI_SETCONTROLCHARSYMBOL
+	1882, // SCI_GETCONTROLCHARSYMBOL
+	2178, // SCI_SETXOFFSET
+	2017, // SCI_GETXOFFSET
+	2129, // SCI_SETPRINTWRAPMODE
+	1956, // SCI_GETPRINTWRAPMODE
+	2204, // SCI_STYLESETHOTSPOT
+	2087, // SCI_SETHOTSPOTACTIVEUNDERLINE
+	2088, // SCI_SETHOTSPOTSINGLELINE
+	2145, // SCI_SETSELECTIONMODE
+	1975, // SCI_GETSELECTIONMODE
+	2169, // SCI_SETWHITESPACECHARS
+	1829, // SCI_AUTOCGETCURRENT
+	1875, // SCI_GETCARETSTICKY
+	2065, // SCI_SETCARETSTICKY
+	2176, // SCI_SETWRAPVISUALFLAGS
+	2015, // SCI_GETWRAPVISUALFLAGS
+	2177, // SCI_SETWRAPVISUALFLAGSLOCATION
+	2016, // SCI_GETWRAPVISUALFLAGSLOCATION
+	2174, // SCI_SETWRAPSTARTINDENT
+	2013, // SCI_GETWRAPSTARTINDENT
+	2124, // SCI_SETPASTECONVERTENDINGS
+	1949, // SCI_GETPASTECONVERTENDINGS
+	2061, // SCI_SETCARETLINEBACKALPHA
+	1871, // SCI_GETCARETLINEBACKALPHA
+	2172, // SCI_SETWRAPINDENTMODE
+	2011, // SCI_GETWRAPINDENTMODE
+	2039, // SCI_MARKERSETALPHA
+	1972, // SCI_GETSELALPHA
+	2143, // SCI_SETSELALPHA
+	1984, // SCI_GETSELEOLFILLED
+	2153, // SCI_SETSELEOLFILLED
+	2188, // SCI_STYLEGETFORE
+	2181, // SCI_STYLEGETBACK
+	2182, // SCI_STYLEGETBOLD
+	2190, // SCI_STYLEGETITALIC
+	2191, // SCI_STYLEGETSIZE
+	2187, // SCI_STYLEGETFONT
+	2186, // SCI_STYLEGETEOLFILLED
+	2193, // SCI_STYLEGETUNDERLINE
+	2183, // SCI_STYLEGETCASE
+	2185, // SCI_STYLEGETCHARACTERSET
+	2194, // SCI_STYLEGETVISIBLE
+	2184, // SCI_STYLEGETCHANGEABLE
+	2189, // SCI_STYLEGETHOTSPOT
+	1904, // SCI_GETHOTSPOTACTIVEUNDERLINE
+	1905, // SCI_GETHOTSPOTSINGLELINE
+	2097, // SCI_SETINDICATORCURRENT
+	1914, // SCI_GETINDICATORCURRENT
+	2098, // SCI_SETINDICATORVALUE
+	1915, // SCI_GETINDICATORVALUE
+	2028, // SCI_INDICSETUNDER
+	2023, // SCI_INDICGETUNDER
+	2066, // SCI_SETCARETSTYLE
+	1876, // SCI_GETCARETSTYLE
+	2126, // SCI_SETPOSITIONCACHE
+	1951, // SCI_GETPOSITIONCACHE
+	2140, // SCI_SETSCROLLWIDTHTRACKING
+	1969, // SCI_GETSCROLLWIDTHTRACKING
+	1878, // SCI_GETCHARACTERPOINTER
+	2099, // SCI_SETKEYSUNICODE
+	1916, // SCI_GETKEYSUNICODE
+	2024, // SCI_INDICSETALPHA
+	2019, // SCI_INDICGETALPHA
+	2078, // SCI_SETEXTRAASCENT
+	1894, // SCI_GETEXTRAASCENT
+	2079, // SCI_SETEXTRADESCENT
+	1895, // SCI_GETEXTRADESCENT
+	2038, // SCI_MARGINSETTEXT
+	2034, // SCI_MARGINGETTEXT
+	2035, // SCI_MARGINSETSTYLE
+	2031, // SCI_MARGINGETSTYLE
+	2037, // SCI_MARGINSETSTYLES
+	2033, // SCI_MARGINGETSTYLES
+	2036, // SCI_MARGINSETSTYLEOFFSET
+	2032, // SCI_MARGINGETSTYLEOFFSET
+	2112, // SCI_SETMARGINOPTIONS
+	1823, // SCI_ANNOTATIONSETTEXT
+	1818, // SCI_ANNOTATIONGETTEXT
+	1820, // SCI_ANNOTATIONSETSTYLE
+	1815, // SCI_ANNOTATIONGETSTYLE
+	1822, // SCI_ANNOTATIONSETSTYLES
+	1817, // SCI_ANNOTATIONGETSTYLES
+	1814, // SCI_ANNOTATIONGETLINES
+	1824, // SCI_ANNOTATIONSETVISIBLE
+	1819, // SCI_ANNOTATIONGETVISIBLE
+	1821, // SCI_ANNOTATIONSETSTYLEOFFSET
+	1816, // SCI_ANNOTATIONGETSTYLEOFFSET
+	1935, // SCI_GETMARGINOPTIONS
+	2026, // SCI_INDICSETOUTLINEALPHA
+	2021, // SCI_INDICGETOUTLINEALPHA
+	2122, // SCI_SETMULTIPLESELECTION
+	1947, // SCI_GETMULTIPLESELECTION
+	2053, // SCI_SETADDITIONALSELECTIONTYPING
+	1863, // SCI_GETADDITIONALSELECTIONTYPING
+	2049, // SCI_SETADDITIONALCARETSBLINK
+	1860, // SCI_GETADDITIONALCARETSBLINK
+	1982, // SCI_GETSELECTIONS
+	2108, // SCI_SETMAINSELECTION
+	1931, // SCI_GETMAINSELECTION
+	2148, // SCI_SETSELECTIONNCARET
+	1978, // SCI_GETSELECTIONNCARET
+	2146, // SCI_SETSELECTIONNANCHOR
+	1976, // SCI_GETSELECTIONNANCHOR
+	2149, // SCI_SETSELECTIONNCARETVIRTUALSPACE
+	1979, // SCI_GETSELECTIONNCARETVIRTUALSPACE
+	2147, // SCI_SETSELECTIONNANCHORVIRTUALSPACE
+	1977, // SCI_GETSELECTIONNANCHORVIRTUALSPACE
+	2151, // SCI_SETSELECTIONNSTART
+	1981, // SCI_GETSELECTIONNSTART
+	2150, // SCI_SETSELECTIONNEND
+	1980, // SCI_GETSELECTIONNEND
+	2135, // SCI_SETRECTANGULARSELECTIONCARET
+	1964, // SCI_GETRECTANGULARSELECTIONCARET
+	2133, // SCI_SETRECTANGULARSELECTIONANCHOR
+	1962, // SCI_GETRECTANGULARSELECTIONANCHOR
+	2136, // SCI_SETRECTANGULARSELECTIONCARETVIRTUALSPACE
+	1965, // SCI_GETRECTANGULARSELECTIONCARETVIRTUALSPACE
+	2134, // SCI_SETRECTANGULARSELECTIONANCHORVIRTUALSPACE
+	1963, // SCI_GETRECTANGULARSELECTIONANCHORVIRTUALSPACE
+	2167, // SCI_SETVIRTUALSPACEOPTIONS
+	2006, // SCI_GETVIRTUALSPACEOPTIONS
+	2137, // SCI_SETRECTANGULARSELECTIONMODIFIER
+	1966, // SCI_GETRECTANGULARSELECTIONMODIFIER
+	2054, // SCI_SETADDITIONALSELFORE
+	2052, // SCI_SETADDITIONALSELBACK
+	2051, // SCI_SETADDITIONALSELALPHA
+	1862, // SCI_GETADDITIONALSELALPHA
+	2048, // SCI_SETADDITIONALCARETFORE
+	1859, // SCI_GETADDITIONALCARETFORE
+	2050, // SCI_SETADDITIONALCARETSVISIBLE
+	1861, // SCI_GETADDITIONALCARETSVISIBLE
+	1830, // SCI_AUTOCGETCURRENTTEXT
+	2085, // SCI_SETFONTQUALITY
+	1901, // SCI_GETFONTQUALITY
+	2080, // SCI_SETFIRSTVISIBLELINE
+	2121, // SCI_SETMULTIPASTE
+	1946, // SCI_GETMULTIPASTE
+	1995, // SCI_GETTAG
+	2090, // SCI_SETIDENTIFIER
+	1907, // SCI_GETIDENTIFIER
+	2046, // SCI_RGBAIMAGESETWIDTH
+	2044, // SCI_RGBAIMAGESETHEIGHT
+	2160, // SCI_SETTECHNOLOGY
+	1998, // SCI_GETTECHNOLOGY
+	1841, // SCI_AUTOCSETCASEINSENSITIVEBEHAVIOUR
+	1827, // SCI_AUTOCGETCASEINSENSITIVEBEHAVIOUR
+	1848, // SCI_AUTOCSETMULTI
+	1835, // SCI_AUTOCGETMULTI
+	1902, // SCI_GETGAPPOSITION
+	2010, // SCI_GETWORDCHARS
+	2008, // SCI_GETWHITESPACECHARS
+	2131, // SCI_SETPUNCTUATIONCHARS
+	1960, // SCI_GETPUNCTUATIONCHARS
+	1973, // SCI_GETSELECTIONEMPTY
+	2045, // SCI_RGBAIMAGESETSCALE
+	1873, // SCI_GETCARETLINEVISIBLEALWAYS
+	2063, // SCI_SETCARETLINEVISIBLEALWAYS
+	2105, // SCI_SETLINEENDTYPESALLOWED
+	1925, // SCI_GETLINEENDTYPESALLOWED
+	1924, // SCI_GETLINEENDTYPESACTIVE
+	1849, // SCI_AUTOCSETORDER
+	1836, // SCI_AUTOCGETORDER
+	2056, // SCI_SETAUTOMATICFOLD
+	1866, // SCI_GETAUTOMATICFOLD
+	2138, // SCI_SETREPRESENTATION
+	1967, // SCI_GETREPRESENTATION
+	2120, // SCI_SETMOUSESELECTIONRECTANGULARSWITCH
+	1945, // SCI_GETMOUSESELECTIONRECTANGULARSWITCH
+	1950, // SCI_GETPHASESDRAW
+	2125, // SCI_SETPHASESDRAW
+	1910, // SCI_GETIMEINTERACTION
+	2094, // SCI_SETIMEINTERACTION
+	2175, // SCI_SETWRAPTHREADS
+	2014, // SCI_GETWRAPTHREADS
+	2092, // SCI_SETIDLESTYLING
+	1908, // SCI_GETIDLESTYLING
+	2093, // SCI_SETIDLESTYLINGBUDGET
+	1909, // SCI_GETIDLESTYLINGBUDGET
+	1913, // SCI_GETINDEXINGLINES
+	2163, // SCI_SETUNDOMEMORYLIMIT
+	2002, // SCI_GETUNDOMEMORYLIMIT
+	2142, // SCI_SETSEGMENTCACHEBUDGET
+	1971, // SCI_GETSEGMENTCACHEBUDGET
+	1952, // SCI_GETPOSITIONCACHESTATISTIC
+	2102, // SCI_SETLAYOUTCACHEPAGES
+	1918, // SCI_GETLAYOUTCACHEPAGES
+	2043, // SCI_OPTIONAL_START
+	2029, // SCI_LEXER_START
+	2103, // SCI_SETLEXER
+	1920, // SCI_GETLEXER
+	2130, // SCI_SETPROPERTY
+	2100, // SCI_SETKEYWORDS
+	2104, // SCI_SETLEXERLANGUAGE
+	1957, // SCI_GETPROPERTY
+	1958, // SCI_GETPROPERTYEXPANDED
+	1959, // SCI_GETPROPERTYINT
+	1988, // SCI_GETSTYLEBITSNEEDED
+	1921, // SCI_GETLEXERLANGUAGE
+	1926, // SCI_GETLINEENDTYPESSUPPORTED
+	1992, // SCI_GETSUBSTYLESSTART
+	1991, // SCI_GETSUBSTYLESLENGTH
+	2091, // SCI_SETIDENTIFIERS
+	1858, // SCI_DISTANCETOSECONDARYSTYLES
+	1990, // SCI_GETSUBSTYLEBASES
+	1989, // SCI_GETSTYLEFROMSUBSTYLE
+	1953, // SCI_GETPRIMARYSTYLEFROMSTYLE
+	2422, // SC_FOLDLEVELNUMBERMASK
+	2423, // SC_FOLDLEVELWHITEFLAG
+	2507, // SC_MULTILINEUNDOREDO
+	2421, // SC_FOLDLEVELHEADERFLAG
+	2535, // SC_STARTACTION
+	2463, // SC_MARK_CHARACTER
+	2493, // SC_MOD_CHANGEINDICATOR
+	2494, // SC_MOD_CHANGELINESTATE
+	2398, // SC_CP_UTF8
+	2495, // SC_MOD_CHANGEMARGIN
+	2491, // SC_MOD_CHANGEANNOTATION
+	2499, // SC_MOD_CONTAINER
+	2503, // SC_MOD_LEXERSTATE
+	1813, // SCFIND_WORDSTART
+	2501, // SC_MOD_INSERTCHECK
+	1811, // SCFIND_REGEXP
+	2498, // SC_MOD_CHANGETABSTOPS
+	1810, // SCFIND_POSIX
+	2504, // SC_MOD_LINESINDEXED
+	2488, // SC_MODEVENTMASKALL
+	1807, // SCFIND_CXX11REGEX
+	2545, // SC_TIME_FOREVER
+	1808 // SCFIND_DFAREGEX
+};
+
 enum {
-	ifaceFunctionCount = 288,
-	ifaceConstantCount = 2555,
-	ifacePropertyCount = 218
+	ifaceFunctionCount = 289,
+	ifaceConstantCount = 2582,
+	ifacePropertyCount = 226,
+	ifaceMessageCount = 683
 };
 
 //--Autogenerated
@@ -3221,3 +6865,9 @@ const int IFaceTable::constantCount = ifaceConstantCount;
 
 const IFaceProperty * const IFaceTable::properties = ifaceProperties;
 const int IFaceTable::propertyCount = ifacePropertyCount;
+
+const int * const IFaceTable::functionsByConstantName = ifaceFunctionsByConstantName;
+const int * const IFaceTable::constantsByValue = ifaceConstantsByValue;
+
+const IFaceMessage * const IFaceTable::messages = ifaceMessages;
+const int IFaceTable::messageCount = ifaceMessageCount;
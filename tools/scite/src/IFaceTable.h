@@ -68,6 +68,12 @@ struct IFaceProperty {
 	}
 };
 
+struct IFaceMessage {
+	int value;
+	int function;
+	int property;
+};
+
 struct IFaceObject {
 	const char *name;
 	const char *prefix;
@@ -88,8 +94,19 @@ public:
 	static int FindFunction(const char *name);
 	static int FindFunctionByConstantName(const char *name);
 	static int FindProperty(const char *name);
+	static int FindFunctionByValue(int value);
+	static int FindPropertyByValue(int value);
 
 	static int GetConstantName(int value, char *nameOut, unsigned nameBufferLen);
+
+private:
+	static const int * const functionsByConstantName;
+	static const IFaceMessage * const messages;
+	static const int * const constantsByValue;
+
+	static const int messageCount;
+
+	static int FindMessage(int value);
 };
 
 #endif
@@ -40,13 +40,6 @@
 // The comparison and case changing functions here assume ASCII
 // or extended ASCII such as the normal Windows code page.
 
-static inline char MakeUpperCase(char ch) {
-	if (ch < 'a' || ch > 'z')
-		return ch;
-	else
-		return static_cast<char>(ch - 'a' + 'A');
-}
-
 inline bool IsASpace(unsigned int ch) {
     return (ch == ' ') || ((ch >= 0x09) && (ch <= 0x0d));
 }
@@ -76,15 +69,148 @@ bool ImportFilter::IsValid(std::string name) const {
 
 bool PropSetFile::caseSensitiveFilenames = false;
 
-PropSetFile::PropSetFile(bool lowerKeys_) : lowerKeys(lowerKeys_), superPS(0) {
+unsigned int PropSetFile::lastVersion = 0;
+
+// Only the most recent changes are remembered as a long run of changes, such as reading
+// a file, forgets most resolutions anyway.
+static const size_t maxChanges = 100;
+
+/**
+ * The keys, and the prefixes of ranges of keys, read while resolving a value so the value
+ * is kept until one of them changes.
+ */
+struct PropSetFile::Dependencies {
+	unsigned int resolved;	///< Latest version of the sets when resolved or last found unchanged
+	std::set<std::string> keys;
+	std::set<std::string> prefixes;
+	Dependencies() : resolved(0) {
+	}
+	void Add(const Dependencies &other) {
+		keys.insert(other.keys.begin(), other.keys.end());
+		prefixes.insert(other.prefixes.begin(), other.prefixes.end());
+	}
+	bool Affected(const std::string &changed) const {
+		if (keys.count(changed))
+			return true;
+		for (std::set<std::string>::const_iterator it = prefixes.begin(); it != prefixes.end(); ++it) {
+			if (changed.compare(0, it->length(), *it) == 0)
+				return true;
+		}
+		return false;
+	}
+};
+
+/**
+ * The patterns of the keys that start with a keybase in the order GetWild tries them.
+ * A file name is matched by looking up the name itself, its suffixes and its prefixes
+ * instead of trying every pattern, so the earliest key with a matching pattern wins as before.
+ */
+class PropSetFile::WildIndex {
+	typedef std::map<std::string, size_t> FirstKeys;
+	bool caseSensitive;
+	std::vector<std::string> values;
+	FirstKeys names;
+	FirstKeys suffixes;
+	FirstKeys prefixes;
+	std::set<size_t> lengthsSuffix;
+	std::set<size_t> lengthsPrefix;
+	size_t always;
+	std::string Folded(std::string s) const {
+		if (!caseSensitive) {
+			for (size_t i = 0; i < s.length(); i++)
+				s[i] = MakeUpperCase(s[i]);
+		}
+		return s;
+	}
+	static void Earliest(const FirstKeys &keys, const std::string &s, size_t &first) {
+		FirstKeys::const_iterator it = keys.find(s);
+		if ((it != keys.end()) && (it->second < first))
+			first = it->second;
+	}
+public:
+	Dependencies dependencies;
+	explicit WildIndex(bool caseSensitive_=false) : caseSensitive(caseSensitive_), always(static_cast<size_t>(-1)) {
+	}
+	size_t AddKey(const std::string &value) {
+		values.push_back(value);
+		return values.size() - 1;
+	}
+	void AddPattern(size_t key, const std::string &pattern) {
+		// insert does not replace so each pattern leads to the earliest key using it
+		const std::string folded = Folded(pattern);
+		names.insert(FirstKeys::value_type(folded, key));
+		if (!folded.empty()) {
+			if (folded[0] == '*') {
+				suffixes.insert(FirstKeys::value_type(folded.substr(1), key));
+				lengthsSuffix.insert(folded.length() - 1);
+			} else if (folded[folded.length()-1] == '*') {
+				prefixes.insert(FirstKeys::value_type(folded.substr(0, folded.length() - 1), key));
+				lengthsPrefix.insert(folded.length() - 1);
+			}
+		}
+	}
+	void AddAlways(size_t key) {
+		if (key < always)
+			always = key;
+	}
+	std::string Find(const char *filename) const {
+		const std::string name = Folded(filename);
+		size_t first = always;
+		Earliest(names, name, first);
+		for (std::set<size_t>::const_iterator it = lengthsSuffix.begin(); (it != lengthsSuffix.end()) && (*it <= name.length()); ++it) {
+			Earliest(suffixes, name.substr(name.length() - *it), first);
+		}
+		for (std::set<size_t>::const_iterator it = lengthsPrefix.begin(); (it != lengthsPrefix.end()) && (*it <= name.length()); ++it) {
+			Earliest(prefixes, name.substr(0, *it), first);
+		}
+		return (first < values.size()) ? values[first] : std::string();
+	}
+};
+
+struct PropSetFile::Resolutions {
+	struct Expansion {
+		std::string value;
+		Dependencies dependencies;
+	};
+	bool caseSensitive;
+	// This set and its base sets when the resolutions were checked
+	std::vector<const PropSetFile *> chain;
+	unsigned int latest;	///< Latest version of the sets in chain
+	std::map<std::string, WildIndex> wilds;
+	std::map<std::string, Expansion> expansions;	///< By keybase and file name separated by NUL
+	Dependencies *reading;
+	Resolutions() : caseSensitive(false), latest(0), reading(0) {
+	}
+	// Collects the keys read while a value is resolved and adds them to any enclosing resolution.
+	class Scope {
+		Dependencies *&reading;
+		Dependencies *outer;
+	public:
+		Scope(Resolutions &resolutions, Dependencies &dependencies) :
+			reading(resolutions.reading), outer(resolutions.reading) {
+			reading = &dependencies;
+		}
+		~Scope() {
+			if (outer)
+				outer->Add(*reading);
+			reading = outer;
+		}
+	};
+};
+
+PropSetFile::PropSetFile(bool lowerKeys_) : lowerKeys(lowerKeys_), recording(0), version(++lastVersion),
+	changesStart(version), resolutions(0), superPS(0) {
 }
 
-PropSetFile::PropSetFile(const PropSetFile &copy) : lowerKeys(copy.lowerKeys), props(copy.props), superPS(copy.superPS) {
+PropSetFile::PropSetFile(const PropSetFile &copy) : lowerKeys(copy.lowerKeys), props(copy.props), recording(0),
+	version(++lastVersion), changesStart(version), resolutions(0), superPS(copy.superPS) {
 }
 
 PropSetFile::~PropSetFile() {
 	superPS = 0;
 	Clear();
+	delete resolutions;
+	resolutions = 0;
 }
 
 PropSetFile &PropSetFile::operator=(const PropSetFile &assign) {
@@ -92,10 +218,56 @@ PropSetFile &PropSetFile::operator=(const PropSetFile &assign) {
 		lowerKeys = assign.lowerKeys;
 		superPS = assign.superPS;
 		props = assign.props;
+		Changed();
 	}
 	return *this;
 }
 
+void PropSetFile::Changed() {
+	version = ++lastVersion;
+	changes.clear();
+	changesStart = version;
+}
+
+void PropSetFile::Changed(const std::string &key) {
+	version = ++lastVersion;
+	if (changes.size() >= maxChanges) {
+		// Forget the older half
+		const size_t forget = maxChanges / 2;
+		changesStart = changes[forget - 1].first;
+		changes.erase(changes.begin(), changes.begin() + forget);
+	}
+	changes.push_back(std::pair<unsigned int, std::string>(version, key));
+}
+
+/**
+ * Whether no key read by a resolution has changed in this set or its base sets since it
+ * was resolved. If so, it is marked as current so the same changes are not checked again.
+ */
+bool PropSetFile::Unchanged(Dependencies &dependencies) const {
+	for (const PropSetFile *psf = this; psf; psf = psf->superPS) {
+		if (psf->version > dependencies.resolved) {
+			if (dependencies.resolved < psf->changesStart)
+				return false;	// Changes forgotten so anything may have changed
+			for (size_t i = psf->changes.size(); (i > 0) && (psf->changes[i-1].first > dependencies.resolved); i--) {
+				if (dependencies.Affected(psf->changes[i-1].second))
+					return false;
+			}
+		}
+	}
+	dependencies.resolved = resolutions->latest;
+	return true;
+}
+
+void PropSetFile::Reading(const std::string &key, bool prefix) const {
+	if (resolutions && resolutions->reading) {
+		if (prefix)
+			resolutions->reading->prefixes.insert(key);
+		else
+			resolutions->reading->keys.insert(key);
+	}
+}
+
 void PropSetFile::Set(const char *key, const char *val, ptrdiff_t lenKey, ptrdiff_t lenVal) {
 	if (!*key)	// Empty keys are not supported
 		return;
@@ -103,7 +275,15 @@ void PropSetFile::Set(const char *key, const char *val, ptrdiff_t lenKey, ptrdif
 		lenKey = static_cast<int>(strlen(key));
 	if (lenVal == -1)
 		lenVal = static_cast<int>(strlen(val));
-	props[std::string(key, lenKey)] = std::string(val, lenVal);
+	const std::string sVal(val, lenVal);
+	std::pair<mapss::iterator, bool> inserted = props.insert(mapss::value_type(std::string(key, lenKey), sVal));
+	if (inserted.second) {
+		Changed(inserted.first->first);
+	} else if (inserted.first->second != sVal) {
+		// Setting the same value again, as is common for file properties, keeps resolutions
+		inserted.first->second = sVal;
+		Changed(inserted.first->first);
+	}
 }
 
 void PropSetFile::Set(const char *keyVal) {
@@ -125,12 +305,16 @@ void PropSetFile::Unset(const char *key, int lenKey) {
 		return;
 	if (lenKey == -1)
 		lenKey = static_cast<int>(strlen(key));
-	mapss::iterator keyPos = props.find(std::string(key, lenKey));
-	if (keyPos != props.end())
+	const std::string sKey(key, lenKey);
+	mapss::iterator keyPos = props.find(sKey);
+	if (keyPos != props.end()) {
 		props.erase(keyPos);
+		Changed(sKey);
+	}
 }
 
 bool PropSetFile::Exists(const char *key) const {
+	Reading(key);
 	mapss::const_iterator keyPos = props.find(std::string(key));
 	if (keyPos != props.end()) {
 		return true;
@@ -146,6 +330,7 @@ bool PropSetFile::Exists(const char *key) const {
 
 std::string PropSetFile::GetString(const char *key) const {
 	const std::string sKey(key);
+	Reading(sKey);
 	const PropSetFile *psf = this;
 	while (psf) {
 		mapss::const_iterator keyPos = psf->props.find(sKey);
@@ -160,6 +345,7 @@ std::string PropSetFile::GetString(const char *key) const {
 
 SString PropSetFile::Get(const char *key) const {
 	const std::string sKey(key);
+	Reading(sKey);
 	const PropSetFile *psf = this;
 	while (psf) {
 		mapss::const_iterator keyPos = psf->props.find(sKey);
@@ -215,6 +401,7 @@ SString PropSetFile::Evaluate(const char *key) const {
 			return escaped.c_str();
 		} else if (isprefix(key, "star ")) {
 			const std::string sKeybase(key + 5);
+			Reading(sKeybase, true);
 			// Create set of variables with values
 			mapss values;
 			// For this property set and all base sets
@@ -334,7 +521,10 @@ static bool isPrefix(const char *target, const char *prefix) {
 }
 
 void PropSetFile::Clear() {
-	props.clear();
+	if (!props.empty()) {
+		props.clear();
+		Changed();
+	}
 }
 
 /**
@@ -396,6 +586,23 @@ static bool GenericPropertiesFile(const FilePath &filename) {
 	return name.find("SciTE") != std::string::npos;
 }
 
+// The files imported by "import *": all .properties files in the directory except for system properties
+static FilePathSet ImportableFiles(FilePath directory, const ImportFilter &filter) {
+	FilePathSet directories;
+	FilePathSet files;
+	directory.List(directories, files);
+	FilePathSet importable;
+	for (size_t i = 0; i < files.size(); i ++) {
+		FilePath fpFile = files[i];
+		if (IsPropertiesFile(fpFile) &&
+			!GenericPropertiesFile(fpFile) &&
+			filter.IsValid(fpFile.BaseName().AsUTF8())) {
+			importable.push_back(fpFile);
+		}
+	}
+	return importable;
+}
+
 void PropSetFile::Import(FilePath filename, FilePath directoryForImports, const ImportFilter &filter, std::vector<FilePath> *imports, size_t depth) {
 	if (depth > 20)	// Possibly recursive import so give up to avoid crash
 		return;
@@ -414,21 +621,17 @@ bool PropSetFile::ReadLine(const char *lineBuffer, bool ifIsTrue, FilePath direc
 	if (isPrefix(lineBuffer, "if ")) {
 		const char *expr = lineBuffer + strlen("if") + 1;
 		ifIsTrue = GetInt(expr) != 0;
+		if (recording)
+			recording->conditions.push_back(std::pair<std::string, bool>(expr, ifIsTrue));
 	} else if (isPrefix(lineBuffer, "import ") && directoryForImports.IsSet()) {
 		SString importName(lineBuffer + strlen("import") + 1);
 		if (importName == "*") {
-			// Import all .properties files in this directory except for system properties
-			FilePathSet directories;
-			FilePathSet files;
-			directoryForImports.List(directories, files);
+			FilePathSet files = ImportableFiles(directoryForImports, filter);
+			if (recording)
+				recording->AddDirectory(directoryForImports, filter);
 			for (size_t i = 0; i < files.size(); i ++) {
-				FilePath fpFile = files[i];
-				if (IsPropertiesFile(fpFile) &&
-					!GenericPropertiesFile(fpFile) &&
-					filter.IsValid(fpFile.BaseName().AsUTF8())) {
-					FilePath importPath(directoryForImports, fpFile);
-					Import(importPath, directoryForImports, filter, imports, depth+1);
-				}
+				FilePath importPath(directoryForImports, files[i]);
+				Import(importPath, directoryForImports, filter, imports, depth+1);
 			}
 		} else if (filter.IsValid(importName.c_str())) {
 			importName += ".properties";
@@ -461,6 +664,8 @@ void PropSetFile::ReadFromMemory(const char *data, size_t len, FilePath director
 
 bool PropSetFile::Read(FilePath filename, FilePath directoryForImports,
                        const ImportFilter &filter, std::vector<FilePath> *imports, size_t depth) {
+	if (recording)
+		recording->AddFile(filename);
 	FILE *rcfile = filename.Open(fileRead);
 	if (rcfile) {
 		fseek(rcfile, 0, SEEK_END);
@@ -484,52 +689,80 @@ bool PropSetFile::Read(FilePath filename, FilePath directoryForImports,
 	return false;
 }
 
-void PropSetFile::SetInteger(const char *key, int i) {
-	char tmp[32];
-	sprintf(tmp, "%d", static_cast<int>(i));
-	Set(key, tmp);
+static std::string FilterKey(const ImportFilter &filter) {
+	std::string key;
+	for (std::set<std::string>::const_iterator it = filter.excludes.begin(); it != filter.excludes.end(); ++it) {
+		key += *it;
+		key += " ";
+	}
+	key += "|";
+	for (std::set<std::string>::const_iterator it = filter.includes.begin(); it != filter.includes.end(); ++it) {
+		key += " ";
+		key += *it;
+	}
+	return key;
 }
 
-static bool StringEqual(const char *a, const char *b, size_t len, bool caseSensitive) {
-	if (caseSensitive) {
-		for (size_t i = 0; i < len; i++) {
-			if (a[i] != b[i])
-				return false;
+/**
+ * Read a properties file and its imports from the cache when a snapshot of them is current,
+ * otherwise read them from the files and give the cache a new snapshot.
+ */
+void PropSetFile::ReadCached(PropertiesCache &cache, FilePath filename, FilePath directoryForImports,
+                             const ImportFilter &filter, std::vector<FilePath> *imports) {
+	const std::string file = filename.AsUTF8();
+	const std::string filterKey = FilterKey(filter);
+	PropertiesSnapshot *snapshot = cache.Find(file, filterKey);
+	if (snapshot && snapshot->Current(filter) && snapshot->ConditionsHold(superPS)) {
+		snapshot->used = true;
+		props.clear();
+		for (size_t i = 0; i < snapshot->properties.size(); i++) {
+			// Already sorted so each insertion is at the end
+			props.insert(props.end(), snapshot->properties[i]);
 		}
-	} else {
-		for (size_t i = 0; i < len; i++) {
-			if (MakeUpperCase(a[i]) != MakeUpperCase(b[i]))
-				return false;
+		Changed();
+		if (imports) {
+			for (size_t i = 0; i < snapshot->imports.size(); i++) {
+				FilePath importPath(GUI::StringFromUTF8(snapshot->imports[i].c_str()));
+				if (std::find(imports->begin(), imports->end(), importPath) == imports->end()) {
+					imports->push_back(importPath);
+				}
+			}
 		}
+		return;
 	}
-	return true;
-}
 
-// Match file names to patterns allowing for a '*' suffix or prefix.
-static bool MatchWild(const char *pattern, size_t lenPattern, const char *fileName, bool caseSensitive) {
-	size_t lenFileName = strlen(fileName);
-	if (lenFileName == lenPattern) {
-		if (StringEqual(pattern, fileName, lenFileName, caseSensitive)) {
-			return true;
+	PropertiesSnapshot fresh;
+	fresh.file = file;
+	fresh.filter = filterKey;
+	std::vector<FilePath> importsRead;
+	recording = &fresh;
+	Read(filename, directoryForImports, filter, &importsRead, 0);
+	recording = 0;
+	for (size_t i = 0; i < importsRead.size(); i++) {
+		fresh.imports.push_back(importsRead[i].AsUTF8());
+		if (imports && (std::find(imports->begin(), imports->end(), importsRead[i]) == imports->end())) {
+			imports->push_back(importsRead[i]);
 		}
 	}
-	if (lenFileName >= lenPattern-1) {
-		if (pattern[0] == '*') {
-			// Matching suffixes
-			return StringEqual(pattern+1, fileName + lenFileName - (lenPattern-1), lenPattern-1, caseSensitive);
-		} else if (pattern[lenPattern-1] == '*') {
-			// Matching prefixes
-			return StringEqual(pattern, fileName, lenPattern-1, caseSensitive);
-		}
+	fresh.properties.assign(props.begin(), props.end());
+	fresh.used = true;
+	// Conditions that depended on properties set by these files can not be checked later
+	if (fresh.ConditionsHold(superPS)) {
+		cache.Replace(fresh);
 	}
-	return false;
+}
+
+void PropSetFile::SetInteger(const char *key, int i) {
+	char tmp[32];
+	sprintf(tmp, "%d", static_cast<int>(i));
+	Set(key, tmp);
 }
 
 static bool startswith(const std::string &s, const char *keybase) {
 	return isPrefix(s.c_str(), keybase);
 }
 
-std::string PropSetFile::GetWildUsingStart(const PropSetFile &psStart, const char *keybase, const char *filename) {
+void PropSetFile::IndexWild(WildIndex &index, const char *keybase) const {
 	const std::string sKeybase(keybase);
 	const size_t lenKeybase = strlen(keybase);
 	const PropSetFile *psf = this;
@@ -537,48 +770,86 @@ std::string PropSetFile::GetWildUsingStart(const PropSetFile &psStart, const cha
 		mapss::const_iterator it = psf->props.lower_bound(sKeybase);
 		while ((it != psf->props.end()) && startswith(it->first, keybase)) {
 			const char *orgkeyfile = it->first.c_str() + lenKeybase;
-			char *keyptr = NULL;
+			std::string keyfile = orgkeyfile;
 
 			if (strncmp(orgkeyfile, "$(", 2) == 0) {
 				const char *cpendvar = strchr(orgkeyfile, ')');
 				if (cpendvar) {
 					std::string var(orgkeyfile, 2, cpendvar - orgkeyfile - 2);
-					std::string s = psStart.GetExpandedString(var.c_str());
-					keyptr = StringDup(s.c_str());
+					keyfile = GetExpandedString(var.c_str());
 				}
 			}
-			const char *keyfile = keyptr;
-
-			if (keyfile == NULL)
-				keyfile = orgkeyfile;
 
+			const size_t key = index.AddKey(it->second);
+			size_t start = 0;
 			for (;;) {
-				const char *del = strchr(keyfile, ';');
-				if (del == NULL)
-					del = keyfile + strlen(keyfile);
-				if (MatchWild(keyfile, del - keyfile, filename, caseSensitiveFilenames)) {
-					delete []keyptr;
-					return it->second;
-				}
-				if (*del == '\0')
+				size_t del = keyfile.find(';', start);
+				if (del == std::string::npos)
+					del = keyfile.length();
+				index.AddPattern(key, keyfile.substr(start, del - start));
+				if (del == keyfile.length())
 					break;
-				keyfile = del + 1;
+				start = del + 1;
 			}
-			delete []keyptr;
 
-			if (0 == strcmp(it->first.c_str(), keybase)) {
-				return it->second;
+			if (it->first == sKeybase) {
+				index.AddAlways(key);
 			}
 			++it;
 		}
 		// Failed here, so try in base property set
 		psf = psf->superPS;
 	}
-	return "";
+}
+
+/**
+ * Forget all resolutions when the chain of sets has changed or when changes to a set since
+ * the resolutions were last checked have been forgotten.
+ */
+void PropSetFile::CheckResolutions() {
+	if (!resolutions)
+		resolutions = new Resolutions();
+	if (resolutions->reading)
+		return;	// Sets do not change while resolving
+	bool same = resolutions->caseSensitive == caseSensitiveFilenames;
+	unsigned int latest = 0;
+	size_t depth = 0;
+	for (const PropSetFile *psf = this; psf; psf = psf->superPS) {
+		same = same && (depth < resolutions->chain.size()) && (resolutions->chain[depth] == psf) &&
+			(psf->changesStart <= resolutions->latest);
+		if (latest < psf->version)
+			latest = psf->version;
+		depth++;
+	}
+	if (!same || (depth != resolutions->chain.size())) {
+		resolutions->caseSensitive = caseSensitiveFilenames;
+		resolutions->chain.clear();
+		for (const PropSetFile *psf = this; psf; psf = psf->superPS) {
+			resolutions->chain.push_back(psf);
+		}
+		resolutions->wilds.clear();
+		resolutions->expansions.clear();
+	}
+	resolutions->latest = latest;
 }
 
 std::string PropSetFile::GetWild(const char *keybase, const char *filename) {
-	return GetWildUsingStart(*this, keybase, filename);
+	CheckResolutions();
+	std::map<std::string, WildIndex>::iterator it = resolutions->wilds.find(keybase);
+	if ((it != resolutions->wilds.end()) && !Unchanged(it->second.dependencies)) {
+		resolutions->wilds.erase(it);
+		it = resolutions->wilds.end();
+	}
+	if (it == resolutions->wilds.end()) {
+		it = resolutions->wilds.insert(std::make_pair(std::string(keybase), WildIndex(caseSensitiveFilenames))).first;
+		it->second.dependencies.resolved = resolutions->latest;
+		Resolutions::Scope scope(*resolutions, it->second.dependencies);
+		Reading(keybase, true);
+		IndexWild(it->second, keybase);
+	} else if (resolutions->reading) {
+		resolutions->reading->Add(it->second.dependencies);
+	}
+	return it->second.Find(filename);
 }
 
 // GetNewExpand does not use Expand as it has to use GetWild with the filename for each
@@ -590,6 +861,23 @@ SString PropSetFile::GetNewExpand(const char *keybase, const char *filename) {
 }
 
 std::string PropSetFile::GetNewExpandString(const char *keybase, const char *filename) {
+	CheckResolutions();
+	std::string resolution(keybase);
+	resolution.push_back('\0');
+	resolution += filename;
+	std::map<std::string, Resolutions::Expansion>::iterator itResolved = resolutions->expansions.find(resolution);
+	if (itResolved != resolutions->expansions.end()) {
+		if (Unchanged(itResolved->second.dependencies)) {
+			if (resolutions->reading)
+				resolutions->reading->Add(itResolved->second.dependencies);
+			return itResolved->second.value;
+		}
+		resolutions->expansions.erase(itResolved);
+	}
+
+	Resolutions::Expansion expansion;
+	expansion.dependencies.resolved = resolutions->latest;
+	Resolutions::Scope scope(*resolutions, expansion.dependencies);
 	char *base = StringDup(GetWild(keybase, filename).c_str());
 	assert(base);
 	char *cpvar = strstr(base, "$(");
@@ -617,6 +905,8 @@ std::string PropSetFile::GetNewExpandString(const char *keybase, const char *fil
 	}
 	std::string sret = base;
 	delete []base;
+	expansion.value = sret;
+	resolutions->expansions[resolution] = expansion;
 	return sret;
 }
 
@@ -650,6 +940,249 @@ bool PropSetFile::GetNext(const char *&key, const char *&val) {
 	return false;
 }
 
+void PropertiesSnapshot::AddFile(const FilePath &path) {
+	PropertiesSource source;
+	source.path = path.AsUTF8();
+	time_t modified = 0;
+	path.Status(source.size, modified);
+	source.modified = modified;
+	sources.push_back(source);
+}
+
+static std::string Listing(const FilePath &directory, const ImportFilter &filter) {
+	FilePathSet files = ImportableFiles(directory, filter);
+	std::string listing;
+	for (size_t i = 0; i < files.size(); i++) {
+		listing += files[i].AsUTF8();
+		listing += "\n";
+	}
+	return listing;
+}
+
+void PropertiesSnapshot::AddDirectory(const FilePath &directory, const ImportFilter &filter) {
+	PropertiesSource source;
+	source.path = directory.AsUTF8();
+	source.size = PropertiesSource::sizeDirectory;
+	source.modified = 0;
+	source.listing = Listing(directory, filter);
+	sources.push_back(source);
+}
+
+bool PropertiesSnapshot::ConditionsHold(const PropSetFile *superPS) const {
+	for (size_t i = 0; i < conditions.size(); i++) {
+		const bool value = superPS && (superPS->GetInt(conditions[i].first.c_str()) != 0);
+		if (value != conditions[i].second)
+			return false;
+	}
+	return true;
+}
+
+bool PropertiesSnapshot::Current(const ImportFilter &filter) const {
+	for (size_t i = 0; i < sources.size(); i++) {
+		const PropertiesSource &source = sources[i];
+		FilePath path(GUI::StringFromUTF8(source.path.c_str()));
+		if (source.size == PropertiesSource::sizeDirectory) {
+			if (Listing(path, filter) != source.listing)
+				return false;
+		} else {
+			long long size = -1;
+			time_t modified = 0;
+			path.Status(size, modified);
+			if ((size != source.size) || (modified != source.modified))
+				return false;
+		}
+	}
+	return true;
+}
+
+// The cache is only read by the program that wrote it so numbers are in native byte order.
+static const char cacheSignature[] = "SciTE properties cache 1\n";
+
+namespace {
+
+class CacheWriter {
+public:
+	std::string data;
+	void Number(long long value) {
+		data.append(reinterpret_cast<const char *>(&value), sizeof(value));
+	}
+	void String(const std::string &s) {
+		Number(s.length());
+		data.append(s);
+	}
+};
+
+class CacheReader {
+	const char *position;
+	const char *end;
+public:
+	bool valid;
+	CacheReader(const char *data, size_t length) : position(data), end(data + length), valid(true) {
+	}
+	bool AtEnd() const {
+		return position == end;
+	}
+	long long Number() {
+		long long value = 0;
+		if (valid && (static_cast<size_t>(end - position) >= sizeof(value))) {
+			memcpy(&value, position, sizeof(value));
+			position += sizeof(value);
+		} else {
+			valid = false;
+		}
+		return value;
+	}
+	std::string String() {
+		const long long length = Number();
+		if (valid && (length >= 0) && (length <= end - position)) {
+			std::string s(position, static_cast<size_t>(length));
+			position += length;
+			return s;
+		}
+		valid = false;
+		return std::string();
+	}
+	// A count of items that each take at least one number so corrupt counts are caught early
+	size_t Count() {
+		const long long count = Number();
+		if ((count < 0) || (count > (end - position) / static_cast<long long>(sizeof(long long)))) {
+			valid = false;
+			return 0;
+		}
+		return static_cast<size_t>(count);
+	}
+};
+
+}
+
+PropertiesCache::PropertiesCache(const FilePath &path_) : path(path_), changed(false) {
+}
+
+void PropertiesCache::Load() {
+	snapshots.clear();
+	changed = false;
+	FILE *fp = path.Open(fileRead);
+	if (!fp)
+		return;
+	std::vector<char> data;
+	fseek(fp, 0, SEEK_END);
+	const long length = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	if (length > 0) {
+		data.resize(length);
+		data.resize(fread(&data[0], 1, data.size(), fp));
+	}
+	fclose(fp);
+
+	const size_t lenSignature = strlen(cacheSignature);
+	if ((data.size() < lenSignature) || (memcmp(&data[0], cacheSignature, lenSignature) != 0))
+		return;
+	CacheReader reader(&data[0] + lenSignature, data.size() - lenSignature);
+	const size_t count = reader.Count();
+	snapshots.resize(count);
+	for (size_t i = 0; (i < count) && reader.valid; i++) {
+		PropertiesSnapshot &snapshot = snapshots[i];
+		snapshot.file = reader.String();
+		snapshot.filter = reader.String();
+		const size_t sources = reader.Count();
+		for (size_t j = 0; (j < sources) && reader.valid; j++) {
+			PropertiesSource source;
+			source.path = reader.String();
+			source.size = reader.Number();
+			source.modified = reader.Number();
+			source.listing = reader.String();
+			snapshot.sources.push_back(source);
+		}
+		const size_t conditions = reader.Count();
+		for (size_t j = 0; (j < conditions) && reader.valid; j++) {
+			const std::string expression = reader.String();
+			snapshot.conditions.push_back(std::pair<std::string, bool>(expression, reader.Number() != 0));
+		}
+		const size_t imports = reader.Count();
+		for (size_t j = 0; (j < imports) && reader.valid; j++) {
+			snapshot.imports.push_back(reader.String());
+		}
+		const size_t properties = reader.Count();
+		snapshot.properties.reserve(properties);
+		for (size_t j = 0; (j < properties) && reader.valid; j++) {
+			const std::string key = reader.String();
+			snapshot.properties.push_back(std::pair<std::string, std::string>(key, reader.String()));
+		}
+	}
+	if (!reader.valid || !reader.AtEnd()) {
+		// Damaged so start again
+		snapshots.clear();
+		changed = true;
+	}
+}
+
+void PropertiesCache::Save() {
+	// Drop snapshots not used this time such as those for an earlier import filter
+	for (size_t i = 0; i < snapshots.size();) {
+		if (snapshots[i].used) {
+			i++;
+		} else {
+			snapshots.erase(snapshots.begin() + i);
+			changed = true;
+		}
+	}
+	if (!changed)
+		return;
+	CacheWriter writer;
+	writer.data = cacheSignature;
+	writer.Number(snapshots.size());
+	for (size_t i = 0; i < snapshots.size(); i++) {
+		const PropertiesSnapshot &snapshot = snapshots[i];
+		writer.String(snapshot.file);
+		writer.String(snapshot.filter);
+		writer.Number(snapshot.sources.size());
+		for (size_t j = 0; j < snapshot.sources.size(); j++) {
+			writer.String(snapshot.sources[j].path);
+			writer.Number(snapshot.sources[j].size);
+			writer.Number(snapshot.sources[j].modified);
+			writer.String(snapshot.sources[j].listing);
+		}
+		writer.Number(snapshot.conditions.size());
+		for (size_t j = 0; j < snapshot.conditions.size(); j++) {
+			writer.String(snapshot.conditions[j].first);
+			writer.Number(snapshot.conditions[j].second ? 1 : 0);
+		}
+		writer.Number(snapshot.imports.size());
+		for (size_t j = 0; j < snapshot.imports.size(); j++) {
+			writer.String(snapshot.imports[j]);
+		}
+		writer.Number(snapshot.properties.size());
+		for (size_t j = 0; j < snapshot.properties.size(); j++) {
+			writer.String(snapshot.properties[j].first);
+			writer.String(snapshot.properties[j].second);
+		}
+	}
+	FILE *fp = path.Open(fileWrite);
+	if (fp) {
+		fwrite(writer.data.c_str(), 1, writer.data.length(), fp);
+		fclose(fp);
+		changed = false;
+	}
+}
+
+PropertiesSnapshot *PropertiesCache::Find(const std::string &file, const std::string &filter) {
+	for (size_t i = 0; i < snapshots.size(); i++) {
+		if ((snapshots[i].file == file) && (snapshots[i].filter == filter))
+			return &snapshots[i];
+	}
+	return 0;
+}
+
+void PropertiesCache::Replace(const PropertiesSnapshot &snapshot) {
+	PropertiesSnapshot *existing = Find(snapshot.file, snapshot.filter);
+	if (existing) {
+		*existing = snapshot;
+	} else {
+		snapshots.push_back(snapshot);
+	}
+	changed = true;
+}
+
 int CompareNoCase(const char *a, const char *b) {
 	while (*a && *b) {
 		if (*a != *b) {
@@ -18,11 +18,70 @@ public:
 	bool IsValid(std::string name) const;
 };
 
+class PropSetFile;
+
+/// A file read as properties or a directory whose properties files were imported.
+struct PropertiesSource {
+	enum { sizeDirectory = -2 };
+	std::string path;
+	long long size;	///< -1 when the file could not be opened
+	long long modified;
+	std::string listing;	///< Importable file names for a directory
+};
+
+/// The properties read from a file and its imports with everything that decided them.
+struct PropertiesSnapshot {
+	std::string file;
+	std::string filter;
+	std::vector<PropertiesSource> sources;
+	std::vector<std::pair<std::string, bool> > conditions;
+	std::vector<std::string> imports;
+	std::vector<std::pair<std::string, std::string> > properties;	///< Sorted by key
+	bool used;
+	PropertiesSnapshot() : used(false) {}
+	void AddFile(const FilePath &path);
+	void AddDirectory(const FilePath &directory, const ImportFilter &filter);
+	bool ConditionsHold(const PropSetFile *superPS) const;
+	bool Current(const ImportFilter &filter) const;
+};
+
+/**
+ * Keeps snapshots of properties files in one binary file so they can be loaded in one
+ * read instead of parsing every file again when none of them have changed.
+ */
+class PropertiesCache {
+	FilePath path;
+	std::vector<PropertiesSnapshot> snapshots;
+	bool changed;
+public:
+	explicit PropertiesCache(const FilePath &path_);
+	void Load();
+	void Save();
+	PropertiesSnapshot *Find(const std::string &file, const std::string &filter);
+	void Replace(const PropertiesSnapshot &snapshot);
+};
+
 class PropSetFile {
 	bool lowerKeys;
-	std::string GetWildUsingStart(const PropSetFile &psStart, const char *keybase, const char *filename);
 	static bool caseSensitiveFilenames;
 	mapss props;
+	PropertiesSnapshot *recording;
+	// Changes whenever props changes so results resolved through this set can be checked
+	static unsigned int lastVersion;
+	unsigned int version;
+	// Keys changed after version changesStart so resolutions not using them can be kept
+	std::vector<std::pair<unsigned int, std::string> > changes;
+	unsigned int changesStart;
+	struct Dependencies;
+	class WildIndex;
+	struct Resolutions;
+	Resolutions *resolutions;
+	void Changed();
+	void Changed(const std::string &key);
+	bool Unchanged(Dependencies &dependencies) const;
+	void Reading(const std::string &key, bool prefix=false) const;
+	void CheckResolutions();
+	void IndexWild(WildIndex &index, const char *keybase) const;
 public:
 	PropSetFile *superPS;
 	PropSetFile(bool lowerKeys_=false);
@@ -46,6 +105,7 @@ public:
 	void ReadFromMemory(const char *data, size_t len, FilePath directoryForImports, const ImportFilter &filter, std::vector<FilePath> *imports, size_t depth);
 	void Import(FilePath filename, FilePath directoryForImports, const ImportFilter &filter, std::vector<FilePath> *imports, size_t depth);
 	bool Read(FilePath filename, FilePath directoryForImports, const ImportFilter &filter, std::vector<FilePath> *imports, size_t depth);
+	void ReadCached(PropertiesCache &cache, FilePath filename, FilePath directoryForImports, const ImportFilter &filter, std::vector<FilePath> *imports);
 	void SetInteger(const char *key, int i);
 	std::string GetWild(const char *keybase, const char *filename);
 	SString GetNewExpand(const char *keybase, const char *filename="");
@@ -41,7 +41,9 @@
 #include "Cookie.h"
 #include "Worker.h"
 #include "FileWorker.h"
+#include "APIRepository.h"
 #include "MatchMarker.h"
+#include "WordIndex.h"
 #include "SciTEBase.h"
 
 Searcher::Searcher() {
@@ -94,7 +96,7 @@ bool &Searcher::FlagFromCmd(int cmd) {
 	return notFound;
 }
 
-SciTEBase::SciTEBase(Extension *ext) : apis(true), extender(ext) {
+SciTEBase::SciTEBase(Extension *ext) : apis(0), extender(ext) {
 	needIdle = false;
 	codePage = 0;
 	characterSet = 0;
@@ -153,6 +155,8 @@ SciTEBase::SciTEBase(Extension *ext) : apis(true), extender(ext) {
 	indentationWSVisible = true;
 	indentExamine = SC_IV_LOOKBOTH;
 	autoCompleteIgnoreCase = false;
+	wordCompletionRequested = false;
+	undoRedoLazy = false;
 	callTipUseEscapes = false;
 	callTipIgnoreCase = false;
 	autoCCausedByOnlyOne = false;
@@ -187,10 +191,19 @@ SciTEBase::SciTEBase(Extension *ext) : apis(true), extender(ext) {
 
 	timerMask = 0;
 	delayBeforeAutoSave = 0;
+
+	apiRepository = new APIRepository();
 }
 
 SciTEBase::~SciTEBase() {
 	TimerEnd(timerAutoSave);
+	for (size_t i = 0; i < exporters.size(); i++) {
+		exporters[i]->Cancel();
+		delete exporters[i];
+	}
+	delete apiRepository;
+	apiRepository = 0;
+	apis = 0;
 	if (extender)
 		extender->Finalise();
 	popup.Destroy();
@@ -209,6 +222,14 @@ void SciTEBase::WorkerCommand(int cmd, Worker *pWorker) {
 	case WORK_FILEPROGRESS:
  		UpdateProgress(pWorker);
 		break;
+	case WORK_APILOADED:
+		apiRepository->Loaded(static_cast<APILoader *>(pWorker));
+		apiRepository->Find(apisFileNames.c_str(), apis);
+		CheckMenus();
+		break;
+	case WORK_EXPORTED:
+		Exported(static_cast<FileWorker *>(pWorker));
+		break;
 	}
 }
 
@@ -948,7 +969,8 @@ void SciTEBase::MarkAll(MarkPurpose purpose) {
 	int flags = (wholeWord ? SCFIND_WHOLEWORD : 0) |
 	        (matchCase ? SCFIND_MATCHCASE : 0) |
 	        (regExp ? SCFIND_REGEXP : 0) |
-	        (props.GetInt("find.replace.regexp.posix") ? SCFIND_POSIX : 0);
+	        (props.GetInt("find.replace.regexp.posix") ? SCFIND_POSIX : 0) |
+	        (props.GetInt("find.replace.regexp.dfa") ? SCFIND_DFAREGEX : 0);
 
 	findMarker.StartMatch(&wEditor, findTarget,
 		flags, -1,
@@ -1039,7 +1061,8 @@ int SciTEBase::FindNext(bool reverseDirection, bool showWarnings, bool allowRegE
 	int flags = (wholeWord ? SCFIND_WHOLEWORD : 0) |
 	        (matchCase ? SCFIND_MATCHCASE : 0) |
 	        ((allowRegExp && regExp) ? SCFIND_REGEXP : 0) |
-	        (props.GetInt("find.replace.regexp.posix") ? SCFIND_POSIX : 0);
+	        (props.GetInt("find.replace.regexp.posix") ? SCFIND_POSIX : 0) |
+	        (props.GetInt("find.replace.regexp.dfa") ? SCFIND_DFAREGEX : 0);
 
 	wEditor.Call(SCI_SETSEARCHFLAGS, flags);
 	int posFind = FindInTarget(findTarget, startPosition, endPosition);
@@ -1154,7 +1177,8 @@ int SciTEBase::DoReplaceAll(bool inSelection) {
 	int flags = (wholeWord ? SCFIND_WHOLEWORD : 0) |
 	        (matchCase ? SCFIND_MATCHCASE : 0) |
 	        (regExp ? SCFIND_REGEXP : 0) |
-	        (props.GetInt("find.replace.regexp.posix") ? SCFIND_POSIX : 0);
+	        (props.GetInt("find.replace.regexp.posix") ? SCFIND_POSIX : 0) |
+	        (props.GetInt("find.replace.regexp.dfa") ? SCFIND_DFAREGEX : 0);
 	wEditor.Call(SCI_SETSEARCHFLAGS, flags);
 	int posFind = FindInTarget(findTarget, startPosition, endPosition);
 	if ((findTarget.length() == 1) && regExp && (findTarget[0] == '^')) {
@@ -1447,7 +1471,7 @@ char *SciTEBase::GetNearestWords(const char *wordStart, size_t searchLen,
 		const char *separators, bool ignoreCase /*=false*/, bool exactLen /*=false*/) {
 	char *words = 0;
 	while (!words && *separators) {
-		words = apis.GetNearestWords(wordStart, searchLen, ignoreCase, *separators, exactLen);
+		words = apis->GetNearestWords(wordStart, searchLen, ignoreCase, *separators, exactLen);
 		separators++;
 	}
 	return words;
@@ -1472,7 +1496,7 @@ void SciTEBase::FillFunctionDefinition(int pos /*= -1*/) {
 		delete []words;
 
 		// Should get current api definition
-		const char *word = apis.GetNearestWord(currentCallTipWord.c_str(), currentCallTipWord.length(),
+		const char *word = apis->GetNearestWord(currentCallTipWord.c_str(), currentCallTipWord.length(),
 		        callTipIgnoreCase, calltipWordCharacters, currentCallTip);
 		if (word) {
 			functionDefinition = word;
@@ -1659,6 +1683,37 @@ bool SciTEBase::StartAutoComplete() {
 	return true;
 }
 
+/**
+ * The word index of the current buffer, started again if it does not match the document.
+ * Mapped documents are read only and may be huge so they have no index and NULL is returned.
+ */
+WordIndex *SciTEBase::CurrentWordIndex() {
+	Buffer *buffer = CurrentBuffer();
+	if (buffer->isMapped) {
+		if (buffer->wordIndex)
+			buffer->wordIndex->Clear();
+		return 0;
+	}
+	if (!buffer->wordIndex)
+		buffer->wordIndex = new WordIndex();
+	if (!buffer->wordIndex->Valid(&wEditor, wordCharacters.c_str()))
+		buffer->wordIndex->Start(&wEditor, wordCharacters.c_str());
+	return buffer->wordIndex;
+}
+
+/// Words are only indexed in the background once they may be needed for completion.
+bool SciTEBase::IndexWordsWhileIdle() {
+	return wordCompletionRequested || props.GetInt("autocompleteword.automatic") ||
+		props.GetInt("autocompleteword.buffers");
+}
+
+static bool CompareWordsNoCase(const std::string &a, const std::string &b) {
+	const int cmp = CompareNoCase(a.c_str(), b.c_str());
+	if (cmp != 0)
+		return cmp < 0;
+	return a < b;
+}
+
 bool SciTEBase::StartAutoCompleteWord(bool onlyOneWord) {
 	const std::string line = GetCurrentLine();
 	const int current = GetCaretInLine();
@@ -1675,65 +1730,45 @@ bool SciTEBase::StartAutoCompleteWord(bool onlyOneWord) {
 	if (startword == current || allNumber)
 		return true;
 	const std::string root = line.substr(startword, current - startword);
-	const int doclen = LengthDocument();
-	Sci_TextToFind ft = {{0, 0}, 0, {0, 0}};
-	ft.lpstrText = const_cast<char *>(root.c_str());
-	ft.chrg.cpMin = 0;
-	ft.chrg.cpMax = doclen;
-	ft.chrgText.cpMin = 0;
-	ft.chrgText.cpMax = 0;
-	const int flags = SCFIND_WORDSTART | (autoCompleteIgnoreCase ? 0 : SCFIND_MATCHCASE);
-	const int posCurrentWord = wEditor.Call(SCI_GETCURRENTPOS) - static_cast<int>(root.length());
-	unsigned int minWordLength = 0;
-	unsigned int nwords = 0;
-
-	// wordsNear contains a list of words separated by single spaces and with a space
-	// at the start and end. This makes it easy to search for words.
-	std::string wordsNear;
-	wordsNear.append("\n");
-
-	int posFind = wEditor.CallString(SCI_FINDTEXT, flags, reinterpret_cast<char *>(&ft));
-	TextReader acc(wEditor);
-	while (posFind >= 0 && posFind < doclen) {	// search all the document
-		int wordEnd = posFind + static_cast<int>(root.length());
-		if (posFind != posCurrentWord) {
-			while (wordCharacters.contains(acc.SafeGetCharAt(wordEnd)))
-				wordEnd++;
-			const unsigned int wordLength = wordEnd - posFind;
-			if (wordLength > root.length()) {
-				std::string word = GetRangeString(wEditor, posFind, wordEnd);
-				word.insert(0, "\n");
-				word.append("\n");
-				if (wordsNear.find(word.c_str()) == std::string::npos) {	// add a new entry
-					wordsNear += word.c_str() + 1;
-					if (minWordLength < wordLength)
-						minWordLength = wordLength;
-
-					nwords++;
-					if (onlyOneWord && nwords > 1) {
-						return true;
-					}
-				}
-			}
+	// The word being typed is in the document but should not complete itself
+	size_t endword = current;
+	while (endword < line.length() && wordCharacters.contains(line[endword]))
+		endword++;
+	const std::string wordCurrent = line.substr(startword, endword - startword);
+
+	wordCompletionRequested = true;
+	std::vector<std::string> wordsNear;
+	WordIndex *wordIndex = CurrentWordIndex();
+	if (wordIndex) {
+		while (!wordIndex->Complete())
+			wordIndex->Continue(&wEditor);
+		wordIndex->WordsStarting(root, autoCompleteIgnoreCase, wordCurrent, wordsNear);
+	}
+	if (props.GetInt("autocompleteword.buffers")) {
+		for (int i = 0; i < buffers.length; i++) {
+			Buffer &buffer = buffers.buffers[i];
+			if ((i != buffers.Current()) && buffer.wordIndex && buffer.wordIndex->Complete())
+				buffer.wordIndex->WordsStarting(root, autoCompleteIgnoreCase, std::string(), wordsNear);
+		}
+	}
+	if (autoCompleteIgnoreCase)
+		std::sort(wordsNear.begin(), wordsNear.end(), CompareWordsNoCase);
+	else
+		std::sort(wordsNear.begin(), wordsNear.end());
+	wordsNear.erase(std::unique(wordsNear.begin(), wordsNear.end()), wordsNear.end());
+
+	if (onlyOneWord && wordsNear.size() > 1)
+		return true;
+	if (!wordsNear.empty()) {
+		// Use \n as word separator so words may contain spaces
+		std::string acText;
+		for (size_t i = 0; i < wordsNear.size(); i++) {
+			if (i)
+				acText += '\n';
+			acText += wordsNear[i];
 		}
-		ft.chrg.cpMin = wordEnd;
-		posFind = wEditor.CallString(SCI_FINDTEXT, flags, reinterpret_cast<char *>(&ft));
-	}
-	const size_t length = wordsNear.length();
-	if ((length > 2) && (!onlyOneWord || (minWordLength > root.length()))) {
-		// Protect spaces by temporrily transforming to \001
-		std::replace(wordsNear.begin(), wordsNear.end(), ' ', '\001');
-		StringList wl(true);
-		wl.Set(wordsNear.c_str());
-		char *words = wl.GetNearestWords("", 0, autoCompleteIgnoreCase);
-		std::string acText(words);
-		// Use \n as word separator
-		std::replace(acText.begin(), acText.end(), ' ', '\n');
-		// Return spaces from \001
-		std::replace(acText.begin(), acText.end(), '\001', ' ');
 		wEditor.Call(SCI_AUTOCSETSEPARATOR, '\n');
 		wEditor.CallString(SCI_AUTOCSHOW, root.length(), acText.c_str());
-		delete []words;
 	} else {
 		wEditor.Call(SCI_AUTOCCANCEL);
 	}
@@ -3505,6 +3540,7 @@ void SciTEBase::MenuCommand(int cmdID, int source) {
 		break;
 
 	case IDM_STOPEXECUTE:
+		CancelExports();
 		StopExecute();
 		break;
 
@@ -3922,6 +3958,13 @@ void SciTEBase::Notify(SCNotification *notification) {
 		if (CurrentBuffer()->findMarks == Buffer::fmModified) {
 			RemoveFindMarks();
 		}
+		if ((notification->nmhdr.idFrom == IDM_SRCWIN) && IndexWordsWhileIdle()) {
+			WordIndex *wordIndex = CurrentWordIndex();
+			if (wordIndex && !wordIndex->Complete()) {
+				// Index the words of the document while idle
+				SetIdler(true);
+			}
+		}
 		if (notification->updated & (SC_UPDATE_SELECTION | SC_UPDATE_CONTENT)) {
 			if ((notification->nmhdr.idFrom == IDM_SRCWIN) == (wEditor.HasFocus())) {
 				// Obly highlight focussed pane.
@@ -3941,8 +3984,13 @@ void SciTEBase::Notify(SCNotification *notification) {
 		break;
 
 	case SCN_MODIFIED:
-		if (notification->nmhdr.idFrom == IDM_SRCWIN)
+		if (notification->nmhdr.idFrom == IDM_SRCWIN) {
 			CurrentBuffer()->DocumentModified();
+			if (CurrentBuffer()->wordIndex) {
+				CurrentBuffer()->wordIndex->Modified(&wEditor, notification->modificationType,
+					notification->position, notification->length, notification->linesAdded);
+			}
+		}
 		if (notification->modificationType & SC_LASTSTEPINUNDOREDO) {
 			//when the user hits undo or redo, several normal insert/delete
 			//notifications may fire, but we will end up here in the end
@@ -3953,8 +4001,10 @@ void SciTEBase::Notify(SCNotification *notification) {
 				currentWordHighlight.textHasChanged = true;
 			}
 			//this will be called a lot, and usually means "typing".
-			EnableAMenuItem(IDM_UNDO, true);
-			EnableAMenuItem(IDM_REDO, false);
+			if (!undoRedoLazy) {
+				EnableAMenuItem(IDM_UNDO, true);
+				EnableAMenuItem(IDM_REDO, false);
+			}
 			if (CurrentBuffer()->findMarks == Buffer::fmMarked) {
 				CurrentBuffer()->findMarks = Buffer::fmModified;
 			}
@@ -4085,7 +4135,7 @@ void SciTEBase::CheckMenus() {
 	EnableAMenuItem(IDM_OPENDIRECTORYPROPERTIES, props.GetInt("properties.directory.enable") != 0);
 	for (int toolItem = 0; toolItem < toolMax; toolItem++)
 		EnableAMenuItem(IDM_TOOLS + toolItem, ToolIsImmediate(toolItem) || !jobQueue.IsExecuting());
-	EnableAMenuItem(IDM_STOPEXECUTE, jobQueue.IsExecuting());
+	EnableAMenuItem(IDM_STOPEXECUTE, jobQueue.IsExecuting() || !exporters.empty());
 	if (buffers.size > 0) {
 		TabSelect(buffers.Current());
 		for (int bufferItem = 0; bufferItem < buffers.lengthVisible; bufferItem++) {
@@ -4203,6 +4253,11 @@ void SciTEBase::OnIdle() {
 		matchMarker.Continue();
 		return;
 	}
+	WordIndex *wordIndex = IndexWordsWhileIdle() ? CurrentWordIndex() : 0;
+	if (wordIndex && !wordIndex->Complete()) {
+		wordIndex->Continue(&wEditor);
+		return;
+	}
 	SetIdler(false);
 }
 
@@ -4256,15 +4311,15 @@ void SciTEBase::PerformOne(char *action) {
 		} else if (isprefix(action, "enumproperties:")) {
 			EnumProperties(arg);
 		} else if (isprefix(action, "exportashtml:")) {
-			SaveToHTML(GUI::StringFromUTF8(arg));
+			SaveToHTML(GUI::StringFromUTF8(arg), true);
 		} else if (isprefix(action, "exportasrtf:")) {
-			SaveToRTF(GUI::StringFromUTF8(arg));
+			SaveToRTF(GUI::StringFromUTF8(arg), 0, -1, true);
 		} else if (isprefix(action, "exportaspdf:")) {
-			SaveToPDF(GUI::StringFromUTF8(arg));
+			SaveToPDF(GUI::StringFromUTF8(arg), true);
 		} else if (isprefix(action, "exportaslatex:")) {
-			SaveToTEX(GUI::StringFromUTF8(arg));
+			SaveToTEX(GUI::StringFromUTF8(arg), true);
 		} else if (isprefix(action, "exportasxml:")) {
-			SaveToXML(GUI::StringFromUTF8(arg));
+			SaveToXML(GUI::StringFromUTF8(arg), true);
 		} else if (isprefix(action, "find:") && wEditor.Created()) {
 			findWhat = arg;
 			FindNext(false, false);
@@ -4687,10 +4742,14 @@ bool SciTEBase::ProcessCommandLine(GUI::gui_string &args, int phase) {
 
 // Implement ExtensionAPI methods
 sptr_t SciTEBase::Send(Pane p, unsigned int msg, uptr_t wParam, sptr_t lParam) {
-	if (p == paneEditor)
-		return wEditor.Call(msg, wParam, lParam);
-	else
-		return wOutput.Call(msg, wParam, lParam);
+	GUI::ScintillaWindow &wPane = (p == paneEditor) ? wEditor : wOutput;
+	switch (msg) {
+	case SCI_GETCHARACTERPOINTER:
+	case SCI_GETRANGEPOINTER:
+		// Extensions may read the document in place so the pointer must not be truncated
+		return wPane.CallReturnPointer(msg, wParam, lParam);
+	}
+	return wPane.Call(msg, wParam, lParam);
 }
 
 char *SciTEBase::Range(Pane p, int start, int end) {
@@ -77,12 +77,17 @@ public:
 };
 
 struct FileWorker;
+class Exporter;
+class APIRepository;
+class WordIndex;
+class GrepQueue;
 
 class Buffer : public RecentFile {
 public:
 	sptr_t doc;
 	bool isDirty;
 	bool isReadOnly;
+	bool isMapped;	///< Shows a memory mapped file
 	bool failedSave;
 	bool useMonoFont;
 	enum { empty, reading, readAll, open } lifeState;
@@ -95,17 +100,19 @@ public:
 	std::vector<int> foldState;
 	std::vector<int> bookmarks;
 	FileWorker *pFileWorker;
+	WordIndex *wordIndex;	///< Owned by the BufferList and moved with doc
 	PropSetFile props;
 	enum FutureDo { fdNone=0, fdFinishSave=1 } futureDo;
 	Buffer() :
-			RecentFile(), doc(0), isDirty(false), isReadOnly(false), failedSave(false), useMonoFont(true), lifeState(empty),
+			RecentFile(), doc(0), isDirty(false), isReadOnly(false), isMapped(false), failedSave(false), useMonoFont(true), lifeState(empty),
 			unicodeMode(uni8Bit), fileModTime(0), fileModLastAsk(0), documentModTime(0),
-			findMarks(fmNone), pFileWorker(0), futureDo(fdNone) {}
+			findMarks(fmNone), pFileWorker(0), wordIndex(0), futureDo(fdNone) {}
 
 	void Init() {
 		RecentFile::Init();
 		isDirty = false;
 		isReadOnly = false;
+		isMapped = false;
 		failedSave = false;
 		useMonoFont = true;
 		lifeState = empty;
@@ -145,8 +152,9 @@ public:
 struct BackgroundActivities {
 	int loaders;
 	int storers;
-	int totalWork;
-	int totalProgress;
+	int exporters;
+	long long totalWork;
+	long long totalProgress;
 	GUI::gui_string fileNameLast;
 };
 
@@ -375,7 +383,8 @@ protected:
 	SString language;
 	int lexLanguage;
 	int lexLPeg;
-	StringList apis;
+	StringList *apis;	///< Owned by apiRepository
+	APIRepository *apiRepository;
 	SString apisFileNames;
 	std::string functionDefinition;
 
@@ -452,6 +461,8 @@ protected:
 	bool indentationWSVisible;
 	int indentExamine;
 	bool autoCompleteIgnoreCase;
+	bool wordCompletionRequested;	///< Once words have been completed, buffers are indexed while idle
+	bool undoRedoLazy;
 	bool callTipUseEscapes;
 	bool callTipIgnoreCase;
 	bool autoCCausedByOnlyOne;
@@ -487,6 +498,7 @@ protected:
 	int scrollOutput;
 	bool returnOutputToCommand;
 	JobQueue jobQueue;
+	std::vector<FileWorker *> exporters;	///< Exports being written in the background
 
 	bool macrosEnabled;
 	SString currentMacro;
@@ -586,7 +598,8 @@ protected:
 	void DiscoverEOLSetting();
 	void DiscoverIndentSetting();
 	std::string DiscoverLanguage();
-	void OpenFile(long fileSize, bool suppressMessage, bool asynchronous);
+	void OpenFile(long long fileSize, bool suppressMessage, bool asynchronous);
+	bool OpenMapped(long long fileSize);
 	virtual void OpenUriList(const char *) {}
 	virtual bool OpenDialog(FilePath directory, const GUI::gui_char *filesFilter) = 0;
 	virtual bool SaveAsDialog() = 0;
@@ -629,20 +642,23 @@ protected:
 	bool Save(SaveFlags sf = sfProgressVisible);
 	void SaveAs(const GUI::gui_char *file, bool fixCase);
 	virtual void SaveACopy() = 0;
-	void SaveToHTML(FilePath saveName);
+	void Export(Exporter *pExporter, bool synchronous);
+	void Exported(FileWorker *pExporter);
+	void CancelExports();
+	void SaveToHTML(FilePath saveName, bool synchronous = false);
 	void StripTrailingSpaces();
 	void EnsureFinalNewLine();
 	bool PrepareBufferForSave(FilePath saveName);
 	bool SaveBuffer(FilePath saveName, SaveFlags sf);
 	virtual void SaveAsHTML() = 0;
 	void SaveToStreamRTF(std::ostream &os, int start = 0, int end = -1);
-	void SaveToRTF(FilePath saveName, int start = 0, int end = -1);
+	void SaveToRTF(FilePath saveName, int start = 0, int end = -1, bool synchronous = false);
 	virtual void SaveAsRTF() = 0;
-	void SaveToPDF(FilePath saveName);
+	void SaveToPDF(FilePath saveName, bool synchronous = false);
 	virtual void SaveAsPDF() = 0;
-	void SaveToTEX(FilePath saveName);
+	void SaveToTEX(FilePath saveName, bool synchronous = false);
 	virtual void SaveAsTEX() = 0;
-	void SaveToXML(FilePath saveName);
+	void SaveToXML(FilePath saveName, bool synchronous = false);
 	virtual void SaveAsXML() = 0;
 	virtual FilePath GetDefaultDirectory() = 0;
 	virtual FilePath GetSciteDefaultHome() = 0;
@@ -743,6 +759,8 @@ protected:
 	void ContinueCallTip();
 	virtual void EliminateDuplicateWords(char *words);
 	virtual bool StartAutoComplete();
+	WordIndex *CurrentWordIndex();
+	bool IndexWordsWhileIdle();
 	virtual bool StartAutoCompleteWord(bool onlyOneWord);
 	virtual bool StartExpandAbbreviation();
 	bool PerformInsertAbbreviation();
@@ -856,7 +874,6 @@ protected:
 	void SetOverrideLanguage(int cmdID);
 	StyleAndWords GetStyleAndWords(const char *base);
 	SString ExtensionFileName();
-	static const char *GetNextPropItem(const char *pStart, char *pPropItem, int maxLen);
 	void ForwardPropertyToEditor(const char *key);
 	void DefineMarker(int marker, int markerType, Colour fore, Colour back, Colour backSelected);
 	void ReadAPI(const SString &fileNameForExtension);
@@ -901,7 +918,8 @@ protected:
 	    grepDot = 8, grepBinary = 16, grepScroll = 32
 	};
 	virtual bool GrepIntoDirectory(const FilePath &directory);
-	void GrepRecursive(GrepFlags gf, FilePath baseDir, const char *searchString, const GUI::gui_char *fileTypes);
+	void GrepRecursive(GrepFlags gf, FilePath baseDir, const GUI::gui_char *fileTypes, GrepQueue &queue);
+	void GrepOutput(GrepFlags gf, const std::string &os);
 	void InternalGrep(GrepFlags gf, const GUI::gui_char *directory, const GUI::gui_char *files,
 			  const char *search, sptr_t &originalEnd);
 	void EnumProperties(const char *action);
@@ -943,6 +961,8 @@ public:
 	void ProcessExecute();
 	GUI::WindowID GetID() { return wSciTE.GetID(); }
 
+	static const char *GetNextPropItem(const char *pStart, char *pPropItem, int maxLen);
+
 	virtual bool PerformOnNewThread(Worker *pWorker) = 0;
 	virtual void PostOnMainThread(int cmd, Worker *pWorker) = 0;
 	virtual void WorkerCommand(int cmd, Worker *pWorker);
@@ -40,6 +40,7 @@
 #include "Worker.h"
 #include "FileWorker.h"
 #include "MatchMarker.h"
+#include "WordIndex.h"
 #include "SciTEBase.h"
 
 const GUI::gui_char defaultSessionFileName[] = GUI_TEXT("SciTE.session");
@@ -91,6 +92,10 @@ void Buffer::CancelLoad() {
 BufferList::BufferList() : current(0), stackcurrent(0), stack(0), buffers(0), size(0), length(0), lengthVisible(0), initialised(false) {}
 
 BufferList::~BufferList() {
+	for (int i = 0; i < size; i++) {
+		delete buffers[i].wordIndex;
+		buffers[i].wordIndex = 0;
+	}
 	delete []buffers;
 	delete []stack;
 }
@@ -152,13 +157,17 @@ void BufferList::RemoveInvisible(int index) {
 }
 
 void BufferList::RemoveCurrent() {
-	// Delete and move up to fill gap but ensure doc pointer is saved.
+	// Delete and move up to fill gap but ensure doc pointer and word index are saved.
 	sptr_t currentDoc = buffers[current].doc;
+	WordIndex *currentWordIndex = buffers[current].wordIndex;
 	buffers[current].CompleteLoading();
 	for (int i = current;i < length - 1;i++) {
 		buffers[i] = buffers[i + 1];
 	}
 	buffers[length - 1].doc = currentDoc;
+	buffers[length - 1].wordIndex = currentWordIndex;
+	if (currentWordIndex)
+		currentWordIndex->Clear();
 
 	if (length > 1) {
 		CommitStackSelection();
@@ -282,6 +291,7 @@ BackgroundActivities BufferList::CountBackgroundActivities() const {
 	BackgroundActivities bg;
 	bg.loaders = 0;
 	bg.storers = 0;
+	bg.exporters = 0;
 	bg.totalWork = 0;
 	bg.totalProgress = 0;
 	for (int i = 0;i < length;i++) {
@@ -367,6 +377,8 @@ void SciTEBase::SwitchDocumentAt(int index, sptr_t pdoc) {
 	}
 	sptr_t pdocOld = buffers.buffers[index].doc;
 	buffers.buffers[index].doc = pdoc;
+	if (buffers.buffers[index].wordIndex)
+		buffers.buffers[index].wordIndex->Clear();
 	if (pdocOld) {
 		wEditor.Call(SCI_RELEASEDOCUMENT, 0, pdocOld);
 	}
@@ -492,6 +504,10 @@ bool SciTEBase::CanMakeRoom(bool maySaveIfDirty) {
 
 void SciTEBase::ClearDocument() {
 	wEditor.Call(SCI_SETREADONLY, 0);
+	if (wEditor.Call(SCI_GETREADONLY)) {
+		// Mapped text can not be cleared so replace it with an empty document
+		SwitchDocumentAt(buffers.Current(), wEditor.CallReturnPointer(SCI_CREATEDOCUMENT, 0, 0));
+	}
 	wEditor.Call(SCI_SETUNDOCOLLECTION, 0);
 	wEditor.Call(SCI_CLEARALL);
 	wEditor.Call(SCI_EMPTYUNDOBUFFER);
@@ -10,6 +10,7 @@
 #include <ctype.h>
 #include <stdio.h>
 #include <stddef.h>
+#include <limits.h>
 #include <fcntl.h>
 #include <time.h>
 
@@ -17,6 +18,22 @@
 #include <vector>
 #include <set>
 #include <map>
+#include <algorithm>
+
+#if defined(__unix__)
+
+#include <unistd.h>
+
+#else
+
+// Only include <windows.h> for Sleep.
+
+#undef _WIN32_WINNT
+#define _WIN32_WINNT  0x0500
+#define NOMINMAX
+#include <windows.h>
+
+#endif
 
 #include "Scintilla.h"
 #include "ILexer.h"
@@ -238,9 +255,10 @@ void SciTEBase::DiscoverIndentSetting() {
 	}
 }
 
-void SciTEBase::OpenFile(long fileSize, bool suppressMessage, bool asynchronous) {
-	if (CurrentBuffer()->pFileWorker) {
+void SciTEBase::OpenFile(long long fileSize, bool suppressMessage, bool asynchronous) {
+	if (CurrentBuffer()->pFileWorker || (fileSize > INT_MAX)) {
 		// Already performing an asynchronous load or save so do not restart load
+		// or the file has grown too large for a document since it was opened
 		if (!suppressMessage) {
 			GUI::gui_string msg = LocaliseMessage("Could not open file '^0'.", filePath.AsInternal());
 			WindowMessageBox(wSciTE, msg);
@@ -302,6 +320,30 @@ void SciTEBase::OpenFile(long fileSize, bool suppressMessage, bool asynchronous)
 	}
 }
 
+// Show the file read only from a memory mapping so that huge files are not copied into memory.
+// Returns false when the file can not be mapped so that it is read normally.
+bool SciTEBase::OpenMapped(long long fileSize) {
+	if (CurrentBuffer()->pFileWorker || (fileSize > INT_MAX))
+		return false;
+	MappedFile *mappedFile = MappedFile::Map(filePath);
+	if (!mappedFile)
+		return false;
+	const UniMode unicodeMode = mappedFile->unicodeMode;
+	// The document releases the mapping when it is deleted
+	sptr_t pdocMapped = wEditor.CallReturnPointer(SCI_CREATEMAPPEDDOCUMENT, 0,
+		reinterpret_cast<sptr_t>(static_cast<IMappedText *>(mappedFile)));
+	if (!pdocMapped) {
+		mappedFile->Release();
+		return false;
+	}
+	CurrentBuffer()->SetTimeFromFile();
+	CurrentBuffer()->unicodeMode = unicodeMode;
+	CurrentBuffer()->isReadOnly = true;
+	SwitchDocumentAt(buffers.Current(), pdocMapped);
+	CompleteOpen(ocCompleteCurrent);
+	return true;
+}
+
 void SciTEBase::TextRead(FileWorker *pFileWorker) {
 	FileLoader *pFileLoader = static_cast<FileLoader *>(pFileWorker);
 	int iBuffer = buffers.GetDocumentByWorker(pFileLoader);
@@ -454,14 +496,23 @@ void SciTEBase::TextWritten(FileWorker *pFileWorker) {
 void SciTEBase::UpdateProgress(Worker *) {
 	GUI::gui_string prog;
 	BackgroundActivities bgActivities = buffers.CountBackgroundActivities();
-	int countBoth = bgActivities.loaders + bgActivities.storers;
-	if (countBoth == 0) {
+	for (size_t i = 0; i < exporters.size(); i++) {
+		if (!exporters[i]->FinishedJob()) {
+			bgActivities.exporters++;
+			bgActivities.fileNameLast = exporters[i]->path.AsInternal();
+			bgActivities.totalWork += exporters[i]->SizeJob();
+			bgActivities.totalProgress += exporters[i]->ProgressMade();
+		}
+	}
+	int countAll = bgActivities.loaders + bgActivities.storers + bgActivities.exporters;
+	if (countAll == 0) {
 		// Should hide UI
 		ShowBackgroundProgress(GUI_TEXT(""), 0, 0);
 	} else {
-		if (countBoth == 1) {
-			prog += LocaliseMessage(bgActivities.loaders ? "Opening '^0'" : "Saving '^0'",
-				bgActivities.fileNameLast.c_str());
+		if (countAll == 1) {
+			const char *activity = bgActivities.loaders ? "Opening '^0'" :
+				(bgActivities.storers ? "Saving '^0'" : "Exporting '^0'");
+			prog += LocaliseMessage(activity, bgActivities.fileNameLast.c_str());
 		} else {
 			if (bgActivities.loaders) {
 				prog += LocaliseMessage("Opening ^0 files ", GUI::StringFromInteger(bgActivities.loaders).c_str());
@@ -469,8 +520,18 @@ void SciTEBase::UpdateProgress(Worker *) {
 			if (bgActivities.storers) {
 				prog += LocaliseMessage("Saving ^0 files ", GUI::StringFromInteger(bgActivities.storers).c_str());
 			}
+			if (bgActivities.exporters) {
+				prog += LocaliseMessage("Exporting ^0 files ", GUI::StringFromInteger(bgActivities.exporters).c_str());
+			}
+		}
+		// The progress bars take int so scale down when saving or loading more than 2 GB
+		long long totalWork = bgActivities.totalWork;
+		long long totalProgress = bgActivities.totalProgress;
+		while (totalWork > INT_MAX) {
+			totalWork /= 1024;
+			totalProgress /= 1024;
 		}
-		ShowBackgroundProgress(prog, bgActivities.totalWork, bgActivities.totalProgress);
+		ShowBackgroundProgress(prog, static_cast<int>(totalWork), static_cast<int>(totalProgress));
 	}
 }
 
@@ -504,12 +565,12 @@ bool SciTEBase::Open(FilePath file, OpenFlags of) {
 		return false;
 	}
 
-	long size = absPath.IsUntitled() ? 0 : absPath.GetFileLength();
+	long long size = absPath.IsUntitled() ? 0 : absPath.GetFileLength();
 	if (size > 0) {
 		// Real file, not empty buffer
 		int maxSize = props.GetInt("max.file.size");
 		if (maxSize > 0 && size > maxSize) {
-			GUI::gui_string sSize = GUI::StringFromInteger(size);
+			GUI::gui_string sSize = GUI::StringFromUTF8(StdStringFromLongLong(size).c_str());
 			GUI::gui_string sMaxSize = GUI::StringFromInteger(maxSize);
 			GUI::gui_string msg = LocaliseMessage("File '^0' is ^1 bytes long,\n"
 			        "larger than the ^2 bytes limit set in the properties.\n"
@@ -520,6 +581,16 @@ bool SciTEBase::Open(FilePath file, OpenFlags of) {
 				return false;
 			}
 		}
+		// Documents use int positions so can not hold larger files, even when mapped
+		if (size > INT_MAX) {
+			GUI::gui_string sSize = GUI::StringFromUTF8(StdStringFromLongLong(size).c_str());
+			GUI::gui_string sMaxSize = GUI::StringFromInteger(INT_MAX);
+			GUI::gui_string msg = LocaliseMessage("File '^0' is ^1 bytes long,\n"
+			        "larger than the ^2 bytes that can be edited.",
+			        absPath.AsInternal(), sSize.c_str(), sMaxSize.c_str());
+			WindowMessageBox(wSciTE, msg, mbsIconWarning);
+			return false;
+		}
 	}
 
 	if (buffers.size == buffers.length) {
@@ -531,6 +602,14 @@ bool SciTEBase::Open(FilePath file, OpenFlags of) {
 	} else {
 		if (index < 0 || !(of & ofForceLoad)) { // No new buffer, already opened
 			New();
+		} else {
+			wEditor.Call(SCI_SETREADONLY, 0);
+			if (wEditor.Call(SCI_GETREADONLY)) {
+				// Mapped text can not be changed in place so reload into a new document
+				// which may be mapped again. The mapped text had no undo history to keep.
+				ClearDocument();
+				of = static_cast<OpenFlags>(of & ~ofPreserveUndo);
+			}
 		}
 	}
 
@@ -556,6 +635,7 @@ bool SciTEBase::Open(FilePath file, OpenFlags of) {
 	SetBuffersMenu();
 
 	bool asynchronous = false;
+	bool mapped = false;
 	if (!filePath.IsUntitled()) {
 		wEditor.Call(SCI_SETREADONLY, 0);
 		wEditor.Call(SCI_CANCEL);
@@ -565,16 +645,22 @@ bool SciTEBase::Open(FilePath file, OpenFlags of) {
 			wEditor.Call(SCI_SETUNDOCOLLECTION, 0);
 		}
 
-		asynchronous = (size > props.GetInt("background.open.size", -1)) &&
-			!(of & (ofPreserveUndo|ofSynchronous));
-		OpenFile(size, of & ofQuiet, asynchronous);
+		const int mappedSize = props.GetInt("mapped.file.size");
+		mapped = (mappedSize > 0) && (size >= mappedSize) && !(of & ofPreserveUndo) &&
+			OpenMapped(size);
+		if (!mapped) {
+			asynchronous = (size > props.GetInt("background.open.size", -1)) &&
+				!(of & (ofPreserveUndo|ofSynchronous));
+			OpenFile(size, of & ofQuiet, asynchronous);
+		}
 
 		if (of & ofPreserveUndo) {
 			wEditor.Call(SCI_ENDUNDOACTION);
 		} else {
 			wEditor.Call(SCI_EMPTYUNDOBUFFER);
 		}
-		CurrentBuffer()->isReadOnly = props.GetInt("read.only");
+		CurrentBuffer()->isReadOnly = props.GetInt("read.only") || mapped;
+		CurrentBuffer()->isMapped = mapped;
 		wEditor.Call(SCI_SETREADONLY, CurrentBuffer()->isReadOnly);
 	}
 	RemoveFileFromStack(filePath);
@@ -817,6 +903,8 @@ SciTEBase::SaveResult SciTEBase::SaveIfUnsureAll() {
 	if (SaveAllBuffers(false) == saveCancelled) {
 		return saveCancelled;
 	}
+	// Exports in progress are abandoned when quitting
+	CancelExports();
 	if (props.GetInt("save.recent")) {
 		for (int i = 0; i < buffers.lengthVisible; ++i) {
 			Buffer buff = buffers.buffers[i];
@@ -1180,125 +1268,260 @@ void SciTEBase::OpenFilesFromStdin() {
 		Open(GUI_TEXT(""));
 }
 
-class BufferedFile {
-	FILE *fp;
-	bool readAll;
-	bool exhausted;
-	enum {bufLen = 64 * 1024};
-	char buffer[bufLen];
-	size_t pos;
-	size_t valid;
-	void EnsureData() {
-		if (pos >= valid) {
-			if (readAll || !fp) {
-				exhausted = true;
-			} else {
-				valid = fread(buffer, 1, bufLen, fp);
-				if (valid < bufLen) {
-					readAll = true;
+static bool IsWordCharacter(int ch) {
+	return (ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z')  || (ch >= '0' && ch <= '9')  || (ch == '_');
+}
+
+static bool IsLineEnd(char ch) {
+	return ch == '\r' || ch == '\n';
+}
+
+/**
+ * Reads a file in blocks and finds the lines containing the search string.
+ * Each block is searched as a single buffer rather than line by line and lines are only
+ * counted up to each match. An unfinished line at the end of a block, which always holds
+ * the last (search length - 1) bytes, is kept for the next block so no match is missed.
+ */
+class GrepFile {
+	enum {blockSize = 64 * 1024};
+	bool wholeWord;
+	bool matchCase;
+	bool binary;
+	std::vector<char> text;
+	std::vector<char> lowered;
+	int lineNum;
+	static const char *Find(const char *s, const char *end, const char *searchString, size_t searchLength) {
+		while (end - s >= static_cast<ptrdiff_t>(searchLength)) {
+			if (!searchLength)
+				return s;
+			s = static_cast<const char *>(memchr(s, searchString[0], end - s - searchLength + 1));
+			if (!s)
+				return NULL;
+			if (memcmp(s, searchString, searchLength) == 0)
+				return s;
+			s++;
+		}
+		return NULL;
+	}
+	// Length of the whole lines at the start of the text, not including a final CR that may
+	// be followed by a LF in the next block.
+	static size_t LengthWholeLines(const char *original, size_t length) {
+		size_t lengthLines = length;
+		if ((lengthLines > 0) && (original[lengthLines - 1] == '\r'))
+			lengthLines--;
+		while ((lengthLines > 0) && !IsLineEnd(original[lengthLines - 1]))
+			lengthLines--;
+		return lengthLines;
+	}
+	void SearchLines(const char *original, size_t length, const char *searchString,
+		const std::string &path, std::string &result) {
+		const char *compare = original;
+		if (!matchCase) {
+			lowered.resize(length);
+			for (size_t i = 0; i < length; i++) {
+				const char ch = original[i];
+				lowered[i] = (ch >= 'A' && ch <= 'Z') ? static_cast<char>(ch - 'A' + 'a') : ch;
+			}
+			compare = &lowered[0];
+		}
+		const char *compareEnd = compare + length;
+		const size_t searchLength = strlen(searchString);
+		const char *counted = compare;
+		const char *s = compare;
+		while (s) {
+			const char *match = Find(s, compareEnd, searchString, searchLength);
+			if (!match)
+				break;
+			const char *lineStart = match;
+			while ((lineStart > s) && !IsLineEnd(lineStart[-1]))
+				lineStart--;
+			const char *lineEnd = match;
+			while ((lineEnd < compareEnd) && !IsLineEnd(*lineEnd))
+				lineEnd++;
+			// As with C strings, text after a NUL is not compared or shown
+			const char *nul = static_cast<const char *>(memchr(lineStart, '\0', lineEnd - lineStart));
+			const char *visibleEnd = nul ? nul : lineEnd;
+			if (match + searchLength > visibleEnd)
+				match = NULL;
+			if (wholeWord) {
+				while (match) {
+					if (((match == lineStart) || !IsWordCharacter(match[-1])) &&
+					        ((match + searchLength == visibleEnd) || !IsWordCharacter(match[searchLength]))) {
+						break;
+					}
+					match = Find(match + 1, visibleEnd, searchString, searchLength);
 				}
-				pos = 0;
+			}
+			if (match) {
+				counted = CountLines(counted, lineStart, compareEnd);
+				result.append(path);
+				result.append(":");
+				result.append(StdStringFromInteger(lineNum));
+				result.append(":");
+				result.append(original + (lineStart - compare), visibleEnd - lineStart);
+				result.append("\n");
+			}
+			if (lineEnd == compareEnd) {
+				s = NULL;
+			} else if ((lineEnd[0] == '\r') && (lineEnd + 1 < compareEnd) && (lineEnd[1] == '\n')) {
+				s = lineEnd + 2;
+			} else {
+				s = lineEnd + 1;
 			}
 		}
+		CountLines(counted, compareEnd, compareEnd);
 	}
-public:
-	BufferedFile(FilePath fPath) {
-		fp = fPath.Open(fileRead);
-		readAll = false;
-		exhausted = fp == NULL;
-		buffer[0] = 0;
-		pos = 0;
-		valid = 0;
-	}
-	~BufferedFile() {
-		if (fp) {
-			fclose(fp);
+	const char *CountLines(const char *counted, const char *end, const char *compareEnd) {
+		for (; counted < end; counted++) {
+			if ((*counted == '\n') || ((*counted == '\r') && ((counted + 1 == compareEnd) || (counted[1] != '\n'))))
+				lineNum++;
 		}
-		fp = NULL;
-	}
-	bool Exhausted() const {
-		return exhausted;
+		return counted;
 	}
-	int NextByte() {
-		EnsureData();
-		if (pos >= valid) {
-			return 0;
-		}
-		return buffer[pos++];
+	// Private so GrepFile objects can not be copied
+	GrepFile(const GrepFile &);
+	GrepFile &operator=(const GrepFile &);
+public:
+	GrepFile(bool wholeWord_, bool matchCase_, bool binary_) :
+		wholeWord(wholeWord_), matchCase(matchCase_), binary(binary_), lineNum(1) {
 	}
-	bool BufferContainsNull() {
-		EnsureData();
-		for (size_t i = 0;i < valid;i++) {
-			if (buffer[i] == '\0')
-				return true;
+	void Search(const FilePath &fPath, const char *searchString, std::string &result) {
+		// Lines never contain line ends so neither can matches
+		if (strpbrk(searchString, "\r\n"))
+			return;
+		FILE *fp = fPath.Open(fileRead);
+		if (!fp)
+			return;
+		const std::string path = fPath.AsUTF8();
+		lineNum = 1;
+		size_t length = 0;
+		bool firstBlock = true;
+		for (;;) {
+			if (text.size() < length + blockSize)
+				text.resize(length + blockSize);
+			const size_t lenBlock = fread(&text[length], 1, blockSize, fp);
+			// Files with a NUL in their first block are binary
+			if (firstBlock && !binary && memchr(&text[0], '\0', lenBlock))
+				break;
+			firstBlock = false;
+			length += lenBlock;
+			const size_t lengthLines = (lenBlock == 0) ? length : LengthWholeLines(&text[0], length);
+			if (lengthLines > 0) {
+				SearchLines(&text[0], lengthLines, searchString, path, result);
+				std::copy(text.begin() + lengthLines, text.begin() + length, text.begin());
+				length -= lengthLines;
+			}
+			if (lenBlock == 0)
+				break;
 		}
-		return false;
+		fclose(fp);
 	}
 };
 
-class FileReader {
-	BufferedFile *bf;
-	int lineNum;
-	bool lastWasCR;
-	std::string lineToCompare;
-	std::string lineToShow;
-	bool caseSensitive;
-	// Private so FileReader objects can not be copied
-	FileReader(const FileReader &);
+/**
+ * Files to be searched by a Find in Files, in the order their results are shown, shared by
+ * the searching threads which each take the next file not yet started.
+ * Files are added while the directories are still being listed so searching starts at once.
+ * Results are held until those of all earlier files are ready so the output does not depend
+ * on how the threads were scheduled.
+ */
+class GrepQueue {
+	Mutex *mutex;
+	const char *searchString;
+	FilePathSet files;
+	std::vector<std::string> results;
+	std::vector<bool> searched;
+	size_t nextFile;
+	size_t nextResult;
+	bool listed;
+	bool cancelled;
+	// Private so GrepQueue objects can not be copied
+	GrepQueue(const GrepQueue &);
+	GrepQueue &operator=(const GrepQueue &);
 public:
-
-	FileReader(FilePath fPath, bool caseSensitive_) {
-		bf = new BufferedFile(fPath);
-		lineNum = 0;
-		lastWasCR = false;
-		caseSensitive = caseSensitive_;
-	}
-	~FileReader() {
-		delete bf;
-		bf = NULL;
-	}
-	const char *Next() {
-		if (bf->Exhausted()) {
-			return NULL;
+	enum Progress { searchedFile, waitingForFiles, finished };
+	explicit GrepQueue(const char *searchString_) :
+		mutex(Mutex::Create()), searchString(searchString_),
+		nextFile(0), nextResult(0), listed(false), cancelled(false) {
+	}
+	~GrepQueue() {
+		delete mutex;
+	}
+	void Add(const FilePath &fPath) {
+		Lock lock(mutex);
+		files.push_back(fPath);
+		results.push_back(std::string());
+		searched.push_back(false);
+	}
+	/// No more files will be added.
+	void Listed() {
+		Lock lock(mutex);
+		listed = true;
+	}
+	Progress SearchNext(GrepFile &grepFile) {
+		size_t index = 0;
+		FilePath fPath;
+		{
+			Lock lock(mutex);
+			if (cancelled)
+				return finished;
+			if (nextFile >= files.size())
+				return listed ? finished : waitingForFiles;
+			index = nextFile++;
+			// Copied as files may be reallocated by Add while this file is searched
+			fPath = files[index];
 		}
-		lineToShow.clear();
-		while (!bf->Exhausted()) {
-			int ch = bf->NextByte();
-			if (lastWasCR && ch == '\n' && lineToShow.empty()) {
-				lastWasCR = false;
-			} else if (ch == '\r' || ch == '\n') {
-				lastWasCR = ch == '\r';
-				break;
-			} else {
-				lineToShow.push_back(static_cast<char>(ch));
-			}
+		std::string result;
+		grepFile.Search(fPath, searchString, result);
+		Lock lock(mutex);
+		results[index].swap(result);
+		searched[index] = true;
+		return searchedFile;
+	}
+	std::string ResultsReady() {
+		Lock lock(mutex);
+		std::string ready;
+		while ((nextResult < files.size()) && searched[nextResult]) {
+			ready.append(results[nextResult]);
+			std::string().swap(results[nextResult]);
+			nextResult++;
 		}
-		lineNum++;
-		lineToCompare = lineToShow;
-		if (!caseSensitive) {
-			for (unsigned int j = 0; j < lineToCompare.length(); j++) {
-				if (lineToCompare[j] >= 'A' && lineToCompare[j] <= 'Z') {
-					lineToCompare[j] = static_cast<char>(lineToCompare[j] - 'A' + 'a');
-				}
-			}
-		}
-		return lineToCompare.c_str();
-	}
-	int LineNumber() const {
-		return lineNum;
+		return ready;
 	}
-	const char *Original() const {
-		return lineToShow.c_str();
-	}
-	bool BufferContainsNull() {
-		return bf->BufferContainsNull();
+	void Cancel() {
+		Lock lock(mutex);
+		cancelled = true;
 	}
 };
 
-static bool IsWordCharacter(int ch) {
-	return (ch >= 'A' && ch <= 'Z') || (ch >= 'a' && ch <= 'z')  || (ch >= '0' && ch <= '9')  || (ch == '_');
+// Wait a little for other threads to list or search files.
+static void GrepPause() {
+	const int pauseTime = 5;
+#ifdef __unix__
+	usleep(pauseTime * 1000);
+#else
+	::Sleep(pauseTime);
+#endif
 }
 
+struct GrepWorker : public Worker {
+	GrepQueue *queue;
+	GrepFile grepFile;
+	GrepWorker(GrepQueue *queue_, bool wholeWord, bool matchCase, bool binary) :
+		queue(queue_), grepFile(wholeWord, matchCase, binary) {
+	}
+	virtual void Execute() {
+		for (;;) {
+			const GrepQueue::Progress progress = queue->SearchNext(grepFile);
+			if (progress == GrepQueue::finished)
+				break;
+			if (progress == GrepQueue::waitingForFiles)
+				GrepPause();
+		}
+		SetCompleted();
+	}
+};
+
 bool SciTEBase::GrepIntoDirectory(const FilePath &directory) {
     const GUI::gui_char *sDirectory = directory.AsInternal();
 #ifdef __APPLE__
@@ -1308,48 +1531,29 @@ bool SciTEBase::GrepIntoDirectory(const FilePath &directory) {
     return sDirectory[0] != '.';
 }
 
-void SciTEBase::GrepRecursive(GrepFlags gf, FilePath baseDir, const char *searchString, const GUI::gui_char *fileTypes) {
+void SciTEBase::GrepRecursive(GrepFlags gf, FilePath baseDir, const GUI::gui_char *fileTypes, GrepQueue &queue) {
+	if (jobQueue.Cancelled())
+		return;
 	FilePathSet directories;
 	FilePathSet files;
 	baseDir.List(directories, files);
-	size_t searchLength = strlen(searchString);
-	SString os;
 	for (size_t i = 0; i < files.size(); i ++) {
-		if (jobQueue.Cancelled())
-			return;
 		FilePath fPath = files[i];
 		if (*fileTypes == '\0' || fPath.Matches(fileTypes)) {
-			//OutputAppendStringSynchronised(i->AsInternal());
-			//OutputAppendStringSynchronised("\n");
-			FileReader fr(fPath, gf & grepMatchCase);
-			if ((gf & grepBinary) || !fr.BufferContainsNull()) {
-				while (const char *line = fr.Next()) {
-					const char *match = strstr(line, searchString);
-					if (match) {
-						if (gf & grepWholeWord) {
-							const char *lineEnd = line + strlen(line);
-							while (match) {
-								if (((match == line) || !IsWordCharacter(match[-1])) &&
-								        ((match + searchLength == (lineEnd)) || !IsWordCharacter(match[searchLength]))) {
-									break;
-								}
-								match = strstr(match + 1, searchString);
-							}
-						}
-						if (match) {
-							os.append(fPath.AsUTF8().c_str());
-							os.append(":");
-							std::string lNumber = StdStringFromInteger(fr.LineNumber());
-							os.append(lNumber.c_str());
-							os.append(":");
-							os.append(fr.Original());
-							os.append("\n");
-						}
-					}
-				}
-			}
+			queue.Add(fPath);
+		}
+	}
+	// Show what the other threads have found while the rest are listed
+	GrepOutput(gf, queue.ResultsReady());
+	for (size_t j = 0; j < directories.size(); j++) {
+		FilePath fPath = directories[j];
+		if ((gf & grepDot) || GrepIntoDirectory(fPath.Name())) {
+			GrepRecursive(gf, fPath, fileTypes, queue);
 		}
 	}
+}
+
+void SciTEBase::GrepOutput(GrepFlags gf, const std::string &os) {
 	if (os.length()) {
 		if (gf & grepStdOut) {
 			fwrite(os.c_str(), os.length(), 1, stdout);
@@ -1357,12 +1561,6 @@ void SciTEBase::GrepRecursive(GrepFlags gf, FilePath baseDir, const char *search
 			OutputAppendStringSynchronised(os.c_str());
 		}
 	}
-	for (size_t j = 0; j < directories.size(); j++) {
-		FilePath fPath = directories[j];
-		if ((gf & grepDot) || GrepIntoDirectory(fPath.Name())) {
-			GrepRecursive(gf, fPath, searchString, fileTypes);
-		}
-	}
 }
 
 void SciTEBase::InternalGrep(GrepFlags gf, const GUI::gui_char *directory, const GUI::gui_char *fileTypes, const char *search, sptr_t &originalEnd) {
@@ -1382,7 +1580,41 @@ void SciTEBase::InternalGrep(GrepFlags gf, const GUI::gui_char *directory, const
 	if (!(gf & grepMatchCase)) {
 		LowerCaseAZ(searchString);
 	}
-	GrepRecursive(gf, FilePath(directory), searchString.c_str(), fileTypes);
+	const bool wholeWord = (gf & grepWholeWord) != 0;
+	const bool matchCase = (gf & grepMatchCase) != 0;
+	const bool binary = (gf & grepBinary) != 0;
+	GrepQueue queue(searchString.c_str());
+	// The workers search while this thread lists the files and then this thread searches
+	// too so start one fewer workers than find.in.files.threads
+	const size_t threads = std::max(props.GetInt("find.in.files.threads", 4), 1);
+	std::vector<GrepWorker *> workers;
+	while (workers.size() + 1 < threads) {
+		GrepWorker *pWorker = new GrepWorker(&queue, wholeWord, matchCase, binary);
+		if (!PerformOnNewThread(pWorker)) {
+			delete pWorker;
+			break;
+		}
+		workers.push_back(pWorker);
+	}
+	GrepRecursive(gf, FilePath(directory), fileTypes, queue);
+	queue.Listed();
+	GrepFile grepFile(wholeWord, matchCase, binary);
+	while (!jobQueue.Cancelled() && (queue.SearchNext(grepFile) == GrepQueue::searchedFile)) {
+		GrepOutput(gf, queue.ResultsReady());
+	}
+	for (size_t w = 0; w < workers.size(); w++) {
+		while (!workers[w]->FinishedJob()) {
+			if (jobQueue.Cancelled())
+				queue.Cancel();
+			GrepOutput(gf, queue.ResultsReady());
+			GrepPause();
+		}
+		delete workers[w];
+	}
+	if (jobQueue.Cancelled())
+		queue.Cancel();
+	else
+		GrepOutput(gf, queue.ResultsReady());
 	if (!(gf & grepStdOut)) {
 		std::string sExitMessage(">");
 		if (jobQueue.TimeCommands()) {
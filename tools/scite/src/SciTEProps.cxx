@@ -50,6 +50,7 @@ const GUI::gui_char menuAccessIndicator[] = GUI_TEXT("&");
 #include "JobQueue.h"
 #include "Cookie.h"
 #include "Worker.h"
+#include "APIRepository.h"
 #include "MatchMarker.h"
 #include "SciTEBase.h"
 
@@ -126,6 +127,12 @@ void SciTEBase::ReadGlobalPropFile() {
 	SString excludes;
 	SString includes;
 
+	// Reading every imported file is slow on network drives so use a cache when nothing changed
+	const bool useCache = props.GetInt("properties.cache", 1) != 0;
+	PropertiesCache cache(UserFilePath(GUI_TEXT("SciTEProperties.cache")));
+	if (useCache)
+		cache.Load();
+
 	for (int attempt=0; attempt<2; attempt++) {
 
 		SString excludesRead = props.Get("imports.exclude");
@@ -142,13 +149,22 @@ void SciTEBase::ReadGlobalPropFile() {
 
 		propsBase.Clear();
 		FilePath propfileBase = GetDefaultPropertiesFileName();
-		propsBase.Read(propfileBase, propfileBase.Directory(), filter, &importFiles, 0);
+		if (useCache)
+			propsBase.ReadCached(cache, propfileBase, propfileBase.Directory(), filter, &importFiles);
+		else
+			propsBase.Read(propfileBase, propfileBase.Directory(), filter, &importFiles, 0);
 
 		propsUser.Clear();
 		FilePath propfileUser = GetUserPropertiesFileName();
-		propsUser.Read(propfileUser, propfileUser.Directory(), filter, &importFiles, 0);
+		if (useCache)
+			propsUser.ReadCached(cache, propfileUser, propfileUser.Directory(), filter, &importFiles);
+		else
+			propsUser.Read(propfileUser, propfileUser.Directory(), filter, &importFiles, 0);
 	}
 
+	if (useCache)
+		cache.Save();
+
 	if (!localiser.read) {
 		ReadLocalization();
 	}
@@ -324,56 +340,21 @@ void SciTEBase::DefineMarker(int marker, int markerType, Colour fore, Colour bac
 	wEditor.Call(SCI_MARKERSETBACKSELECTED, marker, backSelected);
 }
 
-static long FileLength(const char *path) {
-	long len = 0;
-	FILE *fp = fopen(path, "rb");
-	if (fp) {
-		fseek(fp, 0, SEEK_END);
-		len = ftell(fp);
-		fclose(fp);
-	}
-	return len;
-}
-
+/**
+ * API files are read and sorted on a background thread the first time a set of them is needed.
+ * apis stays NULL until that completes and WorkerCommand sets it.
+ */
 void SciTEBase::ReadAPI(const SString &fileNameForExtension) {
-	SString sApiFileNames = props.GetNewExpand("api.",
-	                        fileNameForExtension.c_str());
-	size_t nameLength = sApiFileNames.length();
-	if (nameLength) {
-		sApiFileNames.substitute(';', '\0');
-		const char *apiFileName = sApiFileNames.c_str();
-		const char *nameEnd = apiFileName + nameLength;
-
-		size_t tlen = 0;    // total api length
-
-		// Calculate total length
-		while (apiFileName < nameEnd) {
-			tlen += FileLength(apiFileName);
-			apiFileName += strlen(apiFileName) + 1;
-		}
-
-		// Load files
-		if (tlen > 0) {
-			char *buffer = apis.Allocate(static_cast<int>(tlen));
-			if (buffer) {
-				apiFileName = sApiFileNames.c_str();
-				tlen = 0;
-				while (apiFileName < nameEnd) {
-					FILE *fp = fopen(apiFileName, "rb");
-					if (fp) {
-						fseek(fp, 0, SEEK_END);
-						long len = ftell(fp);
-						if (len > 0) {
-							fseek(fp, 0, SEEK_SET);
-							size_t readBytes = fread(buffer + tlen, 1, len, fp);
-							tlen += readBytes;
-						}
-						fclose(fp);
-					}
-					apiFileName += strlen(apiFileName) + 1;
-				}
-				apis.SetFromAllocated();
-			}
+	apisFileNames = props.GetNewExpand("api.", fileNameForExtension.c_str());
+	const std::string fileNames = apisFileNames.c_str();
+	if (!apiRepository->Find(fileNames, apis) && !fileNames.empty() && !apiRepository->Loading(fileNames)) {
+		APILoader *loader = apiRepository->Load(this, fileNames);
+		if (!PerformOnNewThread(loader)) {
+			// No thread available so read now and take the result immediately
+			loader->pListener = 0;
+			loader->Execute();
+			apiRepository->Loaded(loader);
+			apiRepository->Find(fileNames, apis);
 		}
 	}
 }
@@ -687,11 +668,7 @@ void SciTEBase::ReadProperties() {
 		ForwardPropertyToEditor(propertiesToForward[i]);
 	}
 
-	if (apisFileNames != props.GetNewExpand("api.",	fileNameForExtension.c_str())) {
-		apis.Clear();
-		ReadAPI(fileNameForExtension);
-		apisFileNames = props.GetNewExpand("api.", fileNameForExtension.c_str());
-	}
+	ReadAPI(fileNameForExtension);
 
 	props.Set("APIPath", apisFileNames.c_str());
 
@@ -965,6 +942,12 @@ void SciTEBase::ReadProperties() {
 
 	wEditor.Call(SCI_SETLAYOUTCACHE, props.GetInt("cache.layout", SC_CACHE_CARET));
 	wOutput.Call(SCI_SETLAYOUTCACHE, props.GetInt("output.cache.layout", SC_CACHE_CARET));
+	wEditor.Call(SCI_SETLAYOUTCACHEPAGES, props.GetInt("cache.layout.pages", 4));
+	wEditor.Call(SCI_SETIDLESTYLING, props.GetInt("idle.styling", SC_IDLESTYLING_NONE));
+	wOutput.Call(SCI_SETIDLESTYLING, props.GetInt("output.idle.styling", SC_IDLESTYLING_NONE));
+	wEditor.Call(SCI_SETIDLESTYLINGBUDGET, props.GetInt("idle.styling.budget", 20));
+	wEditor.Call(SCI_SETSEGMENTCACHEBUDGET, props.GetInt("segment.cache.budget", 0x100000));
+	wEditor.Call(SCI_SETUNDOMEMORYLIMIT, props.GetInt("undo.memory.limit"));
 
 	bracesCheck = props.GetInt("braces.check");
 	bracesSloppy = props.GetInt("braces.sloppy");
@@ -1029,6 +1012,7 @@ void SciTEBase::ReadProperties() {
 	wEditor.Call(SCI_SETWRAPVISUALFLAGSLOCATION, props.GetInt("wrap.visual.flags.location"));
  	wEditor.Call(SCI_SETWRAPSTARTINDENT, props.GetInt("wrap.visual.startindent"));
  	wEditor.Call(SCI_SETWRAPINDENTMODE, props.GetInt("wrap.indent.mode"));
+	wEditor.Call(SCI_SETWRAPTHREADS, props.GetInt("wrap.threads"));
 
 	if (props.GetInt("os.x.home.end.keys")) {
 		AssignKey(SCK_HOME, 0, SCI_SCROLLTOSTART);
@@ -1078,13 +1062,15 @@ void SciTEBase::ReadProperties() {
 	// To put the folder markers in the line number region
 	//wEditor.Call(SCI_SETMARGINMASKN, 0, SC_MASK_FOLDERS);
 
-	wEditor.Call(SCI_SETMODEVENTMASK, SC_MOD_CHANGEFOLD);
+	// Insertions and deletions keep the word index of the buffer up to date
+	wEditor.Call(SCI_SETMODEVENTMASK, SC_MOD_CHANGEFOLD | SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT
+		| SC_MOD_BEFOREINSERT | SC_MOD_BEFOREDELETE);
 
-	if (0==props.GetInt("undo.redo.lazy")) {
+	undoRedoLazy = props.GetInt("undo.redo.lazy") != 0;
+	if (!undoRedoLazy) {
 		// Trap for insert/delete notifications (also fired by undo
 		// and redo) so that the buttons can be enabled if needed.
-		wEditor.Call(SCI_SETMODEVENTMASK, SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT
-			| SC_LASTSTEPINUNDOREDO | wEditor.Call(SCI_GETMODEVENTMASK, 0));
+		wEditor.Call(SCI_SETMODEVENTMASK, SC_LASTSTEPINUNDOREDO | wEditor.Call(SCI_GETMODEVENTMASK, 0));
 
 		//SC_LASTSTEPINUNDOREDO is probably not needed in the mask; it
 		//doesn't seem to fire as an event of its own; just modifies the
@@ -67,6 +67,12 @@ std::string StdStringFromSizeT(size_t i) {
 	return strstrm.str();
 }
 
+std::string StdStringFromLongLong(long long i) {
+	std::ostringstream strstrm;
+	strstrm << i;
+	return strstrm.str();
+}
+
 std::string StdStringFromDouble(double d, int precision) {
 	char number[32];
 	sprintf(number, "%.*f", precision, d);
@@ -85,6 +91,25 @@ void LowerCaseAZ(std::string &s) {
 	std::transform(s.begin(), s.end(), s.begin(), std::ptr_fun<int, int>(LowerCaseAZ));
 }
 
+int CompareNCaseInsensitive(const char *a, const char *b, size_t len) {
+	while (*a && *b && len) {
+		if (*a != *b) {
+			char upperA = MakeUpperCase(*a);
+			char upperB = MakeUpperCase(*b);
+			if (upperA != upperB)
+				return upperA - upperB;
+		}
+		a++;
+		b++;
+		len--;
+	}
+	if (len == 0)
+		return 0;
+	else
+		// Either *a or *b is nul
+		return *a - *b;
+}
+
 /**
  * Convert a string into C string literal form using \a, \b, \f, \n, \r, \t, \v, and \ooo.
  * The return value is a newly allocated character array containing the result.
@@ -19,12 +19,25 @@ int Remove(T &s, const T &sFind) {
 
 std::string StdStringFromInteger(int i);
 std::string StdStringFromSizeT(size_t i);
+std::string StdStringFromLongLong(long long i);
 std::string StdStringFromDouble(double d, int precision);
 
 // Basic case lowering that converts A-Z to a-z.
 // Does not handle non-ASCII characters.
 void LowerCaseAZ(std::string &s);
 
+// Basic case raising that converts a-z to A-Z.
+// Does not handle non-ASCII characters.
+inline char MakeUpperCase(char ch) {
+	if (ch < 'a' || ch > 'z')
+		return ch;
+	else
+		return static_cast<char>(ch - 'a' + 'A');
+}
+
+// Compare up to len characters of a and b ignoring the case of a-z.
+int CompareNCaseInsensitive(const char *a, const char *b, size_t len);
+
 // StringSplit can be expanded over std::string or GUI::gui_string
 template <typename T>
 std::vector<T> StringSplit(const T &text, int separator) {
@@ -9,41 +9,21 @@
 #include <string.h>
 
 #include <string>
+#include <vector>
 #include <map>
 
+#include "Scintilla.h"
+
+#include "GUI.h"
+
 #include "SString.h"
+#include "StringHelpers.h"
 #include "StringList.h"
 
 static inline bool IsASpace(unsigned int ch) {
     return (ch == ' ') || ((ch >= 0x09) && (ch <= 0x0d));
 }
 
-static inline char MakeUpperCase(char ch) {
-	if (ch < 'a' || ch > 'z')
-		return ch;
-	else
-		return static_cast<char>(ch - 'a' + 'A');
-}
-
-static int CompareNCaseInsensitive(const char *a, const char *b, size_t len) {
-	while (*a && *b && len) {
-		if (*a != *b) {
-			char upperA = MakeUpperCase(*a);
-			char upperB = MakeUpperCase(*b);
-			if (upperA != upperB)
-				return upperA - upperB;
-		}
-		a++;
-		b++;
-		len--;
-	}
-	if (len == 0)
-		return 0;
-	else
-		// Either *a or *b is nul
-		return *a - *b;
-}
-
 /**
  * Creates an array that points into each word in the string and puts \0 terminators
  * after each word.
@@ -148,6 +128,47 @@ static void SortStringListNoCase(char **wordsNoCase, unsigned int len) {
 	      slCmpStringNoCase);
 }
 
+/**
+ * Sort in both orders now rather than on first use so a list can be prepared
+ * by a background thread.
+ */
+void StringList::Sort() {
+	if (!sorted) {
+		sorted = true;
+		SortStringList(words, len);
+	}
+	if (!sortedNoCase) {
+		sortedNoCase = true;
+		SortStringListNoCase(wordsNoCase, len);
+	}
+}
+
+static int ComparePrefix(const char *wordStart, const char *word, size_t searchLen, bool ignoreCase) {
+	if (ignoreCase)
+		return CompareNCaseInsensitive(wordStart, word, searchLen);
+	else
+		return strncmp(wordStart, word, searchLen);
+}
+
+/**
+ * Binary search for the first word of a sorted array that starts with wordStart.
+ * Returns len when there is no such word.
+ */
+static int FirstWithPrefix(char **sortedWords, int len, const char *wordStart, size_t searchLen, bool ignoreCase) {
+	int start = 0;
+	int end = len;
+	while (start < end) {
+		const int pivot = (start + end) / 2;
+		if (ComparePrefix(wordStart, sortedWords[pivot], searchLen, ignoreCase) > 0)
+			start = pivot + 1;
+		else
+			end = pivot;
+	}
+	if ((start < len) && (ComparePrefix(wordStart, sortedWords[start], searchLen, ignoreCase) == 0))
+		return start;
+	return len;
+}
+
 /**
  * Returns an element (complete) of the StringList array which has
  * the same beginning as the passed string.
@@ -155,12 +176,6 @@ static void SortStringListNoCase(char **wordsNoCase, unsigned int len) {
  * Letter case can be ignored or preserved (default).
  */
 const char *StringList::GetNearestWord(const char *wordStart, size_t searchLen, bool ignoreCase /*= false*/, SString wordCharacters /*='/0' */, int wordIndex /*= -1 */) {
-	int start = 0; // lower bound of the api array block to search
-	int end = len - 1; // upper bound of the api array block to search
-	int pivot; // index of api array element just being compared
-	int cond; // comparison result (in the sense of strcmp() result)
-	const char *word; // api array element just being compared
-
 	if (0 == words)
 		return NULL;
 	if (ignoreCase) {
@@ -168,76 +183,21 @@ const char *StringList::GetNearestWord(const char *wordStart, size_t searchLen,
 			sortedNoCase = true;
 			SortStringListNoCase(wordsNoCase, len);
 		}
-		while (start <= end) { // binary searching loop
-			pivot = (start + end) >> 1;
-			word = wordsNoCase[pivot];
-			cond = CompareNCaseInsensitive(wordStart, word, searchLen);
-			if (!cond) {
-				// find first word
-				start = pivot;
-				while (start > 0 && !CompareNCaseInsensitive(wordStart, wordsNoCase[start-1], searchLen)) {
-					start--;
-				}
-				// find last word
-				end = pivot;
-				while (end < len-1 && !CompareNCaseInsensitive(wordStart, wordsNoCase[end+1], searchLen)) {
-					end++;
-				}
-
-				// Finds first word in a series of equal words
-				for (pivot = start; pivot <= end; pivot++) {
-					word = wordsNoCase[pivot];
-					if (!word[searchLen] || !wordCharacters.contains(word[searchLen])) {
-						if (wordIndex <= 0) // Checks if a specific index was requested
-							return word; // result must not be freed with free()
-						wordIndex--;
-					}
-				}
-				return NULL;
-			}
-			else if (cond > 0)
-				start = pivot + 1;
-			else if (cond < 0)
-				end = pivot - 1;
-		}
 	} else { // preserve the letter case
 		if (!sorted) {
 			sorted = true;
 			SortStringList(words, len);
 		}
-		while (start <= end) { // binary searching loop
-			pivot = (start + end) >> 1;
-			word = words[pivot];
-			cond = strncmp(wordStart, word, searchLen);
-			if (!cond) {
-				// find first word
-				start = pivot;
-				while (start > 0 && !strncmp(wordStart, words[start-1], searchLen)) {
-					start--;
-				}
-				// find last word
-				end = pivot;
-				while (end < len-1 && !strncmp(wordStart, words[end+1], searchLen)) {
-					end++;
-				}
-
-				// Finds first word in a series of equal words
-				pivot = start;
-				while (pivot <= end) {
-					word = words[pivot];
-					if (!word[searchLen] || !wordCharacters.contains(word[searchLen])) {
-						if (wordIndex <= 0) // Checks if a specific index was requested
-							return word; // result must not be freed with free()
-						wordIndex--;
-					}
-					pivot++;
-				}
-				return NULL;
-			}
-			else if (cond > 0)
-				start = pivot + 1;
-			else if (cond < 0)
-				end = pivot - 1;
+	}
+	char **sortedWords = ignoreCase ? wordsNoCase : words;
+	// Finds first word in a series of equal words
+	for (int pivot = FirstWithPrefix(sortedWords, len, wordStart, searchLen, ignoreCase);
+		(pivot < len) && !ComparePrefix(wordStart, sortedWords[pivot], searchLen, ignoreCase); pivot++) {
+		const char *word = sortedWords[pivot];
+		if (!word[searchLen] || !wordCharacters.contains(word[searchLen])) {
+			if (wordIndex <= 0) // Checks if a specific index was requested
+				return word; // result must not be freed with free()
+			wordIndex--;
 		}
 	}
 	return NULL;
@@ -291,10 +251,6 @@ char *StringList::GetNearestWords(
 	unsigned int wordlen; // length of the word part (before the '(' brace) of the api array element
 	SString wordsNear;
 	wordsNear.setsizegrowth(1000);
-	int start = 0; // lower bound of the api array block to search
-	int end = len - 1; // upper bound of the api array block to search
-	int pivot; // index of api array element just being compared
-	int cond; // comparison result (in the sense of strcmp() result)
 
 	if (0 == words)
 		return NULL;
@@ -303,65 +259,24 @@ char *StringList::GetNearestWords(
 			sortedNoCase = true;
 			SortStringListNoCase(wordsNoCase, len);
 		}
-		while (start <= end) { // Binary searching loop
-			pivot = (start + end) / 2;
-			cond = CompareNCaseInsensitive(wordStart, wordsNoCase[pivot], searchLen);
-			if (!cond) {
-				// Find first match
-				while ((pivot > start) &&
-					(0 == CompareNCaseInsensitive(wordStart,
-						wordsNoCase[pivot-1], searchLen))) {
-					--pivot;
-				}
-				// Grab each match
-				while ((pivot <= end) &&
-					(0 == CompareNCaseInsensitive(wordStart,
-						wordsNoCase[pivot], searchLen))) {
-					wordlen = LengthWord(wordsNoCase[pivot], otherSeparator) + 1;
-					++pivot;
-					if (exactLen && wordlen != LengthWord(wordStart, otherSeparator) + 1)
-						continue;
-					wordsNear.append(wordsNoCase[pivot-1], wordlen, ' ');
-				}
-				return wordsNear.detach();
-			} else if (cond < 0) {
-				end = pivot - 1;
-			} else if (cond > 0) {
-				start = pivot + 1;
-			}
-		}
 	} else {	// Preserve the letter case
 		if (!sorted) {
 			sorted = true;
 			SortStringList(words, len);
 		}
-		while (start <= end) { // Binary searching loop
-			pivot = (start + end) / 2;
-			cond = strncmp(wordStart, words[pivot], searchLen);
-			if (!cond) {
-				// Find first match
-				while ((pivot > start) &&
-					(0 == strncmp(wordStart,
-						words[pivot-1], searchLen))) {
-					--pivot;
-				}
-				// Grab each match
-				while ((pivot <= end) &&
-					(0 == strncmp(wordStart,
-						words[pivot], searchLen))) {
-					wordlen = LengthWord(words[pivot], otherSeparator) + 1;
-					++pivot;
-					if (exactLen && wordlen != LengthWord(wordStart, otherSeparator) + 1)
-						continue;
-					wordsNear.append(words[pivot-1], wordlen, ' ');
-				}
-				return wordsNear.detach();
-			} else if (cond < 0) {
-				end = pivot - 1;
-			} else if (cond > 0) {
-				start = pivot + 1;
-			}
-		}
 	}
-	return NULL;
+	char **sortedWords = ignoreCase ? wordsNoCase : words;
+	int pivot = FirstWithPrefix(sortedWords, len, wordStart, searchLen, ignoreCase);
+	if (pivot >= len)
+		return NULL;
+	// Grab each match
+	while ((pivot < len) &&
+		(0 == ComparePrefix(wordStart, sortedWords[pivot], searchLen, ignoreCase))) {
+		wordlen = LengthWord(sortedWords[pivot], otherSeparator) + 1;
+		++pivot;
+		if (exactLen && wordlen != LengthWord(wordStart, otherSeparator) + 1)
+			continue;
+		wordsNear.append(sortedWords[pivot-1], wordlen, ' ');
+	}
+	return wordsNear.detach();
 }
@@ -25,6 +25,7 @@ public:
 	void Set(const char *s);
 	char *Allocate(int size);
 	void SetFromAllocated();
+	void Sort();
 	const char *GetNearestWord(const char *wordStart, size_t searchLen,
 		bool ignoreCase = false, SString wordCharacters="", int wordIndex = -1);
 	char *GetNearestWords(const char *wordStart, size_t searchLen,
@@ -5,7 +5,11 @@
 // Copyright 1998-2010 by Neil Hodgson <neilh@scintilla.org>
 // The License.txt file describes the conditions under which this software may be distributed.
 
+#include <string.h>
+
 #include <string>
+#include <vector>
+#include <algorithm>
 
 #include "Scintilla.h"
 #include "GUI.h"
@@ -76,6 +80,80 @@ int TextReader::GetLineState(int line) {
 	return sw.Call(SCI_GETLINESTATE, line);
 }
 
+StyledTextReader::StyledTextReader() :
+	lenDoc(0),
+	startPos(0) {
+}
+
+/**
+ * Copies the text and styles from @a start to @a end, which is the end of the document when
+ * negative. With @a withLines, the start and fold level of every line are copied too.
+ */
+void StyledTextReader::Fill(GUI::ScintillaWindow &sw, int start, int end, bool withLines) {
+	lenDoc = sw.Call(SCI_GETTEXTLENGTH, 0, 0);
+	if ((end < 0) || (end > lenDoc))
+		end = lenDoc;
+	if (start > end)
+		start = end;
+	startPos = start;
+	const int length = end - start;
+	chars.resize(length);
+	styles.resize(length);
+	// SCI_GETSTYLEDTEXT fills pairs of character and style followed by two NULs
+	std::vector<char> cells(blockSize * 2 + 2);
+	for (int blockStart = start; blockStart < end; blockStart += blockSize) {
+		const int blockEnd = (end - blockStart > blockSize) ? blockStart + blockSize : end;
+		Sci_TextRange tr = {{blockStart, blockEnd}, &cells[0]};
+		sw.Call(SCI_GETSTYLEDTEXT, 0, reinterpret_cast<sptr_t>(&tr));
+		for (int i = 0; i < blockEnd - blockStart; i++) {
+			chars[blockStart - start + i] = cells[i * 2];
+			styles[blockStart - start + i] = cells[i * 2 + 1];
+		}
+	}
+	lineStarts.clear();
+	levels.clear();
+	if (withLines) {
+		const int lines = sw.Call(SCI_GETLINECOUNT, 0, 0);
+		lineStarts.resize(lines);
+		levels.resize(lines);
+		for (int line = 0; line < lines; line++) {
+			lineStarts[line] = sw.Call(SCI_POSITIONFROMLINE, line, 0);
+			levels[line] = sw.Call(SCI_GETFOLDLEVEL, line, 0);
+		}
+	}
+}
+
+/**
+ * Returns the end of the run of characters starting at @a position with the same style where
+ * those after the first are not in @a special. The run does not extend past @a end or the
+ * range copied so it can be written from RangePointer(position).
+ */
+int StyledTextReader::RunEnd(int position, int end, const char *special) const {
+	const int endCopied = startPos + static_cast<int>(chars.size());
+	if (end > endCopied)
+		end = endCopied;
+	const char style = StyleAt(position);
+	int pos = position + 1;
+	while ((pos < end) && (styles[pos - startPos] == style) &&
+		!strchr(special, chars[pos - startPos])) {
+		pos++;
+	}
+	return pos;
+}
+
+int StyledTextReader::GetLine(int position) const {
+	if (lineStarts.empty())
+		return 0;
+	return static_cast<int>(std::upper_bound(lineStarts.begin(), lineStarts.end(), position) -
+		lineStarts.begin()) - 1;
+}
+
+int StyledTextReader::LevelAt(int line) const {
+	if ((line < 0) || (line >= static_cast<int>(levels.size())))
+		return SC_FOLDLEVELBASE;
+	return levels[line];
+}
+
 StyleWriter::StyleWriter(GUI::ScintillaWindow &sw_) :
 	TextReader(sw_),
 	validLen(0),
@@ -64,6 +64,44 @@ public:
 	int GetLineState(int line);
 };
 
+// Copies the text and styles of a range of a document, fetching them together in large blocks,
+// for tasks like exporting that visit every position. The copy does not change with the
+// document so it may be read on another thread while the document is edited.
+class StyledTextReader {
+	// Private so StyledTextReader objects can not be copied
+	StyledTextReader(const StyledTextReader &source);
+	StyledTextReader &operator=(const StyledTextReader &);
+	enum {blockSize=0x10000};
+	int lenDoc;
+	int startPos;
+	std::vector<char> chars;
+	std::vector<char> styles;
+	std::vector<int> lineStarts;
+	std::vector<int> levels;
+public:
+	StyledTextReader();
+	void Fill(GUI::ScintillaWindow &sw, int start=0, int end=-1, bool withLines=false);
+	/// Returns 0 for positions outside the range copied.
+	char operator[](int position) const {
+		const size_t index = position - startPos;
+		return (index < chars.size()) ? chars[index] : 0;
+	}
+	char StyleAt(int position) const {
+		const size_t index = position - startPos;
+		return (index < styles.size()) ? styles[index] : 0;
+	}
+	int Length() const {
+		return lenDoc;
+	}
+	int RunEnd(int position, int end, const char *special) const;
+	const char *RangePointer(int position) const {
+		return &chars[position - startPos];
+	}
+	// Lines are only available when filled withLines
+	int GetLine(int position) const;
+	int LevelAt(int line) const;
+};
+
 // Adds methods needed to write styles and folding
 class StyleWriter : public TextReader {
 	// Private so StyleWriter objects can not be copied
@@ -0,0 +1,333 @@
+// SciTE - Scintilla based Text Editor
+/** @file TableLexer.cxx
+ ** Lexer driven by a table of states and transitions built by a script.
+ **/
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <string.h>
+#include <ctype.h>
+
+#include <string>
+#include <vector>
+
+#include "Scintilla.h"
+
+#include "GUI.h"
+#include "StyleWriter.h"
+#include "TableLexer.h"
+
+#include "WordList.h"
+#include "CharClassify.h"
+#include "RESearch.h"
+
+#ifdef SCI_NAMESPACE
+using namespace Scintilla;
+#endif
+
+namespace {
+
+// Tokens longer than this are not checked against keywords, fold points or handlers.
+const unsigned int tokenLengthMax = 1000;
+
+CharClassify charClassify;
+
+class StyleWriterIndexer : public CharacterIndexer {
+	StyleWriter &styler;
+public:
+	explicit StyleWriterIndexer(StyleWriter &styler_) : styler(styler_) {}
+	virtual char CharAt(int index) {
+		return styler.SafeGetCharAt(index, '\0');
+	}
+};
+
+bool ValidState(int state) {
+	return state >= 0 && state < TableLexer::stateMax;
+}
+
+unsigned int LineStartPosition(StyleWriter &styler, int line, unsigned int lengthDoc) {
+	// Scintilla returns -1 for lines after the last line
+	const int pos = styler.LineStart(line);
+	if (pos < 0 || static_cast<unsigned int>(pos) > lengthDoc)
+		return lengthDoc;
+	return pos;
+}
+
+// Position of the line end characters of the line finishing before lineNext.
+unsigned int LineContentEnd(StyleWriter &styler, unsigned int lineStart, unsigned int lineNext) {
+	unsigned int end = lineNext;
+	while (end > lineStart) {
+		const char ch = styler.SafeGetCharAt(end - 1);
+		if (ch != '\r' && ch != '\n')
+			break;
+		end--;
+	}
+	return end;
+}
+
+}
+
+struct TableLexer::Rule {
+	Action action;
+	MatchKind kind;
+	bool caseSensitive;
+	std::string literal;
+	bool member[256];
+	RESearch *search;
+	int style;
+	Rule(Action action_, MatchKind kind_, bool caseSensitive_, int style_) :
+		action(action_), kind(kind_), caseSensitive(caseSensitive_), search(0), style(style_) {
+		memset(member, 0, sizeof(member));
+	}
+	~Rule() {
+		delete search;
+	}
+private:
+	Rule(const Rule &);
+	Rule &operator=(const Rule &);
+};
+
+struct TableLexer::Keywords {
+	int style;
+	WordList words;
+	int styleKeyword;
+	Keywords(int style_, int styleKeyword_) : style(style_), styleKeyword(styleKeyword_) {}
+};
+
+TableLexer::TableLexer() {
+	for (int state = 0; state < stateMax; state++) {
+		lineEndState[state] = -1;
+		tokenHandled[state] = false;
+		textNeeded[state] = false;
+	}
+}
+
+TableLexer::~TableLexer() {
+	for (int state = 0; state < stateMax; state++) {
+		for (std::vector<Rule *>::iterator it = rules[state].begin(); it != rules[state].end(); ++it)
+			delete *it;
+	}
+	for (std::vector<Keywords *>::iterator it = keywords.begin(); it != keywords.end(); ++it)
+		delete *it;
+}
+
+const char *TableLexer::AddRule(int state, Action action, MatchKind kind, const char *pattern, int lenPattern, int style, bool caseSensitive) {
+	if (!ValidState(state) || !ValidState(style))
+		return "State out of range";
+	if (lenPattern <= 0)
+		return "Empty pattern";
+	Rule *rule = new Rule(action, kind, caseSensitive, style);
+	if (kind == matchLiteral) {
+		rule->literal.assign(pattern, lenPattern);
+	} else if (kind == matchCharacters) {
+		// A set of characters and ranges such as "a-zA-Z0-9_"
+		const unsigned char *p = reinterpret_cast<const unsigned char *>(pattern);
+		const unsigned char *end = p + lenPattern;
+		while (p < end) {
+			int first = *p;
+			int last = *p;
+			if (p + 2 < end && p[1] == '-') {
+				last = p[2];
+				p += 3;
+			} else {
+				p++;
+			}
+			for (int ch = first; ch <= last; ch++) {
+				rule->member[ch] = true;
+				if (!caseSensitive && ch < 0x80) {
+					rule->member[tolower(ch)] = true;
+					rule->member[toupper(ch)] = true;
+				}
+			}
+		}
+	} else {
+		// Anchor the expression so it only matches at the current position
+		std::string anchored(pattern, lenPattern);
+		if (anchored[0] != '^')
+			anchored.insert(0, "^");
+		rule->search = new RESearch(&charClassify);
+		const char *errmsg = rule->search->Compile(anchored.c_str(), static_cast<int>(anchored.length()), caseSensitive, false);
+		if (errmsg) {
+			delete rule;
+			return errmsg;
+		}
+	}
+	rules[state].push_back(rule);
+	return 0;
+}
+
+void TableLexer::SetLineEndState(int state, int stateNext) {
+	if (ValidState(state))
+		lineEndState[state] = ValidState(stateNext) ? stateNext : -1;
+}
+
+void TableLexer::AddKeywords(int style, const char *words, int styleKeyword) {
+	if (!ValidState(style) || !ValidState(styleKeyword))
+		return;
+	Keywords *kw = new Keywords(style, styleKeyword);
+	kw->words.Set(words);
+	keywords.push_back(kw);
+	textNeeded[style] = true;
+}
+
+void TableLexer::AddFoldPoint(int style, const char *text, int delta) {
+	if (!ValidState(style))
+		return;
+	foldPoints.push_back(FoldPoint(style, text, delta));
+	textNeeded[style] = true;
+}
+
+void TableLexer::SetTokenHandler(int style, bool handled) {
+	if (!ValidState(style))
+		return;
+	tokenHandled[style] = handled;
+	if (handled)
+		textNeeded[style] = true;
+}
+
+int TableLexer::MatchLength(const Rule *rule, StyleWriter &styler, unsigned int pos, unsigned int lineEnd) const {
+	// Matches never extend over the end of a line
+	if (rule->kind == matchLiteral) {
+		const unsigned int len = static_cast<unsigned int>(rule->literal.length());
+		if (pos + len > lineEnd)
+			return 0;
+		for (unsigned int i = 0; i < len; i++) {
+			const char ch = styler[pos + i];
+			const char chRule = rule->literal[i];
+			if (rule->caseSensitive ? (ch != chRule) :
+			        (tolower(static_cast<unsigned char>(ch)) != tolower(static_cast<unsigned char>(chRule))))
+				return 0;
+		}
+		return len;
+	} else if (rule->kind == matchCharacters) {
+		unsigned int end = pos;
+		while (end < lineEnd && rule->member[static_cast<unsigned char>(styler[end])])
+			end++;
+		return end - pos;
+	} else {
+		if (pos >= lineEnd)
+			return 0;
+		StyleWriterIndexer indexer(styler);
+		if (rule->search->Execute(indexer, pos, lineEnd))
+			return rule->search->eopat[0] - rule->search->bopat[0];
+		return 0;
+	}
+}
+
+void TableLexer::FinishRun(StyleWriter &styler, unsigned int start, unsigned int end, int style, TokenHandler *handler, int &levelNext) {
+	if (end <= start)
+		return;
+	if (textNeeded[style] && (end - start) <= tokenLengthMax) {
+		std::string text;
+		text.reserve(end - start);
+		for (unsigned int pos = start; pos < end; pos++)
+			text += styler[pos];
+		for (std::vector<Keywords *>::const_iterator it = keywords.begin(); it != keywords.end(); ++it) {
+			if ((*it)->style == style && (*it)->words.InList(text.c_str())) {
+				style = (*it)->styleKeyword;
+				break;
+			}
+		}
+		if (handler && tokenHandled[style]) {
+			const int styleHandler = handler->OnToken(style, text);
+			if (ValidState(styleHandler))
+				style = styleHandler;
+		}
+		for (std::vector<FoldPoint>::const_iterator it = foldPoints.begin(); it != foldPoints.end(); ++it) {
+			if (it->style == style && it->text == text)
+				levelNext += it->delta;
+		}
+	}
+	styler.ColourTo(end - 1, style);
+}
+
+void TableLexer::Lex(StyleWriter &styler, unsigned int startPos, int length, TokenHandler *handler) {
+	const unsigned int lengthDoc = styler.Length();
+
+	// Lex whole lines so each line can be restarted from the line state of the line before
+	int lineCurrent = styler.GetLine(startPos);
+	unsigned int pos = LineStartPosition(styler, lineCurrent, lengthDoc);
+	unsigned int endPos = startPos + length;
+	if (endPos > lengthDoc)
+		endPos = lengthDoc;
+	if (endPos > pos)
+		endPos = LineStartPosition(styler, styler.GetLine(endPos - 1) + 1, lengthDoc);
+
+	int state = 0;
+	int levelCurrent = SC_FOLDLEVELBASE;
+	if (lineCurrent > 0) {
+		state = styler.GetLineState(lineCurrent - 1);
+		if (!ValidState(state))
+			state = 0;
+		// The level for the following line is kept in the upper 16 bits as done by LexCPP
+		const int levelPrevious = styler.LevelAt(lineCurrent - 1) >> 16;
+		if (levelPrevious >= SC_FOLDLEVELBASE)
+			levelCurrent = levelPrevious;
+	}
+	int levelNext = levelCurrent;
+	const bool folding = !foldPoints.empty();
+
+	styler.StartAt(pos, static_cast<char>(0xffu));
+	styler.StartSegment(pos);
+
+	unsigned int runStart = pos;
+	unsigned int lineNext = LineStartPosition(styler, lineCurrent + 1, lengthDoc);
+	unsigned int lineEnd = LineContentEnd(styler, pos, lineNext);
+	while (pos < endPos) {
+		const Rule *rule = 0;
+		int lenMatch = 0;
+		for (std::vector<Rule *>::const_iterator it = rules[state].begin(); it != rules[state].end(); ++it) {
+			lenMatch = MatchLength(*it, styler, pos, lineEnd);
+			if (lenMatch > 0) {
+				rule = *it;
+				break;
+			}
+		}
+
+		if (!rule) {
+			pos++;
+		} else if (rule->action == actionToken) {
+			FinishRun(styler, runStart, pos, state, handler, levelNext);
+			FinishRun(styler, pos, pos + lenMatch, rule->style, handler, levelNext);
+			pos += lenMatch;
+			runStart = pos;
+		} else if (rule->action == actionEnter) {
+			FinishRun(styler, runStart, pos, state, handler, levelNext);
+			state = rule->style;
+			runStart = pos;
+			pos += lenMatch;
+		} else {
+			pos += lenMatch;
+			FinishRun(styler, runStart, pos, state, handler, levelNext);
+			state = rule->style;
+			runStart = pos;
+		}
+
+		// Matches stop before the line end characters so the line end is only reached by
+		// stepping. Tokens end there so keywords and fold points apply to this line.
+		if (pos == lineEnd && runStart < lineEnd) {
+			FinishRun(styler, runStart, pos, state, handler, levelNext);
+			runStart = pos;
+		}
+		if (pos >= lineNext) {
+			FinishRun(styler, runStart, pos, state, handler, levelNext);
+			runStart = pos;
+			if (lineEndState[state] >= 0)
+				state = lineEndState[state];
+			styler.SetLineState(lineCurrent, state);
+			if (folding) {
+				if (levelNext < SC_FOLDLEVELBASE)
+					levelNext = SC_FOLDLEVELBASE;
+				int lev = levelCurrent | (levelNext << 16);
+				if (levelNext > levelCurrent)
+					lev |= SC_FOLDLEVELHEADERFLAG;
+				styler.SetLevel(lineCurrent, lev);
+				levelCurrent = levelNext;
+			}
+			lineCurrent++;
+			lineNext = LineStartPosition(styler, lineCurrent + 1, lengthDoc);
+			lineEnd = LineContentEnd(styler, pos, lineNext);
+		}
+	}
+	FinishRun(styler, runStart, pos, state, handler, levelNext);
+	styler.Flush();
+}
@@ -0,0 +1,69 @@
+// SciTE - Scintilla based Text Editor
+/** @file TableLexer.h
+ ** Lexer driven by a table of states and transitions built by a script.
+ **/
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef TABLELEXER_H
+#define TABLELEXER_H
+
+// A state machine whose description is built once by a script and which then
+// styles a document without calling back into the script except for tokens
+// that have a handler.
+// Each state is also the style of the text lexed in that state. Rules for a state
+// are tried in the order they were added at every position and the first rule that
+// matches decides what happens:
+//  actionToken - the match is styled with the rule style and the state is unchanged
+//  actionEnter - the match starts a run of the rule state
+//  actionExit  - the match ends the current run and the rule state follows
+// The state at the end of each line is stored in the line state so restyling can
+// start at any line.
+class TableLexer {
+public:
+	enum { stateMax = 256 };
+	enum MatchKind { matchLiteral, matchCharacters, matchRegex };
+	enum Action { actionToken, actionEnter, actionExit };
+
+	class TokenHandler {
+	public:
+		virtual ~TokenHandler() {}
+		/// Return the style for a token or -1 to keep the style chosen by the table.
+		virtual int OnToken(int style, const std::string &text) = 0;
+	};
+
+	TableLexer();
+	~TableLexer();
+	/// Returns an error message or NULL if the rule was added.
+	const char *AddRule(int state, Action action, MatchKind kind, const char *pattern, int lenPattern, int style, bool caseSensitive=true);
+	void SetLineEndState(int state, int stateNext);
+	void AddKeywords(int style, const char *words, int styleKeyword);
+	void AddFoldPoint(int style, const char *text, int delta);
+	void SetTokenHandler(int style, bool handled);
+	void Lex(StyleWriter &styler, unsigned int startPos, int length, TokenHandler *handler);
+
+private:
+	struct Rule;
+	struct Keywords;
+	struct FoldPoint {
+		int style;
+		std::string text;
+		int delta;
+		FoldPoint(int style_, const std::string &text_, int delta_) : style(style_), text(text_), delta(delta_) {}
+	};
+
+	std::vector<Rule *> rules[stateMax];
+	int lineEndState[stateMax];
+	std::vector<Keywords *> keywords;
+	std::vector<FoldPoint> foldPoints;
+	bool tokenHandled[stateMax];
+	bool textNeeded[stateMax];
+
+	// Private so TableLexer objects can not be copied
+	TableLexer(const TableLexer &);
+	TableLexer &operator=(const TableLexer &);
+
+	int MatchLength(const Rule *rule, StyleWriter &styler, unsigned int pos, unsigned int lineEnd) const;
+	void FinishRun(StyleWriter &styler, unsigned int start, unsigned int end, int style, TokenHandler *handler, int &levelNext);
+};
+
+#endif
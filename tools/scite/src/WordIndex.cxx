@@ -0,0 +1,181 @@
+// SciTE - Scintilla based Text Editor
+/** @file WordIndex.cxx
+ ** Index of the words in a document for word completion.
+ **/
+// Copyright 1998-2014 by Neil Hodgson <neilh@scintilla.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include "Scintilla.h"
+
+#include "GUI.h"
+
+#include "StringHelpers.h"
+#include "WordIndex.h"
+
+bool WordIndex::CompareWords::operator()(const std::string &a, const std::string &b) const {
+	const int cmp = CompareNCaseInsensitive(a.c_str(), b.c_str(), std::min(a.length(), b.length()));
+	if (cmp != 0)
+		return cmp < 0;
+	if (a.length() != b.length())
+		return a.length() < b.length();
+	return a < b;
+}
+
+WordIndex::WordIndex() {
+	Clear();
+}
+
+WordIndex::~WordIndex() {
+}
+
+void WordIndex::Clear() {
+	words.clear();
+	doc = 0;
+	wordCharacters.clear();
+	for (int ch = 0; ch < 256; ch++)
+		isWordCharacter[ch] = false;
+	lineCount = 0;
+	length = 0;
+	linesIndexed = 0;
+	lineModified = -1;
+	linesModified = 0;
+}
+
+/**
+ * Adds (increment 1) or removes (increment -1) the words of lines [lineStart, lineEnd).
+ */
+void WordIndex::CountWords(GUI::ScintillaWindow *pSci, int lineStart, int lineEnd, int increment) {
+	if (lineStart >= lineEnd)
+		return;
+	const int positionStart = pSci->Call(SCI_POSITIONFROMLINE, lineStart);
+	const int positionEnd = pSci->Call(SCI_GETLINEENDPOSITION, lineEnd - 1);
+	if (positionEnd <= positionStart)
+		return;
+	std::vector<char> text(positionEnd - positionStart + 1);
+	Sci_TextRange tr;
+	tr.chrg.cpMin = positionStart;
+	tr.chrg.cpMax = positionEnd;
+	tr.lpstrText = &text[0];
+	pSci->Call(SCI_GETTEXTRANGE, 0, reinterpret_cast<sptr_t>(&tr));
+	const char *textEnd = &text[0] + (positionEnd - positionStart);
+	const char *s = &text[0];
+	while (s < textEnd) {
+		while ((s < textEnd) && !isWordCharacter[static_cast<unsigned char>(*s)])
+			s++;
+		const char *wordStart = s;
+		while ((s < textEnd) && isWordCharacter[static_cast<unsigned char>(*s)])
+			s++;
+		if (s > wordStart) {
+			const std::string word(wordStart, s);
+			if (increment > 0) {
+				words[word]++;
+			} else {
+				WordCounts::iterator it = words.find(word);
+				if (it != words.end()) {
+					if (--(it->second) <= 0)
+						words.erase(it);
+				}
+			}
+		}
+	}
+}
+
+/// Is the index for the document in pSci and its counts are not known to be out of date.
+bool WordIndex::Valid(GUI::ScintillaWindow *pSci, const std::string &wordCharacters_) const {
+	return doc &&
+		(doc == pSci->CallReturnPointer(SCI_GETDOCPOINTER)) &&
+		(wordCharacters == wordCharacters_) &&
+		(length == pSci->Call(SCI_GETLENGTH)) &&
+		(lineCount == pSci->Call(SCI_GETLINECOUNT));
+}
+
+void WordIndex::Start(GUI::ScintillaWindow *pSci, const std::string &wordCharacters_) {
+	Clear();
+	doc = pSci->CallReturnPointer(SCI_GETDOCPOINTER);
+	wordCharacters = wordCharacters_;
+	for (size_t i = 0; i < wordCharacters.length(); i++)
+		isWordCharacter[static_cast<unsigned char>(wordCharacters[i])] = true;
+	// Words do not continue over line ends
+	isWordCharacter[static_cast<unsigned char>('\r')] = false;
+	isWordCharacter[static_cast<unsigned char>('\n')] = false;
+	lineCount = pSci->Call(SCI_GETLINECOUNT);
+	length = pSci->Call(SCI_GETLENGTH);
+}
+
+bool WordIndex::Complete() const {
+	return doc && (linesIndexed >= lineCount);
+}
+
+void WordIndex::Continue(GUI::ScintillaWindow *pSci) {
+	const int segment = 2000;
+	const int lineEndSegment = std::min(linesIndexed + segment, lineCount);
+	CountWords(pSci, linesIndexed, lineEndSegment, 1);
+	linesIndexed = lineEndSegment;
+}
+
+/**
+ * Called for each SC_MOD_BEFOREINSERT, SC_MOD_BEFOREDELETE, SC_MOD_INSERTTEXT, and
+ * SC_MOD_DELETETEXT notification. The words of the lines touched are removed before
+ * the change and the words of the resulting lines added after it.
+ * Lines not yet indexed are left for Continue.
+ */
+void WordIndex::Modified(GUI::ScintillaWindow *pSci, int modificationType, int position, int lengthChange, int linesAdded) {
+	if (!doc || (doc != pSci->CallReturnPointer(SCI_GETDOCPOINTER)))
+		return;
+	if (modificationType & (SC_MOD_BEFOREINSERT | SC_MOD_BEFOREDELETE)) {
+		int lineStart = pSci->Call(SCI_LINEFROMPOSITION, position);
+		// A change at the start of a line may join a "\r" ending the line before with a "\n"
+		if ((lineStart > 0) && (position == pSci->Call(SCI_POSITIONFROMLINE, lineStart)))
+			lineStart--;
+		const int lengthDeleted = (modificationType & SC_MOD_BEFOREDELETE) ? lengthChange : 0;
+		const int lineEnd = pSci->Call(SCI_LINEFROMPOSITION, position + lengthDeleted) + 1;
+		lineModified = -1;
+		if (lineStart < linesIndexed) {
+			CountWords(pSci, lineStart, std::min(lineEnd, linesIndexed), -1);
+			if (lineEnd > linesIndexed) {
+				// The lines were only partly indexed so leave them all for Continue
+				linesIndexed = lineStart;
+			} else {
+				lineModified = lineStart;
+				linesModified = lineEnd - lineStart;
+			}
+		}
+	} else if (modificationType & (SC_MOD_INSERTTEXT | SC_MOD_DELETETEXT)) {
+		length += (modificationType & SC_MOD_INSERTTEXT) ? lengthChange : -lengthChange;
+		lineCount += linesAdded;
+		if (lineModified >= 0) {
+			// The lines removed become linesAdded more or fewer lines, even when a line end
+			// is split or joined without changing the number of lines
+			linesIndexed += linesAdded;
+			CountWords(pSci, lineModified, lineModified + linesModified + linesAdded, 1);
+		}
+		lineModified = -1;
+	}
+}
+
+/**
+ * Appends to found each word longer than root that starts with root.
+ * One occurrence of wordExcluded, the word being completed, is not counted.
+ */
+void WordIndex::WordsStarting(const std::string &root, bool ignoreCase, const std::string &wordExcluded,
+	std::vector<std::string> &found) const {
+	for (WordCounts::const_iterator it = words.lower_bound(root); it != words.end(); ++it) {
+		const std::string &word = it->first;
+		if (CompareNCaseInsensitive(word.c_str(), root.c_str(), root.length()) != 0)
+			break;
+		if (word.length() <= root.length())
+			continue;
+		if (!ignoreCase && (word.compare(0, root.length(), root) != 0))
+			continue;
+		if ((word == wordExcluded) && (it->second <= 1))
+			continue;
+		found.push_back(word);
+	}
+}
@@ -0,0 +1,50 @@
+// SciTE - Scintilla based Text Editor
+/** @file WordIndex.h
+ ** Index of the words in a document for word completion.
+ **/
+// Copyright 1998-2014 by Neil Hodgson <neilh@scintilla.org>
+// The License.txt file describes the conditions under which this software may be distributed.
+
+#ifndef WORDINDEX_H
+#define WORDINDEX_H
+
+/**
+ * Counts each word of a document so the words starting with some text can be found
+ * without searching the document.
+ * The index is built a segment of lines at a time while idle and is then kept up to date
+ * from modification notifications which only rescan the lines changed.
+ */
+class WordIndex {
+	struct CompareWords {
+		bool operator()(const std::string &a, const std::string &b) const;
+	};
+	// Ordered ignoring case then by case so one map serves both kinds of search
+	typedef std::map<std::string, int, CompareWords> WordCounts;
+	WordCounts words;
+	sptr_t doc;
+	std::string wordCharacters;
+	bool isWordCharacter[256];
+	int lineCount;
+	int length;
+	int linesIndexed;	///< Lines before this are in the index
+	int lineModified;	///< First line removed before the current modification or -1
+	int linesModified;	///< Number of lines removed before the current modification
+	void CountWords(GUI::ScintillaWindow *pSci, int lineStart, int lineEnd, int increment);
+public:
+	WordIndex();
+	~WordIndex();
+	void Clear();
+	bool Valid(GUI::ScintillaWindow *pSci, const std::string &wordCharacters_) const;
+	void Start(GUI::ScintillaWindow *pSci, const std::string &wordCharacters_);
+	bool Complete() const;
+	void Continue(GUI::ScintillaWindow *pSci);
+	void Modified(GUI::ScintillaWindow *pSci, int modificationType, int position, int lengthChange, int linesAdded);
+	void WordsStarting(const std::string &root, bool ignoreCase, const std::string &wordExcluded,
+		std::vector<std::string> &found) const;
+private:
+	// Private so WordIndex objects can not be copied
+	WordIndex(const WordIndex &);
+	WordIndex &operator=(const WordIndex &);
+};
+
+#endif
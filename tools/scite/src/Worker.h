@@ -10,8 +10,8 @@ private:
 	Mutex *mutex;
 	volatile bool completed;
 	volatile bool cancelling;
-	volatile int jobSize;
-	volatile int jobProgress;
+	volatile long long jobSize;
+	volatile long long jobProgress;
 public:
 	Worker() : mutex(Mutex::Create()), completed(false), cancelling(false), jobSize(1), jobProgress(0) {
 	}
@@ -31,19 +31,19 @@ public:
 		Lock lock(mutex);
 		return cancelling;
 	}
-	int SizeJob() const {
+	long long SizeJob() const {
 		Lock lock(mutex);
 		return jobSize;
 	}
-	void SetSizeJob(int size) {
+	void SetSizeJob(long long size) {
 		Lock lock(mutex);
 		jobSize = size;
 	}
-	int ProgressMade() const {
+	long long ProgressMade() const {
 		Lock lock(mutex);
 		return jobProgress;
 	}
-	void IncrementProgress(int increment) {
+	void IncrementProgress(long long increment) {
 		Lock lock(mutex);
 		jobProgress += increment;
 	}
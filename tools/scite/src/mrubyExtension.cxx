@@ -11,6 +11,7 @@
 
 #include <string>
 #include <vector>
+#include <new>
 
 #include "Scintilla.h"
 
@@ -20,10 +21,19 @@
 #include "StyleWriter.h"
 #include "Extender.h"
 #include "mrubyExtension.h"
+#include "TableLexer.h"
 
 #include "IFaceTable.h"
 #include "SciTEKeys.h"
 
+#include "WordList.h"
+#include "CharClassify.h"
+#include "RESearch.h"
+
+#ifdef SCI_NAMESPACE
+using namespace Scintilla;
+#endif
+
 extern "C" {
 #include "mruby.h"
 #include "mruby/array.h"
@@ -33,6 +43,7 @@ extern "C" {
 #include "mruby/error.h"
 #include "mruby/hash.h"
 #include "mruby/irep.h"
+#include "mruby/proc.h"
 #include "mruby/string.h"
 #include "mruby/variable.h"
 #include "../mrblib/mrblib_extman.c"
@@ -62,13 +73,22 @@ extern "C" {
 
 #define M_SCITE mrb_module_get(mrb, "SciTE")
 
+static void sc_free(mrb_state *mrb, void *ptr);
 static void pmo_free(mrb_state *mrb, void *ptr);
+static void wordlist_free(mrb_state *mrb, void *ptr);
+static void tablelexer_free(mrb_state *mrb, void *ptr);
+static void textview_free(mrb_state *mrb, void *ptr);
 static void subprocess_free(mrb_state *mrb, void *ptr);
-static mrb_data_type mrb_sc_type  = { "SciTEStylingContext", mrb_free };
+static void sendbatch_free(mrb_state *mrb, void *ptr);
+static mrb_data_type mrb_sc_type  = { "SciTEStylingContext", sc_free };
 static mrb_data_type mrb_pmo_type = { "SciTEPaneMatchObject", pmo_free };
 static mrb_data_type mrb_po_type  = { "SciTEPane", mrb_free };
 static mrb_data_type mrb_ipb_type = { "SciTEIFacePropertyBinding", mrb_free };
+static mrb_data_type mrb_wl_type  = { "SciTEWordList", wordlist_free };
+static mrb_data_type mrb_tl_type  = { "SciTETableLexer", tablelexer_free };
+static mrb_data_type mrb_tv_type  = { "SciTETextView", textview_free };
 static mrb_data_type mrb_subprocess_type = { "SciTESubprocess", subprocess_free };
+static mrb_data_type mrb_sb_type  = { "SciTESendBatch", sendbatch_free };
 
 static ExtensionAPI *host = 0;
 static mrb_state *mrbState = 0;
@@ -106,7 +126,16 @@ mrubyExtension &mrubyExtension::Instance() {
 static ExtensionAPI::Pane check_pane_object(mrb_state *mrb, mrb_value self);
 static mrb_value create_pane_object(mrb_state *mrb, ExtensionAPI::Pane p);
 static mrb_value iface_function_helper(mrb_state *mrb, ExtensionAPI::Pane pane, const IFaceFunction &func, mrb_int argc, mrb_value *argv);
-static mrb_value cf_pane_metatable_newindex(mrb_state *mrb, mrb_value self, const char *name, mrb_value val);
+
+// The message parameters worked out from the script arguments of one call
+struct IFaceCall {
+	sptr_t params[2];
+	bool needStringResult;
+};
+
+static IFaceCall iface_function_arguments(mrb_state *mrb, const IFaceFunction &func, mrb_int argc, mrb_value *argv, mrb_value keep);
+static mrb_value iface_function_send(mrb_state *mrb, ExtensionAPI::Pane p, const IFaceFunction &func, IFaceCall call);
+static mrb_value iface_result_value(const IFaceFunction &func, sptr_t result);
 static void stylingcontext_init(mrb_state *mrb);
 static void backtrace(mrb_state *mrb, const char *error = NULL);
 
@@ -160,6 +189,24 @@ static const char *obj_to_cstr(mrb_state *mrb, mrb_value obj)
 	return mrb_string_value_cstr(mrb, &str);
 }
 
+static IFaceFunction send_function(int message) {
+	IFaceFunction func = { "", 0, iface_void, { iface_void, iface_void } };
+	int funcIdx = IFaceTable::FindFunctionByValue(message);
+	if (funcIdx >= 0) {
+		func = IFaceTable::functions[funcIdx];
+	} else {
+		int propIdx = IFaceTable::FindPropertyByValue(message);
+		if (propIdx >= 0) {
+			if (IFaceTable::properties[propIdx].getter == message) {
+				func = IFaceTable::properties[propIdx].GetterFunction();
+			} else {
+				func = IFaceTable::properties[propIdx].SetterFunction();
+			}
+		}
+	}
+	return func;
+}
+
 static mrb_value cf_scite_send(mrb_state *mrb, ExtensionAPI::Pane pane) {
 	// This is reinstated as a replacement for the old <pane>:send, which was removed
 	// due to safety concerns.  Is now exposed as scite.SendEditor / scite.SendOutput.
@@ -170,26 +217,7 @@ static mrb_value cf_scite_send(mrb_state *mrb, ExtensionAPI::Pane pane) {
 	mrb_int message, argc;
 	mrb_get_args(mrb, "i*", &message, &argv, &argc);
 
-	IFaceFunction func = { "", 0, iface_void, { iface_void, iface_void } };
-	for (int funcIdx = 0; funcIdx < IFaceTable::functionCount; ++funcIdx) {
-		if (IFaceTable::functions[funcIdx].value == message) {
-			func = IFaceTable::functions[funcIdx];
-			break;
-		}
-	}
-
-	if (func.value == 0) {
-		for (int propIdx = 0; propIdx < IFaceTable::propertyCount; ++propIdx) {
-			if (IFaceTable::properties[propIdx].getter == message) {
-				func = IFaceTable::properties[propIdx].GetterFunction();
-				break;
-			} else if (IFaceTable::properties[propIdx].setter == message) {
-				func = IFaceTable::properties[propIdx].SetterFunction();
-				break;
-			}
-		}
-	}
-
+	IFaceFunction func = send_function(static_cast<int>(message));
 	if (func.value != 0) {
 		if (IFaceFunctionIsScriptable(func)) {
 			return iface_function_helper(mrb, pane, func, argc, argv);
@@ -212,6 +240,138 @@ static mrb_value cf_scite_send_output(mrb_state *mrb, mrb_value /*self*/) {
 	return cf_scite_send(mrb, ExtensionAPI::paneOutput);
 }
 
+struct SendBatch {
+	ExtensionAPI::Pane pane;
+	mrb_value batch;
+	bool packed;
+	mrb_int count;
+	std::vector<IFaceFunction> functions;
+	std::vector<IFaceCall> calls;
+	mrb_value results;
+};
+
+static void sendbatch_free(mrb_state *mrb, void *ptr) {
+	if (ptr) {
+		SendBatch *sb = static_cast<SendBatch *>(ptr);
+		sb->~SendBatch();
+		mrb_free(mrb, ptr);
+	}
+}
+
+static mrb_value send_batch_messages(mrb_state *mrb, mrb_value data) {
+	SendBatch *sb = static_cast<SendBatch *>(mrb_data_get_ptr(mrb, data, &mrb_sb_type));
+	const int tupleSize = 3;
+	int ai = mrb_gc_arena_save(mrb);
+	for (mrb_int i = 0; i < sb->count; i++) {
+		mrb_value result;
+		if (sb->packed) {
+			const int *tuple = reinterpret_cast<const int *>(RSTRING_PTR(sb->batch)) + i * tupleSize;
+			result = iface_result_value(sb->functions[i], host->Send(sb->pane, tuple[0], tuple[1], tuple[2]));
+		} else {
+			result = iface_function_send(mrb, sb->pane, sb->functions[i], sb->calls[i]);
+		}
+		mrb_ary_push(mrb, sb->results, result);
+		mrb_gc_arena_restore(mrb, ai);
+	}
+	return sb->results;
+}
+
+static mrb_value send_batch_end_undo(mrb_state *mrb, mrb_value data) {
+	SendBatch *sb = static_cast<SendBatch *>(mrb_data_get_ptr(mrb, data, &mrb_sb_type));
+	host->Send(sb->pane, SCI_ENDUNDOACTION, 0, 0);
+	return mrb_nil_value();
+}
+
+static mrb_value cf_scite_send_batch(mrb_state *mrb, ExtensionAPI::Pane pane) {
+	// Sends many messages in one call and returns their results in an array.
+	// The batch is either an array of [message, args...] arrays whose arguments are
+	// converted as by send_editor, or a string of packed native int triples for
+	// messages that only take numbers.
+	// Every argument is converted before anything is sent so a bad argument never
+	// leaves a batch half done, and an undo group is closed even if sending raises.
+	mrb_value batch;
+	mrb_bool undoGroup = false;
+	mrb_get_args(mrb, "o|b", &batch, &undoGroup);
+
+	// Held by a data object so it is freed even when a conversion raises
+	SendBatch *psb = new (mrb_malloc(mrb, sizeof(SendBatch))) SendBatch();
+	mrb_value data = mrb_obj_value(mrb_data_object_alloc(mrb, mrb->object_class, psb, &mrb_sb_type));
+	SendBatch &sb = *psb;
+	sb.pane = pane;
+	sb.batch = batch;
+	sb.packed = mrb_string_p(batch);
+	if (!sb.packed && !mrb_array_p(batch)) {
+		raise_error(mrb, "Batch must be an array of [message, wParam, lParam] or a string of packed integers.");
+		return mrb_nil_value();
+	}
+	const int tupleSize = 3;
+	sb.count = sb.packed ? RSTRING_LEN(batch) / (tupleSize * sizeof(int)) : RARRAY_LEN(batch);
+	if (sb.packed && (RSTRING_LEN(batch) % (tupleSize * sizeof(int)))) {
+		raise_error(mrb, "Packed batch length is not a multiple of three integers.");
+		return mrb_nil_value();
+	}
+
+	// Strings made while converting arguments must live until their messages are sent
+	mrb_value keep = mrb_ary_new(mrb);
+	sb.results = mrb_ary_new_capa(mrb, sb.count);
+	sb.functions.resize(static_cast<size_t>(sb.count));
+	if (!sb.packed)
+		sb.calls.resize(static_cast<size_t>(sb.count));
+	int messageLast = 0;
+	IFaceFunction funcLast = { "", 0, iface_void, { iface_void, iface_void } };
+	int ai = mrb_gc_arena_save(mrb);
+	for (mrb_int i = 0; i < sb.count; i++) {
+		int message;
+		mrb_value tuple = mrb_nil_value();
+		if (sb.packed) {
+			message = reinterpret_cast<const int *>(RSTRING_PTR(batch))[i * tupleSize];
+		} else {
+			tuple = RARRAY_PTR(batch)[i];
+			if (!mrb_array_p(tuple) || RARRAY_LEN(tuple) < 1 || !mrb_fixnum_p(RARRAY_PTR(tuple)[0])) {
+				raise_error(mrb, "Each batch entry must be [message, wParam, lParam].");
+				return mrb_nil_value();
+			}
+			message = static_cast<int>(mrb_fixnum(RARRAY_PTR(tuple)[0]));
+		}
+		if (message != messageLast || funcLast.value == 0) {
+			funcLast = send_function(message);
+			messageLast = message;
+		}
+		const IFaceFunction &func = funcLast;
+		if (func.value == 0) {
+			raise_error(mrb, "Message number does not match any published Scintilla function or property");
+			return mrb_nil_value();
+		} else if (!IFaceFunctionIsScriptable(func)) {
+			raise_error(mrb, "Cannot call send for this function: not scriptable.");
+			return mrb_nil_value();
+		} else if (sb.packed) {
+			if (!(IFaceTypeIsNumeric(func.paramType[0]) || func.paramType[0] == iface_void || func.paramType[0] == iface_bool) ||
+			        !(IFaceTypeIsNumeric(func.paramType[1]) || func.paramType[1] == iface_void || func.paramType[1] == iface_bool) ||
+			        func.paramType[0] == iface_keymod) {
+				raise_error(mrb, "Packed batches can only send messages with numeric arguments.");
+				return mrb_nil_value();
+			}
+		} else {
+			sb.calls[i] = iface_function_arguments(mrb, func, RARRAY_LEN(tuple) - 1, RARRAY_PTR(tuple) + 1, keep);
+		}
+		sb.functions[i] = func;
+		mrb_gc_arena_restore(mrb, ai);
+	}
+
+	if (!undoGroup)
+		return send_batch_messages(mrb, data);
+	host->Send(pane, SCI_BEGINUNDOACTION, 0, 0);
+	return mrb_ensure(mrb, send_batch_messages, data, send_batch_end_undo, data);
+}
+
+static mrb_value cf_scite_send_editor_batch(mrb_state *mrb, mrb_value /*self*/) {
+	return cf_scite_send_batch(mrb, ExtensionAPI::paneEditor);
+}
+
+static mrb_value cf_scite_send_output_batch(mrb_state *mrb, mrb_value /*self*/) {
+	return cf_scite_send_batch(mrb, ExtensionAPI::paneOutput);
+}
+
 static mrb_value cf_scite_constname(mrb_state *mrb, mrb_value /*self*/) {
 	char constName[100] = "";
 	mrb_int message;
@@ -295,17 +455,29 @@ static ExtensionAPI::Pane check_pane_object(mrb_state *mrb, mrb_value self) {
 	return pane;
 }
 
+// Returns the document bytes from start to end in place. The pointer is only valid
+// until the document is next modified.
+static const char *range_pointer(ExtensionAPI::Pane p, int start, int end) {
+	return reinterpret_cast<const char *>(host->Send(p, SCI_GETRANGEPOINTER, start, end - start));
+}
+
+static mrb_value range_string(mrb_state *mrb, ExtensionAPI::Pane p, int start, int end) {
+	int length = static_cast<int>(host->Send(p, SCI_GETLENGTH, 0, 0));
+	if (end > length)
+		end = length;
+	if (start < 0)
+		start = 0;
+	if (end <= start)
+		return mrb_str_new(mrb, 0, 0);
+	return mrb_str_new(mrb, range_pointer(p, start, end), end - start);
+}
+
 static mrb_value cf_pane_textrange(mrb_state *mrb, mrb_value self) {
 	ExtensionAPI::Pane p = check_pane_object(mrb, self);
 	mrb_int cpMin, cpMax;
 	mrb_get_args(mrb, "ii", &cpMin, &cpMax);
 	if (cpMax >= 0) {
-		char *range = host->Range(p, cpMin, cpMax);
-		if (range) {
-			mrb_value ret = mrb_str_new_cstr(mrb, range);
-			delete[]range;
-			return ret;
-		}
+		return range_string(mrb, p, static_cast<int>(cpMin), static_cast<int>(cpMax));
 	} else {
 		raise_error(mrb, "Invalid argument 1 for <pane>:textrange.  Positive number or zero expected.");
 	}
@@ -362,6 +534,147 @@ static mrb_value cf_pane_findtext(mrb_state *mrb, mrb_value self) {
 	}
 }
 
+// Text views read a range of the document in place instead of copying it into a
+// string. The document is not copied and no pointer is kept: each access asks
+// Scintilla for the range again so a view stays safe when the document changes.
+// A view covers fixed document positions so after a modification it sees the new
+// text at those positions and raises an error once the document no longer reaches
+// its end. valid? reports whether the document length is unchanged since the view
+// was made.
+
+struct TextView {
+	ExtensionAPI::Pane pane;
+	int start;
+	int length;
+	int lengthDocument;
+};
+
+static void textview_free(mrb_state *mrb, void *ptr) {
+	mrb_free(mrb, ptr);
+}
+
+static TextView *check_text_view(mrb_state *mrb, mrb_value self) {
+	return static_cast<TextView *>(mrb_data_get_ptr(mrb, self, &mrb_tv_type));
+}
+
+static const char *text_view_pointer(mrb_state *mrb, const TextView *tv) {
+	if (tv->start + tv->length > host->Send(tv->pane, SCI_GETLENGTH, 0, 0)) {
+		raise_error(mrb, "Text view is beyond the end of the document.");
+		return NULL;
+	}
+	return range_pointer(tv->pane, tv->start, tv->start + tv->length);
+}
+
+static mrb_value cf_pane_text_view(mrb_state *mrb, mrb_value self) {
+	ExtensionAPI::Pane p = check_pane_object(mrb, self);
+	mrb_int start = 0, length = -1;
+	mrb_get_args(mrb, "|ii", &start, &length);
+	int lengthDocument = static_cast<int>(host->Send(p, SCI_GETLENGTH, 0, 0));
+	if (start < 0 || start > lengthDocument)
+		raise_error(mrb, "Invalid argument 1 for <pane>:text_view.  Position within the document expected.");
+	if (length < 0 || start + length > lengthDocument)
+		length = lengthDocument - start;
+
+	TextView *tv = static_cast<TextView *>(mrb_malloc(mrb, sizeof(TextView)));
+	tv->pane = p;
+	tv->start = static_cast<int>(start);
+	tv->length = static_cast<int>(length);
+	tv->lengthDocument = lengthDocument;
+	RClass *textview_class = mrb_class_get_under(mrb, M_SCITE, "TextView");
+	return mrb_obj_value(mrb_data_object_alloc(mrb, textview_class, tv, &mrb_tv_type));
+}
+
+static mrb_value cf_textview_start(mrb_state *mrb, mrb_value self) {
+	return mrb_fixnum_value(check_text_view(mrb, self)->start);
+}
+
+static mrb_value cf_textview_length(mrb_state *mrb, mrb_value self) {
+	return mrb_fixnum_value(check_text_view(mrb, self)->length);
+}
+
+static mrb_value cf_textview_valid(mrb_state *mrb, mrb_value self) {
+	TextView *tv = check_text_view(mrb, self);
+	return mrb_bool_value(tv->lengthDocument == host->Send(tv->pane, SCI_GETLENGTH, 0, 0));
+}
+
+static mrb_value cf_textview_getbyte(mrb_state *mrb, mrb_value self) {
+	TextView *tv = check_text_view(mrb, self);
+	mrb_int pos;
+	mrb_get_args(mrb, "i", &pos);
+	if (pos < 0)
+		pos += tv->length;
+	if (pos < 0 || pos >= tv->length)
+		return mrb_nil_value();
+	return mrb_fixnum_value(static_cast<unsigned char>(text_view_pointer(mrb, tv)[pos]));
+}
+
+static mrb_value cf_textview_byteslice(mrb_state *mrb, mrb_value self) {
+	TextView *tv = check_text_view(mrb, self);
+	mrb_int pos, len = 1;
+	mrb_get_args(mrb, "i|i", &pos, &len);
+	if (pos < 0)
+		pos += tv->length;
+	if (pos < 0 || pos > tv->length || len < 0)
+		return mrb_nil_value();
+	if (pos + len > tv->length)
+		len = tv->length - pos;
+	return mrb_str_new(mrb, text_view_pointer(mrb, tv) + pos, len);
+}
+
+static mrb_value cf_textview_index(mrb_state *mrb, mrb_value self) {
+	TextView *tv = check_text_view(mrb, self);
+	char *sub;
+	mrb_int lenSub, pos = 0;
+	mrb_get_args(mrb, "s|i", &sub, &lenSub, &pos);
+	if (pos < 0)
+		pos += tv->length;
+	if (pos < 0 || pos + lenSub > tv->length)
+		return mrb_nil_value();
+	const char *text = text_view_pointer(mrb, tv);
+	if (lenSub == 0)
+		return mrb_fixnum_value(pos);
+	const char *end = text + tv->length - lenSub + 1;
+	for (const char *p = text + pos; p < end; p++) {
+		p = static_cast<const char *>(memchr(p, sub[0], end - p));
+		if (!p)
+			break;
+		if (memcmp(p, sub, lenSub) == 0)
+			return mrb_fixnum_value(p - text);
+	}
+	return mrb_nil_value();
+}
+
+static mrb_value cf_textview_each_line(mrb_state *mrb, mrb_value self) {
+	// Yields each line with its line end and the offset of the line in the view.
+	TextView *tv = check_text_view(mrb, self);
+	mrb_value blk;
+	mrb_get_args(mrb, "&", &blk);
+	int pos = 0;
+	while (pos < tv->length) {
+		// The block may modify the document so the text is looked up for each line
+		const char *text = text_view_pointer(mrb, tv);
+		int end = pos;
+		while (end < tv->length && text[end] != '\n' && text[end] != '\r')
+			end++;
+		if (end < tv->length) {
+			if (text[end] == '\r' && end + 1 < tv->length && text[end + 1] == '\n')
+				end++;
+			end++;
+		}
+		int ai = mrb_gc_arena_save(mrb);
+		mrb_value argv[2] = { mrb_str_new(mrb, text + pos, end - pos), mrb_fixnum_value(pos) };
+		mrb_yield_argv(mrb, blk, 2, argv);
+		mrb_gc_arena_restore(mrb, ai);
+		pos = end;
+	}
+	return self;
+}
+
+static mrb_value cf_textview_to_s(mrb_state *mrb, mrb_value self) {
+	TextView *tv = check_text_view(mrb, self);
+	return mrb_str_new(mrb, text_view_pointer(mrb, tv), tv->length);
+}
+
 // Pane match generator.  This was prototyped in about 30 lines of Lua.
 // I hope the C++ version is more robust at least, e.g. prevents infinite
 // loops and is more tamper-resistant.
@@ -428,14 +741,7 @@ static mrb_value cf_match_metatable_index(mrb_state *mrb, mrb_value self) {
 		// If the document is changed while in the match loop, this will be broken.
 		// Exception: if the changes are made exclusively through match:replace,
 		// everything will be fine.
-		char *range = host->Range(pmo->pane, pmo->startPos, pmo->endPos);
-		if (range) {
-			mrb_value ret = mrb_str_new_cstr(mrb, range);
-			delete[]range;
-			return ret;
-		} else {
-			return mrb_nil_value();
-		}
+		return range_string(mrb, pmo->pane, pmo->startPos, pmo->endPos);
 	} else if (mid == mrb_intern_lit(mrb, "replace")) {
 		return cf_match_replace(mrb, pmo, replaceText, len);
 	}
@@ -755,23 +1061,28 @@ static bool CallNamedFunction(const char *name, int numberArg, int numberArg2) {
 	return handled;
 }
 
-static mrb_value iface_function_helper(mrb_state *mrb, ExtensionAPI::Pane p, const IFaceFunction &func, mrb_int argc, mrb_value *argv) {
+/**
+ * Converts the script arguments of a call to func into message parameters, raising when
+ * an argument does not convert. Strings made by the conversion are pushed onto keep when
+ * it is an array so they outlive the GC arena of the caller.
+ */
+static IFaceCall iface_function_arguments(mrb_state *mrb, const IFaceFunction &func, mrb_int argc, mrb_value *argv, mrb_value keep) {
 	int arg = 0;
 
-	sptr_t params[2] = { 0, 0 };
-
-	char *stringResult = 0;
-	bool needStringResult = false;
+	IFaceCall call = { { 0, 0 }, false };
+	sptr_t *params = call.params;
 
 	int loopParamCount = 2;
 
 	if (func.paramType[0] == iface_length && func.paramType[1] == iface_string) {
 		mrb_value str = (arg < argc) ? mrb_str_to_str(mrb, argv[arg]) : mrb_str_new_cstr(mrb, "");
+		if (mrb_array_p(keep))
+			mrb_ary_push(mrb, keep, str);
 		params[0] = RSTRING_LEN(str);
 		params[1] = reinterpret_cast<sptr_t>(params[0] ? RSTRING_PTR(str) : "");
 		loopParamCount = 0;
 	} else if ((func.paramType[1] == iface_stringresult) || (func.returnType == iface_stringresult)) {
-		needStringResult = true;
+		call.needStringResult = true;
 		// The buffer will be allocated later, so it won't leak if Lua does
 		// a longjmp in response to a bad arg.
 		if (func.paramType[0] == iface_length) {
@@ -783,7 +1094,13 @@ static mrb_value iface_function_helper(mrb_state *mrb, ExtensionAPI::Pane p, con
 
 	for (int i=0; i<loopParamCount; ++i) {
 		if (func.paramType[i] == iface_string) {
-			const char *s = (arg < argc) ? obj_to_cstr(mrb, argv[arg++]) : NULL;
+			const char *s = NULL;
+			if (arg < argc) {
+				mrb_value str = mrb_str_to_str(mrb, argv[arg++]);
+				s = mrb_string_value_cstr(mrb, &str);
+				if (mrb_array_p(keep))
+					mrb_ary_push(mrb, keep, str);
+			}
 			params[i] = reinterpret_cast<sptr_t>(s ? s : "");
 		} else if (func.paramType[i] == iface_keymod) {
 			int keycode = (arg < argc) ? (static_cast<int>(mrb_fixnum(mrb_to_int(mrb, argv[arg++])) & 0xFFFF)) : 0;
@@ -797,14 +1114,30 @@ static mrb_value iface_function_helper(mrb_state *mrb, ExtensionAPI::Pane p, con
 			params[i] = params[i - 1];
 		}
 	}
+	return call;
+}
+
+static mrb_value iface_result_value(const IFaceFunction &func, sptr_t result) {
+	if (func.returnType == iface_bool) {
+		return mrb_bool_value(!!result);
+	} else if (IFaceTypeIsNumeric(func.returnType)) {
+		return mrb_fixnum_value(result);
+	}
+	return mrb_nil_value();
+}
+
+static mrb_value iface_function_send(mrb_state *mrb, ExtensionAPI::Pane p, const IFaceFunction &func, IFaceCall call) {
+	sptr_t *params = call.params;
+	mrb_value stringResult = mrb_nil_value();
 	sptr_t stringResultLen = 0;
-	if (needStringResult) {
+	if (call.needStringResult) {
 		stringResultLen = host->Send(p, func.value, params[0], 0);
 		if (stringResultLen >= 0) {
-			// not all string result methods are guaranteed to add a null terminator
-			stringResult = new char[stringResultLen + 1];
-			stringResult[stringResultLen] = '\0';
-			params[1] = reinterpret_cast<sptr_t>(stringResult);
+			// Scintilla writes straight into the string; mruby keeps room for a terminator
+			// and not all string result methods are guaranteed to add one
+			stringResult = mrb_str_new(mrb, 0, stringResultLen);
+			RSTRING_PTR(stringResult)[stringResultLen] = '\0';
+			params[1] = reinterpret_cast<sptr_t>(RSTRING_PTR(stringResult));
 		} else {
 			// Is this an error?  Are there any cases where it's not an error,
 			// and where the right thing to do is just return a blank string?
@@ -822,21 +1155,17 @@ static mrb_value iface_function_helper(mrb_state *mrb, ExtensionAPI::Pane p, con
 
 	sptr_t result = host->Send(p, func.value, params[0], params[1]);
 
-	if (stringResult) {
-		if (stringResultLen > 0 && stringResult[stringResultLen - 1] == 0)
-			--stringResultLen;
-		mrb_value ret = mrb_str_new(mrb, stringResult, stringResultLen);
-		delete[] stringResult;
-		return ret;
+	if (call.needStringResult) {
+		if (stringResultLen > 0 && RSTRING_PTR(stringResult)[stringResultLen - 1] == 0)
+			mrb_str_resize(mrb, stringResult, stringResultLen - 1);
+		return stringResult;
 	}
 
-	if (func.returnType == iface_bool) {
-		return mrb_bool_value(!!result);
-	} else if (IFaceTypeIsNumeric(func.returnType)) {
-		return mrb_fixnum_value(result);
-	}
+	return iface_result_value(func, result);
+}
 
-	return mrb_nil_value();
+static mrb_value iface_function_helper(mrb_state *mrb, ExtensionAPI::Pane p, const IFaceFunction &func, mrb_int argc, mrb_value *argv) {
+	return iface_function_send(mrb, p, func, iface_function_arguments(mrb, func, argc, argv, mrb_nil_value()));
 }
 
 struct IFacePropertyBinding {
@@ -887,48 +1216,105 @@ static mrb_value cf_ifaceprop_metatable_newindex(mrb_state *mrb, mrb_value self)
 	return iface_function_helper(mrb, ipb->pane, func, argc, argv);
 }
 
-static int push_iface_function(mrb_state *mrb, mrb_value self, const char *name, mrb_int argc, mrb_value *argv, mrb_value *ret) {
-	int i = IFaceTable::FindFunction(camelize(name).c_str());
-	if (i >= 0) {
-		if (IFaceFunctionIsScriptable(IFaceTable::functions[i])) {
-			*ret = iface_function_helper(mrb, check_pane_object(mrb, self), IFaceTable::functions[i], argc, argv);
-			return 1;
+// Pane method names are resolved against IFaceTable only once per symbol.
+// The first call goes through method_missing, which binds the resolved function
+// or property to a real method on SciTE::Pane so later calls dispatch directly.
+
+enum PaneBindingKind {
+	pbFunction,
+	pbPropertyGetter,
+	pbPropertyBool,
+	pbPropertyIndexed,
+	pbPropertySetter
+};
+
+struct PaneBinding {
+	PaneBindingKind kind;
+	int index;
+};
+
+static bool resolve_pane_setter(mrb_state *mrb, const char *name, PaneBinding *binding) {
+	int propidx = IFaceTable::FindProperty(camelize(name).c_str());
+	if (propidx >= 0) {
+		const IFaceProperty &prop = IFaceTable::properties[propidx];
+		if (IFacePropertyIsScriptable(prop)) {
+			if (prop.setter) {
+				if (prop.paramType == iface_void) {
+					binding->kind = pbPropertySetter;
+					binding->index = propidx;
+					return true;
+				} else {
+					raise_error(mrb, "Error - (pane object) cannot assign directly to indexed property");
+				}
+			} else {
+				raise_error(mrb, "Error - (pane object) cannot assign to a read-only property");
+			}
 		}
 	}
-	return -1; // signal to try next pane index handler
+
+	raise_error(mrb, "Error - (pane object) expected the name of a writable property");
+	return false;
 }
 
-static int push_iface_propval(mrb_state *mrb, mrb_value self, const char *name, mrb_int argc, mrb_value *argv, mrb_value *ret) {
-	// this function doesn't raise errors, but returns 0 if the function is not handled.
+static bool resolve_pane_binding(mrb_state *mrb, const char *name, PaneBinding *binding) {
+	const std::string ifaceName = camelize(name);
 
-	int propidx = IFaceTable::FindProperty(camelize(name).c_str());
+	int i = IFaceTable::FindFunction(ifaceName.c_str());
+	if (i >= 0 && IFaceFunctionIsScriptable(IFaceTable::functions[i])) {
+		binding->kind = pbFunction;
+		binding->index = i;
+		return true;
+	}
+
+	int propidx = IFaceTable::FindProperty(ifaceName.c_str());
 	if (propidx >= 0) {
 		const IFaceProperty &prop = IFaceTable::properties[propidx];
 		if (!IFacePropertyIsScriptable(prop)) {
 			raise_error(mrb, "Error: iface property is not scriptable.");
-			return -1;
+			return false;
 		}
 
+		binding->index = propidx;
 		if (prop.paramType == iface_void) {
 			if (prop.getter) {
-				*ret = iface_function_helper(mrb, check_pane_object(mrb, self), prop.GetterFunction(), argc, argv);
-				return 1;
+				binding->kind = pbPropertyGetter;
+				return true;
 			}
 		} else if (prop.paramType == iface_bool) {
-			// The bool getter is untested since there are none in the iface.
-			// However, the following is suggested as a reference protocol.
-			ExtensionAPI::Pane p = check_pane_object(mrb, self);
-
 			if (prop.getter) {
-				if (host->Send(p, prop.getter, 1, 0)) {
-					*ret = mrb_nil_value();
-					return 1;
-				} else {
-					*ret = iface_function_helper(mrb, check_pane_object(mrb, self), prop.GetterFunction(), argc, argv);
-					return 1;
-				}
+				binding->kind = pbPropertyBool;
+				return true;
 			}
 		} else {
+			binding->kind = pbPropertyIndexed;
+			return true;
+		}
+	}
+
+	raise_error(mrb, "Pane function / readable property / indexed writable property name expected");
+	return false;
+}
+
+static mrb_value call_pane_binding(mrb_state *mrb, mrb_value self, const PaneBinding &binding, mrb_int argc, mrb_value *argv) {
+	ExtensionAPI::Pane p = check_pane_object(mrb, self);
+
+	if (binding.kind == pbFunction) {
+		return iface_function_helper(mrb, p, IFaceTable::functions[binding.index], argc, argv);
+	}
+
+	const IFaceProperty &prop = IFaceTable::properties[binding.index];
+	switch (binding.kind) {
+	case pbPropertyGetter:
+		return iface_function_helper(mrb, p, prop.GetterFunction(), argc, argv);
+	case pbPropertyBool:
+		// The bool getter is untested since there are none in the iface.
+		// However, the following is suggested as a reference protocol.
+		if (host->Send(p, prop.getter, 1, 0)) {
+			return mrb_nil_value();
+		} else {
+			return iface_function_helper(mrb, p, prop.GetterFunction(), argc, argv);
+		}
+	case pbPropertyIndexed: {
 			// Indexed property.  These return an object with the following behavior:
 			// if there is a getter, __index calls it
 			// otherwise, __index raises "property 'name' is write-only".
@@ -937,66 +1323,64 @@ static int push_iface_propval(mrb_state *mrb, mrb_value self, const char *name,
 
 			IFacePropertyBinding *ipb = static_cast<IFacePropertyBinding *>(mrb_malloc(mrb, sizeof(IFacePropertyBinding)));
 			if (ipb) {
-				ipb->pane = check_pane_object(mrb, self);
+				ipb->pane = p;
 				ipb->prop = &prop;
 				RClass *ifaceprop_class = mrb_class_get_under(mrb, M_SCITE, "IFacePropertyBinding");
-				*ret = mrb_obj_value(mrb_data_object_alloc(mrb, ifaceprop_class, ipb, &mrb_ipb_type));
-				return 1;
+				return mrb_obj_value(mrb_data_object_alloc(mrb, ifaceprop_class, ipb, &mrb_ipb_type));
 			} else {
 				raise_error(mrb, "Internal error: failed to allocate userdata for indexed property");
-				return -1;
 			}
+			break;
 		}
+	case pbPropertySetter: {
+			mrb_value val = (argc > 0) ? argv[0] : mrb_nil_value();
+			return iface_function_helper(mrb, p, prop.SetterFunction(), 1, &val);
+		}
+	default:
+		break;
 	}
+	return mrb_nil_value();
+}
 
-	return -1; // signal to try next pane index handler
+static mrb_value cf_pane_bound_method(mrb_state *mrb, mrb_value self) {
+	PaneBinding binding;
+	binding.kind = static_cast<PaneBindingKind>(mrb_fixnum(mrb_cfunc_env_get(mrb, 0)));
+	binding.index = static_cast<int>(mrb_fixnum(mrb_cfunc_env_get(mrb, 1)));
+
+	mrb_value *argv;
+	mrb_int argc;
+	mrb_get_args(mrb, "*", &argv, &argc);
+	return call_pane_binding(mrb, self, binding, argc, argv);
+}
+
+static void bind_pane_method(mrb_state *mrb, mrb_sym mid, const PaneBinding &binding) {
+	RClass *pane_class = mrb_class_get_under(mrb, M_SCITE, "Pane");
+	if (mrb_obj_respond_to(mrb, pane_class, mid))
+		return; // method_missing was called explicitly for an already bound name
+	mrb_value env[] = { mrb_fixnum_value(binding.kind), mrb_fixnum_value(binding.index) };
+	struct RProc *proc = mrb_proc_new_cfunc_with_env(mrb, cf_pane_bound_method, 2, env);
+	mrb_define_method_raw(mrb, pane_class, mid, proc);
 }
 
 static mrb_value cf_pane_metatable_index(mrb_state *mrb, mrb_value self) {
-	mrb_value oname;
+	mrb_sym mid;
 	mrb_int argc;
 	mrb_value *argv;
-	mrb_get_args(mrb, "o|*", &oname, &argv, &argc);
-	mrb_value str = mrb_str_to_str(mrb, oname);
-	const char *name = RSTRING_PTR(str);
-	size_t len = RSTRING_LEN(str);
-
-	if (len > 0 && name[len - 1] == '=')
-		return cf_pane_metatable_newindex(mrb, self, std::string(name, len - 1).c_str(), argv[0]);
-
-	// these return the number of values pushed (possibly 0), or -1 if no match
-	mrb_value ret;
-	int results = push_iface_function(mrb, self, name, argc, argv, &ret);
-	if (results < 0)
-		results = push_iface_propval(mrb, self, name, argc, argv, &ret);
-
-	if (results >= 0) {
-		return ret;
-	}
-
-	raise_error(mrb, "Pane function / readable property / indexed writable property name expected");
-	return mrb_nil_value();
-}
+	mrb_get_args(mrb, "n*", &mid, &argv, &argc);
+	mrb_int len;
+	const char *name = mrb_sym2name_len(mrb, mid, &len);
 
-static mrb_value cf_pane_metatable_newindex(mrb_state *mrb, mrb_value self, const char *name, mrb_value val) {
-	int propidx = IFaceTable::FindProperty(camelize(name).c_str());
-	if (propidx >= 0) {
-		const IFaceProperty &prop = IFaceTable::properties[propidx];
-		if (IFacePropertyIsScriptable(prop)) {
-			if (prop.setter) {
-				if (prop.paramType == iface_void) {
-					return iface_function_helper(mrb, check_pane_object(mrb, self), prop.SetterFunction(), 1, &val);
-				} else {
-					raise_error(mrb, "Error - (pane object) cannot assign directly to indexed property");
-				}
-			} else {
-				raise_error(mrb, "Error - (pane object) cannot assign to a read-only property");
-			}
-		}
+	PaneBinding binding;
+	if (len > 0 && name[len - 1] == '=') {
+		if (!resolve_pane_setter(mrb, std::string(name, len - 1).c_str(), &binding))
+			return mrb_nil_value();
+	} else {
+		if (!resolve_pane_binding(mrb, name, &binding))
+			return mrb_nil_value();
 	}
 
-	raise_error(mrb, "Error - (pane object) expected the name of a writable property");
-	return mrb_nil_value();
+	bind_pane_method(mrb, mid, binding);
+	return call_pane_binding(mrb, self, binding, argc, argv);
 }
 
 mrb_value create_pane_object(mrb_state *mrb, ExtensionAPI::Pane p) {
@@ -1016,20 +1400,22 @@ static mrb_value cf_global_metatable_index(mrb_state *mrb, mrb_value self) {
 		return mrb_nil_value();
 	}
 
+	mrb_value value = mrb_nil_value();
 	int i = IFaceTable::FindConstant(name);
 	if (i >= 0) {
-		return mrb_fixnum_value(IFaceTable::constants[i].value);
+		value = mrb_fixnum_value(IFaceTable::constants[i].value);
 	} else {
 		i = IFaceTable::FindFunctionByConstantName(name);
 		if (i >= 0) {
-			return mrb_fixnum_value(IFaceTable::functions[i].value);
-
-			// FindFunctionByConstantName is slow, so cache the result into the
-			// global table.  My tests show this gives an order of magnitude
-			// improvement.
-			/* FIXME: */
+			value = mrb_fixnum_value(IFaceTable::functions[i].value);
 		}
 	}
+	if (!mrb_nil_p(value)) {
+		// Cache the result as a real constant so later references
+		// do not go through const_missing.
+		mrb_define_const(mrb, mrb_class_ptr(self), name, value);
+		return value;
+	}
 
 	if (mrb_class_real(mrb_class_ptr(self)) != mrb->object_class) {
 		mrb_name_error(mrb, sym, "uninitialized constant %S::%S", self, mrb_sym2str(mrb, sym));
@@ -1732,6 +2118,8 @@ static bool InitGlobalScope(bool checkProperties, bool forceReload = false) {
 	RClass *scite = mrb_define_module(mrbState, "SciTE");
 	mrb_define_module_function(mrbState, scite, "send_editor", cf_scite_send_editor, MRB_ARGS_ARG(1, 31));
 	mrb_define_module_function(mrbState, scite, "send_output", cf_scite_send_output, MRB_ARGS_ARG(1, 31));
+	mrb_define_module_function(mrbState, scite, "send_editor_batch", cf_scite_send_editor_batch, MRB_ARGS_ARG(1, 1));
+	mrb_define_module_function(mrbState, scite, "send_output_batch", cf_scite_send_output_batch, MRB_ARGS_ARG(1, 1));
 	mrb_define_module_function(mrbState, scite, "constant_name", cf_scite_constname, MRB_ARGS_REQ(1));
 	mrb_define_module_function(mrbState, scite, "open", cf_scite_open, MRB_ARGS_REQ(1));
 	mrb_define_module_function(mrbState, scite, "menu_command", cf_scite_menu_command, MRB_ARGS_REQ(1));
@@ -1760,6 +2148,8 @@ static bool InitGlobalScope(bool checkProperties, bool forceReload = false) {
 	mrb_define_method(mrbState, pane_class, "remove", cf_pane_remove, MRB_ARGS_REQ(2));
 	mrb_define_method(mrbState, pane_class, "append", cf_pane_append, MRB_ARGS_REQ(1));
 	mrb_define_method(mrbState, pane_class, "match", cf_pane_match, MRB_ARGS_ARG(1, 3));
+	mrb_define_method(mrbState, pane_class, "text_view", cf_pane_text_view, MRB_ARGS_OPT(2));
+	mrb_define_alias(mrbState, pane_class, "textView", "text_view");
 	
 	// editor
 	mrb_value oeditor = create_pane_object(mrbState, ExtensionAPI::paneEditor);
@@ -1782,6 +2172,20 @@ static bool InitGlobalScope(bool checkProperties, bool forceReload = false) {
 	mrb_define_method(mrbState, pane_match_object_class, "each", cf_pane_match_each, MRB_ARGS_BLOCK());
 	mrb_define_method(mrbState, pane_match_object_class, "to_s", cf_match_metatable_tostring, MRB_ARGS_NONE());
 
+	// TextView
+	RClass *textview_class = mrb_define_class_under(mrbState, scite, "TextView", mrbState->object_class);
+	MRB_SET_INSTANCE_TT(textview_class, MRB_TT_DATA);
+	mrb_undef_class_method(mrbState, textview_class, "new");
+	mrb_define_method(mrbState, textview_class, "start", cf_textview_start, MRB_ARGS_NONE());
+	mrb_define_method(mrbState, textview_class, "length", cf_textview_length, MRB_ARGS_NONE());
+	mrb_define_method(mrbState, textview_class, "size", cf_textview_length, MRB_ARGS_NONE());
+	mrb_define_method(mrbState, textview_class, "valid?", cf_textview_valid, MRB_ARGS_NONE());
+	mrb_define_method(mrbState, textview_class, "getbyte", cf_textview_getbyte, MRB_ARGS_REQ(1));
+	mrb_define_method(mrbState, textview_class, "byteslice", cf_textview_byteslice, MRB_ARGS_ARG(1, 1));
+	mrb_define_method(mrbState, textview_class, "index", cf_textview_index, MRB_ARGS_ARG(1, 1));
+	mrb_define_method(mrbState, textview_class, "each_line", cf_textview_each_line, MRB_ARGS_BLOCK());
+	mrb_define_method(mrbState, textview_class, "to_s", cf_textview_to_s, MRB_ARGS_NONE());
+
 	// IFacePropertyBinding
 	RClass *ifaceprop_class = mrb_define_class_under(mrbState, scite, "IFacePropertyBinding", mrbState->object_class);
 	MRB_SET_INSTANCE_TT(ifaceprop_class, MRB_TT_DATA);
@@ -2075,6 +2479,39 @@ struct StylingContext {
 	int lenCurrent;
 	int lenNext;
 
+	// The last pattern compiled by forward_to_regex as script lexers repeat patterns
+	CharClassify *charClass;
+	RESearch *search;
+	std::string searchPattern;
+	bool searchCaseSensitive;
+
+	StylingContext() : charClass(0), search(0), searchCaseSensitive(true) {
+	}
+
+	~StylingContext() {
+		delete search;
+		search = 0;
+		delete charClass;
+		charClass = 0;
+	}
+
+	const char *CompileSearch(const char *pattern, int length, bool caseSensitive) {
+		if (search && (searchCaseSensitive == caseSensitive) &&
+		        (searchPattern.compare(0, std::string::npos, pattern, length) == 0))
+			return 0;
+		if (!search) {
+			charClass = new CharClassify();
+			search = new RESearch(charClass);
+		}
+		searchPattern.clear();
+		const char *errmsg = search->Compile(pattern, length, caseSensitive, false);
+		if (!errmsg) {
+			searchPattern.assign(pattern, length);
+			searchCaseSensitive = caseSensitive;
+		}
+		return errmsg;
+	}
+
 	static StylingContext *Context(mrb_state *mrb, mrb_value self) {
 		return static_cast<StylingContext *>(mrb_data_get_ptr(mrb, self, &mrb_sc_type));
 	}
@@ -2339,6 +2776,132 @@ struct StylingContext {
 		return mrb_bool_value(context->Match(s));
 	}
 
+	// Bulk primitives so that a script lexer does its work per token
+	// rather than crossing into Ruby for every character.
+
+	// A set of bytes given as a string of characters and ranges such as "a-zA-Z0-9_".
+	// Multi-byte characters are classified by their lead byte.
+	struct CharacterClass {
+		bool member[256];
+		explicit CharacterClass(const char *spec) {
+			memset(member, 0, sizeof(member));
+			const unsigned char *p = reinterpret_cast<const unsigned char *>(spec);
+			while (*p) {
+				if (p[1] == '-' && p[2]) {
+					for (int ch = p[0]; ch <= p[2]; ch++)
+						member[ch] = true;
+					p += 3;
+				} else {
+					member[*p++] = true;
+				}
+			}
+		}
+		bool Contains(char ch) const {
+			return member[static_cast<unsigned char>(ch)];
+		}
+	};
+
+	class StylerIndexer : public CharacterIndexer {
+		StyleWriter *styler;
+	public:
+		explicit StylerIndexer(StyleWriter *styler_) : styler(styler_) {}
+		virtual char CharAt(int index) {
+			return styler->SafeGetCharAt(index, '\0');
+		}
+	};
+
+	char CurrentChar() const {
+		return cursor[cursorPos % 3][0];
+	}
+
+	void ForwardTo(unsigned int pos) {
+		while (currentPos < endPos && currentPos < pos)
+			Forward();
+	}
+
+	void ForwardWhile(const CharacterClass &cc, bool inClass) {
+		while (currentPos < endPos && cc.Contains(CurrentChar()) == inClass)
+			Forward();
+	}
+
+	static mrb_value ForwardWhile(mrb_state *mrb, mrb_value self) {
+		StylingContext *context = Context(mrb, self);
+		const char *chars;
+		mrb_get_args(mrb, "z", &chars);
+		context->ForwardWhile(CharacterClass(chars), true);
+		return mrb_fixnum_value(context->currentPos);
+	}
+
+	static mrb_value ForwardUntil(mrb_state *mrb, mrb_value self) {
+		StylingContext *context = Context(mrb, self);
+		const char *chars;
+		mrb_get_args(mrb, "z", &chars);
+		context->ForwardWhile(CharacterClass(chars), false);
+		return mrb_fixnum_value(context->currentPos);
+	}
+
+	static mrb_value ForwardToRegex(mrb_state *mrb, mrb_value self) {
+		StylingContext *context = Context(mrb, self);
+		char *pattern;
+		mrb_int len;
+		mrb_bool caseSensitive = true;
+		mrb_get_args(mrb, "s|b", &pattern, &len, &caseSensitive);
+
+		const char *errmsg = context->CompileSearch(pattern, static_cast<int>(len), !!caseSensitive);
+		if (errmsg) {
+			raise_error(mrb, errmsg);
+			return mrb_nil_value();
+		}
+
+		unsigned int limit = context->endPos < context->endDoc ? context->endPos : context->endDoc;
+		StylerIndexer indexer(context->styler);
+		if (context->currentPos < limit &&
+		        context->search->Execute(indexer, context->currentPos, limit)) {
+			context->ForwardTo(context->search->bopat[0]);
+			return mrb_fixnum_value(context->search->eopat[0] - context->search->bopat[0]);
+		}
+		context->ForwardTo(limit);
+		return mrb_nil_value();
+	}
+
+	static mrb_value ScanWord(mrb_state *mrb, mrb_value self) {
+		StylingContext *context = Context(mrb, self);
+		const char *chars;
+		mrb_value owords = mrb_nil_value();
+		mrb_get_args(mrb, "z|o", &chars, &owords);
+		WordList *keywords = NULL;
+		if (!mrb_nil_p(owords))
+			keywords = static_cast<WordList *>(mrb_data_get_ptr(mrb, owords, &mrb_wl_type));
+
+		unsigned int start = context->currentPos;
+		context->ForwardWhile(CharacterClass(chars), true);
+		std::string word;
+		for (unsigned int pos = start; pos < context->currentPos; pos++)
+			word += context->styler->SafeGetCharAt(pos);
+
+		mrb_value vals[] = {
+			mrb_str_new(mrb, word.c_str(), word.length()),
+			mrb_bool_value(keywords && !word.empty() && keywords->InList(word.c_str()))
+		};
+		return mrb_ary_new_from_values(mrb, 2, vals);
+	}
+
+	static mrb_value ColourRun(mrb_state *mrb, mrb_value self) {
+		// Colour the next length bytes with style then continue in the current state.
+		StylingContext *context = Context(mrb, self);
+		mrb_int length, style;
+		mrb_get_args(mrb, "ii", &length, &style);
+		if (length > 0) {
+			int stateCurrent = context->state;
+			context->Colourize();
+			context->state = static_cast<int>(style);
+			context->ForwardTo(context->currentPos + static_cast<unsigned int>(length));
+			context->Colourize();
+			context->state = stateCurrent;
+		}
+		return mrb_nil_value();
+	}
+
 	static mrb_value StartPos(mrb_state *mrb, mrb_value self) {
 		return mrb_fixnum_value(Context(mrb, self)->startPos);
 	}
@@ -2353,7 +2916,7 @@ struct StylingContext {
 
 	static mrb_value Create(mrb_state* mrb, int startPos, int lengthDoc, int initStyle, StyleWriter *styler) {
 		RClass *styling_context_class = mrb_class_get_under(mrb, M_SCITE, "StylingContext");
-		StylingContext *sc = static_cast<StylingContext *>(mrb_malloc(mrb, sizeof(StylingContext)));
+		StylingContext *sc = new (mrb_malloc(mrb, sizeof(StylingContext))) StylingContext();
 		sc->startPos = startPos;
 		sc->lengthDoc = lengthDoc;
 		sc->initStyle = initStyle;
@@ -2365,6 +2928,195 @@ struct StylingContext {
 
 };
 
+static void sc_free(mrb_state *mrb, void *ptr) {
+	if (ptr) {
+		StylingContext *sc = static_cast<StylingContext *>(ptr);
+		sc->~StylingContext();
+		mrb_free(mrb, ptr);
+	}
+}
+
+static void wordlist_free(mrb_state *mrb, void *ptr) {
+	if (ptr) {
+		WordList *wl = static_cast<WordList *>(ptr);
+		wl->~WordList();
+		mrb_free(mrb, ptr);
+	}
+}
+
+static mrb_value cf_wordlist_initialize(mrb_state *mrb, mrb_value self) {
+	const char *words = "";
+	mrb_get_args(mrb, "|z", &words);
+	WordList *wl = static_cast<WordList *>(DATA_PTR(self));
+	if (wl)
+		wordlist_free(mrb, wl);
+	mrb_data_init(self, NULL, &mrb_wl_type);
+	wl = new (mrb_malloc(mrb, sizeof(WordList))) WordList();
+	wl->Set(words);
+	mrb_data_init(self, wl, &mrb_wl_type);
+	return self;
+}
+
+static mrb_value cf_wordlist_set(mrb_state *mrb, mrb_value self) {
+	const char *words;
+	mrb_get_args(mrb, "z", &words);
+	static_cast<WordList *>(mrb_data_get_ptr(mrb, self, &mrb_wl_type))->Set(words);
+	return self;
+}
+
+static mrb_value cf_wordlist_include(mrb_state *mrb, mrb_value self) {
+	const char *word;
+	mrb_get_args(mrb, "z", &word);
+	return mrb_bool_value(static_cast<WordList *>(mrb_data_get_ptr(mrb, self, &mrb_wl_type))->InList(word));
+}
+
+static mrb_value cf_wordlist_length(mrb_state *mrb, mrb_value self) {
+	return mrb_fixnum_value(static_cast<WordList *>(mrb_data_get_ptr(mrb, self, &mrb_wl_type))->Length());
+}
+
+static void tablelexer_free(mrb_state *mrb, void *ptr) {
+	if (ptr) {
+		TableLexer *lexer = static_cast<TableLexer *>(ptr);
+		lexer->~TableLexer();
+		mrb_free(mrb, ptr);
+	}
+}
+
+static TableLexer *check_table_lexer(mrb_state *mrb, mrb_value self) {
+	return static_cast<TableLexer *>(mrb_data_get_ptr(mrb, self, &mrb_tl_type));
+}
+
+static mrb_value cf_tablelexer_initialize(mrb_state *mrb, mrb_value self) {
+	TableLexer *lexer = static_cast<TableLexer *>(DATA_PTR(self));
+	if (lexer)
+		tablelexer_free(mrb, lexer);
+	mrb_data_init(self, NULL, &mrb_tl_type);
+	lexer = new (mrb_malloc(mrb, sizeof(TableLexer))) TableLexer();
+	mrb_data_init(self, lexer, &mrb_tl_type);
+	mrb_iv_set(mrb, self, mrb_intern_lit(mrb, "token_handlers"), mrb_hash_new(mrb));
+	return self;
+}
+
+static mrb_value tablelexer_add_rule(mrb_state *mrb, mrb_value self, TableLexer::Action action) {
+	mrb_int state, style;
+	mrb_sym kind;
+	char *pattern;
+	mrb_int len;
+	mrb_bool caseSensitive = true;
+	mrb_get_args(mrb, "insi|b", &state, &kind, &pattern, &len, &style, &caseSensitive);
+
+	TableLexer::MatchKind matchKind;
+	if (kind == mrb_intern_lit(mrb, "literal")) {
+		matchKind = TableLexer::matchLiteral;
+	} else if (kind == mrb_intern_lit(mrb, "chars")) {
+		matchKind = TableLexer::matchCharacters;
+	} else if (kind == mrb_intern_lit(mrb, "regex")) {
+		matchKind = TableLexer::matchRegex;
+	} else {
+		raise_error(mrb, "Match kind must be :literal, :chars or :regex");
+		return mrb_nil_value();
+	}
+	const char *errmsg = check_table_lexer(mrb, self)->AddRule(static_cast<int>(state), action, matchKind,
+		pattern, static_cast<int>(len), static_cast<int>(style), !!caseSensitive);
+	if (errmsg)
+		raise_error(mrb, errmsg);
+	return self;
+}
+
+static mrb_value cf_tablelexer_token(mrb_state *mrb, mrb_value self) {
+	return tablelexer_add_rule(mrb, self, TableLexer::actionToken);
+}
+
+static mrb_value cf_tablelexer_enter(mrb_state *mrb, mrb_value self) {
+	return tablelexer_add_rule(mrb, self, TableLexer::actionEnter);
+}
+
+static mrb_value cf_tablelexer_exit(mrb_state *mrb, mrb_value self) {
+	return tablelexer_add_rule(mrb, self, TableLexer::actionExit);
+}
+
+static mrb_value cf_tablelexer_line_end(mrb_state *mrb, mrb_value self) {
+	mrb_int state, stateNext;
+	mrb_get_args(mrb, "ii", &state, &stateNext);
+	check_table_lexer(mrb, self)->SetLineEndState(static_cast<int>(state), static_cast<int>(stateNext));
+	return self;
+}
+
+static mrb_value cf_tablelexer_keywords(mrb_state *mrb, mrb_value self) {
+	mrb_int style, styleKeyword;
+	const char *words;
+	mrb_get_args(mrb, "izi", &style, &words, &styleKeyword);
+	check_table_lexer(mrb, self)->AddKeywords(static_cast<int>(style), words, static_cast<int>(styleKeyword));
+	return self;
+}
+
+static mrb_value cf_tablelexer_fold(mrb_state *mrb, mrb_value self) {
+	mrb_int style, delta;
+	const char *text;
+	mrb_get_args(mrb, "izi", &style, &text, &delta);
+	check_table_lexer(mrb, self)->AddFoldPoint(static_cast<int>(style), text, static_cast<int>(delta));
+	return self;
+}
+
+static mrb_value cf_tablelexer_on_token(mrb_state *mrb, mrb_value self) {
+	mrb_int style;
+	mrb_value blk = mrb_nil_value();
+	mrb_get_args(mrb, "i&", &style, &blk);
+	mrb_value handlers = mrb_iv_get(mrb, self, mrb_intern_lit(mrb, "token_handlers"));
+	mrb_hash_set(mrb, handlers, mrb_fixnum_value(style), blk);
+	check_table_lexer(mrb, self)->SetTokenHandler(static_cast<int>(style), !mrb_nil_p(blk));
+	return self;
+}
+
+// Calls the blocks given to SciTE::TableLexer#on_token while a table lexer runs.
+class TableLexerTokenHandler : public TableLexer::TokenHandler {
+	mrb_state *mrb;
+	mrb_value handlers;
+public:
+	TableLexerTokenHandler(mrb_state *mrb_, mrb_value self) : mrb(mrb_) {
+		handlers = mrb_iv_get(mrb, self, mrb_intern_lit(mrb, "token_handlers"));
+	}
+	virtual int OnToken(int style, const std::string &text) {
+		mrb_value blk = mrb_hash_get(mrb, handlers, mrb_fixnum_value(style));
+		if (mrb_nil_p(blk))
+			return -1;
+		int ai = mrb_gc_arena_save(mrb);
+		mrb_value argv[2] = { mrb_str_new(mrb, text.c_str(), text.length()), mrb_fixnum_value(style) };
+		mrb_value ret = mrb_yield_argv(mrb, blk, 2, argv);
+		int styleToken = -1;
+		if (mrb->exc) {
+			backtrace(mrb, ">mruby: an error occured in SciTE::TableLexer token handler\n");
+			mrb->exc = NULL;
+		} else if (mrb_fixnum_p(ret)) {
+			styleToken = static_cast<int>(mrb_fixnum(ret));
+		}
+		mrb_gc_arena_restore(mrb, ai);
+		return styleToken;
+	}
+};
+
+static mrb_value cf_scite_register_lexer(mrb_state *mrb, mrb_value /*self*/) {
+	// A lexer registered for a language replaces on_style for buffers using that
+	// language through a lexer.*.ext=script_xxx property. nil removes it.
+	mrb_value language, lexer;
+	mrb_get_args(mrb, "So", &language, &lexer);
+	if (!mrb_nil_p(lexer))
+		check_table_lexer(mrb, lexer);
+	mrb_value lexers = mrb_iv_get(mrb, mrb_obj_value(M_SCITE), mrb_intern_lit(mrb, "table_lexers"));
+	if (mrb_nil_p(lexer))
+		mrb_hash_delete_key(mrb, lexers, language);
+	else
+		mrb_hash_set(mrb, lexers, language, lexer);
+	return mrb_nil_value();
+}
+
+static mrb_value find_table_lexer(mrb_state *mrb, const std::string &language) {
+	if (language.empty())
+		return mrb_nil_value();
+	mrb_value lexers = mrb_iv_get(mrb, mrb_obj_value(M_SCITE), mrb_intern_lit(mrb, "table_lexers"));
+	return mrb_hash_get(mrb, lexers, mrb_str_new(mrb, language.c_str(), language.length()));
+}
+
 static void stylingcontext_init(mrb_state *mrb) {
 	RClass *sc_class = mrb_define_class_under(mrb, M_SCITE, "StylingContext", mrb->object_class);
 	MRB_SET_INSTANCE_TT(sc_class, MRB_TT_DATA);
@@ -2393,14 +3145,54 @@ static void stylingcontext_init(mrb_state *mrb) {
 	mrb_define_method(mrb, sc_class, "token", StylingContext::Token, MRB_ARGS_NONE());
 	mrb_define_method(mrb, sc_class, "match", StylingContext::Match, MRB_ARGS_REQ(1));
 
+	mrb_define_method(mrb, sc_class, "forward_while", StylingContext::ForwardWhile, MRB_ARGS_REQ(1));
+	mrb_define_method(mrb, sc_class, "forward_until", StylingContext::ForwardUntil, MRB_ARGS_REQ(1));
+	mrb_define_method(mrb, sc_class, "forward_to_regex", StylingContext::ForwardToRegex, MRB_ARGS_ARG(1, 1));
+	mrb_define_method(mrb, sc_class, "scan_word", StylingContext::ScanWord, MRB_ARGS_ARG(1, 1));
+	mrb_define_method(mrb, sc_class, "colour_run", StylingContext::ColourRun, MRB_ARGS_REQ(2));
+	mrb_define_alias(mrb, sc_class, "forwardWhile", "forward_while");
+	mrb_define_alias(mrb, sc_class, "forwardUntil", "forward_until");
+	mrb_define_alias(mrb, sc_class, "forwardToRegex", "forward_to_regex");
+	mrb_define_alias(mrb, sc_class, "scanWord", "scan_word");
+	mrb_define_alias(mrb, sc_class, "colourRun", "colour_run");
+
 	mrb_define_method(mrb, sc_class, "start_pos", StylingContext::StartPos, MRB_ARGS_NONE());
 	mrb_define_method(mrb, sc_class, "length_doc", StylingContext::LengthDoc, MRB_ARGS_NONE());
 	mrb_define_method(mrb, sc_class, "init_style", StylingContext::InitStyle, MRB_ARGS_NONE());
+
+	RClass *wl_class = mrb_define_class_under(mrb, M_SCITE, "WordList", mrb->object_class);
+	MRB_SET_INSTANCE_TT(wl_class, MRB_TT_DATA);
+	mrb_define_method(mrb, wl_class, "initialize", cf_wordlist_initialize, MRB_ARGS_OPT(1));
+	mrb_define_method(mrb, wl_class, "set", cf_wordlist_set, MRB_ARGS_REQ(1));
+	mrb_define_method(mrb, wl_class, "include?", cf_wordlist_include, MRB_ARGS_REQ(1));
+	mrb_define_method(mrb, wl_class, "length", cf_wordlist_length, MRB_ARGS_NONE());
+
+	RClass *tl_class = mrb_define_class_under(mrb, M_SCITE, "TableLexer", mrb->object_class);
+	MRB_SET_INSTANCE_TT(tl_class, MRB_TT_DATA);
+	mrb_define_method(mrb, tl_class, "initialize", cf_tablelexer_initialize, MRB_ARGS_NONE());
+	mrb_define_method(mrb, tl_class, "token", cf_tablelexer_token, MRB_ARGS_ARG(4, 1));
+	mrb_define_method(mrb, tl_class, "enter", cf_tablelexer_enter, MRB_ARGS_ARG(4, 1));
+	mrb_define_method(mrb, tl_class, "exit", cf_tablelexer_exit, MRB_ARGS_ARG(4, 1));
+	mrb_define_method(mrb, tl_class, "line_end", cf_tablelexer_line_end, MRB_ARGS_REQ(2));
+	mrb_define_method(mrb, tl_class, "keywords", cf_tablelexer_keywords, MRB_ARGS_REQ(3));
+	mrb_define_method(mrb, tl_class, "fold", cf_tablelexer_fold, MRB_ARGS_REQ(3));
+	mrb_define_method(mrb, tl_class, "on_token", cf_tablelexer_on_token, MRB_ARGS_REQ(1) | MRB_ARGS_BLOCK());
+	mrb_define_alias(mrb, tl_class, "lineEnd", "line_end");
+	mrb_define_alias(mrb, tl_class, "onToken", "on_token");
+
+	mrb_iv_set(mrb, mrb_obj_value(M_SCITE), mrb_intern_lit(mrb, "table_lexers"), mrb_hash_new(mrb));
+	mrb_define_module_function(mrb, M_SCITE, "register_lexer", cf_scite_register_lexer, MRB_ARGS_REQ(2));
 }
 
 bool mrubyExtension::OnStyle(unsigned int startPos, int lengthDoc, int initStyle, StyleWriter *styler) {
 	bool handled = false;
 	if (mrbState) {
+		mrb_value lexer = find_table_lexer(mrbState, host->Property("Language"));
+		if (!mrb_nil_p(lexer)) {
+			TableLexerTokenHandler handler(mrbState, lexer);
+			check_table_lexer(mrbState, lexer)->Lex(*styler, startPos, lengthDoc, &handler);
+			return true;
+		}
 		mrb_sym mid = mrb_intern_lit(mrbState, "on_style");
 		if (mrb_respond_to(mrbState, mrb_obj_value(mrbState->top_self), mid)) {
 			mrb_value argv[] = { StylingContext::Create(mrbState, startPos, lengthDoc, initStyle, styler) };
@@ -0,0 +1,109 @@
+// Unit Tests for SciTE classes
+/** @file FakeDocument.h
+ ** A document answering the messages SciTE classes send to Scintilla.
+ **/
+
+#ifndef FAKEDOCUMENT_H
+#define FAKEDOCUMENT_H
+
+/**
+ * Holds text, styles and fold levels and answers the messages sent through a
+ * GUI::ScintillaWindow whose ID is set to the FakeDocument.
+ * Lines end with "\r\n", "\r" or "\n" as in Scintilla.
+ */
+struct FakeDocument {
+	std::string text;
+	std::string styles;
+	std::vector<int> lineStarts;
+	std::vector<int> levels;
+	int largestRange;
+	explicit FakeDocument(const std::string &text_) : text(text_), styles(text_.length(), 0), largestRange(0) {
+		FindLines();
+	}
+	void FindLines() {
+		lineStarts.clear();
+		lineStarts.push_back(0);
+		for (size_t i = 0; i < text.length(); i++) {
+			if ((text[i] == '\n') || ((text[i] == '\r') && ((i + 1 == text.length()) || (text[i + 1] != '\n'))))
+				lineStarts.push_back(static_cast<int>(i + 1));
+		}
+		levels.resize(lineStarts.size(), SC_FOLDLEVELBASE);
+	}
+	int Length() const {
+		return static_cast<int>(text.length());
+	}
+	int Lines() const {
+		return static_cast<int>(lineStarts.size());
+	}
+	void SetStyle(int start, int length, char style) {
+		std::fill(styles.begin() + start, styles.begin() + start + length, style);
+	}
+	void Insert(int position, const std::string &s) {
+		text.insert(position, s);
+		styles.insert(position, s.length(), 0);
+		FindLines();
+	}
+	void Delete(int position, int length) {
+		text.erase(position, length);
+		styles.erase(position, length);
+		FindLines();
+	}
+	int LineStart(int line) const {
+		return (line < Lines()) ? lineStarts[line] : Length();
+	}
+	int LineFromPosition(int position) const {
+		return static_cast<int>(std::upper_bound(lineStarts.begin(), lineStarts.end(), position) - lineStarts.begin()) - 1;
+	}
+	int LineEnd(int line) const {
+		int position = LineStart(line + 1);
+		if ((position > LineStart(line)) && (text[position - 1] == '\n'))
+			position--;
+		if ((position > LineStart(line)) && (text[position - 1] == '\r'))
+			position--;
+		return position;
+	}
+	static sptr_t DirectFunction(sptr_t ptr, unsigned int iMessage, uptr_t wParam, sptr_t lParam) {
+		FakeDocument *pdoc = reinterpret_cast<FakeDocument *>(ptr);
+		switch (iMessage) {
+		case SCI_GETDOCPOINTER:
+			return ptr;
+		case SCI_GETLENGTH:
+		case SCI_GETTEXTLENGTH:
+			return pdoc->Length();
+		case SCI_GETSTYLEDTEXT: {
+				Sci_TextRange *tr = reinterpret_cast<Sci_TextRange *>(lParam);
+				const int start = static_cast<int>(tr->chrg.cpMin);
+				const int end = static_cast<int>(tr->chrg.cpMax);
+				pdoc->largestRange = std::max(pdoc->largestRange, end - start);
+				for (int i = start; i < end; i++) {
+					tr->lpstrText[(i - start) * 2] = pdoc->text[i];
+					tr->lpstrText[(i - start) * 2 + 1] = pdoc->styles[i];
+				}
+				tr->lpstrText[(end - start) * 2] = 0;
+				tr->lpstrText[(end - start) * 2 + 1] = 0;
+				return (end - start) * 2;
+			}
+		case SCI_GETTEXTRANGE: {
+				Sci_TextRange *tr = reinterpret_cast<Sci_TextRange *>(lParam);
+				const int start = static_cast<int>(tr->chrg.cpMin);
+				const int end = static_cast<int>(tr->chrg.cpMax);
+				pdoc->text.copy(tr->lpstrText, end - start, start);
+				tr->lpstrText[end - start] = 0;
+				return end - start;
+			}
+		case SCI_GETLINECOUNT:
+			return pdoc->Lines();
+		case SCI_POSITIONFROMLINE:
+			return pdoc->LineStart(static_cast<int>(wParam));
+		case SCI_GETLINEENDPOSITION:
+			return pdoc->LineEnd(static_cast<int>(wParam));
+		case SCI_LINEFROMPOSITION:
+			return pdoc->LineFromPosition(static_cast<int>(wParam));
+		case SCI_GETFOLDLEVEL:
+			return pdoc->levels[wParam];
+		}
+		return 0;
+	}
+};
+
+#endif
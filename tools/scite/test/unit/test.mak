@@ -0,0 +1,33 @@
+# Build the SciTE unit tests with Microsoft Visual C++ using nmake
+
+DEL = del /q
+EXE = unitTest.exe
+
+INCLUDEDIRS = /I../../src /I../../../scintilla/include /I../../../scintilla/test/unit
+
+CXXFLAGS = /EHsc /wd 4805 $(INCLUDEDIRS)
+
+# Files in this directory containing tests
+TESTSRC=test*.cxx
+# Files being tested from scite/src
+TESTEDSRC=\
+ ../../src/APIRepository.cxx \
+ ../../src/FilePath.cxx \
+ ../../src/PropSetFile.cxx \
+ ../../src/StringHelpers.cxx \
+ ../../src/StringList.cxx \
+ ../../src/StyleWriter.cxx \
+ ../../src/WordIndex.cxx
+
+TESTS=$(EXE)
+
+all: $(TESTS)
+
+test: $(TESTS)
+	$(EXE)
+
+clean:
+	$(DEL) $(TESTS) *.o *.obj *.exe
+
+$(EXE): $(TESTSRC) $(TESTEDSRC) $(@B).obj
+	$(CXX) $(CXXFLAGS) /Fe$@ $**
@@ -0,0 +1,165 @@
+// Unit Tests for SciTE classes
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <sys/types.h>
+#ifdef _WIN32
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
+
+#include <string>
+#include <vector>
+#include <map>
+
+#include "Scintilla.h"
+#include "GUI.h"
+#include "SString.h"
+#include "StringList.h"
+#include "FilePath.h"
+#include "Mutex.h"
+#include "Worker.h"
+#include "APIRepository.h"
+
+#include "catch.hpp"
+
+// Test APIRepository.
+
+// The number of sets kept by APIRepository
+static const int setsKept = 8;
+
+static void WriteAPIFile(const std::string &name, const std::string &text, time_t modified) {
+	FILE *fp = fopen(name.c_str(), "wb");
+	REQUIRE(fp);
+	fwrite(text.c_str(), 1, text.length(), fp);
+	fclose(fp);
+	struct utimbuf times;
+	times.actime = modified;
+	times.modtime = modified;
+	utime(name.c_str(), &times);
+}
+
+static std::string APIName(int i) {
+	char name[40];
+	sprintf(name, "unitTestAPI%d.api", i);
+	return name;
+}
+
+// Read the files on this thread as SciTE does when it has no background threads.
+static void LoadSet(APIRepository &repository, const std::string &fileNames) {
+	APILoader *loader = repository.Load(0, fileNames);
+	REQUIRE(repository.Loading(fileNames));
+	loader->Execute();
+	repository.Loaded(loader);
+	REQUIRE(!repository.Loading(fileNames));
+}
+
+static std::string FirstWord(StringList *list) {
+	return list ? list->GetNearestWord("", 0) : "<none>";
+}
+
+TEST_CASE("APIRepository") {
+
+	const time_t modified = 1000000000;
+	for (int i = 0; i <= setsKept; i++) {
+		WriteAPIFile(APIName(i), "fn" + std::string(1, static_cast<char>('a' + i)) + "(x)\n", modified);
+	}
+	APIRepository repository;
+	StringList *list = 0;
+
+	SECTION("FindLoaded") {
+		const std::string names = APIName(0) + ";" + APIName(1);
+		REQUIRE(!repository.Find(names, list));
+		REQUIRE(!list);
+		LoadSet(repository, names);
+		REQUIRE(repository.Find(names, list));
+		REQUIRE(list);
+		REQUIRE(FirstWord(list) == "fna(x)");
+		REQUIRE(std::string(list->GetNearestWord("fnb", 3)) == "fnb(x)");
+	}
+
+	SECTION("NotFoundWhileLoading") {
+		APILoader *loader = repository.Load(0, APIName(0));
+		REQUIRE(!repository.Find(APIName(0), list));
+		loader->Execute();
+		repository.Loaded(loader);
+		REQUIRE(repository.Find(APIName(0), list));
+	}
+
+	SECTION("NoEntries") {
+		WriteAPIFile(APIName(0), "", modified);
+		LoadSet(repository, APIName(0));
+		REQUIRE(repository.Find(APIName(0), list));
+		REQUIRE(!list);
+	}
+
+	SECTION("ReloadAfterSizeChange") {
+		LoadSet(repository, APIName(0));
+		WriteAPIFile(APIName(0), "changed(x)\n", modified);
+		REQUIRE(!repository.Find(APIName(0), list));
+		REQUIRE(!repository.Find(APIName(0), list));
+		LoadSet(repository, APIName(0));
+		REQUIRE(repository.Find(APIName(0), list));
+		REQUIRE(FirstWord(list) == "changed(x)");
+	}
+
+	SECTION("ReloadAfterTimeChange") {
+		LoadSet(repository, APIName(0));
+		// Same size so only the time shows the change
+		WriteAPIFile(APIName(0), "fnz(x)\n", modified + 10);
+		REQUIRE(!repository.Find(APIName(0), list));
+		LoadSet(repository, APIName(0));
+		REQUIRE(repository.Find(APIName(0), list));
+		REQUIRE(FirstWord(list) == "fnz(x)");
+	}
+
+	SECTION("ReloadAfterCreated") {
+		const std::string missing = "unitTestAPIMissing.api";
+		remove(missing.c_str());
+		LoadSet(repository, missing);
+		REQUIRE(repository.Find(missing, list));
+		REQUIRE(!list);
+		WriteAPIFile(missing, "created(x)\n", modified);
+		REQUIRE(!repository.Find(missing, list));
+		LoadSet(repository, missing);
+		REQUIRE(repository.Find(missing, list));
+		REQUIRE(FirstWord(list) == "created(x)");
+		remove(missing.c_str());
+	}
+
+	SECTION("EvictLeastRecentlyUsed") {
+		for (int i = 0; i < setsKept; i++) {
+			LoadSet(repository, APIName(i));
+		}
+		// Using set 0 leaves set 1 as the least recently used
+		REQUIRE(repository.Find(APIName(0), list));
+		LoadSet(repository, APIName(setsKept));
+		REQUIRE(!repository.Find(APIName(1), list));
+		for (int i = 0; i <= setsKept; i++) {
+			if (i != 1) {
+				REQUIRE(repository.Find(APIName(i), list));
+				REQUIRE(FirstWord(list) == "fn" + std::string(1, static_cast<char>('a' + i)) + "(x)");
+			}
+		}
+	}
+
+	SECTION("LoadingNotEvicted") {
+		APILoader *loader = repository.Load(0, APIName(setsKept));
+		for (int i = 0; i < setsKept; i++) {
+			LoadSet(repository, APIName(i));
+		}
+		REQUIRE(repository.Loading(APIName(setsKept)));
+		loader->Execute();
+		repository.Loaded(loader);
+		// Set 0 is now the least recently used of the loaded sets
+		REQUIRE(repository.Find(APIName(setsKept), list));
+		REQUIRE(!repository.Find(APIName(0), list));
+		REQUIRE(repository.Find(APIName(1), list));
+	}
+
+	for (int i = 0; i <= setsKept; i++) {
+		remove(APIName(i).c_str());
+	}
+}
@@ -0,0 +1,296 @@
+// Unit Tests for SciTE classes
+
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <time.h>
+#include <sys/types.h>
+#ifdef _WIN32
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
+
+#include <string>
+#include <vector>
+#include <set>
+#include <map>
+#include <algorithm>
+
+#include "Scintilla.h"
+#include "GUI.h"
+#include "SString.h"
+#include "FilePath.h"
+#include "PropSetFile.h"
+
+#include "catch.hpp"
+
+// Test PropertiesCache and PropSetFile::ReadCached.
+
+// Files are written in the current directory. Names containing "SciTE" are not imported by "import *".
+static const char cacheName[] = "SciTEUnitTest.cache";
+static const char mainName[] = "SciTEUnitTest.properties";
+static const char importedName[] = "unitTestImported.properties";
+static const char addedName[] = "unitTestAdded.properties";
+
+// Write a file then set its modification time so changes of size and time are decided by the test.
+static void WriteFile(const char *name, const std::string &text, time_t modified) {
+	FILE *fp = fopen(name, "wb");
+	REQUIRE(fp);
+	fwrite(text.c_str(), 1, text.length(), fp);
+	fclose(fp);
+	struct utimbuf times;
+	times.actime = modified;
+	times.modtime = modified;
+	utime(name, &times);
+}
+
+static FilePath PathOf(const char *name) {
+	return FilePath(GUI::StringFromUTF8(name));
+}
+
+static std::string ReadValue(PropertiesCache &cache, const char *key, PropSetFile *superPS=0) {
+	PropSetFile props;
+	props.superPS = superPS;
+	std::vector<FilePath> imports;
+	props.ReadCached(cache, PathOf(mainName), FilePath(GUI_TEXT(".")), ImportFilter(), &imports);
+	return props.GetString(key);
+}
+
+TEST_CASE("PropertiesCache") {
+
+	const time_t modified = 1000000000;
+	WriteFile(mainName, "a=1\n", modified);
+	PropertiesCache cache(PathOf(cacheName));
+	cache.Load();
+	REQUIRE(ReadValue(cache, "a") == "1");
+
+	SECTION("UnchangedFileFromCache") {
+		// Same size and time so the cached value is used even though the text differs
+		WriteFile(mainName, "a=2\n", modified);
+		REQUIRE(ReadValue(cache, "a") == "1");
+	}
+
+	SECTION("ChangedSizeReread") {
+		WriteFile(mainName, "a=22\n", modified);
+		REQUIRE(ReadValue(cache, "a") == "22");
+	}
+
+	SECTION("ChangedTimeReread") {
+		WriteFile(mainName, "a=2\n", modified + 10);
+		REQUIRE(ReadValue(cache, "a") == "2");
+	}
+
+	SECTION("SaveLoadRoundTrip") {
+		cache.Save();
+		WriteFile(mainName, "a=2\n", modified);
+		PropertiesCache cacheLoaded(PathOf(cacheName));
+		cacheLoaded.Load();
+		REQUIRE(ReadValue(cacheLoaded, "a") == "1");
+		// A snapshot that is not used is not saved again
+		cacheLoaded.Save();
+		PropertiesCache cacheEmpty(PathOf(cacheName));
+		cacheEmpty.Load();
+		cacheEmpty.Save();
+		PropertiesCache cacheDropped(PathOf(cacheName));
+		cacheDropped.Load();
+		REQUIRE(ReadValue(cacheDropped, "a") == "2");
+	}
+
+	SECTION("TruncatedCacheDiscarded") {
+		cache.Save();
+		const long long lengthCache = PathOf(cacheName).GetFileLength();
+		REQUIRE(lengthCache > 0);
+		std::string data(static_cast<size_t>(lengthCache), '\0');
+		FILE *fp = fopen(cacheName, "rb");
+		REQUIRE(fp);
+		data.resize(fread(&data[0], 1, data.size(), fp));
+		fclose(fp);
+		WriteFile(cacheName, data.substr(0, data.size() - 3), modified);
+		WriteFile(mainName, "a=2\n", modified);
+		PropertiesCache cacheTruncated(PathOf(cacheName));
+		cacheTruncated.Load();
+		REQUIRE(ReadValue(cacheTruncated, "a") == "2");
+	}
+
+	SECTION("CorruptCacheDiscarded") {
+		WriteFile(cacheName, "SciTE properties cache 1\n\xff\xff\xff\xff\xff\xff\xff\x7f", modified);
+		WriteFile(mainName, "a=2\n", modified);
+		PropertiesCache cacheCorrupt(PathOf(cacheName));
+		cacheCorrupt.Load();
+		REQUIRE(ReadValue(cacheCorrupt, "a") == "2");
+		WriteFile(cacheName, "Not a cache", modified);
+		PropertiesCache cacheForeign(PathOf(cacheName));
+		cacheForeign.Load();
+		REQUIRE(ReadValue(cacheForeign, "a") == "2");
+	}
+
+	SECTION("AddedImportReread") {
+		WriteFile(importedName, "b=1\n", modified);
+		WriteFile(mainName, "import *\n", modified);
+		REQUIRE(ReadValue(cache, "b") == "1");
+		REQUIRE(ReadValue(cache, "c") == "");
+		WriteFile(addedName, "c=1\n", modified);
+		REQUIRE(ReadValue(cache, "c") == "1");
+		remove(addedName);
+		remove(importedName);
+	}
+
+	SECTION("ChangedConditionReread") {
+		PropSetFile base;
+		base.Set("x", "1");
+		WriteFile(mainName, "if x\n\ta=1\nb=1\n", modified);
+		REQUIRE(ReadValue(cache, "a", &base) == "1");
+		base.Set("x", "0");
+		REQUIRE(ReadValue(cache, "a", &base) == "");
+		REQUIRE(ReadValue(cache, "b", &base) == "1");
+		base.Set("x", "1");
+		REQUIRE(ReadValue(cache, "a", &base) == "1");
+	}
+
+	remove(mainName);
+	remove(cacheName);
+}
+
+// Test that GetWild and GetNewExpand give the same results when resolutions are kept
+// as when they are resolved again by a copy that has no resolutions.
+
+static const char *keybases[] = { "lexer.", "indent.size.", "command.go.", "x" };
+static const char *filenames[] = { "a.c", "b.cxx", "Makefile", "A.C", "c.h" };
+
+static void RequireSameAsUncached(PropSetFile &props) {
+	for (size_t k = 0; k < sizeof(keybases) / sizeof(keybases[0]); k++) {
+		for (size_t f = 0; f < sizeof(filenames) / sizeof(filenames[0]); f++) {
+			PropSetFile uncached(props);
+			const std::string wild = props.GetWild(keybases[k], filenames[f]);
+			const std::string wildUncached = uncached.GetWild(keybases[k], filenames[f]);
+			REQUIRE(wild == wildUncached);
+			const std::string expanded = props.GetNewExpandString(keybases[k], filenames[f]);
+			const std::string expandedUncached = uncached.GetNewExpandString(keybases[k], filenames[f]);
+			REQUIRE(expanded == expandedUncached);
+		}
+	}
+}
+
+TEST_CASE("PropSetFileResolutions") {
+
+	PropSetFile base;
+	base.Set("file.patterns.cpp", "*.c;*.cxx");
+	base.Set("lexer.$(file.patterns.cpp)", "cpp");
+	base.Set("lexer.*.h", "cpp");
+	base.Set("lexer.Makefile", "makefile");
+	base.Set("command.go.*", "run $(FileName)");
+	base.Set("FileName", "$(lexer.*.h)");
+	PropSetFile props;
+	props.superPS = &base;
+	props.Set("indent.size.*.c", "$(tab)");
+	props.Set("tab", "4");
+	props.Set("x", "$(indent.size.)");
+	RequireSameAsUncached(props);
+	REQUIRE(props.GetNewExpandString("lexer.", "b.cxx") == "cpp");
+	REQUIRE(props.GetNewExpandString("indent.size.", "a.c") == "4");
+
+	SECTION("ChangesOverflow") {
+		// Enough changes that those made after resolving are forgotten
+		props.Set("tab", "8");
+		for (int i = 0; i < 250; i++) {
+			char key[32];
+			sprintf(key, "unrelated.%d", i);
+			props.Set(key, "1");
+			if (i % 37 == 0)
+				RequireSameAsUncached(props);
+		}
+		RequireSameAsUncached(props);
+		REQUIRE(props.GetNewExpandString("indent.size.", "a.c") == "8");
+		base.Set("lexer.*.h", "c");
+		for (int i = 0; i < 250; i++) {
+			char key[32];
+			sprintf(key, "unrelated.%d", i);
+			base.Set(key, "2");
+		}
+		RequireSameAsUncached(props);
+		REQUIRE(props.GetNewExpandString("lexer.", "c.h") == "c");
+	}
+
+	SECTION("VariableKeyExpansionChanges") {
+		REQUIRE(props.GetWild("lexer.", "b.cxx") == "cpp");
+		base.Set("file.patterns.cpp", "*.c");
+		RequireSameAsUncached(props);
+		REQUIRE(props.GetWild("lexer.", "b.cxx") == "");
+		props.Set("file.patterns.cpp", "*.cxx");
+		RequireSameAsUncached(props);
+		REQUIRE(props.GetWild("lexer.", "b.cxx") == "cpp");
+		REQUIRE(props.GetWild("lexer.", "a.c") == "");
+	}
+
+	SECTION("SuperChainChanges") {
+		PropSetFile other;
+		other.Set("lexer.*.c", "other");
+		props.superPS = &other;
+		RequireSameAsUncached(props);
+		REQUIRE(props.GetWild("lexer.", "a.c") == "other");
+		other.superPS = &base;
+		RequireSameAsUncached(props);
+		props.superPS = 0;
+		RequireSameAsUncached(props);
+		REQUIRE(props.GetWild("lexer.", "a.c") == "");
+		props.superPS = &base;
+		RequireSameAsUncached(props);
+	}
+
+	SECTION("CaseSensitivityToggles") {
+		PropSetFile::SetCaseSensitiveFilenames(true);
+		RequireSameAsUncached(props);
+		REQUIRE(props.GetWild("lexer.", "A.C") == "");
+		PropSetFile::SetCaseSensitiveFilenames(false);
+		RequireSameAsUncached(props);
+		REQUIRE(props.GetWild("lexer.", "A.C") == "cpp");
+	}
+
+	SECTION("SetUnchangedValue") {
+		props.Set("tab", "4");
+		base.Set("lexer.*.h", "cpp");
+		RequireSameAsUncached(props);
+		props.Set("tab", "2");
+		RequireSameAsUncached(props);
+		REQUIRE(props.GetNewExpandString("x", "a.c") == "2");
+	}
+
+	SECTION("ClearAndAssign") {
+		PropSetFile replacement;
+		replacement.Set("lexer.*.c", "replaced");
+		props = replacement;
+		REQUIRE(props.superPS == 0);
+		RequireSameAsUncached(props);
+		REQUIRE(props.GetWild("lexer.", "a.c") == "replaced");
+		props.superPS = &base;
+		props.Clear();
+		RequireSameAsUncached(props);
+		REQUIRE(props.GetWild("lexer.", "a.c") == "cpp");
+		base.Clear();
+		RequireSameAsUncached(props);
+		REQUIRE(props.GetWild("lexer.", "a.c") == "");
+	}
+
+	SECTION("RandomChanges") {
+		const char *keys[] = { "tab", "lexer.*.c", "lexer.$(file.patterns.cpp)", "file.patterns.cpp",
+			"indent.size.*", "x", "FileName", "command.go.*.h" };
+		const char *values[] = { "1", "*.h", "*.c;*.h", "$(tab)", "$(x)", "$(FileName) go", "" };
+		const size_t nKeys = sizeof(keys) / sizeof(keys[0]);
+		const size_t nValues = sizeof(values) / sizeof(values[0]);
+		unsigned int seed = 1;
+		for (int change = 0; change < 500; change++) {
+			seed = seed * 1103515245 + 12345;
+			PropSetFile &changed = ((seed >> 20) & 1) ? props : base;
+			const char *key = keys[(seed >> 8) % nKeys];
+			if ((seed >> 4) % 8 == 0) {
+				changed.Unset(key);
+			} else {
+				changed.Set(key, values[(seed >> 12) % nValues]);
+			}
+			if (change % 5 == 0)
+				RequireSameAsUncached(props);
+		}
+		RequireSameAsUncached(props);
+	}
+}
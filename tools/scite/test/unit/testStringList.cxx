@@ -0,0 +1,189 @@
+// Unit Tests for SciTE classes
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "SString.h"
+#include "StringList.h"
+
+#include "catch.hpp"
+
+// Test StringList prefix queries.
+
+static std::string NearestWord(StringList &sl, const char *wordStart, bool ignoreCase, const char *wordCharacters="", int wordIndex=-1) {
+	const char *word = sl.GetNearestWord(wordStart, strlen(wordStart), ignoreCase, wordCharacters, wordIndex);
+	return word ? word : "<none>";
+}
+
+static std::string NearestWords(StringList &sl, const char *wordStart, bool ignoreCase, char otherSeparator='\0', bool exactLen=false) {
+	char *words = sl.GetNearestWords(wordStart, strlen(wordStart), ignoreCase, otherSeparator, exactLen);
+	const std::string result = words ? words : "<none>";
+	delete []words;
+	return result;
+}
+
+static bool UpperLess(const std::string &a, const std::string &b) {
+	return CompareNoCase(a.c_str(), b.c_str()) < 0;
+}
+
+static std::vector<std::string> Split(const std::string &s) {
+	std::vector<std::string> parts;
+	size_t start = 0;
+	while (start < s.length()) {
+		size_t end = s.find(' ', start);
+		if (end == std::string::npos)
+			end = s.length();
+		parts.push_back(s.substr(start, end - start));
+		start = end + 1;
+	}
+	return parts;
+}
+
+TEST_CASE("StringList") {
+
+	SECTION("MatchCase") {
+		StringList sl;
+		sl.Set("apply apple Apple banana apple Application app");
+		REQUIRE(NearestWord(sl, "app", false) == "app");
+		REQUIRE(NearestWord(sl, "appl", false) == "apple");
+		REQUIRE(NearestWord(sl, "App", false) == "Apple");
+		REQUIRE(NearestWord(sl, "Appli", false) == "Application");
+		REQUIRE(NearestWords(sl, "app", false) == "app apple apple apply");
+		REQUIRE(NearestWords(sl, "App", false) == "Apple Application");
+		REQUIRE(NearestWords(sl, "b", false) == "banana");
+	}
+
+	SECTION("IgnoreCase") {
+		StringList sl;
+		sl.Set("apply apple Apple banana apple Application app");
+		REQUIRE(NearestWord(sl, "APPLI", true) == "Application");
+		REQUIRE(NearestWord(sl, "Banana", true) == "banana");
+		std::vector<std::string> found = Split(NearestWords(sl, "APPL", true));
+		std::sort(found.begin(), found.end());
+		REQUIRE(found.size() == 5);
+		REQUIRE(found[0] == "Apple");
+		REQUIRE(found[1] == "Application");
+		REQUIRE(found[2] == "apple");
+		REQUIRE(found[3] == "apple");
+		REQUIRE(found[4] == "apply");
+	}
+
+	SECTION("Duplicates") {
+		StringList sl;
+		sl.Set("same same same other");
+		REQUIRE(NearestWords(sl, "sa", false) == "same same same");
+		REQUIRE(NearestWord(sl, "sa", false, "", 2) == "same");
+		REQUIRE(NearestWord(sl, "sa", false, "", 3) == "<none>");
+		REQUIRE(NearestWord(sl, "SA", true, "", 2) == "same");
+		REQUIRE(NearestWord(sl, "SA", true, "", 3) == "<none>");
+	}
+
+	SECTION("NoMatch") {
+		StringList sl;
+		sl.Set("bb cc dd");
+		for (int ignoreCase = 0; ignoreCase < 2; ignoreCase++) {
+			// Before the first, between words and after the last
+			REQUIRE(NearestWord(sl, "a", ignoreCase != 0) == "<none>");
+			REQUIRE(NearestWord(sl, "bc", ignoreCase != 0) == "<none>");
+			REQUIRE(NearestWord(sl, "e", ignoreCase != 0) == "<none>");
+			REQUIRE(NearestWords(sl, "a", ignoreCase != 0) == "<none>");
+			REQUIRE(NearestWords(sl, "bc", ignoreCase != 0) == "<none>");
+			REQUIRE(NearestWords(sl, "e", ignoreCase != 0) == "<none>");
+			REQUIRE(NearestWord(sl, "bbb", ignoreCase != 0) == "<none>");
+		}
+		StringList empty;
+		REQUIRE(NearestWord(empty, "a", false) == "<none>");
+		REQUIRE(NearestWords(empty, "a", true) == "<none>");
+	}
+
+	SECTION("WordCharacters") {
+		// A word continuing with a word character is only a part of a longer identifier
+		StringList sl(true);
+		sl.Set("func(a)\nfunction(b)\nfunc_2(c)\n");
+		REQUIRE(NearestWord(sl, "func", false, "abcdefghijklmnopqrstuvwxyz_0123456789") == "func(a)");
+		REQUIRE(NearestWord(sl, "func", false, "abcdefghijklmnopqrstuvwxyz_0123456789", 1) == "<none>");
+		REQUIRE(NearestWord(sl, "func", false, "", 1) == "func_2(c)");
+	}
+
+	SECTION("ExactLength") {
+		StringList sl(true);
+		sl.Set("func(a)\nFunc(b)\nfunction(c)\nfunc (d)\nfun(e)\n");
+		// Spaces before the '(' are not part of the word
+		REQUIRE(NearestWords(sl, "func", false) == "func func function");
+		REQUIRE(NearestWords(sl, "func", false, '\0', true) == "func func");
+		std::vector<std::string> found = Split(NearestWords(sl, "FUNC", true, '\0', true));
+		std::sort(found.begin(), found.end());
+		REQUIRE(found.size() == 3);
+		REQUIRE(found[0] == "Func");
+		REQUIRE(found[2] == "func");
+		REQUIRE(NearestWords(sl, "funct", false, '\0', true) == "<none>");
+		REQUIRE(NearestWords(sl, "function", false, '\0', true) == "function");
+		REQUIRE(NearestWords(sl, "fun", false, '\0', true) == "fun");
+		sl.Set("fn.member\nfn.m\n");
+		REQUIRE(NearestWords(sl, "fn.m", false, '.', true) == "fn fn");
+	}
+
+	SECTION("SameAsLinearSearch") {
+		const char *pieces[] = { "a", "A", "b", "_", "ab", "Ab", "aB", "z" };
+		const size_t nPieces = sizeof(pieces) / sizeof(pieces[0]);
+		unsigned int seed = 1;
+		for (int list = 0; list < 50; list++) {
+			std::vector<std::string> words;
+			std::string text;
+			const int nWords = list % 20 + 1;
+			for (int w = 0; w < nWords; w++) {
+				std::string word;
+				do {
+					seed = seed * 1103515245 + 12345;
+					word += pieces[(seed >> 8) % nPieces];
+				} while ((seed >> 16) % 3);
+				words.push_back(word);
+				text += word + " ";
+			}
+			StringList sl;
+			sl.Set(text.c_str());
+			for (int query = 0; query < 20; query++) {
+				seed = seed * 1103515245 + 12345;
+				std::string prefix = pieces[(seed >> 8) % nPieces];
+				if ((seed >> 16) % 2)
+					prefix += pieces[(seed >> 20) % nPieces];
+				for (int ignoreCase = 0; ignoreCase < 2; ignoreCase++) {
+					std::vector<std::string> expected;
+					for (size_t w = 0; w < words.size(); w++) {
+						const int compared = ignoreCase ?
+							CompareNoCase(words[w].substr(0, prefix.length()).c_str(), prefix.c_str()) :
+							words[w].compare(0, prefix.length(), prefix);
+						if (compared == 0)
+							expected.push_back(words[w]);
+					}
+					std::vector<std::string> found;
+					if (!expected.empty())
+						found = Split(NearestWords(sl, prefix.c_str(), ignoreCase != 0));
+					REQUIRE(found.size() == expected.size());
+					if (!expected.empty()) {
+						std::sort(expected.begin(), expected.end());
+						std::sort(found.begin(), found.end());
+						REQUIRE(found == expected);
+						// The first of the words in the order of the mode
+						std::vector<std::string> ordered = expected;
+						if (ignoreCase)
+							std::stable_sort(ordered.begin(), ordered.end(), UpperLess);
+						const std::string nearest = NearestWord(sl, prefix.c_str(), ignoreCase != 0);
+						if (ignoreCase) {
+							REQUIRE(CompareNoCase(nearest.c_str(), ordered[0].c_str()) == 0);
+						} else {
+							REQUIRE(nearest == ordered[0]);
+						}
+					} else {
+						REQUIRE(NearestWords(sl, prefix.c_str(), ignoreCase != 0) == "<none>");
+						REQUIRE(NearestWord(sl, prefix.c_str(), ignoreCase != 0) == "<none>");
+					}
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,130 @@
+// Unit Tests for SciTE classes
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "Scintilla.h"
+#include "GUI.h"
+#include "StyleWriter.h"
+
+#include "FakeDocument.h"
+
+#include "catch.hpp"
+
+const int blockSize = 0x10000;
+
+// Test StyledTextReader.
+
+TEST_CASE("StyledTextReader") {
+
+	// Three blocks and a bit of x in style 1 with short runs of y in style 2 straddling
+	// the first two block edges and a tab just after the third
+	std::string text(blockSize * 3 + 100, 'x');
+	text.replace(blockSize - 2, 4, "yyyy");
+	text.replace(blockSize * 2 - 1, 2, "yy");
+	text[blockSize * 3 + 1] = '\t';
+	FakeDocument doc(text);
+	doc.SetStyle(0, static_cast<int>(text.length()), 1);
+	doc.SetStyle(blockSize - 2, 4, 2);
+	doc.SetStyle(blockSize * 2 - 1, 2, 2);
+	GUI::ScintillaWindow sw;
+	sw.SetID(&doc);
+	StyledTextReader acc;
+
+	SECTION("FillsInBlocks") {
+		acc.Fill(sw);
+		REQUIRE(acc.Length() == static_cast<int>(text.length()));
+		REQUIRE(doc.largestRange == blockSize);
+		for (int i = 0; i < acc.Length(); i++) {
+			REQUIRE(acc[i] == text[i]);
+			REQUIRE(acc.StyleAt(i) == doc.styles[i]);
+		}
+	}
+
+	SECTION("RunsCrossBlockEdges") {
+		acc.Fill(sw);
+		const int length = acc.Length();
+		// The run of x before the first edge starts at 0 and ends at the y
+		REQUIRE(acc.RunEnd(0, length, "\t") == blockSize - 2);
+		// Runs that straddle an edge are returned whole
+		REQUIRE(acc.RunEnd(blockSize - 2, length, "\t") == blockSize + 2);
+		REQUIRE(acc.RunEnd(blockSize - 1, length, "\t") == blockSize + 2);
+		REQUIRE(acc.RunEnd(blockSize * 2 - 1, length, "\t") == blockSize * 2 + 1);
+		// A run of x covering the whole block between the edges
+		REQUIRE(acc.RunEnd(blockSize + 2, length, "\t") == blockSize * 2 - 1);
+		// The run crossing the third edge stops at the special character
+		REQUIRE(acc.RunEnd(blockSize * 2 + 1, length, "\t") == blockSize * 3 + 1);
+		// Runs do not go past the end given
+		REQUIRE(acc.RunEnd(blockSize + 2, blockSize + 10, "\t") == blockSize + 10);
+		REQUIRE(acc.RunEnd(length - 1, length, "\t") == length);
+	}
+
+	SECTION("RangePointerMatchesDocument") {
+		acc.Fill(sw);
+		const int length = acc.Length();
+		for (int i = 0; i < length;) {
+			const int runEnd = acc.RunEnd(i, length, "\t");
+			std::string run(acc.RangePointer(i), runEnd - i);
+			REQUIRE(run == text.substr(i, runEnd - i));
+			i = runEnd;
+		}
+	}
+
+	SECTION("Range") {
+		// As used when copying a selection as RTF
+		const int start = blockSize - 10;
+		const int end = blockSize * 2 + 10;
+		acc.Fill(sw, start, end);
+		REQUIRE(acc[start] == 'x');
+		REQUIRE(acc[blockSize] == 'y');
+		REQUIRE(acc.StyleAt(blockSize) == 2);
+		// Outside the range copied
+		REQUIRE(acc[start - 1] == 0);
+		REQUIRE(acc[end] == 0);
+		REQUIRE(acc.StyleAt(end) == 0);
+		REQUIRE(acc[-1] == 0);
+		// Runs stop at the end of the range copied
+		REQUIRE(acc.RunEnd(blockSize * 2 + 1, acc.Length(), "\t") == end);
+		std::string run(acc.RangePointer(start), blockSize - 2 - start);
+		REQUIRE(run == text.substr(start, blockSize - 2 - start));
+	}
+
+	SECTION("CopyUnchangedByEdits") {
+		acc.Fill(sw);
+		doc.text[5] = 'z';
+		doc.styles[5] = 3;
+		REQUIRE(acc[5] == 'x');
+		REQUIRE(acc.StyleAt(5) == 1);
+	}
+}
+
+TEST_CASE("StyledTextReaderLines") {
+
+	FakeDocument doc("a\nbb\n\nccc");
+	doc.levels[1] = (SC_FOLDLEVELBASE + 1) | SC_FOLDLEVELHEADERFLAG;
+	GUI::ScintillaWindow sw;
+	sw.SetID(&doc);
+	StyledTextReader acc;
+
+	SECTION("WithoutLines") {
+		acc.Fill(sw);
+		REQUIRE(acc.GetLine(7) == 0);
+		REQUIRE(acc.LevelAt(1) == SC_FOLDLEVELBASE);
+	}
+
+	SECTION("WithLines") {
+		acc.Fill(sw, 0, -1, true);
+		REQUIRE(acc.GetLine(0) == 0);
+		REQUIRE(acc.GetLine(1) == 0);
+		REQUIRE(acc.GetLine(2) == 1);
+		REQUIRE(acc.GetLine(5) == 2);
+		REQUIRE(acc.GetLine(6) == 3);
+		REQUIRE(acc.GetLine(9) == 3);
+		REQUIRE(acc.LevelAt(0) == SC_FOLDLEVELBASE);
+		REQUIRE(acc.LevelAt(1) == ((SC_FOLDLEVELBASE + 1) | SC_FOLDLEVELHEADERFLAG));
+		REQUIRE(acc.LevelAt(4) == SC_FOLDLEVELBASE);
+	}
+}
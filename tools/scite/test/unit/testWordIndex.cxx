@@ -0,0 +1,190 @@
+// Unit Tests for SciTE classes
+
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+
+#include "Scintilla.h"
+#include "GUI.h"
+#include "WordIndex.h"
+
+#include "FakeDocument.h"
+
+#include "catch.hpp"
+
+// Test WordIndex.
+
+static const std::string wordCharacters = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789";
+
+// Edit the document as Scintilla does, notifying the index before and after.
+static void Insert(FakeDocument &doc, GUI::ScintillaWindow &sw, WordIndex &wi, int position, const std::string &s) {
+	const int length = static_cast<int>(s.length());
+	wi.Modified(&sw, SC_MOD_BEFOREINSERT, position, length, 0);
+	const int linesBefore = doc.Lines();
+	doc.Insert(position, s);
+	wi.Modified(&sw, SC_MOD_INSERTTEXT, position, length, doc.Lines() - linesBefore);
+}
+
+static void Delete(FakeDocument &doc, GUI::ScintillaWindow &sw, WordIndex &wi, int position, int length) {
+	wi.Modified(&sw, SC_MOD_BEFOREDELETE, position, length, 0);
+	const int linesBefore = doc.Lines();
+	doc.Delete(position, length);
+	wi.Modified(&sw, SC_MOD_DELETETEXT, position, length, doc.Lines() - linesBefore);
+}
+
+static void IndexAll(GUI::ScintillaWindow &sw, WordIndex &wi) {
+	while (!wi.Complete())
+		wi.Continue(&sw);
+}
+
+// The words in the index and whether each occurs more than once.
+static std::map<std::string, bool> Words(const WordIndex &wi) {
+	std::vector<std::string> found;
+	wi.WordsStarting("", false, "", found);
+	std::map<std::string, bool> words;
+	for (size_t i = 0; i < found.size(); i++) {
+		std::vector<std::string> others;
+		wi.WordsStarting(found[i], false, found[i], others);
+		// Excluding one occurrence still finds the word when it occurs again
+		words[found[i]] = std::find(others.begin(), others.end(), found[i]) != others.end();
+	}
+	return words;
+}
+
+// Complete the index then compare it with an index built from the current text.
+static void RequireSameAsRebuilt(GUI::ScintillaWindow &sw, WordIndex &wi) {
+	REQUIRE(wi.Valid(&sw, wordCharacters));
+	IndexAll(sw, wi);
+	WordIndex rebuilt;
+	rebuilt.Start(&sw, wordCharacters);
+	IndexAll(sw, rebuilt);
+	REQUIRE(Words(wi) == Words(rebuilt));
+}
+
+static std::vector<std::string> Found(const WordIndex &wi, const std::string &root, bool ignoreCase, const std::string &wordExcluded="") {
+	std::vector<std::string> found;
+	wi.WordsStarting(root, ignoreCase, wordExcluded, found);
+	std::sort(found.begin(), found.end());
+	return found;
+}
+
+// Mostly words that occur once so that any word counted twice or lost is noticed.
+static std::string Piece(unsigned int random, int &serial) {
+	const char *separators[] = { " ", "\r", "\n", "\r\n", "\n\n" };
+	if (random % 2) {
+		char word[20];
+		sprintf(word, "w%d", serial++);
+		return word;
+	}
+	return separators[(random / 2) % (sizeof(separators) / sizeof(separators[0]))];
+}
+
+TEST_CASE("WordIndex") {
+
+	SECTION("WordsStarting") {
+		FakeDocument doc("alpha Alpha alphabet al\r\nbeta alpha_2 ALPHABET\n");
+		GUI::ScintillaWindow sw;
+		sw.SetID(&doc);
+		WordIndex wi;
+		wi.Start(&sw, wordCharacters);
+		REQUIRE(!wi.Complete());
+		IndexAll(sw, wi);
+		std::vector<std::string> found = Found(wi, "alpha", false);
+		REQUIRE(found.size() == 2);
+		REQUIRE(found[0] == "alpha_2");
+		REQUIRE(found[1] == "alphabet");
+		found = Found(wi, "alpha", true);
+		REQUIRE(found.size() == 3);
+		REQUIRE(found[0] == "ALPHABET");
+		// The only occurrence of the word being completed is not offered
+		found = Found(wi, "al", false, "alphabet");
+		REQUIRE(found.size() == 2);
+		REQUIRE(found[0] == "alpha");
+		REQUIRE(found[1] == "alpha_2");
+		REQUIRE(Found(wi, "gamma", true).empty());
+	}
+
+	SECTION("EditsInIndexedLines") {
+		FakeDocument doc("one two\nthree\r\nfour");
+		GUI::ScintillaWindow sw;
+		sw.SetID(&doc);
+		WordIndex wi;
+		wi.Start(&sw, wordCharacters);
+		IndexAll(sw, wi);
+		Insert(doc, sw, wi, 3, "\r\nfive");
+		RequireSameAsRebuilt(sw, wi);
+		Delete(doc, sw, wi, 0, 10);
+		RequireSameAsRebuilt(sw, wi);
+		REQUIRE(Found(wi, "t", false).size() == 2);
+		REQUIRE(Found(wi, "o", false).empty());
+	}
+
+	SECTION("LineEndsJoinAndSplit") {
+		// Inserting or deleting next to a line end may join "\r" and "\n" into one line end or split them
+		FakeDocument doc("aa\rbb\r\ncc\ndd");
+		GUI::ScintillaWindow sw;
+		sw.SetID(&doc);
+		WordIndex wi;
+		wi.Start(&sw, wordCharacters);
+		IndexAll(sw, wi);
+		Insert(doc, sw, wi, 3, "\n");	// "aa\r\nbb"
+		RequireSameAsRebuilt(sw, wi);
+		Insert(doc, sw, wi, 8, "ee");	// "bb\ree\ncc"
+		RequireSameAsRebuilt(sw, wi);
+		Delete(doc, sw, wi, 8, 2);	// "bb\r\ncc"
+		RequireSameAsRebuilt(sw, wi);
+		Delete(doc, sw, wi, 8, 1);	// "bb\rcc"
+		RequireSameAsRebuilt(sw, wi);
+		Insert(doc, sw, wi, 0, "ff\r");
+		RequireSameAsRebuilt(sw, wi);
+		Delete(doc, sw, wi, 2, 1);	// "ffaa"
+		RequireSameAsRebuilt(sw, wi);
+		REQUIRE(Found(wi, "f", false).size() == 1);
+	}
+
+	SECTION("RandomEdits") {
+		// Longer than one segment of Continue so that edits are made before, after and
+		// across the lines indexed so far
+		unsigned int seed = 1;
+		int serial = 0;
+		std::string text;
+		while (text.length() < 30000) {
+			seed = seed * 1103515245 + 12345;
+			text += Piece(seed >> 8, serial);
+		}
+		FakeDocument doc(text);
+		GUI::ScintillaWindow sw;
+		sw.SetID(&doc);
+		for (int round = 0; round < 20; round++) {
+			WordIndex wi;
+			wi.Start(&sw, wordCharacters);
+			wi.Continue(&sw);
+			for (int edit = 0; edit < 20; edit++) {
+				seed = seed * 1103515245 + 12345;
+				// Half the edits are close to the end of the first segment
+				int position = static_cast<int>((seed >> 4) % (doc.Length() + 1));
+				if ((seed >> 20) % 2) {
+					position = doc.LineStart(2000) + static_cast<int>((seed >> 12) % 40) - 20;
+					position = std::max(0, std::min(position, doc.Length()));
+				}
+				if ((seed >> 24) % 2) {
+					std::string s;
+					for (unsigned int i = 0; i <= (seed >> 26) % 4; i++)
+						s += Piece(seed >> (i * 3), serial);
+					Insert(doc, sw, wi, position, s);
+				} else {
+					const int length = std::min(static_cast<int>((seed >> 16) % 30), doc.Length() - position);
+					Delete(doc, sw, wi, position, length);
+				}
+				REQUIRE(wi.Valid(&sw, wordCharacters));
+				if (edit % 7 == 6)
+					wi.Continue(&sw);
+			}
+			RequireSameAsRebuilt(sw, wi);
+		}
+	}
+}
@@ -0,0 +1,71 @@
+// Unit Tests for SciTE classes
+
+/*
+    Currently tested:
+        APIRepository
+        PropertiesCache
+        PropSetFile resolutions
+        StringList
+        StyledTextReader
+        WordIndex
+*/
+
+#include <string.h>
+
+#include <string>
+#include <vector>
+#include <algorithm>
+
+#include "Scintilla.h"
+#include "GUI.h"
+#include "Mutex.h"
+
+#include "FakeDocument.h"
+
+#define CATCH_CONFIG_MAIN  // This tells Catch to provide a main() - only do this in one cpp file
+#include "catch.hpp"
+
+// Calls made through a ScintillaWindow go to the FakeDocument that is its ID
+
+sptr_t GUI::ScintillaWindow::Send(unsigned int msg, uptr_t, sptr_t) {
+	if (msg == SCI_GETDIRECTFUNCTION)
+		return reinterpret_cast<sptr_t>(FakeDocument::DirectFunction);
+	if (msg == SCI_GETDIRECTPOINTER)
+		return reinterpret_cast<sptr_t>(GetID());
+	return 0;
+}
+
+// Needed for TextReader and StyleWriter in StyleWriter.cxx
+
+bool GUI::IsDBCSLeadByte(int, char) {
+	return false;
+}
+
+sptr_t GUI::ScintillaWindow::SendPointer(unsigned int, uptr_t, void *) {
+	return 0;
+}
+
+// Needed for FilePath and PropSetFile. Only converts ASCII which is enough for the names used by the tests.
+
+GUI::gui_string GUI::StringFromUTF8(const char *s) {
+	return GUI::gui_string(s, s + strlen(s));
+}
+
+std::string GUI::UTF8FromString(const GUI::gui_string &s) {
+	std::string sUTF8;
+	for (size_t i = 0; i < s.length(); i++)
+		sUTF8 += static_cast<char>(s[i]);
+	return sUTF8;
+}
+
+// Needed for Worker. The tests run loaders on the main thread so no locking is required.
+
+class NullMutex : public Mutex {
+public:
+	virtual void Lock() {}
+	virtual void Unlock() {}
+};
+
+Mutex *Mutex::Create() {
+	return new NullMutex();
+}
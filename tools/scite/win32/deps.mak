@@ -48,6 +48,11 @@ UniqueInstance.o: UniqueInstance.cxx ../../scintilla/include/Scintilla.h \
  ../src/MatchMarker.h ../src/SciTEBase.h ../src/SciTEKeys.h \
  UniqueInstance.h ../src/StripDefinition.h Strips.h
 WinMutex.o: WinMutex.cxx ../src/Mutex.h
+APIRepository.o: ../src/APIRepository.cxx \
+ ../../scintilla/include/Scintilla.h ../../scintilla/include/ILexer.h \
+ ../src/GUI.h ../src/SString.h ../src/StringList.h ../src/StringHelpers.h \
+ ../src/FilePath.h ../src/Mutex.h ../src/Cookie.h ../src/Worker.h \
+ ../src/FileWorker.h ../src/APIRepository.h
 Cookie.o: ../src/Cookie.cxx ../src/SString.h ../src/Cookie.h
 Credits.o: ../src/Credits.cxx ../../scintilla/include/Scintilla.h \
  ../../scintilla/include/ILexer.h ../src/GUI.h ../src/SString.h \
@@ -90,15 +95,15 @@ SciTEBase.o: ../src/SciTEBase.cxx ../../scintilla/include/Scintilla.h \
  ../src/GUI.h ../src/SString.h ../src/StringList.h ../src/StringHelpers.h \
  ../src/FilePath.h ../src/StyleDefinition.h ../src/PropSetFile.h \
  ../src/StyleWriter.h ../src/Extender.h ../src/SciTE.h ../src/Mutex.h \
- ../src/JobQueue.h ../src/Cookie.h ../src/Worker.h ../src/FileWorker.h \
- ../src/MatchMarker.h ../src/SciTEBase.h
+ ../src/JobQueue.h ../src/Cookie.h ../src/Worker.h ../src/FileWorker.h ../src/APIRepository.h \
+ ../src/MatchMarker.h ../src/WordIndex.h ../src/SciTEBase.h
 SciTEBuffers.o: ../src/SciTEBuffers.cxx \
  ../../scintilla/include/Scintilla.h ../../scintilla/include/SciLexer.h \
  ../../scintilla/include/ILexer.h ../src/GUI.h ../src/SString.h \
  ../src/StringList.h ../src/StringHelpers.h ../src/FilePath.h \
  ../src/StyleDefinition.h ../src/PropSetFile.h ../src/StyleWriter.h \
  ../src/Extender.h ../src/SciTE.h ../src/Mutex.h ../src/JobQueue.h \
- ../src/Cookie.h ../src/Worker.h ../src/FileWorker.h ../src/MatchMarker.h \
+ ../src/Cookie.h ../src/Worker.h ../src/FileWorker.h ../src/MatchMarker.h ../src/WordIndex.h \
  ../src/SciTEBase.h
 SciTEIO.o: ../src/SciTEIO.cxx ../../scintilla/include/Scintilla.h \
  ../../scintilla/include/ILexer.h ../src/GUI.h ../src/SString.h \
@@ -113,7 +118,7 @@ SciTEProps.o: ../src/SciTEProps.cxx ../../scintilla/include/Scintilla.h \
  ../src/FilePath.h ../src/StyleDefinition.h ../src/PropSetFile.h \
  ../src/StyleWriter.h ../src/Extender.h ../src/SciTE.h \
  ../src/IFaceTable.h ../src/Mutex.h ../src/JobQueue.h ../src/Cookie.h \
- ../src/Worker.h ../src/MatchMarker.h ../src/SciTEBase.h
+ ../src/Worker.h ../src/APIRepository.h ../src/MatchMarker.h ../src/SciTEBase.h
 StringHelpers.o: ../src/StringHelpers.cxx \
  ../../scintilla/include/Scintilla.h ../src/GUI.h ../src/StringHelpers.h
 StringList.o: ../src/StringList.cxx ../src/SString.h ../src/StringList.h
@@ -123,6 +128,8 @@ StyleDefinition.o: ../src/StyleDefinition.cxx \
 StyleWriter.o: ../src/StyleWriter.cxx ../../scintilla/include/Scintilla.h \
  ../src/GUI.h ../src/StyleWriter.h
 Utf8_16.o: ../src/Utf8_16.cxx ../src/Utf8_16.h
+WordIndex.o: ../src/WordIndex.cxx ../../scintilla/include/Scintilla.h \
+ ../src/GUI.h ../src/WordIndex.h
 lapi.o: ../lua/src/lapi.c ../lua/include/lua.h ../lua/include/luaconf.h \
  ../src/scite_lua_win.h ../lua/src/lapi.h ../lua/src/lobject.h \
  ../lua/src/llimits.h ../lua/src/ldebug.h ../lua/src/lstate.h \
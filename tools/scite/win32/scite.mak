@@ -58,6 +58,7 @@ CCFLAGS=$(CCFLAGS) $(CXXNDEBUG)
 INCLUDEDIRS=-I../../scintilla/include -I../../scintilla/win32 -I../src
 
 SHAREDOBJS=\
+	APIRepository.obj \
 	Cookie.obj \
 	Credits.obj \
 	DirectorExtension.obj \
@@ -83,7 +84,8 @@ SHAREDOBJS=\
 	StyleWriter.obj \
 	UniqueInstance.obj \
 	Utf8_16.obj \
-	WinMutex.obj
+	WinMutex.obj \
+	WordIndex.obj
 
 OBJS=\
 	$(SHAREDOBJS) \
@@ -96,6 +98,7 @@ OBJSSTATIC=\
 	Sc1.obj \
 	..\..\scintilla\win32\Accessor.obj \
 	..\..\scintilla\win32\AutoComplete.obj \
+	..\..\scintilla\win32\BackgroundWrap.obj \
 	..\..\scintilla\win32\CallTip.obj \
 	..\..\scintilla\win32\CaseConvert.obj \
 	..\..\scintilla\win32\CaseFolder.obj \
@@ -106,6 +109,7 @@ OBJSSTATIC=\
 	..\..\scintilla\win32\CharClassify.obj \
 	..\..\scintilla\win32\ContractionState.obj \
 	..\..\scintilla\win32\Decoration.obj \
+	..\..\scintilla\win32\DFASearch.obj \
 	..\..\scintilla\win32\Document.obj \
 	..\..\scintilla\win32\EditModel.obj \
 	..\..\scintilla\win32\Editor.obj \
@@ -126,6 +130,7 @@ OBJSSTATIC=\
 	..\..\scintilla\win32\RunStyles.obj \
 	..\..\scintilla\win32\ScintillaBaseL.obj \
 	..\..\scintilla\win32\ScintillaWinL.obj \
+	..\..\scintilla\win32\SegmentCache.obj \
 	..\..\scintilla\win32\Selection.obj \
 	..\..\scintilla\win32\Style.obj \
 	..\..\scintilla\win32\StyleContext.obj \
@@ -195,11 +200,16 @@ CXXFLAGS=$(CXXFLAGS) -DNO_LUA
 !ENDIF
 
 !IFNDEF NO_MRUBY
-MRUBY_OBJS = mrubyExtension.obj
+MRUBY_OBJS = mrubyExtension.obj TableLexer.obj
+# Scintilla objects called by mrubyExtension and TableLexer that Sc1 already links
+MRUBY_SCINTILLA_OBJS = \
+	..\..\scintilla\win32\CharClassify.obj \
+	..\..\scintilla\win32\RESearch.obj \
+	..\..\scintilla\win32\WordList.obj
 
-OBJS = $(OBJS) $(MRUBY_OBJS)
+OBJS = $(OBJS) $(MRUBY_OBJS) $(MRUBY_SCINTILLA_OBJS)
 OBJSSTATIC = $(OBJSSTATIC) $(MRUBY_OBJS)
-INCLUDEDIRS = $(INCLUDEDIRS) -I../../../../../../include
+INCLUDEDIRS = $(INCLUDEDIRS) -I../../../../../../include -I../../scintilla/lexlib -I../../scintilla/src
 !ELSE
 CXXFLAGS=$(CXXFLAGS) -DNO_MRUBY
 !ENDIF
@@ -460,6 +470,20 @@ UniqueInstance.obj: \
 WinMutex.obj: \
 	WinMutex.cxx \
 	../src/Mutex.h
+APIRepository.obj: \
+	../src/APIRepository.cxx \
+	../../scintilla/include/Scintilla.h \
+	../../scintilla/include/ILexer.h \
+	../src/GUI.h \
+	../src/SString.h \
+	../src/StringList.h \
+	../src/StringHelpers.h \
+	../src/FilePath.h \
+	../src/Mutex.h \
+	../src/Cookie.h \
+	../src/Worker.h \
+	../src/FileWorker.h \
+	../src/APIRepository.h
 Cookie.obj: \
 	../src/Cookie.cxx \
 	../src/SString.h \
@@ -572,7 +596,9 @@ SciTEBase.obj: \
 	../src/Cookie.h \
 	../src/Worker.h \
 	../src/FileWorker.h \
+	../src/APIRepository.h \
 	../src/MatchMarker.h \
+	../src/WordIndex.h \
 	../src/SciTEBase.h
 SciTEBuffers.obj: \
 	../src/SciTEBuffers.cxx \
@@ -595,6 +621,7 @@ SciTEBuffers.obj: \
 	../src/Worker.h \
 	../src/FileWorker.h \
 	../src/MatchMarker.h \
+	../src/WordIndex.h \
 	../src/SciTEBase.h
 SciTEIO.obj: \
 	../src/SciTEIO.cxx \
@@ -638,6 +665,7 @@ SciTEProps.obj: \
 	../src/JobQueue.h \
 	../src/Cookie.h \
 	../src/Worker.h \
+	../src/APIRepository.h \
 	../src/MatchMarker.h \
 	../src/SciTEBase.h
 StringHelpers.obj: \
@@ -664,6 +692,11 @@ StyleWriter.obj: \
 Utf8_16.obj: \
 	../src/Utf8_16.cxx \
 	../src/Utf8_16.h
+WordIndex.obj: \
+	../src/WordIndex.cxx \
+	../../scintilla/include/Scintilla.h \
+	../src/GUI.h \
+	../src/WordIndex.h
 
 !IFNDEF NO_LUA
 LuaExtension.obj: \
@@ -696,9 +729,17 @@ mrubyExtension.obj: \
 	../src/StyleWriter.h \
 	../src/Extender.h \
 	../src/mrubyExtension.h \
+	../src/TableLexer.h \
 	../src/IFaceTable.h \
 	../src/SciTEKeys.h
 
+TableLexer.obj: \
+	../src/TableLexer.cxx \
+	../../scintilla/include/Scintilla.h \
+	../src/GUI.h \
+	../src/StyleWriter.h \
+	../src/TableLexer.h
+
 !IFDEF NO_LUA
 IFaceTable.obj: \
 	../src/IFaceTable.cxx \